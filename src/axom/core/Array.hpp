@@ -15,6 +15,8 @@
 // C/C++ includes
 #include <cstring>   // for std::memcpy
 #include <iostream>  // for std::cerr
+#include <new>       // for placement new
+#include <utility>   // for std::move, std::forward
 
 namespace axom
 {
@@ -66,11 +68,18 @@ constexpr IndexType ZERO = 0;
  *    \note The Array destructor does not deallocate a user-supplied buffer,
  *     since it does not manage that memory.
  *
+ *  An Array with native storage allocates its buffer with the allocator whose
+ *  ID is given to its constructor, the default allocator otherwise, and keeps
+ *  using that allocator when it grows. Arrays cannot be copied, but they can
+ *  be moved, e.g., returned by value from a function. A moved-from Array is
+ *  empty, with no buffer, and can be reused.
+ *
  * \warning Reallocations tend to be costly operations in terms of performance.
  *  Use `reserve()` when the number of nodes is known a priori, or opt to
  *  use a constructor that takes an actual size and capacity when possible.
  *
- * \tparam T the type of the values to hold.
+ * \tparam T the type of the values to hold. Since the values are relocated
+ *  with memcpy, T must be trivially copyable.
  *
  */
 template <typename T>
@@ -91,6 +100,8 @@ public:
    * \param [in] num_components the number of values per tuple. If not
    *  specified defaults to 1.
    * \param [in] capacity the number of tuples to allocate space for.
+   * \param [in] allocator_id the ID of the allocator of the buffer. If not
+   *  specified defaults to the default allocator.
    *
    * \note If no capacity or capacity less than num_tuples is specified
    *  then it will default to at least num_tuples * DEFAULT_RESIZE_RATIO.
@@ -104,8 +115,12 @@ public:
    * \post size() == num_tuples
    * \post numComponents() == num_components
    * \post getResizeRatio() == DEFAULT_RESIZE_RATIO
+   * \post getAllocatorID() == allocator_id
    */
-  Array(IndexType num_tuples, IndexType num_components = 1, IndexType capacity = 0);
+  Array(IndexType num_tuples,
+        IndexType num_components = 1,
+        IndexType capacity = 0,
+        int allocator_id = getDefaultAllocatorID());
 
   /// @}
 
@@ -144,6 +159,21 @@ public:
 
   /// @}
 
+  /*!
+   * \brief Move constructor. Takes over the buffer of other, which is left
+   *  empty.
+   *
+   * \note Arrays whose storage is managed by a subclass, e.g., sidre::Array,
+   *  cannot be moved.
+   */
+  Array(Array&& other) noexcept;
+
+  /*!
+   * \brief Move assignment. Frees the buffer of this Array and takes over the
+   *  buffer of other, which is left empty.
+   */
+  Array& operator=(Array&& other) noexcept;
+
   /*!
    * Destructor. Frees the associated buffer unless the memory is external.
    */
@@ -241,7 +271,21 @@ public:
    *
    * \pre m_num_components == 1.
    */
-  void append(const T& value);
+  void append(const T& value) { emplace_back(value); }
+
+  /*!
+   * \brief Constructs a value at the end of the array from the given
+   *  arguments.
+   *
+   * \param [in] args the arguments of the constructor of T.
+   *
+   * \note Reallocation is done if the new size will exceed the capacity. The
+   *  arguments may refer to values in the array.
+   *
+   * \pre m_num_components == 1.
+   */
+  template <typename... Args>
+  void emplace_back(Args&&... args);
 
   /*!
    * \brief Append tuples to the end of the array.
@@ -389,6 +433,14 @@ public:
    */
   virtual bool isInSidre() const { return false; }
 
+  /*!
+   * \brief Return the ID of the allocator of the data array.
+   *
+   * \note Returns INVALID_ALLOCATOR_ID if the memory is external or managed
+   *  by a subclass.
+   */
+  int getAllocatorID() const { return m_allocator_id; }
+
   /// @}
 
 protected:
@@ -454,6 +506,52 @@ protected:
    */
   virtual void dynamicRealloc(IndexType new_num_tuples);
 
+  /*!
+   * \brief Update the number of tuples, through updateNumTuples() only if
+   *  the storage is managed by a subclass.
+   *
+   * \param [in] new_num_tuples the new number of tuples.
+   */
+  inline void setNumTuples(IndexType new_num_tuples)
+  {
+    if(m_has_custom_storage)
+    {
+      updateNumTuples(new_num_tuples);
+      return;
+    }
+
+    assert(new_num_tuples >= 0);
+    assert(new_num_tuples <= m_capacity);
+    m_num_tuples = new_num_tuples;
+  }
+
+  /*!
+   * \brief Grow the data array to hold new_num_tuples tuples, through
+   *  dynamicRealloc() only if the storage is managed by a subclass.
+   *
+   * \param [in] new_num_tuples the number of tuples which exceeds the current
+   *  capacity.
+   */
+  inline void growCapacity(IndexType new_num_tuples)
+  {
+    if(m_has_custom_storage)
+    {
+      dynamicRealloc(new_num_tuples);
+    }
+    else
+    {
+      Array::dynamicRealloc(new_num_tuples);
+    }
+  }
+
+  /*!
+   * \brief Reallocates the native data array with the allocator of this
+   *  Array.
+   *
+   * \param [in] new_capacity the new number of tuples to allocate.
+   */
+  void reallocNative(IndexType new_capacity);
+
   /// \name Internal bounds-checking routines
   /// @{
 
@@ -476,10 +574,18 @@ protected:
   IndexType m_capacity;
   IndexType m_num_components;
   double m_resize_ratio;
-  bool const m_is_external;
+  bool m_is_external;
+  int m_allocator_id;
+
+  /*!
+   * \brief True if a subclass manages the storage through the virtual
+   *  updateNumTuples(), setCapacity() and dynamicRealloc() methods.
+   *
+   * \note Subclasses must set it before the storage is first allocated.
+   */
+  bool m_has_custom_storage;
 
   DISABLE_COPY_AND_ASSIGNMENT(Array);
-  DISABLE_MOVE_AND_ASSIGNMENT(Array);
 };
 
 //------------------------------------------------------------------------------
@@ -495,17 +601,24 @@ Array<T>::Array()
   , m_num_components(1)
   , m_resize_ratio(DEFAULT_RESIZE_RATIO)
   , m_is_external(false)
+  , m_allocator_id(INVALID_ALLOCATOR_ID)
+  , m_has_custom_storage(false)
 { }
 
 //------------------------------------------------------------------------------
 template <typename T>
-Array<T>::Array(IndexType num_tuples, IndexType num_components, IndexType capacity)
+Array<T>::Array(IndexType num_tuples,
+                IndexType num_components,
+                IndexType capacity,
+                int allocator_id)
   : m_data(nullptr)
   , m_num_tuples(0)
   , m_capacity(0)
   , m_num_components(0)
   , m_resize_ratio(DEFAULT_RESIZE_RATIO)
   , m_is_external(false)
+  , m_allocator_id(allocator_id)
+  , m_has_custom_storage(false)
 {
   initialize(num_tuples, num_components, capacity);
 }
@@ -522,6 +635,8 @@ Array<T>::Array(T* data,
   , m_num_components(num_components)
   , m_resize_ratio(0.0)
   , m_is_external(true)
+  , m_allocator_id(INVALID_ALLOCATOR_ID)
+  , m_has_custom_storage(false)
 {
   m_capacity = (capacity < num_tuples) ? num_tuples : capacity;
 
@@ -531,6 +646,70 @@ Array<T>::Array(T* data,
   assert(m_data != nullptr || m_capacity <= 0);
 }
 
+//------------------------------------------------------------------------------
+template <typename T>
+Array<T>::Array(Array&& other) noexcept
+  : m_data(other.m_data)
+  , m_num_tuples(other.m_num_tuples)
+  , m_capacity(other.m_capacity)
+  , m_num_components(other.m_num_components)
+  , m_resize_ratio(other.m_resize_ratio)
+  , m_is_external(other.m_is_external)
+  , m_allocator_id(other.m_allocator_id)
+  , m_has_custom_storage(false)
+{
+  if(other.m_has_custom_storage)
+  {
+    std::cerr << "Cannot move an Array whose storage is managed by a subclass.";
+    utilities::processAbort();
+  }
+
+  other.m_data = nullptr;
+  other.m_num_tuples = 0;
+  other.m_capacity = 0;
+  other.m_resize_ratio = DEFAULT_RESIZE_RATIO;
+  other.m_is_external = false;
+  other.m_allocator_id = axom::getDefaultAllocatorID();
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+Array<T>& Array<T>::operator=(Array&& other) noexcept
+{
+  if(this == &other)
+  {
+    return *this;
+  }
+
+  if(m_has_custom_storage || other.m_has_custom_storage)
+  {
+    std::cerr << "Cannot move an Array whose storage is managed by a subclass.";
+    utilities::processAbort();
+  }
+
+  if(m_data != nullptr && !m_is_external)
+  {
+    axom::deallocate(m_data);
+  }
+
+  m_data = other.m_data;
+  m_num_tuples = other.m_num_tuples;
+  m_capacity = other.m_capacity;
+  m_num_components = other.m_num_components;
+  m_resize_ratio = other.m_resize_ratio;
+  m_is_external = other.m_is_external;
+  m_allocator_id = other.m_allocator_id;
+
+  other.m_data = nullptr;
+  other.m_num_tuples = 0;
+  other.m_capacity = 0;
+  other.m_resize_ratio = DEFAULT_RESIZE_RATIO;
+  other.m_is_external = false;
+  other.m_allocator_id = axom::getDefaultAllocatorID();
+
+  return *this;
+}
+
 //------------------------------------------------------------------------------
 template <typename T>
 Array<T>::~Array()
@@ -545,18 +724,25 @@ Array<T>::~Array()
 
 //------------------------------------------------------------------------------
 template <typename T>
-inline void Array<T>::append(const T& value)
+template <typename... Args>
+inline void Array<T>::emplace_back(Args&&... args)
 {
   assert(m_num_components == 1);
 
   IndexType new_size = m_num_tuples + 1;
   if(new_size > m_capacity)
   {
-    dynamicRealloc(new_size);
+    // the arguments may refer to values in the data array
+    T value(std::forward<Args>(args)...);
+    growCapacity(new_size);
+    new(&m_data[m_num_tuples]) T(std::move(value));
+  }
+  else
+  {
+    new(&m_data[m_num_tuples]) T(std::forward<Args>(args)...);
   }
 
-  m_data[m_num_tuples] = value;
-  updateNumTuples(new_size);
+  setNumTuples(new_size);
 }
 
 //------------------------------------------------------------------------------
@@ -566,12 +752,12 @@ inline void Array<T>::append(const T* tuples, IndexType n)
   IndexType new_size = m_num_tuples + n;
   if(new_size > m_capacity)
   {
-    dynamicRealloc(new_size);
+    growCapacity(new_size);
   }
 
   T* cur_end = m_data + m_num_tuples * m_num_components;
   std::memcpy(cur_end, tuples, n * m_num_components * sizeof(T));
-  updateNumTuples(new_size);
+  setNumTuples(new_size);
 }
 
 //------------------------------------------------------------------------------
@@ -621,10 +807,10 @@ inline void Array<T>::resize(IndexType new_num_tuples)
 
   if(new_num_tuples > m_capacity)
   {
-    dynamicRealloc(new_num_tuples);
+    growCapacity(new_num_tuples);
   }
 
-  updateNumTuples(new_num_tuples);
+  setNumTuples(new_num_tuples);
 }
 
 //------------------------------------------------------------------------------
@@ -674,7 +860,7 @@ inline T* Array<T>::reserveForInsert(IndexType n, IndexType pos)
   IndexType new_size = m_num_tuples + n;
   if(new_size > m_capacity)
   {
-    dynamicRealloc(new_size);
+    growCapacity(new_size);
   }
 
   T* const insert_pos = m_data + pos * m_num_components;
@@ -684,7 +870,7 @@ inline T* Array<T>::reserveForInsert(IndexType n, IndexType pos)
     *(cur_pos + n * m_num_components) = *cur_pos;
   }
 
-  updateNumTuples(new_size);
+  setNumTuples(new_size);
   return insert_pos;
 }
 
@@ -719,10 +905,7 @@ inline void Array<T>::setCapacity(IndexType new_capacity)
     updateNumTuples(new_capacity);
   }
 
-  m_data = axom::reallocate(m_data, new_capacity * m_num_components);
-  m_capacity = new_capacity;
-
-  assert(m_data != nullptr || m_capacity <= 0);
+  reallocNative(new_capacity);
 }
 
 //------------------------------------------------------------------------------
@@ -748,7 +931,23 @@ inline void Array<T>::dynamicRealloc(IndexType new_num_tuples)
     utilities::processAbort();
   }
 
-  m_data = axom::reallocate(m_data, new_capacity * m_num_components);
+  reallocNative(new_capacity);
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+inline void Array<T>::reallocNative(IndexType new_capacity)
+{
+  // a buffer is reallocated by the allocator it came from, so only the first
+  // allocation needs the allocator ID
+  if(m_data == nullptr)
+  {
+    m_data = axom::allocate<T>(new_capacity * m_num_components, m_allocator_id);
+  }
+  else
+  {
+    m_data = axom::reallocate(m_data, new_capacity * m_num_components);
+  }
   m_capacity = new_capacity;
 
   assert(m_data != nullptr || m_capacity <= 0);
@@ -0,0 +1,513 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_ARRAYVIEW_HPP_
+#define AXOM_ARRAYVIEW_HPP_
+
+#include "axom/config.hpp"           // for compile-time defines
+#include "axom/core/Macros.hpp"      // for axom macros
+#include "axom/core/Types.hpp"       // for IndexType definition
+#include "axom/core/StackArray.hpp"  // for axom::StackArray
+#include "axom/core/Array.hpp"       // for axom::Array
+
+// C/C++ includes
+#include <cassert>      // for assert()
+#include <type_traits>  // for std::is_convertible, std::is_same
+
+namespace axom
+{
+/*!
+ * \brief Layout tags of an ArrayView, which determine how its indices map to
+ *  an offset in the underlying buffer.
+ *
+ *  The strides that are known at compile time, e.g., the unit stride of the
+ *  last index of a RowMajor view, are constants in the offset computation,
+ *  which lets the compiler vectorize loops over the contiguous index.
+ */
+namespace layout
+{
+/*!
+ * \brief The last index is contiguous, as in C arrays. For a 2D view over
+ *  tuples of components, this is the array-of-structs layout.
+ */
+struct RowMajor
+{ };
+
+/*!
+ * \brief The first index is contiguous, as in Fortran arrays. For a 2D view
+ *  over tuples of components, this is the struct-of-arrays layout.
+ */
+struct ColumnMajor
+{ };
+
+/*!
+ * \brief The strides of all the indices are given at runtime.
+ */
+struct Strided
+{ };
+
+/*!
+ * \brief The strides of all the indices are known at compile time, e.g.,
+ *  StaticStrides< 3 > for a 1D view over one component of an array of
+ *  3-tuples.
+ */
+template <IndexType... STRIDES>
+struct StaticStrides
+{ };
+
+}  // namespace layout
+
+namespace internal
+{
+/*!
+ * \class ArrayMapping
+ *
+ * \brief Maps the DIM indices of an ArrayView with the given layout to an
+ *  offset in its buffer.
+ */
+template <int DIM, typename Layout>
+class ArrayMapping;
+
+/// \name ArrayMapping Specializations
+/// @{
+
+template <int DIM>
+class ArrayMapping<DIM, layout::RowMajor>
+{
+public:
+  static constexpr bool IS_CONTIGUOUS = true;
+
+  AXOM_HOST_DEVICE ArrayMapping() : m_strides() { }
+
+  explicit ArrayMapping(const StackArray<IndexType, DIM>& shape)
+  {
+    m_strides[DIM - 1] = 1;
+    for(int d = DIM - 2; d >= 0; --d)
+    {
+      m_strides[d] = m_strides[d + 1] * shape[d + 1];
+    }
+  }
+
+  AXOM_HOST_DEVICE IndexType stride(int d) const { return m_strides[d]; }
+
+  AXOM_HOST_DEVICE IndexType offset(const IndexType* idx) const
+  {
+    IndexType offset = idx[DIM - 1];
+    for(int d = 0; d < DIM - 1; ++d)
+    {
+      offset += idx[d] * m_strides[d];
+    }
+    return offset;
+  }
+
+private:
+  StackArray<IndexType, DIM> m_strides;
+};
+
+template <int DIM>
+class ArrayMapping<DIM, layout::ColumnMajor>
+{
+public:
+  static constexpr bool IS_CONTIGUOUS = true;
+
+  AXOM_HOST_DEVICE ArrayMapping() : m_strides() { }
+
+  explicit ArrayMapping(const StackArray<IndexType, DIM>& shape)
+  {
+    m_strides[0] = 1;
+    for(int d = 1; d < DIM; ++d)
+    {
+      m_strides[d] = m_strides[d - 1] * shape[d - 1];
+    }
+  }
+
+  AXOM_HOST_DEVICE IndexType stride(int d) const { return m_strides[d]; }
+
+  AXOM_HOST_DEVICE IndexType offset(const IndexType* idx) const
+  {
+    IndexType offset = idx[0];
+    for(int d = 1; d < DIM; ++d)
+    {
+      offset += idx[d] * m_strides[d];
+    }
+    return offset;
+  }
+
+private:
+  StackArray<IndexType, DIM> m_strides;
+};
+
+template <int DIM>
+class ArrayMapping<DIM, layout::Strided>
+{
+public:
+  static constexpr bool IS_CONTIGUOUS = false;
+
+  AXOM_HOST_DEVICE ArrayMapping() : m_strides() { }
+
+  /*!
+   * \brief Creates the mapping of a contiguous, row-major buffer.
+   */
+  explicit ArrayMapping(const StackArray<IndexType, DIM>& shape)
+  {
+    m_strides[DIM - 1] = 1;
+    for(int d = DIM - 2; d >= 0; --d)
+    {
+      m_strides[d] = m_strides[d + 1] * shape[d + 1];
+    }
+  }
+
+  ArrayMapping(const StackArray<IndexType, DIM>& AXOM_NOT_USED(shape),
+               const StackArray<IndexType, DIM>& strides)
+    : m_strides(strides)
+  { }
+
+  AXOM_HOST_DEVICE IndexType stride(int d) const { return m_strides[d]; }
+
+  AXOM_HOST_DEVICE IndexType offset(const IndexType* idx) const
+  {
+    IndexType offset = 0;
+    for(int d = 0; d < DIM; ++d)
+    {
+      offset += idx[d] * m_strides[d];
+    }
+    return offset;
+  }
+
+private:
+  StackArray<IndexType, DIM> m_strides;
+};
+
+/*!
+ * \brief Computes the offset of the given indices with compile-time strides.
+ */
+template <IndexType STRIDE, IndexType... REST>
+struct StaticOffset
+{
+  AXOM_HOST_DEVICE static constexpr IndexType offset(const IndexType* idx)
+  {
+    return STRIDE * idx[0] + StaticOffset<REST...>::offset(idx + 1);
+  }
+
+  AXOM_HOST_DEVICE static constexpr IndexType stride(int d)
+  {
+    return (d == 0) ? STRIDE : StaticOffset<REST...>::stride(d - 1);
+  }
+};
+
+template <IndexType STRIDE>
+struct StaticOffset<STRIDE>
+{
+  AXOM_HOST_DEVICE static constexpr IndexType offset(const IndexType* idx)
+  {
+    return STRIDE * idx[0];
+  }
+
+  AXOM_HOST_DEVICE static constexpr IndexType stride(int) { return STRIDE; }
+};
+
+template <int DIM, IndexType... STRIDES>
+class ArrayMapping<DIM, layout::StaticStrides<STRIDES...>>
+{
+  AXOM_STATIC_ASSERT_MSG(sizeof...(STRIDES) == DIM,
+                         "StaticStrides must have one stride per dimension");
+
+public:
+  static constexpr bool IS_CONTIGUOUS = false;
+
+  AXOM_HOST_DEVICE ArrayMapping() { }
+
+  explicit ArrayMapping(const StackArray<IndexType, DIM>& AXOM_NOT_USED(shape))
+  { }
+
+  AXOM_HOST_DEVICE IndexType stride(int d) const
+  {
+    return StaticOffset<STRIDES...>::stride(d);
+  }
+
+  AXOM_HOST_DEVICE IndexType offset(const IndexType* idx) const
+  {
+    return StaticOffset<STRIDES...>::offset(idx);
+  }
+};
+
+/// @}
+
+}  // namespace internal
+
+/*!
+ * \class ArrayView
+ *
+ * \brief Provides a non-owning view of a DIM-dimensional array of values.
+ *
+ *  An ArrayView holds a pointer to a buffer, the extent of each of its DIM
+ *  indices, and the mapping of the indices to an offset in the buffer that
+ *  is given by the Layout tag, e.g., layout::RowMajor. It is trivially
+ *  copyable, so it can be captured by value in the kernels of for_all(),
+ *  and its accessors are host-device decorated.
+ *
+ *  A kernel that takes an ArrayView of a given Layout as a template
+ *  parameter can be written once for struct-of-arrays and array-of-structs
+ *  data, and still lets the compiler see the strides that are known at
+ *  compile time.
+ *
+ *  Usage Example:
+ *  \code
+ *
+ *    // a view of the 3-tuples of an axom::Array, in array-of-structs layout
+ *    axom::ArrayView< double, 2 > xyz = axom::make_array_view( coords );
+ *
+ *    // a view of N 3-tuples in struct-of-arrays layout
+ *    axom::ArrayView< double, 2, axom::layout::ColumnMajor > soa( ptr, N, 3 );
+ *
+ *    axom::for_all< ExecSpace >( N, AXOM_LAMBDA( IndexType i ) {
+ *      soa( i, 0 ) = xyz( i, 0 );
+ *    } );
+ *
+ *  \endcode
+ *
+ * \tparam T the type of the values, which is const for a read-only view.
+ * \tparam DIM the number of dimensions.
+ * \tparam Layout the layout tag.
+ *
+ * \note The ArrayView does not check that its buffer is accessible in the
+ *  execution space of the kernels that use it.
+ */
+template <typename T, int DIM = 1, typename Layout = layout::RowMajor>
+class ArrayView
+{
+  AXOM_STATIC_ASSERT_MSG(DIM >= 1, "ArrayView must have at least 1 dimension");
+  using Mapping = internal::ArrayMapping<DIM, Layout>;
+
+public:
+  using value_type = T;
+  using layout_type = Layout;
+  static constexpr int dimension = DIM;
+
+  /// \name ArrayView Constructors
+  /// @{
+
+  /*!
+   * \brief Constructs an empty ArrayView.
+   */
+  AXOM_HOST_DEVICE ArrayView() : m_data(nullptr), m_shape(), m_mapping() { }
+
+  /*!
+   * \brief Constructs an ArrayView of the given buffer and shape.
+   *
+   * \param [in] data pointer to the buffer.
+   * \param [in] shape the extent of each of the DIM indices.
+   *
+   * \note With the Strided layout, the buffer is assumed to be contiguous and
+   *  row-major.
+   */
+  ArrayView(T* data, const StackArray<IndexType, DIM>& shape)
+    : m_data(data)
+    , m_shape(shape)
+    , m_mapping(shape)
+  { }
+
+  /*!
+   * \brief Constructs an ArrayView of the given buffer and extents, e.g.,
+   *  ArrayView< double, 2 >( data, N, 3 ).
+   */
+  template <typename... Extents>
+  ArrayView(T* data, IndexType n0, Extents... extents)
+    : ArrayView(
+        data,
+        StackArray<IndexType, DIM> {{n0, static_cast<IndexType>(extents)...}})
+  {
+    AXOM_STATIC_ASSERT_MSG(sizeof...(Extents) + 1 == DIM,
+                           "ArrayView takes one extent per dimension");
+  }
+
+  /*!
+   * \brief Constructs a Strided ArrayView of the given buffer, shape and
+   *  strides.
+   *
+   * \param [in] data pointer to the buffer.
+   * \param [in] shape the extent of each of the DIM indices.
+   * \param [in] strides the stride of each of the DIM indices, in number of
+   *  values.
+   */
+  ArrayView(T* data,
+            const StackArray<IndexType, DIM>& shape,
+            const StackArray<IndexType, DIM>& strides)
+    : m_data(data)
+    , m_shape(shape)
+    , m_mapping(shape, strides)
+  {
+    AXOM_STATIC_ASSERT_MSG((std::is_same<Layout, layout::Strided>::value),
+                           "Only Strided views take strides at runtime");
+  }
+
+  /*!
+   * \brief Converts an ArrayView to an ArrayView of const values.
+   */
+  template <typename U,
+            typename = typename std::enable_if<
+              std::is_convertible<U (*)[], T (*)[]>::value>::type>
+  AXOM_HOST_DEVICE ArrayView(const ArrayView<U, DIM, Layout>& other)
+    : m_data(other.m_data)
+    , m_shape(other.m_shape)
+    , m_mapping(other.m_mapping)
+  { }
+
+  /// @}
+
+  /// \name ArrayView Accessors
+  /// @{
+
+  /*!
+   * \brief Returns a reference to the value at the given DIM indices.
+   *
+   * \pre 0 <= idx[ d ] < shape( d ) for each d
+   */
+  template <typename... Indices>
+  AXOM_HOST_DEVICE inline T& operator()(Indices... idx) const
+  {
+    AXOM_STATIC_ASSERT_MSG(sizeof...(Indices) == DIM,
+                           "ArrayView takes one index per dimension");
+    const IndexType indices[DIM] = {static_cast<IndexType>(idx)...};
+    assert(inBounds(indices));
+
+    return m_data[m_mapping.offset(indices)];
+  }
+
+  /*!
+   * \brief Returns a reference to the value at the given index of a 1D view.
+   *
+   * \pre 0 <= i < size()
+   */
+  AXOM_HOST_DEVICE inline T& operator[](IndexType i) const
+  {
+    AXOM_STATIC_ASSERT_MSG(DIM == 1, "operator[] requires a 1D ArrayView");
+    return (*this)(i);
+  }
+
+  /*!
+   * \brief Returns a pointer to the first value of the view.
+   */
+  AXOM_HOST_DEVICE T* getData() const { return m_data; }
+
+  /*!
+   * \brief Returns the extent of the given index.
+   */
+  AXOM_HOST_DEVICE IndexType shape(int d) const { return m_shape[d]; }
+
+  /*!
+   * \brief Returns the stride of the given index, in number of values.
+   */
+  AXOM_HOST_DEVICE IndexType stride(int d) const
+  {
+    return m_mapping.stride(d);
+  }
+
+  /*!
+   * \brief Returns the number of values in the view.
+   */
+  AXOM_HOST_DEVICE IndexType size() const
+  {
+    IndexType size = 1;
+    for(int d = 0; d < DIM; ++d)
+    {
+      size *= m_shape[d];
+    }
+    return size;
+  }
+
+  /*!
+   * \brief Returns true iff the view has no values.
+   */
+  AXOM_HOST_DEVICE bool empty() const { return size() == 0; }
+
+  /*!
+   * \brief Returns true if the layout is contiguous, i.e., the values of the
+   *  view are the size() values at the beginning of the buffer.
+   */
+  AXOM_HOST_DEVICE static constexpr bool isContiguous()
+  {
+    return Mapping::IS_CONTIGUOUS;
+  }
+
+  /// @}
+
+private:
+  template <typename U, int D, typename L>
+  friend class ArrayView;
+
+  AXOM_HOST_DEVICE bool inBounds(const IndexType* idx) const
+  {
+    for(int d = 0; d < DIM; ++d)
+    {
+      if(idx[d] < 0 || idx[d] >= m_shape[d])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  T* m_data;
+  StackArray<IndexType, DIM> m_shape;
+  Mapping m_mapping;
+};
+
+/// \name ArrayView Construction from an Array
+/// @{
+
+/*!
+ * \brief Returns a 2D view of the tuples of the given Array, indexed by
+ *  tuple and component.
+ */
+template <typename T>
+inline ArrayView<T, 2> make_array_view(Array<T>& array)
+{
+  return ArrayView<T, 2>(array.getData(), array.size(), array.numComponents());
+}
+
+template <typename T>
+inline ArrayView<const T, 2> make_array_view(const Array<T>& array)
+{
+  return ArrayView<const T, 2>(array.getData(),
+                               array.size(),
+                               array.numComponents());
+}
+
+/*!
+ * \brief Returns a 1D view of the given component of the tuples of an Array.
+ *
+ * \param [in] array the Array.
+ * \param [in] component the component to view.
+ *
+ * \pre 0 <= component < array.numComponents()
+ */
+template <typename T>
+inline ArrayView<T, 1, layout::Strided> make_component_view(
+  Array<T>& array,
+  IndexType component)
+{
+  assert(component >= 0 && component < array.numComponents());
+  return ArrayView<T, 1, layout::Strided>(array.getData() + component,
+                                          {{array.size()}},
+                                          {{array.numComponents()}});
+}
+
+template <typename T>
+inline ArrayView<const T, 1, layout::Strided> make_component_view(
+  const Array<T>& array,
+  IndexType component)
+{
+  assert(component >= 0 && component < array.numComponents());
+  return ArrayView<const T, 1, layout::Strided>(array.getData() + component,
+                                                {{array.size()}},
+                                                {{array.numComponents()}});
+}
+
+/// @}
+
+} /* namespace axom */
+
+#endif /* AXOM_ARRAYVIEW_HPP_ */
@@ -0,0 +1,1059 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_FLATMAP_HPP_
+#define AXOM_FLATMAP_HPP_
+
+#include "axom/config.hpp"                          // for compile-time defines
+#include "axom/core/Macros.hpp"                     // for axom macros
+#include "axom/core/memory_management.hpp"          // for memory allocation
+#include "axom/core/Types.hpp"                      // for axom types
+#include "axom/core/execution/execution_space.hpp"  // for execution spaces
+
+// C/C++ includes
+#include <cstdint>      // for std::int8_t, std::uint64_t
+#include <cstring>      // for std::memcpy, std::memset
+#include <functional>   // for std::hash, std::equal_to
+#include <iterator>     // for std::forward_iterator_tag
+#include <new>          // for placement new
+#include <tuple>        // for std::forward_as_tuple
+#include <type_traits>  // for std::is_same, std::conditional
+#include <utility>      // for std::pair, std::swap
+
+#if defined(__SSE2__) && !defined(__CUDA_ARCH__)
+  #include <emmintrin.h>  // for SSE2 intrinsics
+#endif
+
+namespace axom
+{
+namespace experimental
+{
+namespace flat_map
+{
+/// \name FlatMap Supporting Definitions
+/// @{
+
+/*!
+ * \brief Type of the control bytes of a FlatMap.
+ *
+ *  A full slot stores the 7 low bits of the hash of its key in its control
+ *  byte, which is then non-negative. The other slots store one of the
+ *  negative values below.
+ */
+using ctrl_t = std::int8_t;
+
+constexpr ctrl_t EMPTY = -128;  /*!< slot that has never been used */
+constexpr ctrl_t DELETED = -2;  /*!< slot of an erased item (tombstone) */
+constexpr ctrl_t BUSY = -1;     /*!< slot being filled by bulk_insert() */
+
+/*!
+ * \brief Number of control bytes that are probed at once.
+ */
+constexpr int GROUP_SIZE = 16;
+
+/*!
+ * \brief Mixes the bits of a hash value, so that hash functions that return
+ *  their input, e.g., std::hash for integers, spread keys over the groups.
+ */
+AXOM_HOST_DEVICE inline std::uint64_t mix(std::uint64_t h)
+{
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  return h;
+}
+
+/*!
+ * \brief Returns the index of the lowest set bit of a non-zero mask.
+ */
+AXOM_HOST_DEVICE inline int lowestBit(std::uint32_t mask)
+{
+#if defined(__GNUC__) && !defined(__CUDA_ARCH__)
+  return __builtin_ctz(mask);
+#else
+  int i = 0;
+  while((mask & 1u) == 0)
+  {
+    mask >>= 1;
+    ++i;
+  }
+  return i;
+#endif
+}
+
+/*!
+ * \brief Returns a mask with bit i set if group[ i ] == value.
+ */
+AXOM_HOST_DEVICE inline std::uint32_t matchByte(const ctrl_t* group,
+                                                ctrl_t value)
+{
+#if defined(__SSE2__) && !defined(__CUDA_ARCH__)
+  const __m128i ctrl =
+    _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+  return static_cast<std::uint32_t>(
+    _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(value), ctrl)));
+#else
+  std::uint32_t mask = 0;
+  for(int i = 0; i < GROUP_SIZE; ++i)
+  {
+    mask |= static_cast<std::uint32_t>(group[i] == value) << i;
+  }
+  return mask;
+#endif
+}
+
+/*!
+ * \brief Returns a mask with bit i set if group[ i ] is EMPTY or DELETED.
+ */
+AXOM_HOST_DEVICE inline std::uint32_t matchEmptyOrDeleted(const ctrl_t* group)
+{
+#if defined(__SSE2__) && !defined(__CUDA_ARCH__)
+  const __m128i ctrl =
+    _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+  return static_cast<std::uint32_t>(
+    _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(BUSY), ctrl)));
+#else
+  std::uint32_t mask = 0;
+  for(int i = 0; i < GROUP_SIZE; ++i)
+  {
+    mask |= static_cast<std::uint32_t>(group[i] < BUSY) << i;
+  }
+  return mask;
+#endif
+}
+
+/*!
+ * \brief Returns the index of the slot holding key, or -1.
+ *
+ *  The groups are probed in triangular order starting at the group given by
+ *  the high bits of the hash. In each group, the control bytes that match the
+ *  low bits of the hash are found at once, and the probing stops at the
+ *  first group with an EMPTY slot.
+ */
+template <typename K, typename Slot, typename KeyEqual>
+AXOM_HOST_DEVICE inline IndexType findIndex(const ctrl_t* ctrl,
+                                            const Slot* slots,
+                                            IndexType capacity,
+                                            std::uint64_t hash,
+                                            const K& key,
+                                            const KeyEqual& equal)
+{
+  if(capacity == 0)
+  {
+    return -1;
+  }
+
+  const IndexType group_mask = capacity / GROUP_SIZE - 1;
+  const ctrl_t h2 = static_cast<ctrl_t>(hash & 0x7F);
+  IndexType group = static_cast<IndexType>(hash >> 7) & group_mask;
+
+  for(IndexType step = 1;; ++step)
+  {
+    const IndexType offset = group * GROUP_SIZE;
+    std::uint32_t mask = matchByte(ctrl + offset, h2);
+    while(mask != 0)
+    {
+      const IndexType idx = offset + lowestBit(mask);
+      if(equal(slots[idx].first, key))
+      {
+        return idx;
+      }
+      mask &= mask - 1;
+    }
+
+    if(matchByte(ctrl + offset, EMPTY) != 0)
+    {
+      return -1;
+    }
+
+    group = (group + step) & group_mask;
+  }
+}
+
+/*!
+ * \brief Maps any list of types to void, used to detect member types.
+ */
+template <typename...>
+struct always_void
+{
+  using type = void;
+};
+
+/// @}
+
+}  // namespace flat_map
+
+/*!
+ * \class FlatMapView
+ *
+ * \brief Read-only, trivially copyable view of a FlatMap for lookups in the
+ *  kernels of axom::for_all().
+ *
+ *  A view is obtained from FlatMap::view() and captured by value in the
+ *  kernel. It is invalidated by any modification of the map.
+ *
+ * \note For lookups in device kernels, the map must be allocated in memory
+ *  accessible from the device, and Hash and KeyEqual must be device
+ *  callable.
+ */
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+class FlatMapView
+{
+public:
+  using value_type = std::pair<const Key, T>;
+
+  FlatMapView(const flat_map::ctrl_t* ctrl,
+              const value_type* slots,
+              IndexType capacity,
+              IndexType size,
+              const Hash& hash,
+              const KeyEqual& equal)
+    : m_ctrl(ctrl)
+    , m_slots(slots)
+    , m_capacity(capacity)
+    , m_size(size)
+    , m_hash(hash)
+    , m_equal(equal)
+  { }
+
+  /*!
+   * \brief Returns a pointer to the value mapped to key, or nullptr.
+   */
+  AXOM_HOST_DEVICE const T* find(const Key& key) const
+  {
+    const std::uint64_t h = flat_map::mix(m_hash(key));
+    const IndexType idx =
+      flat_map::findIndex(m_ctrl, m_slots, m_capacity, h, key, m_equal);
+    return (idx < 0) ? nullptr : &(m_slots[idx].second);
+  }
+
+  /*!
+   * \brief Returns true if the map holds an item with the given key.
+   */
+  AXOM_HOST_DEVICE bool contains(const Key& key) const
+  {
+    return find(key) != nullptr;
+  }
+
+  /*!
+   * \brief Returns the number of items in the map.
+   */
+  AXOM_HOST_DEVICE IndexType size() const { return m_size; }
+
+private:
+  const flat_map::ctrl_t* m_ctrl;
+  const value_type* m_slots;
+  IndexType m_capacity;
+  IndexType m_size;
+  Hash m_hash;
+  KeyEqual m_equal;
+};
+
+/*!
+ * \class FlatMap
+ *
+ * \brief Provides a hash map with open addressing, in the style of the
+ *  Swiss tables.
+ *
+ *  The items are stored in a single flat array of slots, with a parallel
+ *  array of one control byte per slot. The slots are probed in groups of
+ *  GROUP_SIZE control bytes, which are compared to the low 7 bits of the
+ *  hash of the key at once, with SSE2 instructions when available, so a
+ *  lookup usually compares a single key. The map grows automatically to
+ *  keep its load factor below 7/8, and erased items leave tombstones that
+ *  are reclaimed when the map is rehashed.
+ *
+ *  Unlike Map, insertions never fail and the items of a FlatMap are
+ *  std::pair< const Key, T > values, as in std::unordered_map. Iterators
+ *  and references are invalidated when the map grows.
+ *
+ *  Lookups with a key of another type than Key, e.g., a const char* in a
+ *  map with std::string keys, are supported when Hash and KeyEqual both
+ *  define is_transparent, as in C++20.
+ *
+ *  Items may be inserted in parallel with bulk_insert(), and looked up in
+ *  the kernels of axom::for_all() through the read-only view().
+ *
+ * \tparam Key the type of keys. Must be copyable or movable.
+ * \tparam T the type of values.
+ * \tparam Hash functor that returns the hash value of a key.
+ * \tparam KeyEqual functor that compares two keys for equality.
+ *
+ * \see Map
+ */
+template <typename Key,
+          typename T,
+          typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class FlatMap
+{
+public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using size_type = IndexType;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using View = FlatMapView<Key, T, Hash, KeyEqual>;
+
+private:
+  template <bool Const>
+  class IteratorBase;
+
+  // enables the heterogeneous lookup methods
+  template <typename H, typename E>
+  using transparent_t = typename flat_map::
+    always_void<typename H::is_transparent, typename E::is_transparent>::type;
+
+public:
+  using iterator = IteratorBase<false>;
+  using const_iterator = IteratorBase<true>;
+
+  /// \name FlatMap Constructors
+  /// @{
+
+  /*!
+   * \brief Constructs an empty FlatMap that can hold the given number of
+   *  items without growing.
+   *
+   * \param [in] count the number of items to reserve space for (optional).
+   * \param [in] hash the hash functor (optional).
+   * \param [in] equal the key comparison functor (optional).
+   */
+  explicit FlatMap(IndexType count = 0,
+                   const Hash& hash = Hash(),
+                   const KeyEqual& equal = KeyEqual())
+    : m_hash(hash)
+    , m_equal(equal)
+  {
+    reserve(count);
+  }
+
+  FlatMap(const FlatMap& other) : m_hash(other.m_hash), m_equal(other.m_equal)
+  {
+    allocate(other.m_capacity);
+    if(m_capacity > 0)
+    {
+      std::memcpy(m_ctrl, other.m_ctrl, m_capacity);
+    }
+
+    for(IndexType i = 0; i < m_capacity; ++i)
+    {
+      if(m_ctrl[i] >= 0)
+      {
+        new(&m_slots[i]) value_type(other.m_slots[i]);
+      }
+    }
+    m_size = other.m_size;
+    m_deleted = other.m_deleted;
+  }
+
+  FlatMap(FlatMap&& other) noexcept
+    : m_hash(other.m_hash)
+    , m_equal(other.m_equal)
+  {
+    swap(other);
+  }
+
+  FlatMap& operator=(FlatMap other)
+  {
+    swap(other);
+    return *this;
+  }
+
+  /*!
+   * \brief Destructor. Destroys the items and frees the associated buffers.
+   */
+  ~FlatMap()
+  {
+    destroyItems();
+    deallocate();
+  }
+
+  /// @}
+
+  /// \name Iterators
+  /// @{
+
+  iterator begin() { return iterator(m_ctrl, m_slots, m_ctrl + m_capacity); }
+  iterator end() { return iterator(m_ctrl + m_capacity); }
+
+  const_iterator begin() const { return cbegin(); }
+  const_iterator end() const { return cend(); }
+
+  const_iterator cbegin() const
+  {
+    return const_iterator(m_ctrl, m_slots, m_ctrl + m_capacity);
+  }
+  const_iterator cend() const { return const_iterator(m_ctrl + m_capacity); }
+
+  /// @}
+
+  /// \name Capacity
+  /// @{
+
+  /*!
+   * \brief Returns the number of items in the map.
+   */
+  IndexType size() const { return m_size; }
+
+  /*!
+   * \brief Checks if the map has no items.
+   */
+  bool empty() const { return (m_size == 0); }
+
+  /*!
+   * \brief Returns the number of slots of the map.
+   */
+  IndexType bucket_count() const { return m_capacity; }
+
+  /*!
+   * \brief Returns the ratio of the number of items to the number of slots.
+   */
+  double load_factor() const
+  {
+    return (m_capacity == 0) ? 0.0 : static_cast<double>(m_size) / m_capacity;
+  }
+
+  /*!
+   * \brief Returns the load factor above which the map grows.
+   */
+  static constexpr double max_load_factor() { return 7.0 / 8.0; }
+
+  /// @}
+
+  /// \name Modifiers
+  /// @{
+
+  /*!
+   * \brief Removes all the items, keeping the allocated slots.
+   */
+  void clear()
+  {
+    destroyItems();
+    if(m_capacity > 0)
+    {
+      std::memset(m_ctrl, flat_map::EMPTY, m_capacity);
+    }
+    m_size = 0;
+    m_deleted = 0;
+  }
+
+  /*!
+   * \brief Ensures the map can hold count items without growing.
+   *
+   * \param [in] count the number of items.
+   *
+   * \note Also reclaims the tombstones of erased items if needed.
+   */
+  void reserve(IndexType count)
+  {
+    if(count + m_deleted > maxLoad(m_capacity))
+    {
+      const IndexType capacity = capacityFor(count > m_size ? count : m_size);
+      rehash(capacity > m_capacity ? capacity : m_capacity);
+    }
+  }
+
+  /*!
+   * \brief Inserts a copy of the given key-value pair if the map does not
+   *  already hold an item with the same key.
+   *
+   * \return A pair whose first element is an iterator to the item with the
+   *  given key, and whose second element is true if the item was inserted.
+   */
+  std::pair<iterator, bool> insert(const value_type& kv)
+  {
+    return try_emplace(kv.first, kv.second);
+  }
+
+  /*!
+   * \brief Inserts an item with the given key and a value constructed from
+   *  args if the map does not already hold an item with the same key.
+   *
+   * \return A pair whose first element is an iterator to the item with the
+   *  given key, and whose second element is true if the item was inserted.
+   */
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+  {
+    return tryEmplaceImpl(key, std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args)
+  {
+    return tryEmplaceImpl(std::move(key), std::forward<Args>(args)...);
+  }
+
+  /*!
+   * \brief Inserts the given key-value pair, or assigns the value to the item
+   *  with the given key if it exists.
+   *
+   * \return A pair whose first element is an iterator to the item with the
+   *  given key, and whose second element is true if the item was inserted.
+   */
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const Key& key, M&& value)
+  {
+    std::pair<iterator, bool> ret = try_emplace(key, std::forward<M>(value));
+    if(!ret.second)
+    {
+      ret.first->second = std::forward<M>(value);
+    }
+    return ret;
+  }
+
+  /*!
+   * \brief Returns a reference to the value mapped to key, inserting a
+   *  default-constructed value if the map has no item with this key.
+   */
+  T& operator[](const Key& key) { return try_emplace(key).first->second; }
+
+  /*!
+   * \brief Inserts the given key-value pairs, in parallel with the given
+   *  execution space.
+   *
+   * \param [in] keys pointer to the array of n keys.
+   * \param [in] values pointer to the array of n values.
+   * \param [in] n the number of key-value pairs.
+   *
+   * \return The number of inserted items. If a key is already in the map or
+   *  repeated in keys, only one of its values is kept.
+   *
+   * \note The map is grown once, before the items are inserted. With
+   *  OMP_EXEC, the threads claim the EMPTY slots with atomic compare and
+   *  swap operations on their control bytes, so the map must not be accessed
+   *  otherwise during the call.
+   *
+   * \tparam ExecSpace the execution space, SEQ_EXEC or OMP_EXEC.
+   */
+  template <typename ExecSpace>
+  IndexType bulk_insert(const Key* keys, const T* values, IndexType n)
+  {
+    AXOM_STATIC_ASSERT(!execution_space<ExecSpace>::onDevice());
+    reserve(m_size + n);
+
+    IndexType num_inserted = 0;
+
+#if defined(AXOM_USE_OPENMP) && defined(__GNUC__)
+    if(!std::is_same<ExecSpace, SEQ_EXEC>::value)
+    {
+  #pragma omp parallel for reduction(+ : num_inserted) schedule(static)
+      for(IndexType i = 0; i < n; ++i)
+      {
+        num_inserted += concurrentInsert(keys[i], values[i]) ? 1 : 0;
+      }
+
+      m_size += num_inserted;
+      return num_inserted;
+    }
+#endif
+
+    for(IndexType i = 0; i < n; ++i)
+    {
+      num_inserted += try_emplace(keys[i], values[i]).second ? 1 : 0;
+    }
+    return num_inserted;
+  }
+
+  /*!
+   * \brief Removes the item with the given key, if any.
+   * \return The number of removed items, 0 or 1.
+   */
+  IndexType erase(const Key& key)
+  {
+    const IndexType idx = findIndex(key);
+    if(idx < 0)
+    {
+      return 0;
+    }
+    eraseAt(idx);
+    return 1;
+  }
+
+  /*!
+   * \brief Removes the item at the given position.
+   * \return An iterator to the item that follows the removed item.
+   */
+  iterator erase(const_iterator pos)
+  {
+    const IndexType idx = static_cast<IndexType>(pos.m_ctrl - m_ctrl);
+    eraseAt(idx);
+    return iterator(m_ctrl + idx, m_slots + idx, m_ctrl + m_capacity);
+  }
+
+  void swap(FlatMap& other) noexcept
+  {
+    std::swap(m_ctrl, other.m_ctrl);
+    std::swap(m_slots, other.m_slots);
+    std::swap(m_capacity, other.m_capacity);
+    std::swap(m_size, other.m_size);
+    std::swap(m_deleted, other.m_deleted);
+    std::swap(m_hash, other.m_hash);
+    std::swap(m_equal, other.m_equal);
+  }
+
+  /// @}
+
+  /// \name Lookup
+  /// @{
+
+  /*!
+   * \brief Returns an iterator to the item with the given key, or end().
+   */
+  iterator find(const Key& key) { return iteratorAt(findIndex(key)); }
+
+  const_iterator find(const Key& key) const
+  {
+    return constIteratorAt(findIndex(key));
+  }
+
+  template <typename K,
+            typename H = Hash,
+            typename E = KeyEqual,
+            typename = transparent_t<H, E>>
+  iterator find(const K& key)
+  {
+    return iteratorAt(findIndex(key));
+  }
+
+  template <typename K,
+            typename H = Hash,
+            typename E = KeyEqual,
+            typename = transparent_t<H, E>>
+  const_iterator find(const K& key) const
+  {
+    return constIteratorAt(findIndex(key));
+  }
+
+  /*!
+   * \brief Returns true if the map holds an item with the given key.
+   */
+  bool contains(const Key& key) const { return findIndex(key) >= 0; }
+
+  template <typename K,
+            typename H = Hash,
+            typename E = KeyEqual,
+            typename = transparent_t<H, E>>
+  bool contains(const K& key) const
+  {
+    return findIndex(key) >= 0;
+  }
+
+  /*!
+   * \brief Returns the number of items with the given key, 0 or 1.
+   */
+  IndexType count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  template <typename K,
+            typename H = Hash,
+            typename E = KeyEqual,
+            typename = transparent_t<H, E>>
+  IndexType count(const K& key) const
+  {
+    return contains(key) ? 1 : 0;
+  }
+
+  /*!
+   * \brief Returns a read-only view of the map for lookups in kernels.
+   */
+  View view() const
+  {
+    return View(m_ctrl, m_slots, m_capacity, m_size, m_hash, m_equal);
+  }
+
+  /// @}
+
+  hasher hash_function() const { return m_hash; }
+  key_equal key_eq() const { return m_equal; }
+
+private:
+  /// \name Private FlatMap Methods
+  /// @{
+
+  /*!
+   * \brief Returns the maximum number of full and deleted slots before the
+   *  map with the given number of slots must grow.
+   */
+  static IndexType maxLoad(IndexType capacity)
+  {
+    return capacity - capacity / 8;
+  }
+
+  /*!
+   * \brief Returns the smallest power-of-two number of slots that holds the
+   *  given number of items.
+   */
+  static IndexType capacityFor(IndexType count)
+  {
+    IndexType capacity = flat_map::GROUP_SIZE;
+    while(maxLoad(capacity) < count)
+    {
+      capacity *= 2;
+    }
+    return capacity;
+  }
+
+  template <typename K>
+  std::uint64_t hashOf(const K& key) const
+  {
+    return flat_map::mix(static_cast<std::uint64_t>(m_hash(key)));
+  }
+
+  template <typename K>
+  IndexType findIndex(const K& key) const
+  {
+    return flat_map::findIndex(m_ctrl,
+                               m_slots,
+                               m_capacity,
+                               hashOf(key),
+                               key,
+                               m_equal);
+  }
+
+  /*!
+   * \brief Returns the index of the first EMPTY or DELETED slot along the
+   *  probe sequence of the given hash.
+   */
+  IndexType findInsertIndex(std::uint64_t hash) const
+  {
+    const IndexType group_mask = m_capacity / flat_map::GROUP_SIZE - 1;
+    IndexType group = static_cast<IndexType>(hash >> 7) & group_mask;
+
+    for(IndexType step = 1;; ++step)
+    {
+      const IndexType offset = group * flat_map::GROUP_SIZE;
+      const std::uint32_t mask = flat_map::matchEmptyOrDeleted(m_ctrl + offset);
+      if(mask != 0)
+      {
+        return offset + flat_map::lowestBit(mask);
+      }
+      group = (group + step) & group_mask;
+    }
+  }
+
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> tryEmplaceImpl(K&& key, Args&&... args)
+  {
+    const std::uint64_t h = hashOf(key);
+    IndexType idx =
+      flat_map::findIndex(m_ctrl, m_slots, m_capacity, h, key, m_equal);
+    if(idx >= 0)
+    {
+      return std::make_pair(iteratorAt(idx), false);
+    }
+
+    if(m_capacity == 0)
+    {
+      rehash(flat_map::GROUP_SIZE);
+    }
+    else if(m_size + m_deleted + 1 > maxLoad(m_capacity))
+    {
+      // only reclaim the tombstones if the items take up less than half the
+      // maximum load, otherwise double the number of slots
+      const bool grow = (m_size + 1 > maxLoad(m_capacity) / 2);
+      rehash(grow ? 2 * m_capacity : m_capacity);
+    }
+
+    idx = findInsertIndex(h);
+    if(m_ctrl[idx] == flat_map::DELETED)
+    {
+      --m_deleted;
+    }
+
+    new(&m_slots[idx]) value_type(std::piecewise_construct,
+                                  std::forward_as_tuple(std::forward<K>(key)),
+                                  std::forward_as_tuple(
+                                    std::forward<Args>(args)...));
+    m_ctrl[idx] = static_cast<flat_map::ctrl_t>(h & 0x7F);
+    ++m_size;
+
+    return std::make_pair(iteratorAt(idx), true);
+  }
+
+  /*!
+   * \brief Inserts a copy of the given key-value pair from one of several
+   *  threads, unless the key is in the map.
+   *
+   *  In each group of the probe sequence, a thread first looks for the key in
+   *  all the full slots of the group, since an erased item may have left an
+   *  EMPTY slot in front of it. It then probes the slots of the group one at
+   *  a time and claims the first EMPTY slot by setting it to BUSY, then sets
+   *  it to the hash bits once the item is constructed. Since slots never
+   *  become EMPTY again during the bulk insertion, two threads inserting the
+   *  same key claim the same slot, and the one that loses waits for the
+   *  winner to finish and sees the key.
+   */
+  bool concurrentInsert(const Key& key, const T& value)
+  {
+#if defined(AXOM_USE_OPENMP) && defined(__GNUC__)
+    const std::uint64_t h = hashOf(key);
+    const flat_map::ctrl_t h2 = static_cast<flat_map::ctrl_t>(h & 0x7F);
+    const IndexType group_mask = m_capacity / flat_map::GROUP_SIZE - 1;
+    IndexType group = static_cast<IndexType>(h >> 7) & group_mask;
+
+    for(IndexType step = 1;; ++step)
+    {
+      const IndexType offset = group * flat_map::GROUP_SIZE;
+      for(IndexType idx = offset; idx < offset + flat_map::GROUP_SIZE; ++idx)
+      {
+        if(__atomic_load_n(&m_ctrl[idx], __ATOMIC_ACQUIRE) == h2 &&
+           m_equal(m_slots[idx].first, key))
+        {
+          return false;
+        }
+      }
+
+      for(IndexType idx = offset; idx < offset + flat_map::GROUP_SIZE; ++idx)
+      {
+        flat_map::ctrl_t c = __atomic_load_n(&m_ctrl[idx], __ATOMIC_ACQUIRE);
+
+        while(c == flat_map::EMPTY || c == flat_map::BUSY)
+        {
+          if(c == flat_map::EMPTY &&
+             __atomic_compare_exchange_n(&m_ctrl[idx],
+                                         &c,
+                                         flat_map::BUSY,
+                                         false,
+                                         __ATOMIC_ACQUIRE,
+                                         __ATOMIC_ACQUIRE))
+          {
+            new(&m_slots[idx]) value_type(key, value);
+            __atomic_store_n(&m_ctrl[idx], h2, __ATOMIC_RELEASE);
+            return true;
+          }
+
+          c = __atomic_load_n(&m_ctrl[idx], __ATOMIC_ACQUIRE);
+        }
+
+        if(c == h2 && m_equal(m_slots[idx].first, key))
+        {
+          return false;
+        }
+      }
+
+      group = (group + step) & group_mask;
+    }
+#else
+    return try_emplace(key, value).second;
+#endif
+  }
+
+  void eraseAt(IndexType idx)
+  {
+    m_slots[idx].~value_type();
+    --m_size;
+
+    // A slot can be reset to EMPTY if its group has an EMPTY slot, since no
+    // probe sequence has then gone past this group. Otherwise, it becomes a
+    // tombstone so that lookups keep probing the next groups.
+    const IndexType offset = idx - idx % flat_map::GROUP_SIZE;
+    if(flat_map::matchByte(m_ctrl + offset, flat_map::EMPTY) != 0)
+    {
+      m_ctrl[idx] = flat_map::EMPTY;
+    }
+    else
+    {
+      m_ctrl[idx] = flat_map::DELETED;
+      ++m_deleted;
+    }
+  }
+
+  /*!
+   * \brief Moves the items to new buffers with the given number of slots,
+   *  which drops the tombstones.
+   */
+  void rehash(IndexType capacity)
+  {
+    flat_map::ctrl_t* old_ctrl = m_ctrl;
+    value_type* old_slots = m_slots;
+    const IndexType old_capacity = m_capacity;
+
+    allocate(capacity);
+    for(IndexType i = 0; i < old_capacity; ++i)
+    {
+      if(old_ctrl[i] >= 0)
+      {
+        value_type& item = old_slots[i];
+        const std::uint64_t h = hashOf(item.first);
+        const IndexType idx = findInsertIndex(h);
+        new(&m_slots[idx])
+          value_type(std::move(const_cast<Key&>(item.first)),
+                     std::move(item.second));
+        m_ctrl[idx] = static_cast<flat_map::ctrl_t>(h & 0x7F);
+        item.~value_type();
+      }
+    }
+    m_deleted = 0;
+
+    axom::deallocate(old_ctrl);
+    axom::deallocate(old_slots);
+  }
+
+  void allocate(IndexType capacity)
+  {
+    m_capacity = capacity;
+    m_ctrl = nullptr;
+    m_slots = nullptr;
+    if(capacity > 0)
+    {
+      m_ctrl = axom::allocate<flat_map::ctrl_t>(capacity);
+      m_slots = axom::allocate<value_type>(capacity);
+      std::memset(m_ctrl, flat_map::EMPTY, capacity);
+    }
+  }
+
+  void deallocate()
+  {
+    axom::deallocate(m_ctrl);
+    axom::deallocate(m_slots);
+    m_capacity = 0;
+  }
+
+  void destroyItems()
+  {
+    if(!std::is_trivially_destructible<value_type>::value)
+    {
+      for(IndexType i = 0; i < m_capacity; ++i)
+      {
+        if(m_ctrl[i] >= 0)
+        {
+          m_slots[i].~value_type();
+        }
+      }
+    }
+  }
+
+  iterator iteratorAt(IndexType idx)
+  {
+    return (idx < 0)
+      ? end()
+      : iterator(m_ctrl + idx, m_slots + idx, m_ctrl + m_capacity);
+  }
+
+  const_iterator constIteratorAt(IndexType idx) const
+  {
+    return (idx < 0)
+      ? cend()
+      : const_iterator(m_ctrl + idx, m_slots + idx, m_ctrl + m_capacity);
+  }
+
+  /// @}
+
+  /// \name Private Data Members
+  /// @{
+
+  flat_map::ctrl_t* m_ctrl {nullptr}; /*!< control byte of each slot */
+  value_type* m_slots {nullptr};      /*!< storage of the items */
+  IndexType m_capacity {0};           /*!< number of slots */
+  IndexType m_size {0};               /*!< number of items */
+  IndexType m_deleted {0};            /*!< number of tombstones */
+  Hash m_hash;
+  KeyEqual m_equal;
+
+  /// @}
+};
+
+/*!
+ * \brief Forward iterator over the items of a FlatMap.
+ */
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <bool Const>
+class FlatMap<Key, T, Hash, KeyEqual>::IteratorBase
+{
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = typename FlatMap::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer =
+    typename std::conditional<Const, const value_type*, value_type*>::type;
+  using reference =
+    typename std::conditional<Const, const value_type&, value_type&>::type;
+
+  IteratorBase() = default;
+
+  /*!
+   * \brief Creates the end iterator.
+   */
+  explicit IteratorBase(const flat_map::ctrl_t* end)
+    : m_ctrl(end)
+    , m_slot(nullptr)
+    , m_end(end)
+  { }
+
+  /*!
+   * \brief Creates an iterator to the first full slot at or after ctrl.
+   */
+  IteratorBase(const flat_map::ctrl_t* ctrl,
+               pointer slot,
+               const flat_map::ctrl_t* end)
+    : m_ctrl(ctrl)
+    , m_slot(slot)
+    , m_end(end)
+  {
+    skipEmptySlots();
+  }
+
+  /*!
+   * \brief Converts an iterator to a const_iterator.
+   */
+  template <bool C = Const, typename = typename std::enable_if<C>::type>
+  IteratorBase(const IteratorBase<false>& other)
+    : m_ctrl(other.m_ctrl)
+    , m_slot(other.m_slot)
+    , m_end(other.m_end)
+  { }
+
+  reference operator*() const { return *m_slot; }
+  pointer operator->() const { return m_slot; }
+
+  IteratorBase& operator++()
+  {
+    ++m_ctrl;
+    ++m_slot;
+    skipEmptySlots();
+    return *this;
+  }
+
+  IteratorBase operator++(int)
+  {
+    IteratorBase tmp(*this);
+    ++(*this);
+    return tmp;
+  }
+
+  friend bool operator==(const IteratorBase& lhs, const IteratorBase& rhs)
+  {
+    return lhs.m_ctrl == rhs.m_ctrl;
+  }
+
+  friend bool operator!=(const IteratorBase& lhs, const IteratorBase& rhs)
+  {
+    return lhs.m_ctrl != rhs.m_ctrl;
+  }
+
+private:
+  friend class FlatMap;
+  friend class IteratorBase<!Const>;
+
+  void skipEmptySlots()
+  {
+    while(m_ctrl != m_end && *m_ctrl < 0)
+    {
+      ++m_ctrl;
+      ++m_slot;
+    }
+  }
+
+  const flat_map::ctrl_t* m_ctrl {nullptr};
+  pointer m_slot {nullptr};
+  const flat_map::ctrl_t* m_end {nullptr};
+};
+
+} /* namespace experimental */
+} /* namespace axom */
+
+#endif /* AXOM_FLATMAP_HPP_ */
@@ -344,6 +344,8 @@ public:
  * \tparam T the type of values to hold, must be copyable.
  * \tparam Hash functor that takes an object of Key type and returns 
  *  a hashed value of size_t (for now)
+ *
+ * \see FlatMap for an open-addressing map that grows automatically.
  */
 
 template <typename Key, typename T, typename Hash = std::hash<Key>>
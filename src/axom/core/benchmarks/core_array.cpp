@@ -0,0 +1,182 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+#include "axom/core.hpp"
+
+using axom::IndexType;
+
+//------------------------------------------------------------------------------
+namespace
+{
+struct Point
+{
+  double x, y, z;
+  Point(double x_, double y_, double z_) : x(x_), y(y_), z(z_) { }
+};
+
+// Builds an Array of n values that is returned by value
+axom::Array<double> buildArray(IndexType n)
+{
+  axom::Array<double> v(axom::internal::ZERO, 1, 0);
+  for(IndexType i = 0; i < n; ++i)
+  {
+    v.append(0.5 * i);
+  }
+  return v;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// Appends values one at a time, starting from the minimum default capacity
+void append_Array(benchmark::State& state)
+{
+  const IndexType n = state.range_x();
+
+  while(state.KeepRunning())
+  {
+    axom::Array<double> v(axom::internal::ZERO);
+    for(IndexType i = 0; i < n; ++i)
+    {
+      v.append(0.5 * i);
+    }
+    benchmark::DoNotOptimize(v.getData());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(append_Array)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 22);
+
+//------------------------------------------------------------------------------
+void append_vector(benchmark::State& state)
+{
+  const IndexType n = state.range_x();
+
+  while(state.KeepRunning())
+  {
+    std::vector<double> v;
+    for(IndexType i = 0; i < n; ++i)
+    {
+      v.push_back(0.5 * i);
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(append_vector)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 22);
+
+//------------------------------------------------------------------------------
+// Appends values to an Array with enough capacity, which only measures the
+// cost of the append itself
+void append_Array_reserved(benchmark::State& state)
+{
+  const IndexType n = state.range_x();
+
+  while(state.KeepRunning())
+  {
+    axom::Array<double> v(axom::internal::ZERO, 1, n);
+    for(IndexType i = 0; i < n; ++i)
+    {
+      v.append(0.5 * i);
+    }
+    benchmark::DoNotOptimize(v.getData());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(append_Array_reserved)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 22);
+
+//------------------------------------------------------------------------------
+void append_vector_reserved(benchmark::State& state)
+{
+  const IndexType n = state.range_x();
+
+  while(state.KeepRunning())
+  {
+    std::vector<double> v;
+    v.reserve(n);
+    for(IndexType i = 0; i < n; ++i)
+    {
+      v.push_back(0.5 * i);
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(append_vector_reserved)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 22);
+
+//------------------------------------------------------------------------------
+void emplace_back_Array(benchmark::State& state)
+{
+  const IndexType n = state.range_x();
+
+  while(state.KeepRunning())
+  {
+    axom::Array<Point> v(axom::internal::ZERO);
+    for(IndexType i = 0; i < n; ++i)
+    {
+      v.emplace_back(1.0 * i, 2.0 * i, 3.0 * i);
+    }
+    benchmark::DoNotOptimize(v.getData());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(emplace_back_Array)->Arg(1 << 10)->Arg(1 << 20);
+
+//------------------------------------------------------------------------------
+void emplace_back_vector(benchmark::State& state)
+{
+  const IndexType n = state.range_x();
+
+  while(state.KeepRunning())
+  {
+    std::vector<Point> v;
+    for(IndexType i = 0; i < n; ++i)
+    {
+      v.emplace_back(1.0 * i, 2.0 * i, 3.0 * i);
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(emplace_back_vector)->Arg(1 << 10)->Arg(1 << 20);
+
+//------------------------------------------------------------------------------
+// Returns Arrays by value and moves them into a container
+void return_by_value_Array(benchmark::State& state)
+{
+  const IndexType n = state.range_x();
+  constexpr int NUM_ARRAYS = 64;
+
+  while(state.KeepRunning())
+  {
+    std::vector<axom::Array<double>> arrays;
+    arrays.reserve(NUM_ARRAYS);
+    for(int i = 0; i < NUM_ARRAYS; ++i)
+    {
+      arrays.push_back(buildArray(n));
+    }
+    benchmark::DoNotOptimize(arrays.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * NUM_ARRAYS * n);
+}
+BENCHMARK(return_by_value_Array)->Arg(1 << 4)->Arg(1 << 12);
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
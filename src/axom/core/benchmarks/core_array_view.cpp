@@ -0,0 +1,104 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+#include "axom/core.hpp"
+
+using axom::IndexType;
+
+namespace
+{
+constexpr int NCOMP = 3;
+using FixedRowMajor = axom::layout::StaticStrides<NCOMP, 1>;
+
+//------------------------------------------------------------------------------
+// Adds a multiple of the first component of each tuple to its last component
+template <typename ViewType>
+void axpy(const ViewType& view, double a)
+{
+  const IndexType n = view.shape(0);
+  for(IndexType i = 0; i < n; ++i)
+  {
+    view(i, NCOMP - 1) += a * view(i, 0);
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// Baseline, with hand-written indexing into an array-of-structs buffer
+void axpy_raw_pointer(benchmark::State& state)
+{
+  const IndexType n = state.range_x();
+  std::vector<double> buffer(NCOMP * n, 1.0);
+
+  while(state.KeepRunning())
+  {
+    double* data = buffer.data();
+    for(IndexType i = 0; i < n; ++i)
+    {
+      data[NCOMP * i + NCOMP - 1] += 0.5 * data[NCOMP * i];
+    }
+    benchmark::DoNotOptimize(data);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(axpy_raw_pointer)->Arg(1 << 10)->Arg(1 << 20);
+
+//------------------------------------------------------------------------------
+template <typename Layout>
+void axpy_view(benchmark::State& state)
+{
+  const IndexType n = state.range_x();
+  std::vector<double> buffer(NCOMP * n, 1.0);
+  axom::ArrayView<double, 2, Layout> view(buffer.data(), n, NCOMP);
+
+  while(state.KeepRunning())
+  {
+    axpy(view, 0.5);
+    benchmark::DoNotOptimize(view.getData());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(axpy_view, axom::layout::RowMajor)
+  ->Arg(1 << 10)
+  ->Arg(1 << 20);
+BENCHMARK_TEMPLATE(axpy_view, axom::layout::ColumnMajor)
+  ->Arg(1 << 10)
+  ->Arg(1 << 20);
+BENCHMARK_TEMPLATE(axpy_view, FixedRowMajor)->Arg(1 << 10)->Arg(1 << 20);
+
+//------------------------------------------------------------------------------
+// Same access pattern as the row-major view, with strides known only at runtime
+void axpy_view_strided(benchmark::State& state)
+{
+  const IndexType n = state.range_x();
+  std::vector<double> buffer(NCOMP * n, 1.0);
+  axom::ArrayView<double, 2, axom::layout::Strided> view(buffer.data(),
+                                                         {{n, NCOMP}},
+                                                         {{NCOMP, 1}});
+
+  while(state.KeepRunning())
+  {
+    axpy(view, 0.5);
+    benchmark::DoNotOptimize(view.getData());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(axpy_view_strided)->Arg(1 << 10)->Arg(1 << 20);
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
@@ -0,0 +1,258 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "benchmark/benchmark_api.h"
+#include "axom/core.hpp"
+
+// C/C++ includes
+#include <algorithm>  // for std::stable_sort, std::sort, std::unique_copy
+#include <cstdint>    // for std::uint32_t
+#include <numeric>    // for std::iota, std::accumulate, std::partial_sum
+#include <random>     // for std::mt19937
+#include <vector>     // for std::vector
+
+//------------------------------------------------------------------------------
+namespace
+{
+/*!
+ * \brief Returns random 30-bit keys, such as the Morton codes of a BVH.
+ */
+std::vector<std::uint32_t> make_keys(std::size_t n)
+{
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<std::uint32_t> dist(0, (1u << 30) - 1);
+  std::vector<std::uint32_t> keys(n);
+  for(std::uint32_t& key : keys)
+  {
+    key = dist(gen);
+  }
+  return keys;
+}
+
+/*!
+ * \brief Returns sorted keys in which each value is repeated a few times.
+ */
+std::vector<std::uint32_t> make_sorted_keys(std::size_t n)
+{
+  std::vector<std::uint32_t> keys(n);
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    keys[i] = static_cast<std::uint32_t>(i / 3 + i / 7);
+  }
+  return keys;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// Sorts of (key, index) pairs, as in the construction of a BVH. The baseline
+// sorts the indices by key with std::stable_sort.
+//------------------------------------------------------------------------------
+void sort_pairs_std(benchmark::State& state)
+{
+  const std::size_t n = state.range_x();
+  const std::vector<std::uint32_t> input = make_keys(n);
+  std::vector<std::uint32_t> keys(n);
+  std::vector<std::int32_t> values(n);
+
+  while(state.KeepRunning())
+  {
+    keys = input;
+    std::iota(values.begin(), values.end(), 0);
+    const std::uint32_t* k = keys.data();
+    std::stable_sort(values.begin(),
+                     values.end(),
+                     [=](std::int32_t i1, std::int32_t i2) {
+                       return k[i1] < k[i2];
+                     });
+    benchmark::DoNotOptimize(values.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(sort_pairs_std)->Arg(1 << 16)->Arg(1 << 22);
+
+template <typename ExecSpace>
+void sort_pairs(benchmark::State& state)
+{
+  const std::size_t n = state.range_x();
+  const std::vector<std::uint32_t> input = make_keys(n);
+  std::vector<std::uint32_t> keys(n);
+  std::vector<std::int32_t> values(n);
+
+  while(state.KeepRunning())
+  {
+    keys = input;
+    std::iota(values.begin(), values.end(), 0);
+    axom::sort_pairs<ExecSpace>(keys.data(), values.data(), n);
+    benchmark::DoNotOptimize(values.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(sort_pairs, axom::SEQ_EXEC)->Arg(1 << 16)->Arg(1 << 22);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE(sort_pairs, axom::OMP_EXEC)->Arg(1 << 16)->Arg(1 << 22);
+#endif
+
+//------------------------------------------------------------------------------
+// Sorts of keys only
+//------------------------------------------------------------------------------
+void radix_sort_std(benchmark::State& state)
+{
+  const std::size_t n = state.range_x();
+  const std::vector<std::uint32_t> input = make_keys(n);
+  std::vector<std::uint32_t> keys(n);
+
+  while(state.KeepRunning())
+  {
+    keys = input;
+    std::sort(keys.begin(), keys.end());
+    benchmark::DoNotOptimize(keys.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(radix_sort_std)->Arg(1 << 16)->Arg(1 << 22);
+
+template <typename ExecSpace>
+void radix_sort(benchmark::State& state)
+{
+  const std::size_t n = state.range_x();
+  const std::vector<std::uint32_t> input = make_keys(n);
+  std::vector<std::uint32_t> keys(n);
+
+  while(state.KeepRunning())
+  {
+    keys = input;
+    axom::radix_sort<ExecSpace>(keys.data(), n);
+    benchmark::DoNotOptimize(keys.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(radix_sort, axom::SEQ_EXEC)->Arg(1 << 16)->Arg(1 << 22);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE(radix_sort, axom::OMP_EXEC)->Arg(1 << 16)->Arg(1 << 22);
+#endif
+
+//------------------------------------------------------------------------------
+// Scans, reductions and unique
+//------------------------------------------------------------------------------
+void exclusive_scan_std(benchmark::State& state)
+{
+  const std::size_t n = state.range_x();
+  const std::vector<axom::IndexType> counts(n, 3);
+  std::vector<axom::IndexType> offsets(n);
+
+  while(state.KeepRunning())
+  {
+    offsets[0] = 0;
+    std::partial_sum(counts.begin(), counts.end() - 1, offsets.begin() + 1);
+    benchmark::DoNotOptimize(offsets.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(exclusive_scan_std)->Arg(1 << 16)->Arg(1 << 22);
+
+template <typename ExecSpace>
+void exclusive_scan(benchmark::State& state)
+{
+  const std::size_t n = state.range_x();
+  const std::vector<axom::IndexType> counts(n, 3);
+  std::vector<axom::IndexType> offsets(n);
+
+  while(state.KeepRunning())
+  {
+    axom::exclusive_scan<ExecSpace>(counts.data(), offsets.data(), n);
+    benchmark::DoNotOptimize(offsets.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(exclusive_scan, axom::SEQ_EXEC)->Arg(1 << 16)->Arg(1 << 22);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE(exclusive_scan, axom::OMP_EXEC)->Arg(1 << 16)->Arg(1 << 22);
+#endif
+
+void reduce_std(benchmark::State& state)
+{
+  const std::size_t n = state.range_x();
+  const std::vector<double> values(n, 0.5);
+
+  while(state.KeepRunning())
+  {
+    double sum = std::accumulate(values.begin(), values.end(), 0.);
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(reduce_std)->Arg(1 << 16)->Arg(1 << 22);
+
+template <typename ExecSpace>
+void reduce(benchmark::State& state)
+{
+  const std::size_t n = state.range_x();
+  const std::vector<double> values(n, 0.5);
+
+  while(state.KeepRunning())
+  {
+    double sum = axom::reduce<ExecSpace>(values.data(), n);
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(reduce, axom::SEQ_EXEC)->Arg(1 << 16)->Arg(1 << 22);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE(reduce, axom::OMP_EXEC)->Arg(1 << 16)->Arg(1 << 22);
+#endif
+
+void unique_std(benchmark::State& state)
+{
+  const std::size_t n = state.range_x();
+  const std::vector<std::uint32_t> keys = make_sorted_keys(n);
+  std::vector<std::uint32_t> output(n);
+
+  while(state.KeepRunning())
+  {
+    auto last = std::unique_copy(keys.begin(), keys.end(), output.begin());
+    benchmark::DoNotOptimize(last);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(unique_std)->Arg(1 << 16)->Arg(1 << 22);
+
+template <typename ExecSpace>
+void unique(benchmark::State& state)
+{
+  const std::size_t n = state.range_x();
+  const std::vector<std::uint32_t> keys = make_sorted_keys(n);
+  std::vector<std::uint32_t> output(n);
+
+  while(state.KeepRunning())
+  {
+    auto count = axom::unique<ExecSpace>(keys.data(), n, output.data());
+    benchmark::DoNotOptimize(count);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(unique, axom::SEQ_EXEC)->Arg(1 << 16)->Arg(1 << 22);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE(unique, axom::OMP_EXEC)->Arg(1 << 16)->Arg(1 << 22);
+#endif
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
@@ -0,0 +1,289 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+#include "axom/core.hpp"
+
+using axom::IndexType;
+using axom::experimental::FlatMap;
+
+//------------------------------------------------------------------------------
+namespace
+{
+// Distinct random keys, the second half of which are never inserted and are
+// used for unsuccessful lookups
+std::vector<long> randomKeys(IndexType n)
+{
+  std::mt19937_64 gen(42);
+  std::vector<long> keys(2 * n);
+  for(auto& k : keys)
+  {
+    k = static_cast<long>(gen() >> 2);
+  }
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+  std::shuffle(keys.begin(), keys.end(), gen);
+  keys.resize(2 * n, -1);
+  return keys;
+}
+
+// The Map does not grow, so it is sized with 8 items per bucket on average
+constexpr int MAP_BUCKET_LEN = 16;
+
+IndexType mapBuckets(IndexType n) { return std::max<IndexType>(n / 8, 1); }
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+void insert_FlatMap(benchmark::State& state)
+{
+  const IndexType n = state.range_x();
+  const std::vector<long> keys = randomKeys(n);
+
+  while(state.KeepRunning())
+  {
+    FlatMap<long, long> map;
+    for(IndexType i = 0; i < n; ++i)
+    {
+      map.insert({keys[i], i});
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(insert_FlatMap)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+//------------------------------------------------------------------------------
+void insert_unordered_map(benchmark::State& state)
+{
+  const IndexType n = state.range_x();
+  const std::vector<long> keys = randomKeys(n);
+
+  while(state.KeepRunning())
+  {
+    std::unordered_map<long, long> map;
+    for(IndexType i = 0; i < n; ++i)
+    {
+      map.insert({keys[i], i});
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(insert_unordered_map)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+//------------------------------------------------------------------------------
+void insert_Map(benchmark::State& state)
+{
+  const IndexType n = state.range_x();
+  const std::vector<long> keys = randomKeys(n);
+
+  while(state.KeepRunning())
+  {
+    axom::experimental::Map<long, long> map(mapBuckets(n), MAP_BUCKET_LEN);
+    for(IndexType i = 0; i < n; ++i)
+    {
+      map.insert(keys[i], i);
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(insert_Map)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+//------------------------------------------------------------------------------
+// Half of the lookups are successful
+void find_FlatMap(benchmark::State& state)
+{
+  const IndexType n = state.range_x();
+  const std::vector<long> keys = randomKeys(n);
+
+  FlatMap<long, long> map;
+  for(IndexType i = 0; i < n; ++i)
+  {
+    map.insert({keys[i], i});
+  }
+
+  while(state.KeepRunning())
+  {
+    long sum = 0;
+    for(const long k : keys)
+    {
+      auto it = map.find(k);
+      sum += (it != map.end()) ? it->second : 0;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * 2 * n);
+}
+BENCHMARK(find_FlatMap)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+//------------------------------------------------------------------------------
+void find_unordered_map(benchmark::State& state)
+{
+  const IndexType n = state.range_x();
+  const std::vector<long> keys = randomKeys(n);
+
+  std::unordered_map<long, long> map;
+  for(IndexType i = 0; i < n; ++i)
+  {
+    map.insert({keys[i], i});
+  }
+
+  while(state.KeepRunning())
+  {
+    long sum = 0;
+    for(const long k : keys)
+    {
+      auto it = map.find(k);
+      sum += (it != map.end()) ? it->second : 0;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * 2 * n);
+}
+BENCHMARK(find_unordered_map)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+//------------------------------------------------------------------------------
+void find_Map(benchmark::State& state)
+{
+  const IndexType n = state.range_x();
+  const std::vector<long> keys = randomKeys(n);
+
+  axom::experimental::Map<long, long> map(mapBuckets(n), MAP_BUCKET_LEN);
+  for(IndexType i = 0; i < n; ++i)
+  {
+    map.insert(keys[i], i);
+  }
+
+  while(state.KeepRunning())
+  {
+    long sum = 0;
+    for(const long k : keys)
+    {
+      const auto& node = map.find(k);
+      sum += (&node != &map.end()) ? node.value : 0;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * 2 * n);
+}
+BENCHMARK(find_Map)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+//------------------------------------------------------------------------------
+// Successful lookups of std::string keys with a const char* key, which does
+// not construct a temporary std::string with the heterogeneous lookup
+struct StringHash
+{
+  using is_transparent = void;
+
+  std::size_t operator()(const char* str) const
+  {
+    std::size_t h = 14695981039346656037ULL;
+    for(; *str != '\0'; ++str)
+    {
+      h = (h ^ static_cast<unsigned char>(*str)) * 1099511628211ULL;
+    }
+    return h;
+  }
+
+  std::size_t operator()(const std::string& str) const
+  {
+    return (*this)(str.c_str());
+  }
+};
+
+struct StringEqual
+{
+  using is_transparent = void;
+
+  bool operator()(const std::string& a, const std::string& b) const
+  {
+    return a == b;
+  }
+
+  bool operator()(const std::string& a, const char* b) const
+  {
+    return a.compare(b) == 0;
+  }
+};
+
+void find_FlatMap_strings(benchmark::State& state)
+{
+  const IndexType n = state.range_x();
+
+  // long names, which std::string does not store inline
+  std::vector<std::string> names(n);
+  FlatMap<std::string, IndexType, StringHash, StringEqual> map;
+  for(IndexType i = 0; i < n; ++i)
+  {
+    names[i] = "mesh_field_with_a_long_name_" + std::to_string(i);
+    map.insert({names[i], i});
+  }
+
+  while(state.KeepRunning())
+  {
+    IndexType sum = 0;
+    for(const auto& name : names)
+    {
+      sum += map.find(name.c_str())->second;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(find_FlatMap_strings)->Arg(1 << 10)->Arg(1 << 16);
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void bulk_insert_FlatMap(benchmark::State& state)
+{
+  const IndexType n = state.range_x();
+  const std::vector<long> keys = randomKeys(n);
+  std::vector<long> values(n);
+  for(IndexType i = 0; i < n; ++i)
+  {
+    values[i] = i;
+  }
+
+  while(state.KeepRunning())
+  {
+    FlatMap<long, long> map;
+    map.bulk_insert<ExecSpace>(keys.data(), values.data(), n);
+    benchmark::DoNotOptimize(map.size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(bulk_insert_FlatMap, axom::SEQ_EXEC)
+  ->Arg(1 << 16)
+  ->Arg(1 << 20);
+#ifdef AXOM_USE_OPENMP
+BENCHMARK_TEMPLATE(bulk_insert_FlatMap, axom::OMP_EXEC)
+  ->Arg(1 << 16)
+  ->Arg(1 << 20);
+#endif
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
@@ -0,0 +1,132 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "benchmark/benchmark_api.h"
+#include "axom/core.hpp"
+
+#ifndef AXOM_USE_UMPIRE
+
+namespace memory = axom::memory;
+
+//------------------------------------------------------------------------------
+namespace
+{
+int get_pool_id()
+{
+  static const int id = memory::makeAllocator<memory::PoolAllocator>("pool");
+  return id;
+}
+
+int get_arena_id()
+{
+  static const int id = memory::makeAllocator<memory::ArenaAllocator>("arena");
+  return id;
+}
+
+/*!
+ * \brief Allocates and frees scratch buffers of the given size the way a
+ *  function that is called in a loop does, e.g., a BVH query.
+ */
+void alloc_free(benchmark::State& state, int allocatorID)
+{
+  const std::size_t n = state.range_x();
+
+  while(state.KeepRunning())
+  {
+    int* counts = axom::allocate<int>(n, allocatorID);
+    int* offsets = axom::allocate<int>(n, allocatorID);
+    counts[0] = offsets[n - 1] = 1;
+    benchmark::DoNotOptimize(counts);
+    benchmark::DoNotOptimize(offsets);
+    axom::deallocate(offsets);
+    axom::deallocate(counts);
+  }
+
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+void alloc_free_malloc(benchmark::State& state)
+{
+  alloc_free(state, memory::MALLOC_ALLOCATOR_ID);
+}
+BENCHMARK(alloc_free_malloc)->Arg(16)->Arg(1 << 10)->Arg(1 << 16);
+
+//------------------------------------------------------------------------------
+void alloc_free_pool(benchmark::State& state)
+{
+  alloc_free(state, get_pool_id());
+}
+BENCHMARK(alloc_free_pool)->Arg(16)->Arg(1 << 10)->Arg(1 << 16);
+
+//------------------------------------------------------------------------------
+void alloc_free_arena(benchmark::State& state)
+{
+  const int arenaID = get_arena_id();
+  memory::ArenaAllocator& arena =
+    *memory::getAllocator<memory::ArenaAllocator>(arenaID);
+  const std::size_t n = state.range_x();
+
+  while(state.KeepRunning())
+  {
+    memory::ArenaScope scope(arena);
+    int* counts = axom::allocate<int>(n, arenaID);
+    int* offsets = axom::allocate<int>(n, arenaID);
+    counts[0] = offsets[n - 1] = 1;
+    benchmark::DoNotOptimize(counts);
+    benchmark::DoNotOptimize(offsets);
+  }
+
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(alloc_free_arena)->Arg(16)->Arg(1 << 10)->Arg(1 << 16);
+
+//------------------------------------------------------------------------------
+// Traverses a large array, which touches fewer pages when they are huge
+template <bool HUGE_PAGES>
+void traverse(benchmark::State& state)
+{
+  static const int id = HUGE_PAGES
+    ? memory::makeAllocator<memory::HugePageAllocator>("huge_pages")
+    : memory::MALLOC_ALLOCATOR_ID;
+
+  const std::size_t n = state.range_x();
+  double* values = axom::allocate<double>(n, id);
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    values[i] = 1.;
+  }
+
+  // visit one value per 4 KiB page, in a scattered order
+  constexpr std::size_t STRIDE = 4096 / sizeof(double);
+  const std::size_t numPages = n / STRIDE;
+  while(state.KeepRunning())
+  {
+    double sum = 0.;
+    for(std::size_t i = 0; i < numPages; ++i)
+    {
+      sum += values[((i * 7919) % numPages) * STRIDE];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  axom::deallocate(values);
+  state.SetItemsProcessed(state.iterations() * numPages);
+}
+BENCHMARK_TEMPLATE(traverse, false)->Arg(1 << 25);
+BENCHMARK_TEMPLATE(traverse, true)->Arg(1 << 25);
+
+#endif /* AXOM_USE_UMPIRE */
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
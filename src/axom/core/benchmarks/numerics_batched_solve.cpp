@@ -0,0 +1,237 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <cstdlib>
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+#include "axom/core.hpp"
+
+using axom::IndexType;
+namespace numerics = axom::numerics;
+
+//------------------------------------------------------------------------------
+namespace
+{
+/*!
+ * \brief Holds count random, diagonally dominant, symmetric N x N systems in
+ *  both array-of-structs (one row-major matrix after the other) and
+ *  struct-of-arrays layouts.
+ */
+template <int N>
+struct Systems
+{
+  std::vector<double> A_aos, b_aos;
+  std::vector<double> A_soa, b_soa;
+
+  explicit Systems(IndexType count)
+    : A_aos(N * N * count)
+    , b_aos(N * count)
+    , A_soa(N * N * count)
+    , b_soa(N * count)
+  {
+    srand(42);
+    for(IndexType m = 0; m < count; ++m)
+    {
+      for(int i = 0; i < N; ++i)
+      {
+        b_aos[m * N + i] = b_soa[i * count + m] = random_real();
+        for(int j = 0; j <= i; ++j)
+        {
+          const double value = random_real() + ((i == j) ? N : 0.);
+          A_aos[(m * N + i) * N + j] = A_aos[(m * N + j) * N + i] = value;
+          A_soa[(i * N + j) * count + m] = A_soa[(j * N + i) * count + m] =
+            value;
+        }
+      }
+    }
+  }
+
+  static double random_real() { return 2. * rand() / RAND_MAX - 1.; }
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// Baseline, one numerics::Matrix at a time
+template <int N>
+void linear_solve_Matrix(benchmark::State& state)
+{
+  const IndexType count = state.range_x();
+  Systems<N> systems(count);
+  std::vector<double> x(N * count);
+
+  while(state.KeepRunning())
+  {
+    for(IndexType m = 0; m < count; ++m)
+    {
+      numerics::Matrix<double> A(N, N);
+      for(int i = 0; i < N; ++i)
+      {
+        for(int j = 0; j < N; ++j)
+        {
+          A(i, j) = systems.A_aos[(m * N + i) * N + j];
+        }
+      }
+      numerics::linear_solve(A, &systems.b_aos[m * N], &x[m * N]);
+    }
+    benchmark::DoNotOptimize(x.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(linear_solve_Matrix, 3)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(linear_solve_Matrix, 4)->Arg(1 << 10)->Arg(1 << 16);
+
+//------------------------------------------------------------------------------
+// Fixed-size solve, one system at a time
+template <int N>
+void linear_solve_fixed(benchmark::State& state)
+{
+  const IndexType count = state.range_x();
+  Systems<N> systems(count);
+  std::vector<double> x(N * count);
+
+  while(state.KeepRunning())
+  {
+    for(IndexType m = 0; m < count; ++m)
+    {
+      numerics::linear_solve<N>(&systems.A_aos[m * N * N],
+                                &systems.b_aos[m * N],
+                                &x[m * N]);
+    }
+    benchmark::DoNotOptimize(x.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(linear_solve_fixed, 3)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(linear_solve_fixed, 4)->Arg(1 << 10)->Arg(1 << 16);
+
+//------------------------------------------------------------------------------
+template <int N, typename ExecSpace>
+void batched_lu_solve(benchmark::State& state)
+{
+  const IndexType count = state.range_x();
+  Systems<N> systems(count);
+  std::vector<double> x(N * count);
+
+  while(state.KeepRunning())
+  {
+    numerics::batched_lu_solve<N, ExecSpace>(count,
+                                             systems.A_soa.data(),
+                                             systems.b_soa.data(),
+                                             x.data());
+    benchmark::DoNotOptimize(x.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * count);
+}
+template <int N>
+void batched_lu_solve_seq(benchmark::State& state)
+{
+  batched_lu_solve<N, axom::SEQ_EXEC>(state);
+}
+BENCHMARK_TEMPLATE(batched_lu_solve_seq, 3)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(batched_lu_solve_seq, 4)->Arg(1 << 10)->Arg(1 << 16);
+
+#ifdef AXOM_USE_OPENMP
+template <int N>
+void batched_lu_solve_omp(benchmark::State& state)
+{
+  batched_lu_solve<N, axom::OMP_EXEC>(state);
+}
+BENCHMARK_TEMPLATE(batched_lu_solve_omp, 3)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(batched_lu_solve_omp, 4)->Arg(1 << 10)->Arg(1 << 16);
+#endif
+
+//------------------------------------------------------------------------------
+// Baseline, one numerics::Matrix at a time
+template <int N>
+void jacobi_eigensolve_Matrix(benchmark::State& state)
+{
+  const IndexType count = state.range_x();
+  Systems<N> systems(count);
+  std::vector<double> lambdas(N * count);
+  numerics::Matrix<double> V(N, N);
+
+  while(state.KeepRunning())
+  {
+    for(IndexType m = 0; m < count; ++m)
+    {
+      numerics::Matrix<double> A(N, N);
+      for(int i = 0; i < N; ++i)
+      {
+        for(int j = 0; j < N; ++j)
+        {
+          A(i, j) = systems.A_aos[(m * N + i) * N + j];
+        }
+      }
+      numerics::jacobi_eigensolve(A, V, &lambdas[m * N]);
+    }
+    benchmark::DoNotOptimize(lambdas.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(jacobi_eigensolve_Matrix, 3)->Arg(1 << 10)->Arg(1 << 16);
+
+//------------------------------------------------------------------------------
+// Fixed-size eigensolve, one matrix at a time
+template <int N>
+void jacobi_eigensolve_fixed(benchmark::State& state)
+{
+  const IndexType count = state.range_x();
+  Systems<N> systems(count);
+  std::vector<double> V(N * N * count);
+  std::vector<double> lambdas(N * count);
+
+  while(state.KeepRunning())
+  {
+    for(IndexType m = 0; m < count; ++m)
+    {
+      numerics::jacobi_eigensolve<N>(&systems.A_aos[m * N * N],
+                                     &V[m * N * N],
+                                     &lambdas[m * N]);
+    }
+    benchmark::DoNotOptimize(lambdas.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(jacobi_eigensolve_fixed, 3)->Arg(1 << 10)->Arg(1 << 16);
+
+//------------------------------------------------------------------------------
+template <int N>
+void batched_jacobi_eigensolve_seq(benchmark::State& state)
+{
+  const IndexType count = state.range_x();
+  Systems<N> systems(count);
+  std::vector<double> V(N * N * count);
+  std::vector<double> lambdas(N * count);
+
+  while(state.KeepRunning())
+  {
+    numerics::batched_jacobi_eigensolve<N>(count,
+                                           systems.A_soa.data(),
+                                           V.data(),
+                                           lambdas.data());
+    benchmark::DoNotOptimize(lambdas.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(batched_jacobi_eigensolve_seq, 3)
+  ->Arg(1 << 10)
+  ->Arg(1 << 16);
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
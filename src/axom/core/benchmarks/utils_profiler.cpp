@@ -0,0 +1,71 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "benchmark/benchmark_api.h"
+#include "axom/core.hpp"
+
+namespace profiler = axom::profiler;
+
+//------------------------------------------------------------------------------
+// Cost of entering and leaving a region that was entered before
+void region(benchmark::State& state)
+{
+  profiler::reset();
+  profiler::set_enabled(state.range_x() != 0);
+
+  profiler::Region outer("outer");
+  while(state.KeepRunning())
+  {
+    profiler::Region inner("inner");
+  }
+
+  profiler::set_enabled(true);
+}
+BENCHMARK(region)->Arg(0)->Arg(1);
+
+//------------------------------------------------------------------------------
+// Cost of entering a region among many siblings, e.g., the last of them
+void region_siblings(benchmark::State& state)
+{
+  const int num_siblings = state.range_x();
+
+  profiler::reset();
+  profiler::Region outer("outer");
+
+  std::vector<std::string> names(num_siblings);
+  for(int i = 0; i < num_siblings; ++i)
+  {
+    names[i] = "sibling_" + std::to_string(i);
+    profiler::Region sibling(names[i]);
+  }
+
+  while(state.KeepRunning())
+  {
+    profiler::Region last(names.back());
+  }
+}
+BENCHMARK(region_siblings)->Arg(1)->Arg(8)->Arg(64);
+
+//------------------------------------------------------------------------------
+void add_counter(benchmark::State& state)
+{
+  profiler::reset();
+  profiler::Region outer("outer");
+
+  while(state.KeepRunning())
+  {
+    profiler::add_counter("bytes", 8.);
+  }
+}
+BENCHMARK(add_counter);
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
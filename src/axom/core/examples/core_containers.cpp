@@ -18,9 +18,16 @@
 
 // Axom includes
 #include "axom/core/Array.hpp"
+#include "axom/core/ArrayView.hpp"
 #include "axom/core/Macros.hpp"
 #include "axom/core/memory_management.hpp"
 
+#ifndef AXOM_USE_UMPIRE
+  #include "axom/core/memory/ArenaAllocator.hpp"
+  #include "axom/core/memory/PoolAllocator.hpp"
+  #include "axom/core/memory/registry.hpp"
+#endif
+
 #ifdef WIN32
   #include "windows.h"
 void sleep(int numSeconds)
@@ -137,8 +144,81 @@ void demoArrayBasic()
   // _extbuffer_end
 }
 
+void demoArrayView()
+{
+  // _arrayview_start
+  // Here is an Array of four 3D points, stored as triples (x, y, z).
+  axom::Array<double> points(4, 3);
+  for(int i = 0; i < points.size(); ++i)
+  {
+    points(i, 0) = i;
+    points(i, 1) = 10 * i;
+    points(i, 2) = 100 * i;
+  }
+
+  // An ArrayView indexes the same memory as a 2D array of points and
+  // coordinates, without owning it.
+  axom::ArrayView<double, 2> xyz = axom::make_array_view(points);
+
+  // Here are the same points stored as three arrays, x[], y[] and z[].
+  double soa[12];
+  using SoA = axom::layout::ColumnMajor;
+  axom::ArrayView<double, 2, SoA> xyz_soa(soa, 4, 3);
+  for(int i = 0; i < xyz.shape(0); ++i)
+  {
+    for(int j = 0; j < xyz.shape(1); ++j)
+    {
+      xyz_soa(i, j) = xyz(i, j);
+    }
+  }
+
+  // A 1D view of the y coordinates of the points in the Array skips the x
+  // and z coordinates.
+  auto y = axom::make_component_view(points, 1);
+  std::cout << "y coordinates = [";
+  for(int i = 0; i < y.size(); ++i)
+  {
+    std::cout << (i > 0 ? ", " : "") << y[i];
+  }
+  std::cout << "], also stored at " << &xyz_soa(0, 1) << std::endl;
+  // _arrayview_end
+}
+
+#ifndef AXOM_USE_UMPIRE
+void demoAllocators()
+{
+  // _allocators_start
+  // Register a pool and an arena once, e.g., at the start of the application.
+  const int poolID =
+    axom::memory::makeAllocator<axom::memory::PoolAllocator>("POOL");
+  const int arenaID =
+    axom::memory::makeAllocator<axom::memory::ArenaAllocator>("SCRATCH");
+
+  // Arrays that are created and destroyed often can use the pool.
+  axom::Array<int> a(0, 1, 0, poolID);
+  for(int i = 0; i < 10; ++i)
+  {
+    a.append(i);
+  }
+  showArray(a, "a");
+
+  // Memory taken from the arena inside a scope is reclaimed all at once when
+  // the scope ends; deallocate() does not need to be called.
+  {
+    axom::memory::ArenaScope scope(arenaID);
+    double* scratch = axom::allocate<double>(1000, arenaID);
+    scratch[0] = 1.;
+  }
+  // _allocators_end
+}
+#endif
+
 int main(int AXOM_NOT_USED(argc), char** AXOM_NOT_USED(argv))
 {
   demoArrayBasic();
+  demoArrayView();
+#ifndef AXOM_USE_UMPIRE
+  demoAllocators();
+#endif
   return 0;
 }
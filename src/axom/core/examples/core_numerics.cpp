@@ -18,6 +18,7 @@
 
 // Axom includes
 #include "axom/core/Macros.hpp"
+#include "axom/core/numerics/batched_solve.hpp"
 #include "axom/core/numerics/eigen_solve.hpp"
 #include "axom/core/numerics/jacobi_eigensolve.hpp"
 #include "axom/core/numerics/linear_solve.hpp"
@@ -275,6 +276,43 @@ void demoMatrix()
     }
   }
   // _solve_end
+
+  // _batched_start
+  {
+    // Solve the same system, with the size known at compile time; A is a
+    // row-major array and is not modified
+    const double A[9] = {1., 2., 4., 3., 8., 14., 2., 6., 13.};
+    const double b[3] = {3., 13., 4.};
+    double x[3];
+
+    int rc = numerics::linear_solve<3>(A, b, x);
+    std::cout << "Fixed-size solve found x = [" << x[0] << ", " << x[1] << ", "
+              << x[2] << "] with result " << rc << std::endl;
+  }
+
+  {
+    // Solve many 2x2 systems at once. Entry (i,j) of every matrix is stored
+    // contiguously, followed by entry (i,j+1), and so on.
+    constexpr int COUNT = 100;
+    std::vector<double> As(2 * 2 * COUNT);
+    std::vector<double> bs(2 * COUNT);
+    std::vector<double> xs(2 * COUNT);
+    for(int m = 0; m < COUNT; ++m)
+    {
+      // the m-th system is [m+1 1; 1 m+1] x = [m+2 m+2], solved by x = [1 1]
+      As[0 * COUNT + m] = m + 1;
+      As[1 * COUNT + m] = 1;
+      As[2 * COUNT + m] = 1;
+      As[3 * COUNT + m] = m + 1;
+      bs[0 * COUNT + m] = m + 2;
+      bs[1 * COUNT + m] = m + 2;
+    }
+
+    numerics::batched_lu_solve<2>(COUNT, As.data(), bs.data(), xs.data());
+    std::cout << "Batched solve found x = [" << xs[COUNT - 1] << ", "
+              << xs[2 * COUNT - 1] << "] for the last system" << std::endl;
+  }
+  // _batched_end
 }
 
 int main(int AXOM_NOT_USED(argc), char** AXOM_NOT_USED(argv))
@@ -38,6 +38,7 @@ void sleep(int numSeconds)
 #include "axom/core/utilities/StringUtilities.hpp"
 #include "axom/core/utilities/Timer.hpp"
 #include "axom/core/utilities/About.hpp"
+#include "axom/core/utilities/profiler/interface.hpp"
 // _header_end
 
 // _fs_string_start
@@ -105,6 +106,25 @@ void demoFileSystemAndString(const char* argv0)
 }
 // _fs_string_end
 
+// _profiler_start
+void demoProfiler()
+{
+  std::vector<double> values;
+  {
+    axom::profiler::Region region("fill");
+    for(int i = 0; i < 1000; ++i)
+    {
+      axom::profiler::Region inner("push_back");
+      values.push_back(i);
+    }
+    axom::profiler::add_counter("bytes", values.size() * sizeof(double));
+  }
+
+  // Prints a table of the regions with their calls, times and counters
+  axom::profiler::write_text_report(std::cout);
+}
+// _profiler_end
+
 int main(int argc, char** argv)
 {
   // _about_start
@@ -137,5 +157,7 @@ int main(int argc, char** argv)
             << std::endl;
   // _timer_end
 
+  demoProfiler();
+
   return 0;
 }
@@ -0,0 +1,234 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_CORE_EXECUTION_ATOMICS_HPP_
+#define AXOM_CORE_EXECUTION_ATOMICS_HPP_
+
+#include "axom/config.hpp"                         /* compile time defs */
+#include "axom/core/execution/execution_space.hpp" /* execution_space traits */
+#include "axom/core/Macros.hpp"                    /* for axom Macros */
+
+// RAJA includes
+#ifdef AXOM_USE_RAJA
+  #include "RAJA/RAJA.hpp"
+#endif
+
+// C/C++ includes
+#include <type_traits>  // for std::is_same
+
+/*!
+ * \file
+ *
+ * \brief Defines atomic operations that may be called from the kernel of
+ *  axom::for_all() with the given execution space.
+ *
+ *  Each operation updates the value at the given address and returns the
+ *  value it held before the update.
+ *
+ *  When Axom is built with RAJA, the operations are the RAJA atomics of the
+ *  atomic_policy of the execution space. Otherwise, SEQ_EXEC updates the
+ *  value directly and OMP_EXEC uses OpenMP atomics, or a compare-and-swap
+ *  loop for atomicMin() and atomicMax().
+ */
+
+namespace axom
+{
+#ifndef AXOM_USE_RAJA
+namespace internal
+{
+template <typename ExecSpace>
+constexpr bool is_serial_atomic()
+{
+  return std::is_same<ExecSpace, SEQ_EXEC>::value;
+}
+
+/*!
+ * \brief Sets *address to value if comp( value, *address ) is true.
+ * \return the value at the address before the update.
+ */
+template <typename ExecSpace, typename T, typename Compare>
+inline T atomicUpdateIf(T* address, T value, Compare comp)
+{
+  AXOM_STATIC_ASSERT(!execution_space<ExecSpace>::onDevice());
+
+  T old = *address;
+  if(is_serial_atomic<ExecSpace>())
+  {
+    if(comp(value, old))
+    {
+      *address = value;
+    }
+    return old;
+  }
+
+  #if defined(__GNUC__)
+  __atomic_load(address, &old, __ATOMIC_RELAXED);
+  while(comp(value, old) &&
+        !__atomic_compare_exchange(address,
+                                   &old,
+                                   &value,
+                                   false,
+                                   __ATOMIC_RELAXED,
+                                   __ATOMIC_RELAXED))
+  { }
+  #else
+    #ifdef AXOM_USE_OPENMP
+      #pragma omp critical(axom_atomic_update)
+    #endif
+  {
+    old = *address;
+    if(comp(value, old))
+    {
+      *address = value;
+    }
+  }
+  #endif
+
+  return old;
+}
+
+}  // namespace internal
+#endif
+
+/*!
+ * \brief Atomically adds value to *address.
+ * \return the value at the address before the update.
+ */
+template <typename ExecSpace, typename T>
+AXOM_HOST_DEVICE inline T atomicAdd(T* address, T value)
+{
+#ifdef AXOM_USE_RAJA
+  using atomic_policy = typename execution_space<ExecSpace>::atomic_policy;
+  return RAJA::atomicAdd<atomic_policy>(address, value);
+#else
+  AXOM_STATIC_ASSERT(!execution_space<ExecSpace>::onDevice());
+
+  T old;
+  if(internal::is_serial_atomic<ExecSpace>())
+  {
+    old = *address;
+    *address += value;
+  }
+  else
+  {
+  #ifdef AXOM_USE_OPENMP
+    #pragma omp atomic capture
+  #endif
+    {
+      old = *address;
+      *address += value;
+    }
+  }
+  return old;
+#endif
+}
+
+/*!
+ * \brief Atomically subtracts value from *address.
+ * \return the value at the address before the update.
+ */
+template <typename ExecSpace, typename T>
+AXOM_HOST_DEVICE inline T atomicSub(T* address, T value)
+{
+#ifdef AXOM_USE_RAJA
+  using atomic_policy = typename execution_space<ExecSpace>::atomic_policy;
+  return RAJA::atomicSub<atomic_policy>(address, value);
+#else
+  AXOM_STATIC_ASSERT(!execution_space<ExecSpace>::onDevice());
+
+  T old;
+  if(internal::is_serial_atomic<ExecSpace>())
+  {
+    old = *address;
+    *address -= value;
+  }
+  else
+  {
+  #ifdef AXOM_USE_OPENMP
+    #pragma omp atomic capture
+  #endif
+    {
+      old = *address;
+      *address -= value;
+    }
+  }
+  return old;
+#endif
+}
+
+/*!
+ * \brief Atomically replaces *address with value.
+ * \return the value at the address before the update.
+ */
+template <typename ExecSpace, typename T>
+AXOM_HOST_DEVICE inline T atomicExchange(T* address, T value)
+{
+#ifdef AXOM_USE_RAJA
+  using atomic_policy = typename execution_space<ExecSpace>::atomic_policy;
+  return RAJA::atomicExchange<atomic_policy>(address, value);
+#else
+  AXOM_STATIC_ASSERT(!execution_space<ExecSpace>::onDevice());
+
+  T old;
+  if(internal::is_serial_atomic<ExecSpace>())
+  {
+    old = *address;
+    *address = value;
+  }
+  else
+  {
+  #ifdef AXOM_USE_OPENMP
+    #pragma omp atomic capture
+  #endif
+    {
+      old = *address;
+      *address = value;
+    }
+  }
+  return old;
+#endif
+}
+
+/*!
+ * \brief Atomically replaces *address with the minimum of *address and value.
+ * \return the value at the address before the update.
+ */
+template <typename ExecSpace, typename T>
+AXOM_HOST_DEVICE inline T atomicMin(T* address, T value)
+{
+#ifdef AXOM_USE_RAJA
+  using atomic_policy = typename execution_space<ExecSpace>::atomic_policy;
+  return RAJA::atomicMin<atomic_policy>(address, value);
+#else
+  return internal::atomicUpdateIf<ExecSpace>(address,
+                                             value,
+                                             [](const T& a, const T& b) {
+                                               return a < b;
+                                             });
+#endif
+}
+
+/*!
+ * \brief Atomically replaces *address with the maximum of *address and value.
+ * \return the value at the address before the update.
+ */
+template <typename ExecSpace, typename T>
+AXOM_HOST_DEVICE inline T atomicMax(T* address, T value)
+{
+#ifdef AXOM_USE_RAJA
+  using atomic_policy = typename execution_space<ExecSpace>::atomic_policy;
+  return RAJA::atomicMax<atomic_policy>(address, value);
+#else
+  return internal::atomicUpdateIf<ExecSpace>(address,
+                                             value,
+                                             [](const T& a, const T& b) {
+                                               return b < a;
+                                             });
+#endif
+}
+
+} /* namespace axom */
+
+#endif /* AXOM_CORE_EXECUTION_ATOMICS_HPP_ */
@@ -26,10 +26,11 @@
  *
  *    Indicates parallel execution with OpenMP on the CPU.
  *
- *    Defined when AXOM_USE_OPENMP and AXOM_USE_RAJA are defined. In addition,
- *    using this execution space requires linking to a RAJA that is configured
- *    with OpenMp, i.e., RAJA_ENABLE_OPENMP must be defined in the generated
- *    RAJA/config.hpp.
+ *    Defined when AXOM_USE_OPENMP is defined. When AXOM_USE_RAJA is also
+ *    defined, using this execution space requires linking to a RAJA that is
+ *    configured with OpenMp, i.e., RAJA_ENABLE_OPENMP must be defined in the
+ *    generated RAJA/config.hpp. Without RAJA, for_all(), the reducers, the
+ *    scans and the atomics run natively with OpenMP.
  *
  *    The default memory allocator when using this execution space is HOST.
  *
@@ -91,7 +92,7 @@ struct execution_space
 // execution_space traits specialization
 #include "axom/core/execution/internal/seq_exec.hpp"
 
-#if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
+#ifdef AXOM_USE_OPENMP
   #include "axom/core/execution/internal/omp_exec.hpp"
 #endif
 
@@ -60,6 +60,35 @@ inline void for_all(const IndexType& begin,
   RAJA::forall<loop_exec>(RAJA::RangeSegment(begin, end),
                           std::forward<KernelType>(kernel));
 
+#elif defined(AXOM_USE_OPENMP)
+
+  constexpr bool is_serial = std::is_same<ExecSpace, SEQ_EXEC>::value;
+  constexpr bool is_omp = std::is_same<ExecSpace, OMP_EXEC>::value;
+  AXOM_STATIC_ASSERT(is_serial || is_omp);
+
+  if(is_serial)
+  {
+    for(IndexType i = begin; i < end; ++i)
+    {
+      kernel(i);
+    }
+  }
+  else
+  {
+  #pragma omp parallel
+    {
+      // each thread runs its own copy of the kernel, so that the reducers
+      // it captures keep a partial result per thread of this team
+      typename std::decay<KernelType>::type body(kernel);
+
+  #pragma omp for schedule(static)
+      for(IndexType i = begin; i < end; ++i)
+      {
+        body(i);
+      }
+    }
+  }
+
 #else
 
   constexpr bool is_serial = std::is_same<ExecSpace, SEQ_EXEC>::value;
@@ -10,10 +10,12 @@
 #include "axom/core/memory_management.hpp"
 
 // RAJA includes
-#include "RAJA/RAJA.hpp"
+#ifdef AXOM_USE_RAJA
+  #include "RAJA/RAJA.hpp"
 
-#ifndef RAJA_ENABLE_OPENMP
-  #error OMP_EXEC requires an OpenMP enabled RAJA
+  #ifndef RAJA_ENABLE_OPENMP
+    #error OMP_EXEC requires an OpenMP enabled RAJA
+  #endif
 #endif
 
 // Umpire includes
@@ -31,15 +33,25 @@ struct OMP_EXEC
 
 /*!
  * \brief execution_space traits specialization for OMP_EXEC
+ *
+ * \note Without RAJA, the policies are void and for_all(), the reducers,
+ *  the scans and the atomics of axom use OpenMP directly.
  */
 template <>
 struct execution_space<OMP_EXEC>
 {
+#ifdef AXOM_USE_RAJA
   using loop_policy = RAJA::omp_parallel_for_exec;
 
   using reduce_policy = RAJA::omp_reduce;
   using atomic_policy = RAJA::omp_atomic;
   using sync_policy = RAJA::omp_synchronize;
+#else
+  using loop_policy = void;
+  using reduce_policy = void;
+  using atomic_policy = void;
+  using sync_policy = void;
+#endif
 
   static constexpr bool async() noexcept { return false; };
   static constexpr bool valid() noexcept { return true; };
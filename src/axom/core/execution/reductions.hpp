@@ -0,0 +1,390 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_CORE_EXECUTION_REDUCTIONS_HPP_
+#define AXOM_CORE_EXECUTION_REDUCTIONS_HPP_
+
+#include "axom/config.hpp"                         /* compile time defs */
+#include "axom/core/execution/execution_space.hpp" /* execution_space traits */
+#include "axom/core/execution/for_all.hpp"         /* for_all() */
+#include "axom/core/Macros.hpp"                    /* for axom Macros */
+#include "axom/core/Types.hpp"                     /* for axom::IndexType */
+
+// RAJA includes
+#ifdef AXOM_USE_RAJA
+  #include "RAJA/RAJA.hpp"
+#endif
+
+// C/C++ includes
+#include <limits>       // for std::numeric_limits
+#include <type_traits>  // for std::is_same
+#include <vector>       // for std::vector
+
+#ifdef AXOM_USE_OPENMP
+  #include <omp.h>  // for omp_get_max_threads(), omp_get_level()
+#endif
+
+/*!
+ * \file
+ *
+ * \brief Defines the ReduceSum, ReduceMin and ReduceMax reducers and the
+ *  reduce() function.
+ *
+ *  A reducer is captured by value in the kernel of axom::for_all() and
+ *  combines the values passed to it by all the iterations of the loop. The
+ *  result is obtained with get() after the loop.
+ *
+ *  Usage Example:
+ *  \code
+ *
+ *    axom::ReduceSum< ExecSpace, double > total( 0.0 );
+ *    axom::ReduceMax< ExecSpace, double > maxval( 0.0 );
+ *
+ *    axom::for_all< ExecSpace >( N, AXOM_LAMBDA( IndexType idx ) {
+ *      total += A[ idx ];
+ *      maxval.max( A[ idx ] );
+ *    } );
+ *
+ *    double sum = total.get( );
+ *
+ *  \endcode
+ *
+ *  When Axom is built with RAJA, the reducers are the RAJA reducers of the
+ *  reduce_policy of the execution space. Otherwise, the copies of a reducer
+ *  that for_all() makes for the threads of the loop keep partial results,
+ *  which are combined at the end of the loop.
+ */
+
+namespace axom
+{
+#ifdef AXOM_USE_RAJA
+
+template <typename ExecSpace, typename T>
+using ReduceSum =
+  RAJA::ReduceSum<typename execution_space<ExecSpace>::reduce_policy, T>;
+
+template <typename ExecSpace, typename T>
+using ReduceMin =
+  RAJA::ReduceMin<typename execution_space<ExecSpace>::reduce_policy, T>;
+
+template <typename ExecSpace, typename T>
+using ReduceMax =
+  RAJA::ReduceMax<typename execution_space<ExecSpace>::reduce_policy, T>;
+
+#else
+
+namespace internal
+{
+/// \name Reduction Operators
+/// @{
+
+template <typename T>
+struct sum_op
+{
+  static constexpr T identity() { return T(0); }
+  static T combine(const T& a, const T& b) { return a + b; }
+};
+
+template <typename T>
+struct min_op
+{
+  static constexpr T identity() { return std::numeric_limits<T>::max(); }
+  static T combine(const T& a, const T& b) { return (b < a) ? b : a; }
+};
+
+template <typename T>
+struct max_op
+{
+  static constexpr T identity() { return std::numeric_limits<T>::lowest(); }
+  static T combine(const T& a, const T& b) { return (a < b) ? b : a; }
+};
+
+/// @}
+
+/*!
+ * \brief Reducer on the CPU whose thread-private copies keep partial results.
+ *
+ *  The reducer that is constructed holds the result. Copies of it, e.g., the
+ *  copies captured by the kernel of for_all(), refer to it:
+ *  <ul>
+ *    <li> A copy made inside an OpenMP parallel region, such as the copy of
+ *         the kernel that for_all() makes for each thread of the team that
+ *         runs the loop, is private to its thread. It combines the values
+ *         passed to it in its own partial result, which is combined into the
+ *         result when the copy is destroyed at the end of the region. </li>
+ *    <li> Other copies combine the values passed to them directly into the
+ *         result, inside a critical section when they are called from a
+ *         parallel region. </li>
+ *  </ul>
+ *  The partial results thus follow the team that actually runs the loop,
+ *  whatever its size or nesting level.
+ *
+ * \tparam T the type of the reduced values
+ * \tparam ReduceOp the reduction operator
+ *
+ * \note The reducer that is constructed must outlive its copies.
+ */
+template <typename T, typename ReduceOp>
+class CpuReducer
+{
+public:
+  explicit CpuReducer(T init = ReduceOp::identity())
+    : m_value(init)
+    , m_root(this)
+    , m_level(-1)
+    , m_dirty(false)
+  { }
+
+  CpuReducer(const CpuReducer& other)
+    : m_value(ReduceOp::identity())
+    , m_root(other.m_root)
+    , m_level(inParallel() ? level() : -1)
+    , m_dirty(false)
+  { }
+
+  ~CpuReducer()
+  {
+    if(m_dirty)
+    {
+      combineIntoRoot(m_value);
+    }
+  }
+
+  CpuReducer& operator=(const CpuReducer&) = delete;
+
+  /*!
+   * \brief Returns the combined result of the initial value and all the
+   *  values passed to this reducer and its copies.
+   */
+  T get() const { return m_root->m_value; }
+
+  /*!
+   * \brief Discards the values passed to the reducer and sets its initial
+   *  value.
+   */
+  void reset(T init) { m_root->m_value = init; }
+
+  /*!
+   * \brief Combines the given value into the partial result of the calling
+   *  thread.
+   */
+  void combine(const T& value) const
+  {
+    if(m_level >= 0 && level() == m_level)
+    {
+      m_value = ReduceOp::combine(m_value, value);
+      m_dirty = true;
+    }
+    else
+    {
+      combineIntoRoot(value);
+    }
+  }
+
+private:
+  void combineIntoRoot(const T& value) const
+  {
+#ifdef AXOM_USE_OPENMP
+    if(inParallel())
+    {
+  #pragma omp critical(axom_cpu_reducer)
+      m_root->m_value = ReduceOp::combine(m_root->m_value, value);
+      return;
+    }
+#endif
+    m_root->m_value = ReduceOp::combine(m_root->m_value, value);
+  }
+
+  static bool inParallel()
+  {
+#ifdef AXOM_USE_OPENMP
+    return omp_in_parallel() != 0;
+#else
+    return false;
+#endif
+  }
+
+  static int level()
+  {
+#ifdef AXOM_USE_OPENMP
+    return omp_get_level();
+#else
+    return 0;
+#endif
+  }
+
+  mutable T m_value;
+  CpuReducer* m_root;
+  int m_level;  // level of the parallel region of a thread-private copy
+  mutable bool m_dirty;
+};
+
+} /* namespace internal */
+
+/*!
+ * \brief Sum reducer for the given execution space.
+ */
+template <typename ExecSpace, typename T>
+class ReduceSum : public internal::CpuReducer<T, internal::sum_op<T>>
+{
+  AXOM_STATIC_ASSERT(!execution_space<ExecSpace>::onDevice());
+  using Base = internal::CpuReducer<T, internal::sum_op<T>>;
+
+public:
+  explicit ReduceSum(T init = T(0)) : Base(init) { }
+
+  const ReduceSum& operator+=(const T& value) const
+  {
+    this->combine(value);
+    return *this;
+  }
+};
+
+/*!
+ * \brief Min reducer for the given execution space.
+ */
+template <typename ExecSpace, typename T>
+class ReduceMin : public internal::CpuReducer<T, internal::min_op<T>>
+{
+  AXOM_STATIC_ASSERT(!execution_space<ExecSpace>::onDevice());
+  using Base = internal::CpuReducer<T, internal::min_op<T>>;
+
+public:
+  explicit ReduceMin(T init = internal::min_op<T>::identity()) : Base(init)
+  { }
+
+  const ReduceMin& min(const T& value) const
+  {
+    this->combine(value);
+    return *this;
+  }
+};
+
+/*!
+ * \brief Max reducer for the given execution space.
+ */
+template <typename ExecSpace, typename T>
+class ReduceMax : public internal::CpuReducer<T, internal::max_op<T>>
+{
+  AXOM_STATIC_ASSERT(!execution_space<ExecSpace>::onDevice());
+  using Base = internal::CpuReducer<T, internal::max_op<T>>;
+
+public:
+  explicit ReduceMax(T init = internal::max_op<T>::identity()) : Base(init)
+  { }
+
+  const ReduceMax& max(const T& value) const
+  {
+    this->combine(value);
+    return *this;
+  }
+};
+
+#endif /* AXOM_USE_RAJA */
+
+#ifndef AXOM_USE_RAJA
+namespace internal
+{
+/*!
+ * \brief Minimum number of entries per thread for which the parallel sum is
+ *  used. Shorter arrays are summed serially.
+ */
+constexpr IndexType MIN_PARALLEL_REDUCE_SIZE = 1 << 14;
+
+/*!
+ * \brief Returns init plus the sum of input[0..N-1].
+ *
+ *  The OpenMP sum splits the array in one block per thread and adds the sums
+ *  of the blocks in order, so that the result only depends on the number of
+ *  threads.
+ */
+template <typename ExecSpace, typename T>
+inline T cpu_reduce(const T* input, IndexType N, T init)
+{
+  AXOM_STATIC_ASSERT(!execution_space<ExecSpace>::onDevice());
+
+  int nthreads = 1;
+  #ifdef AXOM_USE_OPENMP
+  if(!std::is_same<ExecSpace, SEQ_EXEC>::value)
+  {
+    nthreads = omp_get_max_threads();
+  }
+  #endif
+
+  if(nthreads == 1 || N < nthreads * MIN_PARALLEL_REDUCE_SIZE)
+  {
+    T sum = init;
+    for(IndexType i = 0; i < N; ++i)
+    {
+      sum += input[i];
+    }
+    return sum;
+  }
+
+  std::vector<T> block_sums(nthreads, T(0));
+
+  #ifdef AXOM_USE_OPENMP
+    #pragma omp parallel num_threads(nthreads)
+  #endif
+  {
+    int tid = 0;
+    int nt = 1;
+  #ifdef AXOM_USE_OPENMP
+    tid = omp_get_thread_num();
+    nt = omp_get_num_threads();
+  #endif
+
+    const IndexType begin = (N * tid) / nt;
+    const IndexType end = (N * (tid + 1)) / nt;
+
+    T sum = T(0);
+    for(IndexType i = begin; i < end; ++i)
+    {
+      sum += input[i];
+    }
+    block_sums[tid] = sum;
+  }
+
+  T sum = init;
+  for(int t = 0; t < nthreads; ++t)
+  {
+    sum += block_sums[t];
+  }
+  return sum;
+}
+
+}  // namespace internal
+#endif
+
+/*!
+ * \brief Computes the sum of an array.
+ *
+ * \param [in] input pointer to the array of length N.
+ * \param [in] N the length of the array.
+ * \param [in] init the value the sum starts from (optional).
+ *
+ * \return init plus the sum of input[ 0 ], ..., input[ N-1 ].
+ *
+ * \tparam ExecSpace the execution space where to run the reduction.
+ *
+ * \pre input != nullptr
+ */
+template <typename ExecSpace, typename T>
+inline T reduce(const T* input, IndexType N, T init = T(0))
+{
+  AXOM_STATIC_ASSERT(execution_space<ExecSpace>::valid());
+
+#ifdef AXOM_USE_RAJA
+  ReduceSum<ExecSpace, T> sum(init);
+  for_all<ExecSpace>(N, AXOM_LAMBDA(IndexType i) { sum += input[i]; });
+  return static_cast<T>(sum.get());
+#else
+  return internal::cpu_reduce<ExecSpace>(input, N, init);
+#endif
+}
+
+} /* namespace axom */
+
+#endif /* AXOM_CORE_EXECUTION_REDUCTIONS_HPP_ */
@@ -0,0 +1,184 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_CORE_EXECUTION_SCAN_HPP_
+#define AXOM_CORE_EXECUTION_SCAN_HPP_
+
+#include "axom/config.hpp"                         /* compile time defs */
+#include "axom/core/execution/execution_space.hpp" /* execution_space traits */
+#include "axom/core/Macros.hpp"                    /* for axom Macros */
+#include "axom/core/Types.hpp"                     /* for axom::IndexType */
+
+// RAJA includes
+#ifdef AXOM_USE_RAJA
+  #include "RAJA/RAJA.hpp"
+#endif
+
+// C/C++ includes
+#include <type_traits>  // for std::is_same
+#include <vector>       // for std::vector
+
+#ifdef AXOM_USE_OPENMP
+  #include <omp.h>  // for omp_get_max_threads(), omp_get_thread_num()
+#endif
+
+namespace axom
+{
+#ifndef AXOM_USE_RAJA
+namespace internal
+{
+/*!
+ * \brief Minimum number of entries per thread for which the parallel scan
+ *  is used. Shorter arrays are scanned serially.
+ */
+constexpr IndexType MIN_PARALLEL_SCAN_SIZE = 1 << 14;
+
+/*!
+ * \brief Computes the scan of input[0..N-1] into output[0..N-1].
+ *
+ *  The OpenMP scan splits the array in one block per thread. Each thread
+ *  sums its block, the block sums are scanned serially, and each thread
+ *  scans its block starting from the sum of the blocks before it.
+ *
+ * \tparam INCLUSIVE if true, output[i] includes input[i].
+ */
+template <bool INCLUSIVE, typename ExecSpace, typename T>
+inline void cpu_scan(const T* input, T* output, IndexType N)
+{
+  AXOM_STATIC_ASSERT(!execution_space<ExecSpace>::onDevice());
+
+  int nthreads = 1;
+  #ifdef AXOM_USE_OPENMP
+  if(!std::is_same<ExecSpace, SEQ_EXEC>::value)
+  {
+    nthreads = omp_get_max_threads();
+  }
+  #endif
+
+  if(nthreads == 1 || N < nthreads * MIN_PARALLEL_SCAN_SIZE)
+  {
+    T sum = T(0);
+    for(IndexType i = 0; i < N; ++i)
+    {
+      const T value = input[i];
+      output[i] = INCLUSIVE ? sum + value : sum;
+      sum += value;
+    }
+    return;
+  }
+
+  // block_sums[ t+1 ] holds the sum of the block of thread t
+  std::vector<T> block_sums(nthreads + 1, T(0));
+
+  #ifdef AXOM_USE_OPENMP
+    #pragma omp parallel num_threads(nthreads)
+  #endif
+  {
+    int tid = 0;
+    int nt = 1;
+  #ifdef AXOM_USE_OPENMP
+    tid = omp_get_thread_num();
+    nt = omp_get_num_threads();
+  #endif
+
+    const IndexType begin = (N * tid) / nt;
+    const IndexType end = (N * (tid + 1)) / nt;
+
+    T sum = T(0);
+    for(IndexType i = begin; i < end; ++i)
+    {
+      sum += input[i];
+    }
+    block_sums[tid + 1] = sum;
+
+  #ifdef AXOM_USE_OPENMP
+    #pragma omp barrier
+    #pragma omp single
+  #endif
+    {
+      for(int t = 1; t <= nt; ++t)
+      {
+        block_sums[t] += block_sums[t - 1];
+      }
+    }  // implicit barrier
+
+    sum = block_sums[tid];
+    for(IndexType i = begin; i < end; ++i)
+    {
+      const T value = input[i];
+      output[i] = INCLUSIVE ? sum + value : sum;
+      sum += value;
+    }
+  }
+}
+
+}  // namespace internal
+#endif
+
+/*!
+ * \brief Computes the exclusive prefix sum of an array.
+ *
+ * \param [in] input pointer to the array of length N.
+ * \param [out] output pointer to the result, of length N.
+ * \param [in] N the length of the arrays.
+ *
+ * \tparam ExecSpace the execution space where to run the scan.
+ *
+ * \note On output, output[ 0 ] = 0 and output[ i ] is the sum of
+ *  input[ 0 ], ..., input[ i-1 ]. The input and output may be the same array.
+ *
+ * \pre input != nullptr
+ * \pre output != nullptr
+ */
+template <typename ExecSpace, typename T>
+inline void exclusive_scan(const T* input, T* output, IndexType N)
+{
+  AXOM_STATIC_ASSERT(execution_space<ExecSpace>::valid());
+
+#ifdef AXOM_USE_RAJA
+  using loop_policy = typename execution_space<ExecSpace>::loop_policy;
+  RAJA::exclusive_scan<loop_policy>(input,
+                                    input + N,
+                                    output,
+                                    RAJA::operators::plus<T> {});
+#else
+  internal::cpu_scan<false, ExecSpace>(input, output, N);
+#endif
+}
+
+/*!
+ * \brief Computes the inclusive prefix sum of an array.
+ *
+ * \param [in] input pointer to the array of length N.
+ * \param [out] output pointer to the result, of length N.
+ * \param [in] N the length of the arrays.
+ *
+ * \tparam ExecSpace the execution space where to run the scan.
+ *
+ * \note On output, output[ i ] is the sum of input[ 0 ], ..., input[ i ].
+ *  The input and output may be the same array.
+ *
+ * \pre input != nullptr
+ * \pre output != nullptr
+ */
+template <typename ExecSpace, typename T>
+inline void inclusive_scan(const T* input, T* output, IndexType N)
+{
+  AXOM_STATIC_ASSERT(execution_space<ExecSpace>::valid());
+
+#ifdef AXOM_USE_RAJA
+  using loop_policy = typename execution_space<ExecSpace>::loop_policy;
+  RAJA::inclusive_scan<loop_policy>(input,
+                                    input + N,
+                                    output,
+                                    RAJA::operators::plus<T> {});
+#else
+  internal::cpu_scan<true, ExecSpace>(input, output, N);
+#endif
+}
+
+} /* namespace axom */
+
+#endif /* AXOM_CORE_EXECUTION_SCAN_HPP_ */
@@ -0,0 +1,508 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_CORE_EXECUTION_SORT_HPP_
+#define AXOM_CORE_EXECUTION_SORT_HPP_
+
+#include "axom/config.hpp"                         /* compile time defs */
+#include "axom/core/execution/execution_space.hpp" /* execution_space traits */
+#include "axom/core/execution/for_all.hpp"         /* for_all() */
+#include "axom/core/execution/scan.hpp"            /* exclusive_scan() */
+#include "axom/core/Macros.hpp"                    /* for axom Macros */
+#include "axom/core/memory_management.hpp"         /* allocate/deallocate */
+#include "axom/core/Types.hpp"                     /* for axom::IndexType */
+
+// RAJA includes
+#ifdef AXOM_USE_RAJA
+  #include "RAJA/RAJA.hpp"
+#endif
+
+// C/C++ includes
+#include <cstdint>      // for std::uint8_t, ..., std::uint64_t
+#include <cstring>      // for std::memcpy
+#include <type_traits>  // for std::is_arithmetic, std::is_same
+#include <utility>      // for std::swap
+#include <vector>       // for std::vector
+
+#ifdef AXOM_USE_OPENMP
+  #include <omp.h>  // for omp_get_max_threads(), omp_get_thread_num()
+#endif
+
+#if defined(AXOM_USE_RAJA) &&    \
+  ((RAJA_VERSION_MAJOR > 0) ||   \
+   ((RAJA_VERSION_MAJOR == 0) && (RAJA_VERSION_MINOR >= 12)))
+  #define AXOM_SORT_USE_RAJA
+#endif
+
+/*!
+ * \file
+ *
+ * \brief Defines the radix_sort(), sort_pairs() and unique() primitives.
+ *
+ *  When Axom is built with RAJA v0.12 or later, the sorts are the RAJA sorts
+ *  of the loop_policy of the execution space. Otherwise, they are a least
+ *  significant digit radix sort, which is parallel with OpenMP for the
+ *  OMP_EXEC execution space.
+ */
+
+namespace axom
+{
+namespace internal
+{
+/*!
+ * \brief Minimum number of entries per thread for which the parallel radix
+ *  sort and unique are used. Shorter arrays are processed serially.
+ */
+constexpr IndexType MIN_PARALLEL_SORT_SIZE = 1 << 14;
+
+/// \name Radix Sort Keys
+/// @{
+
+template <int NBYTES>
+struct unsigned_of_size;
+
+template <>
+struct unsigned_of_size<1>
+{
+  using type = std::uint8_t;
+};
+
+template <>
+struct unsigned_of_size<2>
+{
+  using type = std::uint16_t;
+};
+
+template <>
+struct unsigned_of_size<4>
+{
+  using type = std::uint32_t;
+};
+
+template <>
+struct unsigned_of_size<8>
+{
+  using type = std::uint64_t;
+};
+
+/*!
+ * \brief Maps the keys of a radix sort to unsigned integers that have the
+ *  same order as the keys.
+ *
+ *  The sign bit of signed integers is flipped. The bits of negative floating
+ *  point numbers are all flipped, and the sign bit of positive ones.
+ */
+template <typename KeyType,
+          bool IS_FLOAT = std::is_floating_point<KeyType>::value,
+          bool IS_SIGNED = std::is_signed<KeyType>::value>
+struct radix_key
+{
+  using type = typename unsigned_of_size<sizeof(KeyType)>::type;
+
+  static type bits(const KeyType& key) { return static_cast<type>(key); }
+};
+
+template <typename KeyType>
+struct radix_key<KeyType, false, true>
+{
+  using type = typename unsigned_of_size<sizeof(KeyType)>::type;
+  static constexpr type SIGN_BIT = type(1) << (8 * sizeof(KeyType) - 1);
+
+  static type bits(const KeyType& key)
+  {
+    return static_cast<type>(key) ^ SIGN_BIT;
+  }
+};
+
+template <typename KeyType>
+struct radix_key<KeyType, true, true>
+{
+  using type = typename unsigned_of_size<sizeof(KeyType)>::type;
+  static constexpr type SIGN_BIT = type(1) << (8 * sizeof(KeyType) - 1);
+
+  static type bits(const KeyType& key)
+  {
+    type b;
+    std::memcpy(&b, &key, sizeof(KeyType));
+    return (b & SIGN_BIT) ? type(~b) : type(b | SIGN_BIT);
+  }
+};
+
+/// @}
+
+/*!
+ * \brief Returns the number of threads to use for a loop of length N on the
+ *  CPU in the given execution space.
+ */
+template <typename ExecSpace>
+inline int cpu_sort_threads(IndexType N)
+{
+  int nthreads = 1;
+#ifdef AXOM_USE_OPENMP
+  if(!std::is_same<ExecSpace, SEQ_EXEC>::value)
+  {
+    nthreads = omp_get_max_threads();
+  }
+#endif
+  return (N < nthreads * MIN_PARALLEL_SORT_SIZE) ? 1 : nthreads;
+}
+
+/*!
+ * \brief Stable least significant digit radix sort of keys[0..N-1], with
+ *  8-bit digits, that also reorders values[0..N-1] if HAS_VALUES is true.
+ *
+ *  The array is split in one block per thread. For each digit, each thread
+ *  counts the digits of its block, the counts are scanned serially in
+ *  (digit, thread) order, and each thread scatters its block to the offsets
+ *  of its digits. Digits that are the same for all the keys are skipped.
+ */
+template <bool HAS_VALUES,
+          typename ExecSpace,
+          typename KeyType,
+          typename ValueType>
+inline void cpu_radix_sort(KeyType* keys, ValueType* values, IndexType N)
+{
+  AXOM_STATIC_ASSERT(!execution_space<ExecSpace>::onDevice());
+  AXOM_STATIC_ASSERT_MSG(std::is_arithmetic<KeyType>::value,
+                         "radix sort keys must be integers or floating point");
+
+  constexpr int RADIX = 256;
+  constexpr int NUM_DIGITS = sizeof(KeyType);
+
+  if(N < 2)
+  {
+    return;
+  }
+
+  const int nthreads = cpu_sort_threads<ExecSpace>(N);
+  const int allocatorID = execution_space<ExecSpace>::allocatorID();
+
+  KeyType* key_buffer = axom::allocate<KeyType>(N, allocatorID);
+  ValueType* value_buffer =
+    HAS_VALUES ? axom::allocate<ValueType>(N, allocatorID) : nullptr;
+
+  // offsets[ t*RADIX + d ] holds the count, then the scatter offset, of
+  // digit d in the block of thread t
+  std::vector<IndexType> offsets(nthreads * RADIX);
+  bool skip_digit = false;
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel num_threads(nthreads)
+#endif
+  {
+    int tid = 0;
+    int nt = 1;
+#ifdef AXOM_USE_OPENMP
+    tid = omp_get_thread_num();
+    nt = omp_get_num_threads();
+#endif
+
+    const IndexType begin = (N * tid) / nt;
+    const IndexType end = (N * (tid + 1)) / nt;
+    IndexType* counts = &offsets[tid * RADIX];
+
+    KeyType* src_keys = keys;
+    KeyType* dst_keys = key_buffer;
+    ValueType* src_values = values;
+    ValueType* dst_values = value_buffer;
+
+    for(int digit = 0; digit < NUM_DIGITS; ++digit)
+    {
+      const int shift = 8 * digit;
+
+      for(int d = 0; d < RADIX; ++d)
+      {
+        counts[d] = 0;
+      }
+      for(IndexType i = begin; i < end; ++i)
+      {
+        ++counts[(radix_key<KeyType>::bits(src_keys[i]) >> shift) & 0xFF];
+      }
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp barrier
+  #pragma omp single
+#endif
+      {
+        IndexType sum = 0;
+        skip_digit = false;
+        for(int d = 0; d < RADIX; ++d)
+        {
+          const IndexType start = sum;
+          for(int t = 0; t < nt; ++t)
+          {
+            const IndexType count = offsets[t * RADIX + d];
+            offsets[t * RADIX + d] = sum;
+            sum += count;
+          }
+          skip_digit = skip_digit || (sum - start == N);
+        }
+      }  // implicit barrier
+
+      if(skip_digit)
+      {
+        continue;
+      }
+
+      for(IndexType i = begin; i < end; ++i)
+      {
+        const int d = (radix_key<KeyType>::bits(src_keys[i]) >> shift) & 0xFF;
+        const IndexType pos = counts[d]++;
+        dst_keys[pos] = src_keys[i];
+        if(HAS_VALUES)
+        {
+          dst_values[pos] = src_values[i];
+        }
+      }
+
+      std::swap(src_keys, dst_keys);
+      std::swap(src_values, dst_values);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp barrier
+#endif
+    }
+
+    // copy back if the result is in the buffers
+    if(src_keys != keys)
+    {
+      for(IndexType i = begin; i < end; ++i)
+      {
+        keys[i] = src_keys[i];
+        if(HAS_VALUES)
+        {
+          values[i] = src_values[i];
+        }
+      }
+    }
+  }
+
+  axom::deallocate(key_buffer);
+  if(HAS_VALUES)
+  {
+    axom::deallocate(value_buffer);
+  }
+}
+
+/*!
+ * \brief Serial version of cpu_unique().
+ *
+ *  This is a separate function, since the arguments that cpu_unique() shares
+ *  with its parallel region may alias the output, which slows down the loop.
+ */
+template <typename T>
+inline IndexType serial_unique(const T* input, IndexType N, T* output)
+{
+  IndexType count = 0;
+  for(IndexType i = 0; i < N; ++i)
+  {
+    if(i == 0 || !(input[i] == input[i - 1]))
+    {
+      output[count++] = input[i];
+    }
+  }
+  return count;
+}
+
+/*!
+ * \brief Copies the first entry of each run of equal entries of
+ *  input[0..N-1] to output and returns their number.
+ *
+ *  Each thread counts the runs that start in its block, the counts are
+ *  scanned serially, and each thread copies its entries to the offset of
+ *  its block.
+ */
+template <typename ExecSpace, typename T>
+inline IndexType cpu_unique(const T* input, IndexType N, T* output)
+{
+  AXOM_STATIC_ASSERT(!execution_space<ExecSpace>::onDevice());
+
+  const int nthreads = cpu_sort_threads<ExecSpace>(N);
+
+  if(nthreads == 1)
+  {
+    return serial_unique(input, N, output);
+  }
+
+  // block_counts[ t+1 ] holds the number of runs starting in block t
+  std::vector<IndexType> block_counts(nthreads + 1, 0);
+
+  // the team may have fewer than nthreads threads, e.g., in a nested region
+  int team_size = 1;
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel num_threads(nthreads)
+#endif
+  {
+    int tid = 0;
+    int nt = 1;
+#ifdef AXOM_USE_OPENMP
+    tid = omp_get_thread_num();
+    nt = omp_get_num_threads();
+#endif
+
+    const IndexType begin = (N * tid) / nt;
+    const IndexType end = (N * (tid + 1)) / nt;
+
+    IndexType count = 0;
+    for(IndexType i = begin; i < end; ++i)
+    {
+      count += (i == 0 || !(input[i] == input[i - 1])) ? 1 : 0;
+    }
+    block_counts[tid + 1] = count;
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp barrier
+  #pragma omp single
+#endif
+    {
+      for(int t = 1; t <= nt; ++t)
+      {
+        block_counts[t] += block_counts[t - 1];
+      }
+      team_size = nt;
+    }  // implicit barrier
+
+    IndexType pos = block_counts[tid];
+    for(IndexType i = begin; i < end; ++i)
+    {
+      if(i == 0 || !(input[i] == input[i - 1]))
+      {
+        output[pos++] = input[i];
+      }
+    }
+  }
+
+  return block_counts[team_size];
+}
+
+}  // namespace internal
+
+/*!
+ * \brief Sorts an array of integer or floating point keys.
+ *
+ * \param [in,out] keys pointer to the array of length N.
+ * \param [in] N the length of the array.
+ *
+ * \tparam ExecSpace the execution space where to run the sort.
+ *
+ * \note Without RAJA, floating point keys are ordered by their bits, so that
+ *  -0.0 comes before 0.0 and NaNs come first or last according to their sign.
+ *
+ * \pre keys != nullptr
+ */
+template <typename ExecSpace, typename KeyType>
+inline void radix_sort(KeyType* keys, IndexType N)
+{
+  AXOM_STATIC_ASSERT(execution_space<ExecSpace>::valid());
+
+#ifdef AXOM_SORT_USE_RAJA
+  using loop_policy = typename execution_space<ExecSpace>::loop_policy;
+  RAJA::sort<loop_policy>(keys, keys + N);
+#else
+  char* no_values = nullptr;
+  internal::cpu_radix_sort<false, ExecSpace>(keys, no_values, N);
+#endif
+}
+
+/*!
+ * \brief Sorts an array of values by an array of integer or floating point
+ *  keys.
+ *
+ * \param [in,out] keys pointer to the array of keys, of length N.
+ * \param [in,out] values pointer to the array of values, of length N.
+ * \param [in] N the length of the arrays.
+ *
+ * \tparam ExecSpace the execution space where to run the sort.
+ *
+ * \note The sort is stable, i.e., values with equal keys keep their order.
+ *  Floating point keys are ordered as in radix_sort().
+ *
+ * \pre keys != nullptr
+ * \pre values != nullptr
+ * \pre ValueType is trivially copyable
+ */
+template <typename ExecSpace, typename KeyType, typename ValueType>
+inline void sort_pairs(KeyType* keys, ValueType* values, IndexType N)
+{
+  AXOM_STATIC_ASSERT(execution_space<ExecSpace>::valid());
+
+#ifdef AXOM_SORT_USE_RAJA
+  using loop_policy = typename execution_space<ExecSpace>::loop_policy;
+  RAJA::stable_sort_pairs<loop_policy>(keys, keys + N, values);
+#else
+  internal::cpu_radix_sort<true, ExecSpace>(keys, values, N);
+#endif
+}
+
+/*!
+ * \brief Copies the distinct entries of a sorted array to another array.
+ *
+ * \param [in] input pointer to the sorted array of length N.
+ * \param [in] N the length of the input array.
+ * \param [out] output pointer to an array of length at least N.
+ *
+ * \return the number of distinct entries, which are at the front of output.
+ *
+ * \tparam ExecSpace the execution space where to run the kernel.
+ *
+ * \note Only consecutive entries are compared, with operator==, so if the
+ *  input is not sorted, the first entry of each run of equal entries is
+ *  copied.
+ *
+ * \pre input != nullptr
+ * \pre output != nullptr and does not overlap input
+ */
+template <typename ExecSpace, typename T>
+inline IndexType unique(const T* input, IndexType N, T* output)
+{
+  AXOM_STATIC_ASSERT(execution_space<ExecSpace>::valid());
+
+#ifdef AXOM_USE_RAJA
+  if(N <= 0)
+  {
+    return 0;
+  }
+
+  const int allocatorID = execution_space<ExecSpace>::allocatorID();
+  IndexType* flags = axom::allocate<IndexType>(N, allocatorID);
+  IndexType* offsets = axom::allocate<IndexType>(N, allocatorID);
+
+  for_all<ExecSpace>(
+    N,
+    AXOM_LAMBDA(IndexType i) {
+      flags[i] = (i == 0 || !(input[i] == input[i - 1])) ? 1 : 0;
+    });
+
+  exclusive_scan<ExecSpace>(flags, offsets, N);
+
+  for_all<ExecSpace>(
+    N,
+    AXOM_LAMBDA(IndexType i) {
+      if(flags[i] != 0)
+      {
+        output[offsets[i]] = input[i];
+      }
+    });
+
+  IndexType last_flag = 0;
+  IndexType last_offset = 0;
+  axom::copy(&last_flag, flags + N - 1, sizeof(IndexType));
+  axom::copy(&last_offset, offsets + N - 1, sizeof(IndexType));
+
+  axom::deallocate(flags);
+  axom::deallocate(offsets);
+
+  return last_offset + last_flag;
+#else
+  return internal::cpu_unique<ExecSpace>(input, N, output);
+#endif
+}
+
+} /* namespace axom */
+
+#undef AXOM_SORT_USE_RAJA
+
+#endif /* AXOM_CORE_EXECUTION_SORT_HPP_ */
@@ -0,0 +1,122 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_MEMORY_ALLOCATOR_HPP_
+#define AXOM_MEMORY_ALLOCATOR_HPP_
+
+#include "axom/core/Macros.hpp"  // for axom macros
+
+// C/C++ includes
+#include <algorithm>  // for std::min
+#include <cstddef>    // for std::size_t, std::max_align_t
+#include <cstdlib>    // for std::malloc, std::realloc, std::free
+#include <cstring>    // for std::memcpy
+
+namespace axom
+{
+namespace memory
+{
+/*!
+ * \brief The alignment, in bytes, of the blocks returned by an Allocator.
+ */
+constexpr std::size_t ALIGNMENT = alignof(std::max_align_t);
+
+/*!
+ * \class Allocator
+ *
+ * \brief Allocator is the base class of the host memory allocators that
+ *  axom::allocate() dispatches to by allocator ID when Axom is not compiled
+ *  with Umpire.
+ *
+ *  An Allocator hands out raw blocks of host memory. The size of a block is
+ *  passed back to deallocate(), so an Allocator does not need to record it.
+ *  Allocators are registered with axom::memory::registerAllocator() or
+ *  axom::memory::makeAllocator(), which return the ID to pass to
+ *  axom::allocate().
+ *
+ * \see registry.hpp
+ */
+class Allocator
+{
+public:
+  Allocator() = default;
+
+  /*!
+   * \brief Destructor.
+   */
+  virtual ~Allocator() = default;
+
+  /*!
+   * \brief Returns a block of at least the given number of bytes, aligned to
+   *  memory::ALIGNMENT, or nullptr if the allocation failed.
+   */
+  virtual void* allocate(std::size_t bytes) = 0;
+
+  /*!
+   * \brief Returns a block obtained from this allocator.
+   *
+   * \param [in] ptr pointer to the block
+   * \param [in] bytes the size of the block, as passed to allocate()
+   */
+  virtual void deallocate(void* ptr, std::size_t bytes) = 0;
+
+  /*!
+   * \brief Resizes a block obtained from this allocator, preserving its
+   *  contents up to the smaller of the two sizes.
+   *
+   *  The default implementation allocates a new block, copies the contents and
+   *  deallocates the old block.
+   *
+   * \return p pointer to the resized block or nullptr if the allocation
+   *  failed, in which case the old block is left untouched.
+   */
+  virtual void* reallocate(void* ptr,
+                           std::size_t oldBytes,
+                           std::size_t newBytes)
+  {
+    void* newPtr = allocate(newBytes);
+    if(newPtr != nullptr)
+    {
+      std::memcpy(newPtr, ptr, std::min(oldBytes, newBytes));
+      deallocate(ptr, oldBytes);
+    }
+    return newPtr;
+  }
+
+private:
+  DISABLE_COPY_AND_ASSIGNMENT(Allocator);
+  DISABLE_MOVE_AND_ASSIGNMENT(Allocator);
+};
+
+/*!
+ * \class MallocAllocator
+ *
+ * \brief Allocates from the system heap with std::malloc() and std::free().
+ */
+class MallocAllocator : public Allocator
+{
+public:
+  MallocAllocator() = default;
+
+  void* allocate(std::size_t bytes) override { return std::malloc(bytes); }
+
+  void deallocate(void* ptr, std::size_t AXOM_NOT_USED(bytes)) override
+  {
+    std::free(ptr);
+  }
+
+  void* reallocate(void* ptr,
+                   std::size_t AXOM_NOT_USED(oldBytes),
+                   std::size_t newBytes) override
+  {
+    return std::realloc(ptr, newBytes);
+  }
+};
+
+} /* namespace memory */
+
+} /* namespace axom */
+
+#endif /* AXOM_MEMORY_ALLOCATOR_HPP_ */
@@ -0,0 +1,170 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/core/memory/ArenaAllocator.hpp"
+
+#ifndef AXOM_USE_UMPIRE
+  #include "axom/core/memory/registry.hpp"
+#endif
+
+// C/C++ includes
+#include <algorithm>  // for std::max
+#include <cassert>    // for assert()
+
+namespace axom
+{
+namespace memory
+{
+namespace
+{
+//------------------------------------------------------------------------------
+inline std::size_t round_up(std::size_t bytes)
+{
+  return (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+}  // namespace
+
+constexpr std::size_t ArenaAllocator::DEFAULT_CHUNK_BYTES;
+
+//------------------------------------------------------------------------------
+ArenaAllocator::ArenaAllocator(std::size_t chunkBytes)
+  : m_chunkBytes(round_up(std::max(chunkBytes, std::size_t(1))))
+  , m_current(0)
+  , m_offset(0)
+  , m_last(nullptr)
+{ }
+
+//------------------------------------------------------------------------------
+ArenaAllocator::~ArenaAllocator() { release(); }
+
+//------------------------------------------------------------------------------
+void* ArenaAllocator::allocate(std::size_t bytes)
+{
+  const std::size_t rounded = round_up(bytes);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if(m_current >= m_chunks.size() ||
+     m_offset + rounded > m_chunks[m_current].bytes)
+  {
+    // Move on to the next chunk that fits the block, or append one. Chunks
+    // that are skipped are reused after the arena is rewound.
+    std::size_t next = (m_current < m_chunks.size()) ? m_current + 1 : 0;
+    while(next < m_chunks.size() && m_chunks[next].bytes < rounded)
+    {
+      ++next;
+    }
+
+    if(next == m_chunks.size())
+    {
+      const std::size_t chunkBytes = std::max(m_chunkBytes, rounded);
+      char* data = static_cast<char*>(std::malloc(chunkBytes));
+      if(data == nullptr)
+      {
+        return nullptr;
+      }
+      m_chunks.push_back(Chunk {data, chunkBytes});
+    }
+
+    m_current = next;
+    m_offset = 0;
+  }
+
+  void* ptr = m_chunks[m_current].data + m_offset;
+  m_offset += rounded;
+  m_last = ptr;
+  return ptr;
+}
+
+//------------------------------------------------------------------------------
+void* ArenaAllocator::reallocate(void* ptr,
+                                 std::size_t oldBytes,
+                                 std::size_t newBytes)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(ptr == m_last)
+    {
+      const Chunk& chunk = m_chunks[m_current];
+      const std::size_t start = static_cast<char*>(ptr) - chunk.data;
+      const std::size_t rounded = round_up(newBytes);
+      if(start + rounded <= chunk.bytes)
+      {
+        m_offset = start + rounded;
+        return ptr;
+      }
+    }
+  }
+
+  return Allocator::reallocate(ptr, oldBytes, newBytes);
+}
+
+//------------------------------------------------------------------------------
+ArenaAllocator::Mark ArenaAllocator::getMark() const
+{
+  // Not locked, since no other thread may allocate meanwhile
+  return Mark {m_current, m_offset};
+}
+
+//------------------------------------------------------------------------------
+void ArenaAllocator::rewind(const Mark& mark)
+{
+  assert(mark.chunk < m_current ||
+         (mark.chunk == m_current && mark.offset <= m_offset));
+
+  m_current = mark.chunk;
+  m_offset = mark.offset;
+  m_last = nullptr;
+}
+
+//------------------------------------------------------------------------------
+void ArenaAllocator::release()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for(const Chunk& chunk : m_chunks)
+  {
+    std::free(chunk.data);
+  }
+  m_chunks.clear();
+  m_current = 0;
+  m_offset = 0;
+  m_last = nullptr;
+}
+
+//------------------------------------------------------------------------------
+std::size_t ArenaAllocator::getChunkBytes() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::size_t bytes = 0;
+  for(const Chunk& chunk : m_chunks)
+  {
+    bytes += chunk.bytes;
+  }
+  return bytes;
+}
+
+//------------------------------------------------------------------------------
+std::size_t ArenaAllocator::getUsedBytes() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::size_t bytes = 0;
+  for(std::size_t i = 0; i < m_current && i < m_chunks.size(); ++i)
+  {
+    bytes += m_chunks[i].bytes;
+  }
+  return bytes + m_offset;
+}
+
+#ifndef AXOM_USE_UMPIRE
+//------------------------------------------------------------------------------
+ArenaScope::ArenaScope(int allocatorID)
+  : ArenaScope(*dynamic_cast<ArenaAllocator*>(getAllocator(allocatorID)))
+{ }
+#endif
+
+} /* namespace memory */
+
+} /* namespace axom */
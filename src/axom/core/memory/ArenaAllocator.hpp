@@ -0,0 +1,189 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_MEMORY_ARENAALLOCATOR_HPP_
+#define AXOM_MEMORY_ARENAALLOCATOR_HPP_
+
+#include "axom/config.hpp"  // for compile-time definitions
+#include "axom/core/memory/Allocator.hpp"
+
+// C/C++ includes
+#include <mutex>   // for std::mutex
+#include <vector>  // for std::vector
+
+namespace axom
+{
+namespace memory
+{
+/*!
+ * \class ArenaAllocator
+ *
+ * \brief ArenaAllocator is a bump allocator that carves blocks from large
+ *  chunks in order and reclaims them all at once.
+ *
+ *  Deallocating a block is a no-op. The memory of all blocks is reclaimed by
+ *  reset(), or that of the blocks allocated after a given mark by rewind().
+ *  An ArenaScope rewinds the arena to where it was when the scope was entered,
+ *  which suits scratch memory that is allocated repeatedly within a function:
+ *
+ * \code
+ *   const int arenaID =
+ *     axom::memory::makeAllocator<axom::memory::ArenaAllocator>("scratch");
+ *   ...
+ *   {
+ *     axom::memory::ArenaScope scope(arenaID);
+ *     double* tmp = axom::allocate<double>(n, arenaID);
+ *     ...
+ *   }  // tmp is reclaimed here
+ * \endcode
+ *
+ *  Chunks are kept for reuse after a reset and only returned to the system by
+ *  release() or the destructor.
+ *
+ * \note Allocations are thread-safe, but getMark(), reset() and rewind(), and
+ *  thus ArenaScopes, must not be used while other threads allocate from the
+ *  arena.
+ */
+class ArenaAllocator : public Allocator
+{
+public:
+  static constexpr std::size_t DEFAULT_CHUNK_BYTES = 1 << 20;
+
+  /*!
+   * \brief A position in the arena, as returned by getMark().
+   */
+  struct Mark
+  {
+    std::size_t chunk;
+    std::size_t offset;
+  };
+
+  /*!
+   * \brief Constructor.
+   *
+   * \param [in] chunkBytes the size of the chunks that blocks are carved from.
+   *  Larger blocks get a chunk of their own.
+   */
+  explicit ArenaAllocator(std::size_t chunkBytes = DEFAULT_CHUNK_BYTES);
+
+  /*!
+   * \brief Destructor. Returns all chunks to the system.
+   */
+  ~ArenaAllocator() override;
+
+  void* allocate(std::size_t bytes) override;
+
+  /*!
+   * \brief Does nothing. The block is reclaimed by reset() or rewind().
+   */
+  void deallocate(void* AXOM_NOT_USED(ptr),
+                  std::size_t AXOM_NOT_USED(bytes)) override
+  { }
+
+  /*!
+   * \brief Resizes the given block, in place if it is the last block that was
+   *  allocated and its chunk has room.
+   */
+  void* reallocate(void* ptr,
+                   std::size_t oldBytes,
+                   std::size_t newBytes) override;
+
+  /*!
+   * \brief Returns the current position in the arena.
+   */
+  Mark getMark() const;
+
+  /*!
+   * \brief Reclaims all blocks allocated after the given mark was taken.
+   *
+   * \pre mark was returned by getMark() after the last reset() or release()
+   *  and no rewind() to an earlier mark has happened since.
+   */
+  void rewind(const Mark& mark);
+
+  /*!
+   * \brief Reclaims all blocks, keeping the chunks for reuse.
+   */
+  void reset() { rewind(Mark {0, 0}); }
+
+  /*!
+   * \brief Reclaims all blocks and returns the chunks to the system.
+   */
+  void release();
+
+  /*!
+   * \brief Returns the number of bytes of the chunks obtained from the system.
+   */
+  std::size_t getChunkBytes() const;
+
+  /*!
+   * \brief Returns the number of bytes in use, including the padding of blocks
+   *  and the unused tails of chunks that did not fit the next block.
+   */
+  std::size_t getUsedBytes() const;
+
+private:
+  struct Chunk
+  {
+    char* data;
+    std::size_t bytes;
+  };
+
+  std::size_t m_chunkBytes;
+  std::vector<Chunk> m_chunks;
+  std::size_t m_current;  // index of the chunk being carved
+  std::size_t m_offset;   // offset of the first free byte in that chunk
+  void* m_last;           // the last block, for reallocate() in place
+
+  mutable std::mutex m_mutex;
+};
+
+/*!
+ * \class ArenaScope
+ *
+ * \brief ArenaScope rewinds an ArenaAllocator to its position at construction
+ *  when it goes out of scope, reclaiming the blocks allocated meanwhile.
+ *
+ *  Scopes nest. The blocks allocated within a scope must not be used after it
+ *  ends.
+ */
+class ArenaScope
+{
+public:
+  /*!
+   * \brief Enters a scope of the given arena.
+   */
+  explicit ArenaScope(ArenaAllocator& arena)
+    : m_arena(arena)
+    , m_mark(arena.getMark())
+  { }
+
+#ifndef AXOM_USE_UMPIRE
+  /*!
+   * \brief Enters a scope of the arena with the given allocator ID.
+   *
+   * \pre allocatorID is the ID of a registered ArenaAllocator.
+   */
+  explicit ArenaScope(int allocatorID);
+#endif
+
+  /*!
+   * \brief Destructor. Rewinds the arena.
+   */
+  ~ArenaScope() { m_arena.rewind(m_mark); }
+
+private:
+  ArenaAllocator& m_arena;
+  ArenaAllocator::Mark m_mark;
+
+  DISABLE_COPY_AND_ASSIGNMENT(ArenaScope);
+  DISABLE_MOVE_AND_ASSIGNMENT(ArenaScope);
+};
+
+} /* namespace memory */
+
+} /* namespace axom */
+
+#endif /* AXOM_MEMORY_ARENAALLOCATOR_HPP_ */
@@ -0,0 +1,124 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/core/memory/HugePageAllocator.hpp"
+
+#ifdef __linux__
+  #include <sys/mman.h>  // for mmap(), munmap(), madvise()
+  #include <cstdint>     // for std::uintptr_t
+#endif
+
+namespace axom
+{
+namespace memory
+{
+namespace
+{
+//------------------------------------------------------------------------------
+inline std::size_t round_up_to_huge_page(std::size_t bytes)
+{
+  constexpr std::size_t PAGE = HugePageAllocator::HUGE_PAGE_BYTES;
+  return (bytes + PAGE - 1) / PAGE * PAGE;
+}
+
+}  // namespace
+
+constexpr std::size_t HugePageAllocator::HUGE_PAGE_BYTES;
+
+//------------------------------------------------------------------------------
+bool HugePageAllocator::isSupported()
+{
+#ifdef __linux__
+  return true;
+#else
+  return false;
+#endif
+}
+
+//------------------------------------------------------------------------------
+void* HugePageAllocator::allocate(std::size_t bytes)
+{
+  if(!isMapped(bytes))
+  {
+    return std::malloc(bytes);
+  }
+
+#ifdef __linux__
+  // Over-map by one huge page and trim the ends, so that the block starts on
+  // a huge page boundary
+  const std::size_t mapBytes = round_up_to_huge_page(bytes);
+  const std::size_t paddedBytes = mapBytes + HUGE_PAGE_BYTES;
+
+  void* region = mmap(nullptr,
+                      paddedBytes,
+                      PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS,
+                      -1,
+                      0);
+  if(region == MAP_FAILED)
+  {
+    return nullptr;
+  }
+
+  const std::uintptr_t start = reinterpret_cast<std::uintptr_t>(region);
+  const std::uintptr_t aligned =
+    (start + HUGE_PAGE_BYTES - 1) / HUGE_PAGE_BYTES * HUGE_PAGE_BYTES;
+  const std::size_t head = aligned - start;
+  const std::size_t tail = paddedBytes - head - mapBytes;
+  if(head > 0)
+  {
+    munmap(region, head);
+  }
+  if(tail > 0)
+  {
+    munmap(reinterpret_cast<char*>(aligned) + mapBytes, tail);
+  }
+
+  void* ptr = reinterpret_cast<void*>(aligned);
+  #ifdef MADV_HUGEPAGE
+  madvise(ptr, mapBytes, MADV_HUGEPAGE);
+  #endif
+  return ptr;
+#else
+  return nullptr;
+#endif
+}
+
+//------------------------------------------------------------------------------
+void HugePageAllocator::deallocate(void* ptr, std::size_t bytes)
+{
+  if(!isMapped(bytes))
+  {
+    std::free(ptr);
+    return;
+  }
+
+#ifdef __linux__
+  munmap(ptr, round_up_to_huge_page(bytes));
+#endif
+}
+
+//------------------------------------------------------------------------------
+void* HugePageAllocator::reallocate(void* ptr,
+                                    std::size_t oldBytes,
+                                    std::size_t newBytes)
+{
+  if(!isMapped(oldBytes) && !isMapped(newBytes))
+  {
+    return std::realloc(ptr, newBytes);
+  }
+
+  if(isMapped(oldBytes) && isMapped(newBytes) &&
+     round_up_to_huge_page(oldBytes) == round_up_to_huge_page(newBytes))
+  {
+    return ptr;
+  }
+
+  return Allocator::reallocate(ptr, oldBytes, newBytes);
+}
+
+} /* namespace memory */
+
+} /* namespace axom */
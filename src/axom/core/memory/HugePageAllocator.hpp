@@ -0,0 +1,70 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_MEMORY_HUGEPAGEALLOCATOR_HPP_
+#define AXOM_MEMORY_HUGEPAGEALLOCATOR_HPP_
+
+#include "axom/core/memory/Allocator.hpp"
+
+namespace axom
+{
+namespace memory
+{
+/*!
+ * \class HugePageAllocator
+ *
+ * \brief HugePageAllocator backs large blocks with huge pages, which reduces
+ *  TLB misses when large arrays are traversed.
+ *
+ *  Blocks of at least a threshold size are mapped directly from the operating
+ *  system, aligned to and rounded up to HUGE_PAGE_BYTES, and marked as
+ *  eligible for transparent huge pages. Smaller blocks go to std::malloc().
+ *
+ * \note Huge pages are only requested on Linux. Elsewhere, or if the kernel
+ *  does not provide transparent huge pages, the blocks are backed by regular
+ *  pages.
+ */
+class HugePageAllocator : public Allocator
+{
+public:
+  static constexpr std::size_t HUGE_PAGE_BYTES = 2 << 20;
+
+  /*!
+   * \brief Constructor.
+   *
+   * \param [in] thresholdBytes the size from which blocks are backed by huge
+   *  pages (optional)
+   */
+  explicit HugePageAllocator(std::size_t thresholdBytes = HUGE_PAGE_BYTES)
+    : m_thresholdBytes(thresholdBytes)
+  { }
+
+  void* allocate(std::size_t bytes) override;
+
+  void deallocate(void* ptr, std::size_t bytes) override;
+
+  void* reallocate(void* ptr,
+                   std::size_t oldBytes,
+                   std::size_t newBytes) override;
+
+  /*!
+   * \brief Checks if huge pages can be requested on this platform.
+   */
+  static bool isSupported();
+
+private:
+  bool isMapped(std::size_t bytes) const
+  {
+    return isSupported() && bytes >= m_thresholdBytes;
+  }
+
+  std::size_t m_thresholdBytes;
+};
+
+} /* namespace memory */
+
+} /* namespace axom */
+
+#endif /* AXOM_MEMORY_HUGEPAGEALLOCATOR_HPP_ */
@@ -0,0 +1,365 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/core/memory/PoolAllocator.hpp"
+
+// C/C++ includes
+#include <algorithm>  // for std::max, std::min
+
+namespace axom
+{
+namespace memory
+{
+namespace
+{
+using FreeList = PoolAllocator::FreeList;
+
+constexpr int NUM_SIZE_CLASSES = PoolAllocator::NUM_SIZE_CLASSES;
+constexpr int MAX_POOLS = PoolAllocator::MAX_THREAD_CACHED_POOLS;
+
+//------------------------------------------------------------------------------
+int floor_log2(std::size_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<int>(8 * sizeof(unsigned long long) - 1) -
+    __builtin_clzll(static_cast<unsigned long long>(value));
+#else
+  int result = 0;
+  while(value >>= 1)
+  {
+    ++result;
+  }
+  return result;
+#endif
+}
+
+/*!
+ * \brief The free lists of one pool, for one thread.
+ */
+struct ThreadLists
+{
+  FreeList lists[NUM_SIZE_CLASSES];
+
+  ThreadLists()
+  {
+    for(int c = 0; c < NUM_SIZE_CLASSES; ++c)
+    {
+      lists[c].limit = PoolAllocator::getThreadCacheLimit(c);
+    }
+  }
+};
+
+// The pools that use thread caches, by slot. A slot is never reused, so that a
+// cache found for a slot always belongs to the pool that was created in it.
+std::mutex s_pools_mutex;
+PoolAllocator* s_pools[MAX_POOLS] = {};
+std::atomic<int> s_num_slots(0);
+
+// The caches of a thread, by pool slot. This is trivially destructible, so
+// that accessing it is cheap.
+thread_local ThreadLists* t_caches[MAX_POOLS] = {};
+
+/*!
+ * \brief Returns the cached blocks of a thread to their pools when the thread
+ *  exits. Constructed when the thread creates its first cache.
+ */
+struct ThreadExitGuard
+{
+  bool armed = false;
+
+  ~ThreadExitGuard()
+  {
+    std::lock_guard<std::mutex> lock(s_pools_mutex);
+    for(int slot = 0; slot < MAX_POOLS; ++slot)
+    {
+      if(t_caches[slot] != nullptr && s_pools[slot] != nullptr)
+      {
+        for(int c = 0; c < NUM_SIZE_CLASSES; ++c)
+        {
+          FreeList& list = t_caches[slot]->lists[c];
+          s_pools[slot]->returnBlocks(list, c, list.count);
+        }
+      }
+      delete t_caches[slot];
+      t_caches[slot] = nullptr;
+    }
+  }
+};
+
+thread_local ThreadExitGuard t_exit_guard;
+
+}  // namespace
+
+constexpr std::size_t PoolAllocator::MAX_POOLED_BYTES;
+constexpr int PoolAllocator::NUM_SIZE_CLASSES;
+constexpr int PoolAllocator::MAX_THREAD_CACHED_POOLS;
+
+//------------------------------------------------------------------------------
+PoolAllocator::PoolAllocator(std::size_t slabBytes)
+  : m_minSlabBytes(slabBytes)
+  , m_slot(s_num_slots.fetch_add(1))
+  , m_slabBytes(0)
+{
+  if(m_slot < MAX_POOLS)
+  {
+    std::lock_guard<std::mutex> lock(s_pools_mutex);
+    s_pools[m_slot] = this;
+  }
+  else
+  {
+    m_slot = -1;
+  }
+}
+
+//------------------------------------------------------------------------------
+PoolAllocator::~PoolAllocator()
+{
+  if(m_slot >= 0)
+  {
+    std::lock_guard<std::mutex> lock(s_pools_mutex);
+    s_pools[m_slot] = nullptr;
+
+    // The caches of other threads are discarded when they exit
+    delete t_caches[m_slot];
+    t_caches[m_slot] = nullptr;
+  }
+
+  for(void* slab : m_slabs)
+  {
+    std::free(slab);
+  }
+}
+
+//------------------------------------------------------------------------------
+int PoolAllocator::getSizeClass(std::size_t bytes)
+{
+  if(bytes <= 32)
+  {
+    return (bytes <= 16) ? 0 : 1;
+  }
+  if(bytes > MAX_POOLED_BYTES)
+  {
+    return -1;
+  }
+
+  // bytes is in (2^p, 2^(p+1)], which is split at 2^p + 2^(p-1)
+  const int p = floor_log2(bytes - 1);
+  const std::size_t half = (std::size_t(3) << (p - 1));
+  return 2 + 2 * (p - 5) + ((bytes > half) ? 1 : 0);
+}
+
+//------------------------------------------------------------------------------
+std::size_t PoolAllocator::getClassBytes(int sizeClass)
+{
+  if(sizeClass < 2)
+  {
+    return 16 * (sizeClass + 1);
+  }
+
+  const int p = 5 + (sizeClass - 2) / 2;
+  return ((sizeClass % 2) == 0) ? (std::size_t(3) << (p - 1))
+                                : (std::size_t(1) << (p + 1));
+}
+
+//------------------------------------------------------------------------------
+int PoolAllocator::getThreadCacheLimit(int sizeClass)
+{
+  const std::size_t blocks = (64 * 1024) / getClassBytes(sizeClass);
+  return static_cast<int>(std::min(std::max(blocks, std::size_t(2)),
+                                   std::size_t(256)));
+}
+
+//------------------------------------------------------------------------------
+void* PoolAllocator::allocate(std::size_t bytes)
+{
+  const int sizeClass = getSizeClass(bytes);
+  if(sizeClass < 0)
+  {
+    return std::malloc(bytes);
+  }
+
+  FreeList* lists = getThreadLists();
+  if(lists == nullptr)
+  {
+    FreeList list;
+    list.limit = getThreadCacheLimit(sizeClass);
+    refill(list, sizeClass);
+    FreeBlock* block = list.head;
+    if(block != nullptr)
+    {
+      list.head = block->next;
+      --list.count;
+      returnBlocks(list, sizeClass, list.count);
+    }
+    return block;
+  }
+
+  FreeList& list = lists[sizeClass];
+  if(list.head == nullptr)
+  {
+    refill(list, sizeClass);
+    if(list.head == nullptr)
+    {
+      return nullptr;
+    }
+  }
+
+  FreeBlock* block = list.head;
+  list.head = block->next;
+  --list.count;
+  return block;
+}
+
+//------------------------------------------------------------------------------
+void PoolAllocator::deallocate(void* ptr, std::size_t bytes)
+{
+  const int sizeClass = getSizeClass(bytes);
+  if(sizeClass < 0)
+  {
+    std::free(ptr);
+    return;
+  }
+
+  FreeBlock* block = static_cast<FreeBlock*>(ptr);
+
+  FreeList* lists = getThreadLists();
+  if(lists == nullptr)
+  {
+    FreeList list;
+    block->next = nullptr;
+    list.head = block;
+    list.count = 1;
+    returnBlocks(list, sizeClass, 1);
+    return;
+  }
+
+  FreeList& list = lists[sizeClass];
+  block->next = list.head;
+  list.head = block;
+  ++list.count;
+
+  if(list.count > list.limit)
+  {
+    returnBlocks(list, sizeClass, list.count - list.limit / 2);
+  }
+}
+
+//------------------------------------------------------------------------------
+void PoolAllocator::returnBlocks(FreeList& list, int sizeClass, int count)
+{
+  if(count <= 0 || list.head == nullptr)
+  {
+    return;
+  }
+
+  // Detach the first count blocks
+  FreeBlock* first = list.head;
+  FreeBlock* last = first;
+  int moved = 1;
+  while(moved < count && last->next != nullptr)
+  {
+    last = last->next;
+    ++moved;
+  }
+  list.head = last->next;
+  list.count -= moved;
+
+  CentralList& central = m_central[sizeClass];
+  std::lock_guard<std::mutex> lock(central.mutex);
+  last->next = central.list.head;
+  central.list.head = first;
+  central.list.count += moved;
+}
+
+//------------------------------------------------------------------------------
+FreeList* PoolAllocator::getThreadLists()
+{
+  if(m_slot < 0)
+  {
+    return nullptr;
+  }
+
+  ThreadLists*& cache = t_caches[m_slot];
+  if(cache == nullptr)
+  {
+    t_exit_guard.armed = true;
+    cache = new ThreadLists;
+  }
+  return cache->lists;
+}
+
+//------------------------------------------------------------------------------
+void PoolAllocator::refill(FreeList& list, int sizeClass)
+{
+  const int batch = std::max(list.limit / 2, 1);
+
+  // Take a batch of blocks from the central list
+  {
+    CentralList& central = m_central[sizeClass];
+    std::lock_guard<std::mutex> lock(central.mutex);
+    while(list.count < batch && central.list.head != nullptr)
+    {
+      FreeBlock* block = central.list.head;
+      central.list.head = block->next;
+      --central.list.count;
+
+      block->next = list.head;
+      list.head = block;
+      ++list.count;
+    }
+  }
+
+  if(list.head != nullptr)
+  {
+    return;
+  }
+
+  // Carve a new slab. A batch of its blocks goes to the thread list and the
+  // rest to the central list.
+  const std::size_t blockBytes = getClassBytes(sizeClass);
+  const std::size_t numBlocks = std::max(m_minSlabBytes / blockBytes,
+                                         std::size_t(1));
+  char* slab = static_cast<char*>(std::malloc(numBlocks * blockBytes));
+  if(slab == nullptr)
+  {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_slabMutex);
+    m_slabs.push_back(slab);
+  }
+  m_slabBytes += numBlocks * blockBytes;
+
+  for(std::size_t i = numBlocks; i-- > 0;)
+  {
+    FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + i * blockBytes);
+    block->next = list.head;
+    list.head = block;
+    ++list.count;
+  }
+
+  if(list.count > batch)
+  {
+    // keep the first batch blocks, which are at the start of the slab
+    FreeBlock* last = list.head;
+    for(int i = 1; i < batch; ++i)
+    {
+      last = last->next;
+    }
+
+    FreeList rest;
+    rest.head = last->next;
+    rest.count = list.count - batch;
+    last->next = nullptr;
+    list.count = batch;
+
+    returnBlocks(rest, sizeClass, rest.count);
+  }
+}
+
+} /* namespace memory */
+
+} /* namespace axom */
@@ -0,0 +1,136 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_MEMORY_POOLALLOCATOR_HPP_
+#define AXOM_MEMORY_POOLALLOCATOR_HPP_
+
+#include "axom/core/memory/Allocator.hpp"
+
+// C/C++ includes
+#include <atomic>  // for std::atomic
+#include <mutex>   // for std::mutex
+#include <vector>  // for std::vector
+
+namespace axom
+{
+namespace memory
+{
+/*!
+ * \class PoolAllocator
+ *
+ * \brief PoolAllocator is a thread-caching pool of size classes, suited to
+ *  scratch buffers that are allocated and freed on every call of a function.
+ *
+ *  Requests of up to PoolAllocator::MAX_POOLED_BYTES are rounded up to one of
+ *  NUM_SIZE_CLASSES size classes, two per power of two. Each thread keeps a
+ *  short free list per size class, so most allocations and deallocations take
+ *  no lock. When a thread's list runs empty it takes a batch of blocks from a
+ *  central list per size class, which is refilled by carving new slabs from
+ *  the system heap, and when the list grows too long the thread returns half
+ *  of it to the central list. Larger requests go to std::malloc().
+ *
+ *  Slabs are only returned to the system when the PoolAllocator is destroyed.
+ *  A block freed on a different thread than the one it was allocated on is
+ *  cached by the freeing thread.
+ *
+ * \note Up to MAX_THREAD_CACHED_POOLS pools use thread caches. Pools created
+ *  beyond that take a lock on each allocation and deallocation.
+ *
+ * \pre A PoolAllocator must not be destroyed while other threads use it.
+ */
+class PoolAllocator : public Allocator
+{
+public:
+  static constexpr std::size_t MAX_POOLED_BYTES = 1 << 20;
+  static constexpr int NUM_SIZE_CLASSES = 32;
+  static constexpr int MAX_THREAD_CACHED_POOLS = 64;
+
+  /*!
+   * \brief Constructor.
+   *
+   * \param [in] slabBytes the minimum size of the slabs that blocks are
+   *  carved from (optional)
+   */
+  explicit PoolAllocator(std::size_t slabBytes = 64 * 1024);
+
+  /*!
+   * \brief Destructor. Returns all slabs to the system.
+   */
+  ~PoolAllocator() override;
+
+  void* allocate(std::size_t bytes) override;
+
+  void deallocate(void* ptr, std::size_t bytes) override;
+
+  /*!
+   * \brief Returns the number of bytes of the slabs obtained from the system.
+   */
+  std::size_t getSlabBytes() const { return m_slabBytes.load(); }
+
+  /*!
+   * \brief Returns the size class of a request of the given number of bytes,
+   *  or -1 if the request is larger than MAX_POOLED_BYTES.
+   */
+  static int getSizeClass(std::size_t bytes);
+
+  /*!
+   * \brief Returns the size in bytes of the blocks of the given size class.
+   */
+  static std::size_t getClassBytes(int sizeClass);
+
+  /*!
+   * \brief Returns the maximum number of free blocks of the given size class
+   *  that a thread caches.
+   */
+  static int getThreadCacheLimit(int sizeClass);
+
+  /// \name Internal structures, public for use by the thread caches
+  /// @{
+
+  struct FreeBlock
+  {
+    FreeBlock* next;
+  };
+
+  struct FreeList
+  {
+    FreeBlock* head = nullptr;
+    int count = 0;
+    int limit = 0; /*!< the thread cache limit of the list's size class */
+  };
+
+  /// @}
+
+  /*!
+   * \brief Moves the given number of blocks, or all of them, from the front of
+   *  the given thread list to the central list of the given size class.
+   */
+  void returnBlocks(FreeList& list, int sizeClass, int count);
+
+private:
+  struct CentralList
+  {
+    std::mutex mutex;
+    FreeList list;
+  };
+
+  FreeList* getThreadLists();
+  void refill(FreeList& list, int sizeClass);
+
+  std::size_t m_minSlabBytes;
+  int m_slot;
+
+  CentralList m_central[NUM_SIZE_CLASSES];
+
+  std::mutex m_slabMutex;
+  std::vector<void*> m_slabs;
+  std::atomic<std::size_t> m_slabBytes;
+};
+
+} /* namespace memory */
+
+} /* namespace axom */
+
+#endif /* AXOM_MEMORY_POOLALLOCATOR_HPP_ */
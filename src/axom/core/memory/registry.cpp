@@ -0,0 +1,258 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/core/memory/registry.hpp"
+
+#ifndef AXOM_USE_UMPIRE
+
+  #include "axom/core/memory_management.hpp"  // for INVALID_ALLOCATOR_ID
+
+  // C/C++ includes
+  #include <atomic>   // for std::atomic
+  #include <cstdint>  // for std::int32_t
+  #include <limits>   // for std::numeric_limits
+  #include <mutex>    // for std::mutex
+  #include <vector>   // for std::vector
+
+namespace axom
+{
+namespace memory
+{
+namespace
+{
+/*!
+ * \brief The header that precedes each allocation.
+ */
+struct alignas(ALIGNMENT) AllocationHeader
+{
+  std::size_t numbytes;     /*!< the size requested by the caller */
+  std::int32_t allocatorID; /*!< the allocator that owns the allocation */
+};
+
+constexpr std::size_t HEADER_BYTES = sizeof(AllocationHeader);
+
+AXOM_STATIC_ASSERT_MSG(HEADER_BYTES % ALIGNMENT == 0,
+                       "allocations must stay aligned after the header");
+
+// The allocators by ID. Slots are filled once and never cleared, so lookups
+// need no lock.
+std::atomic<Allocator*> s_allocators[MAX_ALLOCATORS] = {};
+std::atomic<int> s_default_id(MALLOC_ALLOCATOR_ID);
+
+/*!
+ * \brief The names of the allocators by ID, used for registration and lookup
+ *  by name only.
+ */
+struct Names
+{
+  std::mutex mutex;
+  std::vector<std::string> names {"MALLOC"};
+};
+
+//------------------------------------------------------------------------------
+Names& get_names()
+{
+  // Never destroyed, so that allocators can be used during static destruction
+  static Names* names = new Names;
+  return *names;
+}
+
+//------------------------------------------------------------------------------
+MallocAllocator& get_malloc_allocator()
+{
+  static MallocAllocator allocator;
+  return allocator;
+}
+
+//------------------------------------------------------------------------------
+inline AllocationHeader* get_header(const void* ptr)
+{
+  return reinterpret_cast<AllocationHeader*>(
+    const_cast<char*>(static_cast<const char*>(ptr)) - HEADER_BYTES);
+}
+
+//------------------------------------------------------------------------------
+inline void* get_data(void* block)
+{
+  return static_cast<char*>(block) + HEADER_BYTES;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+int registerAllocator(const std::string& name,
+                      std::unique_ptr<Allocator> allocator)
+{
+  if(allocator == nullptr)
+  {
+    return INVALID_ALLOCATOR_ID;
+  }
+
+  Names& names = get_names();
+  std::lock_guard<std::mutex> lock(names.mutex);
+
+  const int id = static_cast<int>(names.names.size());
+  if(id >= MAX_ALLOCATORS)
+  {
+    return INVALID_ALLOCATOR_ID;
+  }
+  for(const std::string& existing : names.names)
+  {
+    if(existing == name)
+    {
+      return INVALID_ALLOCATOR_ID;
+    }
+  }
+
+  names.names.push_back(name);
+  s_allocators[id].store(allocator.release(), std::memory_order_release);
+  return id;
+}
+
+//------------------------------------------------------------------------------
+Allocator* getAllocator(int allocatorID)
+{
+  if(allocatorID == MALLOC_ALLOCATOR_ID)
+  {
+    return &get_malloc_allocator();
+  }
+  if(allocatorID < 0 || allocatorID >= MAX_ALLOCATORS)
+  {
+    return nullptr;
+  }
+  return s_allocators[allocatorID].load(std::memory_order_acquire);
+}
+
+//------------------------------------------------------------------------------
+int getAllocatorID(const std::string& name)
+{
+  Names& names = get_names();
+  std::lock_guard<std::mutex> lock(names.mutex);
+  for(std::size_t id = 0; id < names.names.size(); ++id)
+  {
+    if(names.names[id] == name)
+    {
+      return static_cast<int>(id);
+    }
+  }
+  return INVALID_ALLOCATOR_ID;
+}
+
+//------------------------------------------------------------------------------
+int getPointerAllocatorID(const void* ptr)
+{
+  return get_header(ptr)->allocatorID;
+}
+
+namespace internal
+{
+//------------------------------------------------------------------------------
+void setDefaultAllocatorID(int allocatorID)
+{
+  if(getAllocator(allocatorID) != nullptr)
+  {
+    s_default_id.store(allocatorID, std::memory_order_relaxed);
+  }
+}
+
+//------------------------------------------------------------------------------
+int getDefaultAllocatorID()
+{
+  return s_default_id.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+void* allocate(std::size_t numbytes, int allocatorID) noexcept
+{
+  if(numbytes > std::numeric_limits<std::size_t>::max() - HEADER_BYTES)
+  {
+    return nullptr;
+  }
+  const std::size_t blockBytes = numbytes + HEADER_BYTES;
+
+  void* block = nullptr;
+  if(allocatorID == MALLOC_ALLOCATOR_ID)
+  {
+    block = std::malloc(blockBytes);
+  }
+  else
+  {
+    Allocator* allocator = getAllocator(allocatorID);
+    if(allocator == nullptr)
+    {
+      return nullptr;
+    }
+    block = allocator->allocate(blockBytes);
+  }
+
+  if(block == nullptr)
+  {
+    return nullptr;
+  }
+
+  AllocationHeader* header = static_cast<AllocationHeader*>(block);
+  header->numbytes = numbytes;
+  header->allocatorID = allocatorID;
+  return get_data(block);
+}
+
+//------------------------------------------------------------------------------
+void deallocate(void* ptr) noexcept
+{
+  AllocationHeader* header = get_header(ptr);
+  if(header->allocatorID == MALLOC_ALLOCATOR_ID)
+  {
+    std::free(header);
+  }
+  else
+  {
+    getAllocator(header->allocatorID)
+      ->deallocate(header, header->numbytes + HEADER_BYTES);
+  }
+}
+
+//------------------------------------------------------------------------------
+void* reallocate(void* ptr, std::size_t numbytes) noexcept
+{
+  if(ptr == nullptr)
+  {
+    return allocate(numbytes, getDefaultAllocatorID());
+  }
+  if(numbytes > std::numeric_limits<std::size_t>::max() - HEADER_BYTES)
+  {
+    return nullptr;
+  }
+
+  AllocationHeader* header = get_header(ptr);
+  const int allocatorID = header->allocatorID;
+  const std::size_t oldBytes = header->numbytes + HEADER_BYTES;
+  const std::size_t newBytes = numbytes + HEADER_BYTES;
+
+  void* block = nullptr;
+  if(allocatorID == MALLOC_ALLOCATOR_ID)
+  {
+    block = std::realloc(header, newBytes);
+  }
+  else
+  {
+    block = getAllocator(allocatorID)->reallocate(header, oldBytes, newBytes);
+  }
+
+  if(block == nullptr)
+  {
+    return nullptr;
+  }
+
+  static_cast<AllocationHeader*>(block)->numbytes = numbytes;
+  return get_data(block);
+}
+
+}  // namespace internal
+
+} /* namespace memory */
+
+} /* namespace axom */
+
+#endif /* AXOM_USE_UMPIRE */
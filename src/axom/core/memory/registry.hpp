@@ -0,0 +1,132 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_MEMORY_REGISTRY_HPP_
+#define AXOM_MEMORY_REGISTRY_HPP_
+
+#include "axom/config.hpp"  // for compile-time definitions
+#include "axom/core/memory/Allocator.hpp"
+
+// C/C++ includes
+#include <memory>   // for std::unique_ptr
+#include <string>   // for std::string
+#include <utility>  // for std::forward
+
+/*!
+ * \file
+ *
+ * When Axom is not compiled with Umpire, axom::allocate() dispatches to the
+ * allocators registered here by allocator ID. Each allocation is preceded by a
+ * small header recording its allocator and size, so that axom::deallocate()
+ * and axom::reallocate() find the allocator that owns a pointer.
+ *
+ * The allocator with ID MALLOC_ALLOCATOR_ID is predefined and is the default
+ * allocator unless another one is set with axom::setDefaultAllocator().
+ */
+
+#ifndef AXOM_USE_UMPIRE
+
+namespace axom
+{
+namespace memory
+{
+/*!
+ * \brief The ID of the predefined allocator, which uses std::malloc().
+ */
+constexpr int MALLOC_ALLOCATOR_ID = 0;
+
+/*!
+ * \brief The maximum number of allocators, including the predefined one.
+ */
+constexpr int MAX_ALLOCATORS = 64;
+
+/*!
+ * \brief Registers the given allocator with the given name.
+ *
+ * \param [in] name the name of the allocator, which must be unique.
+ * \param [in] allocator the allocator. The registry takes ownership of it and
+ *  keeps it for the rest of the program.
+ *
+ * \return ID the ID to pass to axom::allocate(), or INVALID_ALLOCATOR_ID if
+ *  the name is already in use or MAX_ALLOCATORS allocators are registered.
+ */
+int registerAllocator(const std::string& name,
+                      std::unique_ptr<Allocator> allocator);
+
+/*!
+ * \brief Creates and registers an allocator of the given type.
+ *
+ * \param [in] name the name of the allocator, which must be unique.
+ * \param [in] args the arguments of the allocator's constructor.
+ *
+ * \tparam AllocatorType a class derived from memory::Allocator, e.g.,
+ *  PoolAllocator, ArenaAllocator or HugePageAllocator.
+ *
+ * \return ID the ID to pass to axom::allocate(), or INVALID_ALLOCATOR_ID.
+ *
+ * \see registerAllocator()
+ */
+template <typename AllocatorType, typename... Args>
+int makeAllocator(const std::string& name, Args&&... args)
+{
+  return registerAllocator(
+    name,
+    std::unique_ptr<Allocator>(new AllocatorType(std::forward<Args>(args)...)));
+}
+
+/*!
+ * \brief Returns the allocator with the given ID, or nullptr if there is none.
+ */
+Allocator* getAllocator(int allocatorID);
+
+/*!
+ * \brief Returns the allocator with the given ID if it is of the given type,
+ *  otherwise nullptr.
+ */
+template <typename AllocatorType>
+AllocatorType* getAllocator(int allocatorID)
+{
+  return dynamic_cast<AllocatorType*>(getAllocator(allocatorID));
+}
+
+/*!
+ * \brief Returns the ID of the allocator with the given name, or
+ *  INVALID_ALLOCATOR_ID if there is none.
+ */
+int getAllocatorID(const std::string& name);
+
+/*!
+ * \brief Returns the ID of the allocator that owns the given pointer.
+ *
+ * \pre ptr was returned by axom::allocate() or axom::reallocate().
+ */
+int getPointerAllocatorID(const void* ptr);
+
+namespace internal
+{
+/// \name Implementation of the axom memory management routines
+/// @{
+
+void setDefaultAllocatorID(int allocatorID);
+
+int getDefaultAllocatorID();
+
+void* allocate(std::size_t numbytes, int allocatorID) noexcept;
+
+void deallocate(void* ptr) noexcept;
+
+void* reallocate(void* ptr, std::size_t numbytes) noexcept;
+
+/// @}
+
+}  // namespace internal
+
+} /* namespace memory */
+
+} /* namespace axom */
+
+#endif /* AXOM_USE_UMPIRE */
+
+#endif /* AXOM_MEMORY_REGISTRY_HPP_ */
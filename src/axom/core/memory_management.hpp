@@ -16,8 +16,8 @@
   #include "umpire/ResourceManager.hpp"
   #include "umpire/op/MemoryOperationRegistry.hpp"
 #else
+  #include "axom/core/memory/registry.hpp"
   #include <cstring>  // for std::memcpy
-  #include <cstdlib>  // for std::malloc, std::realloc, std::free
 #endif
 
 namespace axom
@@ -48,7 +48,9 @@ inline int getUmpireResourceAllocatorID(
  * \brief Sets the default memory allocator to use.
  * \param [in] allocatorID ID of the Umpire allocator to use.
  * 
- * \note This function has no effect when Axom is not compiled with Umpire.
+ * \note When Axom is not compiled with Umpire, allocatorID is the ID of an
+ *  allocator registered with axom::memory::registerAllocator(). Unknown IDs
+ *  are ignored.
  */
 inline void setDefaultAllocator(int allocatorID)
 {
@@ -57,7 +59,7 @@ inline void setDefaultAllocator(int allocatorID)
   umpire::Allocator allocator = rm.getAllocator(allocatorID);
   rm.setDefaultAllocator(allocator);
 #else
-  AXOM_UNUSED_VAR(allocatorID);
+  memory::internal::setDefaultAllocatorID(allocatorID);
 #endif
 }
 
@@ -71,7 +73,7 @@ inline int getDefaultAllocatorID()
 #ifdef AXOM_USE_UMPIRE
   return umpire::ResourceManager::getInstance().getDefaultAllocator().getId();
 #else
-  return 0;
+  return memory::internal::getDefaultAllocatorID();
 #endif
 }
 
@@ -81,6 +83,10 @@ inline int getDefaultAllocatorID()
  * \param [in] n the number of elements to allocate.
  * \param [in] allocID the Umpire allocator to use (optional)
  *
+ * \note When Axom is not compiled with Umpire, allocID is the ID of an
+ *  allocator registered with axom::memory::registerAllocator(), e.g., a
+ *  memory::PoolAllocator, or memory::MALLOC_ALLOCATOR_ID.
+ *
  * \tparam T the type of pointer returned.
  *
  * \note By default allocate() will use the current default allocator. The
@@ -151,8 +157,7 @@ inline T* allocate(std::size_t n, int allocID) noexcept
   return static_cast<T*>(allocator.allocate(numbytes));
 
 #else
-  AXOM_UNUSED_VAR(allocID);
-  return static_cast<T*>(std::malloc(numbytes));
+  return static_cast<T*>(memory::internal::allocate(numbytes, allocID));
 #endif
 }
 //------------------------------------------------------------------------------
@@ -168,7 +173,7 @@ inline void deallocate(T*& pointer) noexcept
 
 #else
 
-  std::free(pointer);
+  memory::internal::deallocate(pointer);
 
 #endif
 
@@ -224,13 +229,9 @@ inline T* reallocate(T* pointer, std::size_t n) noexcept
 
 #else
 
-  pointer = static_cast<T*>(std::realloc(pointer, numbytes));
-
-  // Consistently handle realloc(0) for std::realloc to match Umpire's behavior
-  if(n == 0 && pointer == nullptr)
-  {
-    pointer = axom::allocate<T>(0);
-  }
+  // The allocation header keeps reallocate(0) a valid pointer, which matches
+  // Umpire's behavior
+  pointer = static_cast<T*>(memory::internal::reallocate(pointer, numbytes));
 
 #endif
 
@@ -0,0 +1,633 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_NUMERICS_BATCHED_SOLVE_HPP_
+#define AXOM_NUMERICS_BATCHED_SOLVE_HPP_
+
+#include "axom/core/Macros.hpp"                      // for AXOM_STATIC_ASSERT
+#include "axom/core/Types.hpp"                       // for IndexType
+#include "axom/core/execution/for_all.hpp"           // for axom::for_all()
+#include "axom/core/numerics/jacobi_eigensolve.hpp"  // for JACOBI_* constants
+#include "axom/core/utilities/Utilities.hpp"  // for abs(), isNearlyEqual()
+
+// C/C++ includes
+#include <cassert>      // for assert()
+#include <cmath>        // for sqrt()
+#include <type_traits>  // for std::is_floating_point
+
+namespace axom
+{
+namespace numerics
+{
+/// \name Fixed-size and Batched Small Matrix Operators
+/// @{
+
+/*!
+ * \brief Solves the \f$ N \times N \f$ linear system \f$ Ax=b \f$, where the
+ *  size of the system is known at compile time.
+ *
+ *  Unlike linear_solve(), this method uses no heap memory and does not modify
+ *  its input. It uses Gaussian elimination with partial pivoting.
+ *
+ * \param [in] A the row-major \f$ N \times N \f$ matrix
+ * \param [in] b the right-hand side
+ * \param [out] x the solution vector (computed)
+ * \return rc return value, 0 if the solve is successful, -1 if A is singular.
+ *
+ * \pre A != nullptr
+ * \pre b != nullptr
+ * \pre x != nullptr
+ */
+template <int N, typename T>
+AXOM_HOST_DEVICE inline int linear_solve(const T* A, const T* b, T* x);
+
+/*!
+ * \brief Computes the eigenvalues and eigenvectors of the real symmetric
+ *  \f$ N \times N \f$ matrix A, where the size of the matrix is known at
+ *  compile time, using the cyclic Jacobi method.
+ *
+ *  Unlike jacobi_eigensolve(), this method uses no heap memory.
+ *
+ * \param [in] A the row-major, symmetric \f$ N \times N \f$ matrix
+ * \param [out] V the row-major matrix whose columns are the eigenvectors
+ * \param [out] lambdas the eigenvalues, in ascending order
+ * \param [in] maxIterations the maximum number of sweeps (optional)
+ * \param [in] TOL convergence tolerance. Default is set to 1.e-18 (optional)
+ *
+ * \return status JACOBI_EIGENSOLVE_SUCCESS on success, otherwise
+ *  JACOBI_EIGENSOLVE_FAILURE if the method did not converge.
+ *
+ * \pre A != nullptr
+ * \pre V != nullptr
+ * \pre lambdas != nullptr
+ */
+template <int N, typename T>
+AXOM_HOST_DEVICE inline int jacobi_eigensolve(
+  const T* A,
+  T* V,
+  T* lambdas,
+  int maxIterations = JACOBI_DEFAULT_MAX_ITERATIONS,
+  T TOL = JACOBI_DEFAULT_TOLERANCE);
+
+/*!
+ * \brief Solves count independent \f$ N \times N \f$ linear systems
+ *  \f$ A_m x_m = b_m \f$ stored in struct-of-arrays layout.
+ *
+ *  Entry \f$ (i,j) \f$ of the m-th matrix is at A[ (i*N + j)*count + m ], and
+ *  entry i of the m-th right-hand side and solution is at b[ i*count + m ] and
+ *  x[ i*count + m ]. The systems are solved in groups of consecutive systems,
+ *  one per SIMD lane, so the elimination vectorizes across the systems.
+ *
+ * \param [in] count the number of systems
+ * \param [in] A the count matrices
+ * \param [in] b the count right-hand sides
+ * \param [out] x the count solutions (computed)
+ * \param [out] status optional buffer of count return values, where status[m]
+ *  is 0 if the m-th system was solved and -1 if its matrix is singular.
+ *
+ * \tparam N the size of the systems
+ * \tparam ExecSpace the execution space for the groups of systems
+ *
+ * \note The solution of a singular system is set to zero.
+ *
+ * \pre A != nullptr
+ * \pre b != nullptr
+ * \pre x != nullptr
+ *
+ * \see linear_solve()
+ */
+template <int N, typename ExecSpace = SEQ_EXEC, typename T>
+inline void batched_lu_solve(IndexType count,
+                             const T* A,
+                             const T* b,
+                             T* x,
+                             int* status = nullptr);
+
+/*!
+ * \brief Computes the eigenvalues and eigenvectors of count independent real
+ *  symmetric \f$ N \times N \f$ matrices stored in struct-of-arrays layout.
+ *
+ *  Entry \f$ (i,j) \f$ of the m-th matrix and of its eigenvector matrix are at
+ *  A[ (i*N + j)*count + m ] and V[ (i*N + j)*count + m ], where column j of
+ *  the eigenvector matrix is the j-th eigenvector. The i-th eigenvalue of the
+ *  m-th matrix is at lambdas[ i*count + m ]. Eigenvalues are sorted in
+ *  ascending order.
+ *
+ * \param [in] count the number of matrices
+ * \param [in] A the count symmetric matrices
+ * \param [out] V the count eigenvector matrices
+ * \param [out] lambdas the count sets of N eigenvalues
+ * \param [out] status optional buffer of count return values, where status[m]
+ *  is JACOBI_EIGENSOLVE_SUCCESS or JACOBI_EIGENSOLVE_FAILURE
+ * \param [in] maxIterations the maximum number of sweeps (optional)
+ * \param [in] TOL convergence tolerance. Default is set to 1.e-18 (optional)
+ *
+ * \tparam N the size of the matrices
+ * \tparam ExecSpace the execution space for the groups of matrices
+ *
+ * \pre A != nullptr
+ * \pre V != nullptr
+ * \pre lambdas != nullptr
+ *
+ * \see jacobi_eigensolve()
+ */
+template <int N, typename ExecSpace = SEQ_EXEC, typename T>
+inline void batched_jacobi_eigensolve(
+  IndexType count,
+  const T* A,
+  T* V,
+  T* lambdas,
+  int* status = nullptr,
+  int maxIterations = JACOBI_DEFAULT_MAX_ITERATIONS,
+  T TOL = JACOBI_DEFAULT_TOLERANCE);
+
+/// @}
+
+//------------------------------------------------------------------------------
+// IMPLEMENTATION
+//------------------------------------------------------------------------------
+namespace internal
+{
+/*!
+ * \brief Returns the number of systems that a batched kernel processes
+ *  together, one per lane.
+ *
+ *  A group spans several vector registers, e.g., 32 doubles, so that compilers
+ *  vectorize the loops over the lanes of a group instead of unrolling them.
+ */
+template <typename T>
+constexpr int batch_width()
+{
+  return (sizeof(T) < 256) ? static_cast<int>(256 / sizeof(T)) : 1;
+}
+
+/*!
+ * \brief Loads W consecutive N x N matrices, starting with matrix first, from
+ *  struct-of-arrays layout into a, padding missing matrices with the identity.
+ */
+template <int N, int W, typename T>
+AXOM_HOST_DEVICE inline void batch_load(const T* A,
+                                        IndexType count,
+                                        IndexType first,
+                                        int nlanes,
+                                        T (&a)[N][N][W])
+{
+  for(int i = 0; i < N; ++i)
+  {
+    for(int j = 0; j < N; ++j)
+    {
+      const T* src = A + (i * N + j) * count + first;
+      for(int l = 0; l < nlanes; ++l)
+      {
+        a[i][j][l] = src[l];
+      }
+      for(int l = nlanes; l < W; ++l)
+      {
+        a[i][j][l] = (i == j) ? static_cast<T>(1) : static_cast<T>(0);
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Solves W systems, starting with system first, one per lane.
+ * \see batched_lu_solve()
+ */
+template <int N, int W, typename T>
+AXOM_HOST_DEVICE inline void lu_solve_lanes(const T* A,
+                                            const T* b,
+                                            T* x,
+                                            int* status,
+                                            IndexType count,
+                                            IndexType first)
+{
+  const IndexType remaining = count - first;
+  const int nlanes = (remaining < W) ? static_cast<int>(remaining) : W;
+
+  T a[N][N][W];
+  T r[N][W];
+  T invdiag[N][W];
+  bool singular[W];
+
+  batch_load<N, W>(A, count, first, nlanes, a);
+  for(int i = 0; i < N; ++i)
+  {
+    for(int l = 0; l < nlanes; ++l)
+    {
+      r[i][l] = b[i * count + first + l];
+    }
+    for(int l = nlanes; l < W; ++l)
+    {
+      r[i][l] = static_cast<T>(0);
+    }
+  }
+
+  for(int l = 0; l < W; ++l)
+  {
+    singular[l] = false;
+  }
+
+  // forward elimination; the multipliers of L are not needed, since the
+  // right-hand side is eliminated along with A
+  for(int k = 0; k < N; ++k)
+  {
+    // swap rows to place the max element of the kth column on the diagonal,
+    // using selects rather than branches so that all lanes stay in step
+    for(int i = k + 1; i < N; ++i)
+    {
+      bool swap[W];
+      for(int l = 0; l < W; ++l)
+      {
+        swap[l] = utilities::abs(a[k][k][l]) < utilities::abs(a[i][k][l]);
+      }
+
+      for(int j = k; j < N; ++j)
+      {
+        for(int l = 0; l < W; ++l)
+        {
+          const T akj = a[k][j][l];
+          const T aij = a[i][j][l];
+          a[k][j][l] = swap[l] ? aij : akj;
+          a[i][j][l] = swap[l] ? akj : aij;
+        }
+      }
+
+      for(int l = 0; l < W; ++l)
+      {
+        const T rk = r[k][l];
+        const T ri = r[i][l];
+        r[k][l] = swap[l] ? ri : rk;
+        r[i][l] = swap[l] ? rk : ri;
+      }
+    }
+
+    // same singularity test as lu_decompose()
+    for(int l = 0; l < W; ++l)
+    {
+      const bool zero =
+        utilities::isNearlyEqual(a[k][k][l], static_cast<T>(0));
+      singular[l] = singular[l] || zero;
+      const T pivot = zero ? static_cast<T>(1) : a[k][k][l];
+      invdiag[k][l] = static_cast<T>(1) / pivot;
+    }
+
+    for(int i = k + 1; i < N; ++i)
+    {
+      T factor[W];
+      for(int l = 0; l < W; ++l)
+      {
+        factor[l] = a[i][k][l] * invdiag[k][l];
+      }
+
+      for(int j = k + 1; j < N; ++j)
+      {
+        for(int l = 0; l < W; ++l)
+        {
+          a[i][j][l] -= factor[l] * a[k][j][l];
+        }
+      }
+
+      for(int l = 0; l < W; ++l)
+      {
+        r[i][l] -= factor[l] * r[k][l];
+      }
+    }
+  }
+
+  // back-substitute (bottom-to-top), overwriting the right-hand side
+  for(int i = N - 1; i >= 0; --i)
+  {
+    for(int j = i + 1; j < N; ++j)
+    {
+      for(int l = 0; l < W; ++l)
+      {
+        r[i][l] -= a[i][j][l] * r[j][l];
+      }
+    }
+
+    for(int l = 0; l < W; ++l)
+    {
+      r[i][l] *= invdiag[i][l];
+    }
+  }
+
+  for(int i = 0; i < N; ++i)
+  {
+    for(int l = 0; l < nlanes; ++l)
+    {
+      x[i * count + first + l] = singular[l] ? static_cast<T>(0) : r[i][l];
+    }
+  }
+
+  if(status != nullptr)
+  {
+    for(int l = 0; l < nlanes; ++l)
+    {
+      status[first + l] = singular[l] ? -1 : 0;
+    }
+  }
+}
+
+/*!
+ * \brief Computes the eigenpairs of W symmetric matrices, starting with
+ *  matrix first, one per lane.
+ *
+ *  Each sweep applies a Jacobi rotation to every off-diagonal entry of every
+ *  matrix, rather than skipping small entries as jacobi_eigensolve() does,
+ *  so that all lanes stay in step. Sweeps stop when all lanes converge.
+ *
+ * \see batched_jacobi_eigensolve()
+ */
+template <int N, int W, typename T>
+AXOM_HOST_DEVICE inline void jacobi_eigensolve_lanes(const T* A,
+                                                     T* V,
+                                                     T* lambdas,
+                                                     int* status,
+                                                     IndexType count,
+                                                     IndexType first,
+                                                     int maxIterations,
+                                                     T TOL)
+{
+  const IndexType remaining = count - first;
+  const int nlanes = (remaining < W) ? static_cast<int>(remaining) : W;
+
+  T a[N][N][W];
+  T v[N][N][W];
+  bool converged[W];
+
+  batch_load<N, W>(A, count, first, nlanes, a);
+  for(int i = 0; i < N; ++i)
+  {
+    for(int j = 0; j < N; ++j)
+    {
+      for(int l = 0; l < W; ++l)
+      {
+        v[i][j][l] = (i == j) ? static_cast<T>(1) : static_cast<T>(0);
+      }
+    }
+  }
+
+  for(int l = 0; l < W; ++l)
+  {
+    converged[l] = false;
+  }
+
+  for(int iter = 0; iter < maxIterations; ++iter)
+  {
+    // same convergence criterion as jacobi_eigensolve(), based on the sum of
+    // the squares of the upper triangular entries of A
+    T sum[W];
+    for(int l = 0; l < W; ++l)
+    {
+      sum[l] = static_cast<T>(0);
+    }
+
+    for(int i = 0; i < N; ++i)
+    {
+      for(int j = i + 1; j < N; ++j)
+      {
+        for(int l = 0; l < W; ++l)
+        {
+          sum[l] += a[i][j][l] * a[i][j][l];
+        }
+      }
+    }
+
+    bool all_converged = true;
+    for(int l = 0; l < W; ++l)
+    {
+      const T thresh = std::sqrt(sum[l]) / (4 * static_cast<T>(N));
+      converged[l] = utilities::isNearlyEqual(thresh, static_cast<T>(0), TOL);
+      all_converged = all_converged && converged[l];
+    }
+
+    if(all_converged)
+    {
+      break;
+    }
+
+    for(int p = 0; p < N; ++p)
+    {
+      for(int q = p + 1; q < N; ++q)
+      {
+        // compute Givens rotation terms: c = cos(theta), s = sin(theta)
+        T c[W];
+        T s[W];
+        for(int l = 0; l < W; ++l)
+        {
+          const T apq = a[p][q][l];
+          const T app = utilities::abs(a[p][p][l]);
+          const T aqq = utilities::abs(a[q][q][l]);
+
+          // off diagonal elements that are negligible next to the diagonal
+          // are zeroed without a rotation
+          const T gapq = 10 * utilities::abs(apq);
+          const bool negligible = (app + gapq == app) && (aqq + gapq == aqq);
+
+          const T h = a[q][q][l] - a[p][p][l];
+          const T theta = h / (2 * (negligible ? static_cast<T>(1) : apq));
+          T t = 1 / (utilities::abs(theta) + std::sqrt(theta * theta + 1));
+          t = (theta < 0) ? -t : t;
+          t = negligible ? static_cast<T>(0) : t;
+
+          c[l] = 1 / std::sqrt(1 + t * t);
+          s[l] = t * c[l];
+        }
+
+        // A = A P and V = V P, where P is the rotation in the (p,q) plane
+        for(int k = 0; k < N; ++k)
+        {
+          for(int l = 0; l < W; ++l)
+          {
+            const T akp = a[k][p][l];
+            const T akq = a[k][q][l];
+            a[k][p][l] = c[l] * akp - s[l] * akq;
+            a[k][q][l] = s[l] * akp + c[l] * akq;
+
+            const T vkp = v[k][p][l];
+            const T vkq = v[k][q][l];
+            v[k][p][l] = c[l] * vkp - s[l] * vkq;
+            v[k][q][l] = s[l] * vkp + c[l] * vkq;
+          }
+        }
+
+        // A = P^T A
+        for(int k = 0; k < N; ++k)
+        {
+          for(int l = 0; l < W; ++l)
+          {
+            const T apk = a[p][k][l];
+            const T aqk = a[q][k][l];
+            a[p][k][l] = c[l] * apk - s[l] * aqk;
+            a[q][k][l] = s[l] * apk + c[l] * aqk;
+          }
+        }
+
+        for(int l = 0; l < W; ++l)
+        {
+          a[p][q][l] = static_cast<T>(0);
+          a[q][p][l] = static_cast<T>(0);
+        }
+      }  // END for all q
+    }    // END for all p
+  }      // END for all iterations
+
+  // sort eigenvalues in ascending order, along with the eigenvectors
+  for(int i = 0; i < N - 1; ++i)
+  {
+    for(int j = 0; j < N - 1 - i; ++j)
+    {
+      bool swap[W];
+      for(int l = 0; l < W; ++l)
+      {
+        swap[l] = a[j + 1][j + 1][l] < a[j][j][l];
+        const T lj = a[j][j][l];
+        const T lj1 = a[j + 1][j + 1][l];
+        a[j][j][l] = swap[l] ? lj1 : lj;
+        a[j + 1][j + 1][l] = swap[l] ? lj : lj1;
+      }
+
+      for(int k = 0; k < N; ++k)
+      {
+        for(int l = 0; l < W; ++l)
+        {
+          const T vkj = v[k][j][l];
+          const T vkj1 = v[k][j + 1][l];
+          v[k][j][l] = swap[l] ? vkj1 : vkj;
+          v[k][j + 1][l] = swap[l] ? vkj : vkj1;
+        }
+      }
+    }
+  }
+
+  for(int i = 0; i < N; ++i)
+  {
+    for(int l = 0; l < nlanes; ++l)
+    {
+      lambdas[i * count + first + l] = a[i][i][l];
+    }
+
+    for(int j = 0; j < N; ++j)
+    {
+      for(int l = 0; l < nlanes; ++l)
+      {
+        V[(i * N + j) * count + first + l] = v[i][j][l];
+      }
+    }
+  }
+
+  if(status != nullptr)
+  {
+    for(int l = 0; l < nlanes; ++l)
+    {
+      status[first + l] =
+        converged[l] ? JACOBI_EIGENSOLVE_SUCCESS : JACOBI_EIGENSOLVE_FAILURE;
+    }
+  }
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+template <int N, typename T>
+AXOM_HOST_DEVICE inline int linear_solve(const T* A, const T* b, T* x)
+{
+  AXOM_STATIC_ASSERT_MSG(std::is_floating_point<T>::value,
+                         "pre: T is a floating point type");
+  AXOM_STATIC_ASSERT_MSG(N > 0, "pre: N is positive");
+
+  // a single system is a batch of one in struct-of-arrays layout
+  int rc = 0;
+  internal::lu_solve_lanes<N, 1>(A, b, x, &rc, 1, 0);
+  return rc;
+}
+
+//------------------------------------------------------------------------------
+template <int N, typename T>
+AXOM_HOST_DEVICE inline int jacobi_eigensolve(const T* A,
+                                              T* V,
+                                              T* lambdas,
+                                              int maxIterations,
+                                              T TOL)
+{
+  AXOM_STATIC_ASSERT_MSG(std::is_floating_point<T>::value,
+                         "pre: T is a floating point type");
+  AXOM_STATIC_ASSERT_MSG(N > 0, "pre: N is positive");
+
+  int rc = JACOBI_EIGENSOLVE_FAILURE;
+  internal::jacobi_eigensolve_lanes<N, 1>(A,
+                                          V,
+                                          lambdas,
+                                          &rc,
+                                          1,
+                                          0,
+                                          maxIterations,
+                                          TOL);
+  return rc;
+}
+
+//------------------------------------------------------------------------------
+template <int N, typename ExecSpace, typename T>
+inline void batched_lu_solve(IndexType count,
+                             const T* A,
+                             const T* b,
+                             T* x,
+                             int* status)
+{
+  AXOM_STATIC_ASSERT_MSG(std::is_floating_point<T>::value,
+                         "pre: T is a floating point type");
+  AXOM_STATIC_ASSERT_MSG(N > 0, "pre: N is positive");
+  assert("pre: matrices buffer is null" && (A != nullptr));
+  assert("pre: right-hand side buffer is null" && (b != nullptr));
+  assert("pre: solution buffer is null" && (x != nullptr));
+
+  constexpr int W = internal::batch_width<T>();
+  const IndexType num_groups = (count + W - 1) / W;
+
+  for_all<ExecSpace>(
+    num_groups,
+    AXOM_LAMBDA(IndexType group) {
+      internal::lu_solve_lanes<N, W>(A, b, x, status, count, group * W);
+    });
+}
+
+//------------------------------------------------------------------------------
+template <int N, typename ExecSpace, typename T>
+inline void batched_jacobi_eigensolve(IndexType count,
+                                      const T* A,
+                                      T* V,
+                                      T* lambdas,
+                                      int* status,
+                                      int maxIterations,
+                                      T TOL)
+{
+  AXOM_STATIC_ASSERT_MSG(std::is_floating_point<T>::value,
+                         "pre: T is a floating point type");
+  AXOM_STATIC_ASSERT_MSG(N > 0, "pre: N is positive");
+  assert("pre: matrices buffer is null" && (A != nullptr));
+  assert("pre: eigenvectors buffer is null" && (V != nullptr));
+  assert("pre: lambdas buffer is null" && (lambdas != nullptr));
+
+  constexpr int W = internal::batch_width<T>();
+  const IndexType num_groups = (count + W - 1) / W;
+
+  for_all<ExecSpace>(
+    num_groups,
+    AXOM_LAMBDA(IndexType group) {
+      internal::jacobi_eigensolve_lanes<N, W>(A,
+                                              V,
+                                              lambdas,
+                                              status,
+                                              count,
+                                              group * W,
+                                              maxIterations,
+                                              TOL);
+    });
+}
+
+} /* end namespace numerics */
+} /* end namespace axom */
+
+#endif /* AXOM_NUMERICS_BATCHED_SOLVE_HPP_ */
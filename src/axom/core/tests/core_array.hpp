@@ -10,6 +10,7 @@
 
 // C/C++ includes
 #include <algorithm> /* for std::fill_n */
+#include <utility>   /* for std::move */
 
 namespace axom
 {
@@ -1042,4 +1043,141 @@ TEST(core_array, deathtest_checkExternal)
   }
 }
 
+
+//------------------------------------------------------------------------------
+namespace internal
+{
+/*!
+ * \brief Returns an Array with the values 0, ..., n - 1 by value.
+ */
+Array<int> make_range(IndexType n)
+{
+  Array<int> v(axom::internal::ZERO, 1, n);
+  for(IndexType i = 0; i < n; ++i)
+  {
+    v.append(static_cast<int>(i));
+  }
+  return v;
+}
+
+} /* end namespace internal */
+
+//------------------------------------------------------------------------------
+TEST(core_array, checkMove)
+{
+  constexpr IndexType SIZE = 100;
+
+  Array<int> v = internal::make_range(SIZE);
+  EXPECT_EQ(v.size(), SIZE);
+  const int* data = v.getData();
+
+  // move construction takes over the buffer
+  Array<int> v2(std::move(v));
+  EXPECT_EQ(v2.getData(), data);
+  EXPECT_EQ(v2.size(), SIZE);
+  EXPECT_EQ(v2.getAllocatorID(), getDefaultAllocatorID());
+  for(IndexType i = 0; i < SIZE; ++i)
+  {
+    EXPECT_EQ(v2[i], i);
+  }
+
+  // the moved-from Array is empty and can be reused
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.capacity(), 0);
+  EXPECT_EQ(v.getData(), nullptr);
+  v.append(7);
+  v.append(8);
+  EXPECT_EQ(v.size(), 2);
+  EXPECT_EQ(v[1], 8);
+
+  // move assignment frees the previous buffer
+  v = std::move(v2);
+  EXPECT_EQ(v.getData(), data);
+  EXPECT_EQ(v.size(), SIZE);
+  EXPECT_TRUE(v2.empty());
+
+  // external buffers stay external when moved
+  int buffer[SIZE];
+  Array<int> ext(buffer, SIZE);
+  Array<int> ext2(std::move(ext));
+  EXPECT_TRUE(ext2.isExternal());
+  EXPECT_EQ(ext2.getData(), buffer);
+  EXPECT_FALSE(ext.isExternal());
+
+  // a moved-from external Array allocates its own buffer when reused
+  EXPECT_EQ(ext.getAllocatorID(), getDefaultAllocatorID());
+  const double ratio = Array<int>::DEFAULT_RESIZE_RATIO;
+  EXPECT_EQ(ext.getResizeRatio(), ratio);
+  ext.reserve(10);
+  EXPECT_NE(ext.getData(), nullptr);
+  EXPECT_EQ(ext.capacity(), 10);
+  ext.append(5);
+  EXPECT_EQ(ext.size(), 1);
+  EXPECT_EQ(ext[0], 5);
+
+  Array<int> ext3(buffer, SIZE);
+  Array<int> other(axom::internal::ZERO);
+  other = std::move(ext3);
+  EXPECT_TRUE(other.isExternal());
+  for(int i = 0; i < 3; ++i)
+  {
+    ext3.append(i);
+  }
+  EXPECT_FALSE(ext3.isExternal());
+  EXPECT_EQ(ext3.size(), 3);
+  EXPECT_EQ(ext3[2], 2);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_array, checkEmplaceBack)
+{
+  struct Point
+  {
+    double x, y;
+    Point(double x_, double y_) : x(x_), y(y_) { }
+  };
+
+  Array<Point> v(axom::internal::ZERO, 1, 2);
+  for(int i = 0; i < 100; ++i)
+  {
+    v.emplace_back(1.0 * i, -1.0 * i);
+  }
+  EXPECT_EQ(v.size(), 100);
+  EXPECT_EQ(v[42].x, 42.0);
+  EXPECT_EQ(v[42].y, -42.0);
+
+  // appending a value of the array itself when the array grows
+  Array<int> w(axom::internal::ZERO, 1, 1);
+  w.append(5);
+  for(int i = 0; i < 20; ++i)
+  {
+    w.emplace_back(w[0]);
+  }
+  for(IndexType i = 0; i < w.size(); ++i)
+  {
+    EXPECT_EQ(w[i], 5);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(core_array, checkAllocatorID)
+{
+  const int allocator_id = getDefaultAllocatorID();
+
+  Array<double> v(axom::internal::ZERO, 3, 0, allocator_id);
+  EXPECT_EQ(v.getAllocatorID(), allocator_id);
+
+  double tuple[3] = {1.0, 2.0, 3.0};
+  for(int i = 0; i < 1000; ++i)
+  {
+    v.append(tuple, 1);
+  }
+  EXPECT_EQ(v.getAllocatorID(), allocator_id);
+  EXPECT_EQ(v(999, 2), 3.0);
+
+  double buffer[3];
+  Array<double> ext(buffer, 1, 3);
+  EXPECT_EQ(ext.getAllocatorID(), INVALID_ALLOCATOR_ID);
+}
+
 } /* end namespace axom */
@@ -0,0 +1,193 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"
+#include "axom/core/Array.hpp"
+#include "axom/core/ArrayView.hpp"
+#include "axom/core/execution/for_all.hpp"
+
+#include "gtest/gtest.h" /* for TEST and EXPECT_* macros */
+
+// C/C++ includes
+#include <vector>
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Scales the first component of each tuple of a 2D view, whatever its layout
+template <typename ExecSpace, typename Layout>
+void scale_first_component(const axom::ArrayView<double, 2, Layout>& view,
+                           double factor)
+{
+  axom::for_all<ExecSpace>(
+    view.shape(0),
+    AXOM_LAMBDA(axom::IndexType i) { view(i, 0) *= factor; });
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_layout_generic_kernel()
+{
+  constexpr axom::IndexType N = 100;
+
+  // the same tuples in array-of-structs and struct-of-arrays layouts
+  std::vector<double> aos(3 * N);
+  std::vector<double> soa(3 * N);
+  for(axom::IndexType i = 0; i < N; ++i)
+  {
+    for(int j = 0; j < 3; ++j)
+    {
+      aos[3 * i + j] = 10.0 * i + j;
+      soa[j * N + i] = 10.0 * i + j;
+    }
+  }
+
+  axom::ArrayView<double, 2> aos_view(aos.data(), N, 3);
+  axom::ArrayView<double, 2, axom::layout::ColumnMajor> soa_view(soa.data(),
+                                                                 N,
+                                                                 3);
+
+  scale_first_component<ExecSpace>(aos_view, 2.0);
+  scale_first_component<ExecSpace>(soa_view, 2.0);
+
+  for(axom::IndexType i = 0; i < N; ++i)
+  {
+    EXPECT_EQ(aos_view(i, 0), 20.0 * i);
+    EXPECT_EQ(soa_view(i, 0), 20.0 * i);
+    for(int j = 1; j < 3; ++j)
+    {
+      EXPECT_EQ(aos_view(i, j), soa_view(i, j));
+    }
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+TEST(core_array_view, layouts)
+{
+  constexpr int NI = 4;
+  constexpr int NJ = 5;
+  constexpr int NK = 6;
+  double buffer[NI * NJ * NK];
+  for(int n = 0; n < NI * NJ * NK; ++n)
+  {
+    buffer[n] = n;
+  }
+
+  axom::ArrayView<double, 3> row(buffer, NI, NJ, NK);
+  axom::ArrayView<double, 3, axom::layout::ColumnMajor> col(buffer, NI, NJ, NK);
+  axom::ArrayView<double, 3, axom::layout::Strided> strided(buffer,
+                                                            {{NI, NJ, NK}},
+                                                            {{1, NI, NI * NJ}});
+  axom::ArrayView<double, 3, axom::layout::StaticStrides<NJ * NK, NK, 1>>
+    fixed(buffer, NI, NJ, NK);
+
+  EXPECT_EQ(row.size(), NI * NJ * NK);
+  EXPECT_EQ(row.shape(1), NJ);
+  EXPECT_EQ(row.stride(0), NJ * NK);
+  EXPECT_EQ(col.stride(2), NI * NJ);
+  EXPECT_EQ(fixed.stride(1), NK);
+  EXPECT_TRUE(row.isContiguous());
+  EXPECT_FALSE(strided.isContiguous());
+
+  for(int i = 0; i < NI; ++i)
+  {
+    for(int j = 0; j < NJ; ++j)
+    {
+      for(int k = 0; k < NK; ++k)
+      {
+        EXPECT_EQ(row(i, j, k), (i * NJ + j) * NK + k);
+        EXPECT_EQ(fixed(i, j, k), row(i, j, k));
+        EXPECT_EQ(col(i, j, k), (k * NJ + j) * NI + i);
+        EXPECT_EQ(strided(i, j, k), col(i, j, k));
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(core_array_view, one_dimensional)
+{
+  int buffer[12];
+  for(int i = 0; i < 12; ++i)
+  {
+    buffer[i] = i;
+  }
+
+  axom::ArrayView<int> view(buffer, 12);
+  EXPECT_EQ(view.size(), 12);
+  EXPECT_EQ(view[7], 7);
+  EXPECT_EQ(view.getData(), buffer);
+
+  // every third value, with a runtime and a compile-time stride
+  axom::ArrayView<int, 1, axom::layout::Strided> every_third(buffer + 1,
+                                                             {{4}},
+                                                             {{3}});
+  axom::ArrayView<int, 1, axom::layout::StaticStrides<3>> fixed(buffer + 1, 4);
+  for(int i = 0; i < 4; ++i)
+  {
+    EXPECT_EQ(every_third[i], 3 * i + 1);
+    EXPECT_EQ(fixed[i], 3 * i + 1);
+  }
+
+  // views of const values
+  axom::ArrayView<const int> const_view = view;
+  EXPECT_EQ(const_view[3], 3);
+
+  axom::ArrayView<int> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.getData(), nullptr);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_array_view, from_array)
+{
+  constexpr axom::IndexType N = 10;
+  axom::Array<double> tuples(N, 3);
+  for(axom::IndexType i = 0; i < N; ++i)
+  {
+    for(int j = 0; j < 3; ++j)
+    {
+      tuples(i, j) = 100.0 * i + j;
+    }
+  }
+
+  auto view = axom::make_array_view(tuples);
+  EXPECT_EQ(view.shape(0), N);
+  EXPECT_EQ(view.shape(1), 3);
+
+  auto ycoords = axom::make_component_view(tuples, 1);
+  EXPECT_EQ(ycoords.size(), N);
+  EXPECT_EQ(ycoords.stride(0), 3);
+
+  const axom::Array<double>& const_tuples = tuples;
+  axom::ArrayView<const double, 2> const_view =
+    axom::make_array_view(const_tuples);
+
+  for(axom::IndexType i = 0; i < N; ++i)
+  {
+    EXPECT_EQ(ycoords[i], 100.0 * i + 1);
+    for(int j = 0; j < 3; ++j)
+    {
+      EXPECT_EQ(view(i, j), tuples(i, j));
+      EXPECT_EQ(const_view(i, j), tuples(i, j));
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(core_array_view, layout_generic_kernel_seq)
+{
+  check_layout_generic_kernel<axom::SEQ_EXEC>();
+}
+
+//------------------------------------------------------------------------------
+#ifdef AXOM_USE_OPENMP
+TEST(core_array_view, layout_generic_kernel_omp)
+{
+  check_layout_generic_kernel<axom::OMP_EXEC>();
+}
+#endif
@@ -0,0 +1,86 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+// Axom includes
+#include "axom/config.hpp"                         /* for compile time defs */
+#include "axom/core/Macros.hpp"                    /* for axom macros */
+#include "axom/core/execution/atomics.hpp"         /* atomic operations */
+#include "axom/core/execution/execution_space.hpp" /* execution_space traits */
+#include "axom/core/execution/for_all.hpp"         /* for_all() traversals */
+#include "axom/core/memory_management.hpp"         /* allocate/deallocate */
+
+// gtest includes
+#include "gtest/gtest.h"
+
+//------------------------------------------------------------------------------
+//  HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_atomics()
+{
+  std::cout << "checking axom atomics with ["
+            << axom::execution_space<ExecSpace>::name() << "]\n";
+
+  constexpr int N = 10000;
+  constexpr int NUM_BINS = 8;
+
+  const int currentAllocatorID = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  int* counts = axom::allocate<int>(NUM_BINS);
+  double* minmax = axom::allocate<double>(2);
+  int* total = axom::allocate<int>(1);
+  for(int i = 0; i < NUM_BINS; ++i)
+  {
+    counts[i] = 0;
+  }
+  minmax[0] = 0.0;
+  minmax[1] = 0.0;
+  *total = N;
+
+  axom::for_all<ExecSpace>(
+    N,
+    AXOM_LAMBDA(axom::IndexType idx) {
+      axom::atomicAdd<ExecSpace>(&counts[idx % NUM_BINS], 1);
+      axom::atomicSub<ExecSpace>(total, 1);
+      axom::atomicMin<ExecSpace>(&minmax[0], -0.5 * idx);
+      axom::atomicMax<ExecSpace>(&minmax[1], 0.5 * idx);
+    });
+
+  for(int i = 0; i < NUM_BINS; ++i)
+  {
+    EXPECT_EQ(counts[i], N / NUM_BINS);
+  }
+  EXPECT_EQ(*total, 0);
+  EXPECT_DOUBLE_EQ(minmax[0], -0.5 * (N - 1));
+  EXPECT_DOUBLE_EQ(minmax[1], 0.5 * (N - 1));
+
+  // atomicExchange returns the old value
+  EXPECT_EQ(axom::atomicExchange<ExecSpace>(total, 42), 0);
+  EXPECT_EQ(*total, 42);
+
+  axom::deallocate(counts);
+  axom::deallocate(minmax);
+  axom::deallocate(total);
+
+  axom::setDefaultAllocator(currentAllocatorID);
+}
+
+} /* end anonymous namespace */
+
+//------------------------------------------------------------------------------
+//  UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(core_execution_atomics, seq_exec) { check_atomics<axom::SEQ_EXEC>(); }
+
+//------------------------------------------------------------------------------
+#ifdef AXOM_USE_OPENMP
+
+TEST(core_execution_atomics, omp_exec) { check_atomics<axom::OMP_EXEC>(); }
+
+#endif
@@ -87,7 +87,7 @@ TEST(core_execution_for_all, seq_exec) { check_for_all<axom::SEQ_EXEC>(); }
 
 //------------------------------------------------------------------------------
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+#ifdef AXOM_USE_OPENMP
 
 TEST(core_execution_for_all, omp_exec) { check_for_all<axom::OMP_EXEC>(); }
 
@@ -0,0 +1,173 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+// Axom includes
+#include "axom/config.hpp"                         /* for compile time defs */
+#include "axom/core/Macros.hpp"                    /* for axom macros */
+#include "axom/core/execution/execution_space.hpp" /* execution_space traits */
+#include "axom/core/execution/for_all.hpp"         /* for_all() traversals */
+#include "axom/core/execution/reductions.hpp"      /* reducers */
+#include "axom/core/memory_management.hpp"         /* allocate/deallocate */
+
+// gtest includes
+#include "gtest/gtest.h"
+
+#ifdef AXOM_USE_OPENMP
+  #include <omp.h>
+#endif
+
+//------------------------------------------------------------------------------
+//  HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_reductions()
+{
+  std::cout << "checking axom reducers with ["
+            << axom::execution_space<ExecSpace>::name() << "]\n";
+
+  constexpr int N = 100000;
+
+  const int currentAllocatorID = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  int* a = axom::allocate<int>(N);
+  for(int i = 0; i < N; ++i)
+  {
+    a[i] = (i % 2 == 0) ? i : -i;
+  }
+
+  axom::ReduceSum<ExecSpace, long> sum(10);
+  axom::ReduceMin<ExecSpace, int> minval(0);
+  axom::ReduceMax<ExecSpace, int> maxval(0);
+
+  axom::for_all<ExecSpace>(
+    N,
+    AXOM_LAMBDA(axom::IndexType idx) {
+      sum += a[idx];
+      minval.min(a[idx]);
+      maxval.max(a[idx]);
+    });
+
+  // each pair of entries ( 2k, -(2k+1) ) sums to -1
+  EXPECT_EQ(static_cast<long>(sum.get()), 10 - N / 2);
+  EXPECT_EQ(static_cast<int>(minval.get()), -(N - 1));
+  EXPECT_EQ(static_cast<int>(maxval.get()), N - 2);
+
+  axom::deallocate(a);
+
+  axom::setDefaultAllocator(currentAllocatorID);
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_reduce(int N)
+{
+  std::cout << "checking axom reduce of length " << N << " with ["
+            << axom::execution_space<ExecSpace>::name() << "]\n";
+
+  const int currentAllocatorID = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  long* a = axom::allocate<long>(N);
+  for(int i = 0; i < N; ++i)
+  {
+    a[i] = i % 5;
+  }
+
+  long expected = 3;
+  for(int i = 0; i < N; ++i)
+  {
+    expected += a[i];
+  }
+  EXPECT_EQ(expected, axom::reduce<ExecSpace>(a, N, 3L));
+  EXPECT_EQ(expected - 3, axom::reduce<ExecSpace>(a, N));
+
+  axom::deallocate(a);
+
+  axom::setDefaultAllocator(currentAllocatorID);
+}
+
+//------------------------------------------------------------------------------
+#ifdef AXOM_USE_OPENMP
+/*!
+ * \brief Checks reducers used by teams that differ from the team size when
+ *  they were constructed, including nested teams.
+ */
+void check_omp_reductions_with_other_teams()
+{
+  constexpr int N = 100000;
+  const int max_threads = omp_get_max_threads();
+  const int max_levels = omp_get_max_active_levels();
+
+  // more threads run the loop than when the reducers were constructed
+  omp_set_num_threads(2);
+  axom::ReduceSum<axom::OMP_EXEC, long> sum(0);
+  axom::ReduceMax<axom::OMP_EXEC, int> maxval(0);
+
+  omp_set_num_threads(8);
+  axom::for_all<axom::OMP_EXEC>(
+    N,
+    AXOM_LAMBDA(axom::IndexType idx) {
+      sum += 1;
+      maxval.max(static_cast<int>(idx));
+    });
+  EXPECT_EQ(sum.get(), N);
+  EXPECT_EQ(maxval.get(), N - 1);
+
+  // the loops of several threads of an outer team add to the same reducers
+  omp_set_max_active_levels(2);
+  omp_set_num_threads(3);
+  sum.reset(0);
+  maxval.reset(0);
+
+  #pragma omp parallel num_threads(3)
+  {
+    const int offset = omp_get_thread_num() * N;
+    axom::for_all<axom::OMP_EXEC>(
+      N,
+      AXOM_LAMBDA(axom::IndexType idx) {
+        sum += 1;
+        maxval.max(offset + static_cast<int>(idx));
+      });
+  }
+  EXPECT_EQ(sum.get(), 3 * N);
+  EXPECT_EQ(maxval.get(), 3 * N - 1);
+
+  omp_set_max_active_levels(max_levels);
+  omp_set_num_threads(max_threads);
+}
+#endif
+
+} /* end anonymous namespace */
+
+//------------------------------------------------------------------------------
+//  UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(core_execution_reductions, seq_exec)
+{
+  check_reductions<axom::SEQ_EXEC>();
+  check_reduce<axom::SEQ_EXEC>(0);
+  check_reduce<axom::SEQ_EXEC>(1000);
+}
+
+//------------------------------------------------------------------------------
+#ifdef AXOM_USE_OPENMP
+
+TEST(core_execution_reductions, omp_exec)
+{
+  check_reductions<axom::OMP_EXEC>();
+  check_reduce<axom::OMP_EXEC>(1000);
+  check_reduce<axom::OMP_EXEC>(1000003);
+}
+
+TEST(core_execution_reductions, omp_exec_other_teams)
+{
+  check_omp_reductions_with_other_teams();
+}
+
+#endif
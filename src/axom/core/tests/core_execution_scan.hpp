@@ -0,0 +1,84 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+// Axom includes
+#include "axom/config.hpp"                         /* for compile time defs */
+#include "axom/core/execution/execution_space.hpp" /* execution_space traits */
+#include "axom/core/execution/scan.hpp"            /* exclusive_scan() */
+#include "axom/core/memory_management.hpp"         /* allocate/deallocate */
+
+// gtest includes
+#include "gtest/gtest.h"
+
+//------------------------------------------------------------------------------
+//  HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_scan(int N)
+{
+  std::cout << "checking axom scans of length " << N << " with ["
+            << axom::execution_space<ExecSpace>::name() << "]\n";
+
+  const int currentAllocatorID = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  axom::IndexType* input = axom::allocate<axom::IndexType>(N);
+  axom::IndexType* exclusive = axom::allocate<axom::IndexType>(N);
+  axom::IndexType* inclusive = axom::allocate<axom::IndexType>(N);
+  for(int i = 0; i < N; ++i)
+  {
+    input[i] = i % 7;
+  }
+
+  axom::exclusive_scan<ExecSpace>(input, exclusive, N);
+  axom::inclusive_scan<ExecSpace>(input, inclusive, N);
+
+  axom::IndexType sum = 0;
+  for(int i = 0; i < N; ++i)
+  {
+    EXPECT_EQ(exclusive[i], sum);
+    sum += input[i];
+    EXPECT_EQ(inclusive[i], sum);
+  }
+
+  // in-place scan
+  axom::exclusive_scan<ExecSpace>(input, input, N);
+  for(int i = 0; i < N; ++i)
+  {
+    EXPECT_EQ(input[i], exclusive[i]);
+  }
+
+  axom::deallocate(input);
+  axom::deallocate(exclusive);
+  axom::deallocate(inclusive);
+
+  axom::setDefaultAllocator(currentAllocatorID);
+}
+
+} /* end anonymous namespace */
+
+//------------------------------------------------------------------------------
+//  UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(core_execution_scan, seq_exec)
+{
+  check_scan<axom::SEQ_EXEC>(0);
+  check_scan<axom::SEQ_EXEC>(100);
+}
+
+//------------------------------------------------------------------------------
+#ifdef AXOM_USE_OPENMP
+
+TEST(core_execution_scan, omp_exec)
+{
+  // the long arrays exercise the blocked parallel scan
+  check_scan<axom::OMP_EXEC>(100);
+  check_scan<axom::OMP_EXEC>(1000003);
+}
+
+#endif
@@ -0,0 +1,191 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+// Axom includes
+#include "axom/config.hpp"                         /* for compile time defs */
+#include "axom/core/execution/execution_space.hpp" /* execution_space traits */
+#include "axom/core/execution/sort.hpp"            /* sort_pairs(), unique() */
+#include "axom/core/memory_management.hpp"         /* allocate/deallocate */
+
+// gtest includes
+#include "gtest/gtest.h"
+
+// C/C++ includes
+#include <algorithm>  // for std::stable_sort, std::sort, std::unique
+#include <cstdint>    // for std::uint32_t
+#include <random>     // for std::mt19937
+#include <vector>     // for std::vector
+
+#ifdef AXOM_USE_OPENMP
+  #include <omp.h>
+#endif
+
+//------------------------------------------------------------------------------
+//  HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+//------------------------------------------------------------------------------
+template <typename ExecSpace, typename KeyType>
+void check_sort(int N, KeyType lo, KeyType hi)
+{
+  std::cout << "checking axom sorts of length " << N << " with ["
+            << axom::execution_space<ExecSpace>::name() << "]\n";
+
+  const int currentAllocatorID = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  KeyType* keys = axom::allocate<KeyType>(N);
+  KeyType* sorted = axom::allocate<KeyType>(N);
+  int* values = axom::allocate<int>(N);
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(static_cast<double>(lo),
+                                              static_cast<double>(hi));
+  std::vector<std::pair<KeyType, int>> expected(N);
+  for(int i = 0; i < N; ++i)
+  {
+    keys[i] = sorted[i] = static_cast<KeyType>(dist(gen));
+    values[i] = i;
+    expected[i] = std::make_pair(keys[i], i);
+  }
+
+  // the expected order keeps the values of equal keys in order
+  std::stable_sort(
+    expected.begin(),
+    expected.end(),
+    [](const std::pair<KeyType, int>& a, const std::pair<KeyType, int>& b) {
+      return a.first < b.first;
+    });
+
+  axom::sort_pairs<ExecSpace>(keys, values, N);
+  axom::radix_sort<ExecSpace>(sorted, N);
+  for(int i = 0; i < N; ++i)
+  {
+    EXPECT_EQ(expected[i].first, keys[i]);
+    EXPECT_EQ(expected[i].second, values[i]);
+    EXPECT_EQ(expected[i].first, sorted[i]);
+  }
+
+  axom::deallocate(keys);
+  axom::deallocate(sorted);
+  axom::deallocate(values);
+
+  axom::setDefaultAllocator(currentAllocatorID);
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_unique(int N)
+{
+  std::cout << "checking axom unique of length " << N << " with ["
+            << axom::execution_space<ExecSpace>::name() << "]\n";
+
+  const int currentAllocatorID = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  int* input = axom::allocate<int>(N);
+  int* output = axom::allocate<int>(N);
+  for(int i = 0; i < N; ++i)
+  {
+    input[i] = (i / 3) + (i / 7);
+  }
+
+  std::vector<int> expected(input, input + N);
+  expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+  const axom::IndexType count = axom::unique<ExecSpace>(input, N, output);
+  ASSERT_EQ(static_cast<axom::IndexType>(expected.size()), count);
+  for(axom::IndexType i = 0; i < count; ++i)
+  {
+    EXPECT_EQ(expected[i], output[i]);
+  }
+
+  axom::deallocate(input);
+  axom::deallocate(output);
+
+  axom::setDefaultAllocator(currentAllocatorID);
+}
+
+//------------------------------------------------------------------------------
+#ifdef AXOM_USE_OPENMP
+/*!
+ * \brief Checks unique() called from a parallel region, where its team has
+ *  fewer threads than omp_get_max_threads().
+ */
+void check_unique_in_parallel_region(int N)
+{
+  const int max_threads = omp_get_max_threads();
+  const int max_levels = omp_get_max_active_levels();
+  omp_set_num_threads(4);
+  omp_set_max_active_levels(1);
+
+  std::vector<int> input(N);
+  std::vector<int> output(N);
+  for(int i = 0; i < N; ++i)
+  {
+    input[i] = i / 2;
+  }
+
+  axom::IndexType count = 0;
+  #pragma omp parallel num_threads(2)
+  {
+    #pragma omp single
+    count = axom::unique<axom::OMP_EXEC>(input.data(), N, output.data());
+  }
+
+  ASSERT_EQ(static_cast<axom::IndexType>((N + 1) / 2), count);
+  for(axom::IndexType i = 0; i < count; ++i)
+  {
+    EXPECT_EQ(i, output[i]);
+  }
+
+  omp_set_max_active_levels(max_levels);
+  omp_set_num_threads(max_threads);
+}
+#endif
+
+} /* end anonymous namespace */
+
+//------------------------------------------------------------------------------
+//  UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(core_execution_sort, seq_exec)
+{
+  using exec = axom::SEQ_EXEC;
+  check_sort<exec, std::uint32_t>(0, 0, 0);
+  check_sort<exec, std::uint32_t>(1000, 0, 100);
+  check_sort<exec, std::uint32_t>(1000, 0, 4e9);
+  check_sort<exec, int>(1000, -1000000, 1000000);
+  check_sort<exec, std::int64_t>(1000, -1e15, 1e15);
+  check_sort<exec, double>(1000, -1e3, 1e3);
+  check_sort<exec, float>(1000, -1.f, 1.f);
+
+  check_unique<exec>(0);
+  check_unique<exec>(1000);
+}
+
+//------------------------------------------------------------------------------
+#ifdef AXOM_USE_OPENMP
+
+TEST(core_execution_sort, omp_exec)
+{
+  // the long arrays exercise the parallel radix sort and unique
+  using exec = axom::OMP_EXEC;
+  check_sort<exec, std::uint32_t>(1000, 0, 4e9);
+  check_sort<exec, std::uint32_t>(1000003, 0, 1000);
+  check_sort<exec, int>(1000003, -1000000, 1000000);
+  check_sort<exec, double>(1000003, -1e3, 1e3);
+
+  check_unique<exec>(1000);
+  check_unique<exec>(1000003);
+}
+
+TEST(core_execution_sort, omp_exec_nested)
+{
+  check_unique_in_parallel_region(1 << 21);
+}
+
+#endif
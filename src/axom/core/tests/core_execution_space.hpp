@@ -102,7 +102,7 @@ TEST(core_execution_space, check_valid)
 {
   check_valid<axom::SEQ_EXEC>();
 
-#if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
+#ifdef AXOM_USE_OPENMP
   check_valid<axom::OMP_EXEC>();
 #endif
 
@@ -0,0 +1,373 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"
+#include "axom/core/FlatMap.hpp"
+#include "axom/core/execution/for_all.hpp"
+#include "axom/core/execution/reductions.hpp"
+
+#include "gtest/gtest.h" /* for TEST and EXPECT_* macros */
+
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+/*!
+ * \brief FNV-1a hash for std::string and const char* keys, with
+ *  heterogeneous lookup enabled.
+ */
+struct StringHash
+{
+  using is_transparent = void;
+
+  std::size_t operator()(const char* str) const
+  {
+    std::size_t h = 14695981039346656037ULL;
+    for(; *str != '\0'; ++str)
+    {
+      h = (h ^ static_cast<unsigned char>(*str)) * 1099511628211ULL;
+    }
+    return h;
+  }
+
+  std::size_t operator()(const std::string& str) const
+  {
+    return (*this)(str.c_str());
+  }
+};
+
+struct StringEqual
+{
+  using is_transparent = void;
+
+  bool operator()(const std::string& a, const std::string& b) const
+  {
+    return a == b;
+  }
+
+  bool operator()(const std::string& a, const char* b) const
+  {
+    return std::strcmp(a.c_str(), b) == 0;
+  }
+};
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_bulk_insert()
+{
+  constexpr int N = 20000;
+
+  // each key appears twice
+  std::vector<int> keys(2 * N);
+  std::vector<double> values(2 * N);
+  for(int i = 0; i < 2 * N; ++i)
+  {
+    keys[i] = (i % N) * 7;
+    values[i] = 0.5 * (i % N);
+  }
+
+  axom::experimental::FlatMap<int, double> map;
+  map.insert({-1, -1.0});
+
+  const axom::IndexType num_inserted =
+    map.bulk_insert<ExecSpace>(keys.data(), values.data(), 2 * N);
+  EXPECT_EQ(num_inserted, N);
+  EXPECT_EQ(map.size(), N + 1);
+
+  // check the items through a view of the map captured in a kernel
+  auto view = map.view();
+  axom::ReduceSum<ExecSpace, int> num_errors(0);
+  axom::for_all<ExecSpace>(
+    N,
+    AXOM_LAMBDA(axom::IndexType i) {
+      const double* v = view.find(7 * i);
+      num_errors += (v == nullptr || *v != 0.5 * i) ? 1 : 0;
+      num_errors += view.contains(7 * i + 1) ? 1 : 0;
+    });
+  EXPECT_EQ(num_errors.get(), 0);
+  EXPECT_EQ(map[-1], -1.0);
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_bulk_insert_after_erase()
+{
+  constexpr int N = 1000;
+
+  std::vector<int> keys(N);
+  std::vector<int> values(N);
+  for(int i = 0; i < N; ++i)
+  {
+    keys[i] = i;
+    values[i] = -i;
+  }
+
+  axom::experimental::FlatMap<int, int> map;
+  for(int i = 0; i < N; ++i)
+  {
+    map.insert({i, i});
+  }
+
+  // erasing leaves EMPTY slots in front of the remaining keys of a group
+  for(int i = 0; i < N; i += 2)
+  {
+    map.erase(i);
+  }
+
+  const axom::IndexType num_inserted =
+    map.bulk_insert<ExecSpace>(keys.data(), values.data(), N);
+  EXPECT_EQ(num_inserted, N / 2);
+  EXPECT_EQ(map.size(), N);
+
+  std::vector<int> counts(N, 0);
+  for(const auto& item : map)
+  {
+    ASSERT_TRUE(item.first >= 0 && item.first < N);
+    ++counts[item.first];
+    EXPECT_EQ(item.second, (item.first % 2 == 0) ? -item.first : item.first);
+  }
+  for(int i = 0; i < N; ++i)
+  {
+    EXPECT_EQ(counts[i], 1);
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+TEST(core_flatmap, insert_and_find)
+{
+  constexpr int N = 1000;
+
+  axom::experimental::FlatMap<int, int> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.bucket_count(), 0);
+  EXPECT_TRUE(map.find(0) == map.end());
+
+  for(int i = 0; i < N; ++i)
+  {
+    auto ret = map.insert({i, 27 * i});
+    EXPECT_TRUE(ret.second);
+    EXPECT_EQ(ret.first->first, i);
+    EXPECT_EQ(ret.first->second, 27 * i);
+  }
+
+  // the map grows automatically, within the maximum load factor
+  EXPECT_EQ(map.size(), N);
+  EXPECT_LE(map.load_factor(), map.max_load_factor());
+
+  // inserting an existing key does not change the map
+  auto ret = map.insert({5, 0});
+  EXPECT_FALSE(ret.second);
+  EXPECT_EQ(ret.first->second, 27 * 5);
+  EXPECT_EQ(map.size(), N);
+
+  for(int i = 0; i < N; ++i)
+  {
+    auto it = map.find(i);
+    ASSERT_TRUE(it != map.end());
+    EXPECT_EQ(it->second, 27 * i);
+    EXPECT_TRUE(map.contains(i));
+  }
+  EXPECT_FALSE(map.contains(N));
+  EXPECT_EQ(map.count(N), 0);
+
+  // every item is visited once by the iterators
+  long sum = 0;
+  int count = 0;
+  for(const auto& kv : map)
+  {
+    sum += kv.second;
+    ++count;
+  }
+  EXPECT_EQ(count, N);
+  EXPECT_EQ(sum, 27L * N * (N - 1) / 2);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_flatmap, insert_or_assign_and_brackets)
+{
+  axom::experimental::FlatMap<int, double> map(100);
+  const axom::IndexType capacity = map.bucket_count();
+  EXPECT_GE(capacity, 100);
+
+  for(int i = 0; i < 100; ++i)
+  {
+    EXPECT_TRUE(map.insert_or_assign(i, 1.0 * i).second);
+  }
+  for(int i = 0; i < 100; ++i)
+  {
+    EXPECT_FALSE(map.insert_or_assign(i, 2.0 * i).second);
+    map[i] += 1.0;
+  }
+
+  // reserve() avoided any growth
+  EXPECT_EQ(map.bucket_count(), capacity);
+
+  for(int i = 0; i < 100; ++i)
+  {
+    EXPECT_EQ(map.find(i)->second, 2.0 * i + 1.0);
+  }
+
+  // operator[] inserts default-constructed values
+  EXPECT_EQ(map[1000], 0.0);
+  EXPECT_EQ(map.size(), 101);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_flatmap, erase)
+{
+  constexpr int N = 2000;
+
+  axom::experimental::FlatMap<int, int> map;
+  for(int i = 0; i < N; ++i)
+  {
+    map.insert({i, i});
+  }
+
+  // erase the even keys
+  for(int i = 0; i < N; i += 2)
+  {
+    EXPECT_EQ(map.erase(i), 1);
+  }
+  EXPECT_EQ(map.erase(0), 0);
+  EXPECT_EQ(map.size(), N / 2);
+
+  for(int i = 0; i < N; ++i)
+  {
+    EXPECT_EQ(map.contains(i), (i % 2) == 1);
+  }
+
+  // erasing and inserting repeatedly reuses the slots of the erased items
+  const axom::IndexType capacity = map.bucket_count();
+  for(int cycle = 0; cycle < 10; ++cycle)
+  {
+    for(int i = 0; i < N; i += 2)
+    {
+      map.insert({N * (cycle + 1) + i, i});
+    }
+    for(int i = 0; i < N; i += 2)
+    {
+      map.erase(N * (cycle + 1) + i);
+    }
+  }
+  EXPECT_EQ(map.size(), N / 2);
+  EXPECT_EQ(map.bucket_count(), capacity);
+
+  // erase with iterators
+  for(auto it = map.begin(); it != map.end();)
+  {
+    it = (it->first % 3 == 0) ? map.erase(it) : ++it;
+  }
+  for(int i = 1; i < N; i += 2)
+  {
+    EXPECT_EQ(map.contains(i), (i % 3) != 0);
+  }
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.begin() == map.end());
+}
+
+//------------------------------------------------------------------------------
+TEST(core_flatmap, copy_and_move)
+{
+  axom::experimental::FlatMap<std::string, std::vector<int>> map;
+  for(int i = 0; i < 100; ++i)
+  {
+    map.try_emplace(std::to_string(i), i, i);
+  }
+
+  axom::experimental::FlatMap<std::string, std::vector<int>> copy(map);
+  EXPECT_EQ(copy.size(), 100);
+  for(int i = 0; i < 100; ++i)
+  {
+    EXPECT_EQ(copy.find(std::to_string(i))->second,
+              std::vector<int>(i, i));
+  }
+
+  copy.erase("7");
+  EXPECT_TRUE(map.contains("7"));
+
+  axom::experimental::FlatMap<std::string, std::vector<int>> moved(
+    std::move(map));
+  EXPECT_EQ(moved.size(), 100);
+  EXPECT_TRUE(map.empty());
+
+  map = copy;
+  EXPECT_EQ(map.size(), 99);
+  EXPECT_FALSE(map.contains("7"));
+}
+
+//------------------------------------------------------------------------------
+TEST(core_flatmap, heterogeneous_lookup)
+{
+  axom::experimental::FlatMap<std::string, int, StringHash, StringEqual> map;
+  map.insert({"alpha", 1});
+  map.insert({"beta", 2});
+
+  // const char* keys are looked up without constructing a std::string
+  const char* key = "beta";
+  EXPECT_TRUE(map.contains(key));
+  EXPECT_EQ(map.find(key)->second, 2);
+  EXPECT_EQ(map.count("gamma"), 0);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_flatmap, compare_to_unordered_map)
+{
+  constexpr int N = 50000;
+
+  std::unordered_map<long, int> expected;
+  axom::experimental::FlatMap<long, int> map;
+
+  // a pseudo-random sequence of insertions and removals
+  unsigned long state = 12345;
+  for(int i = 0; i < N; ++i)
+  {
+    state = state * 6364136223846793005UL + 1442695040888963407UL;
+    const long key = static_cast<long>((state >> 33) % 5000);
+    if((state >> 20) % 3 == 0)
+    {
+      EXPECT_EQ(map.erase(key),
+                static_cast<axom::IndexType>(expected.erase(key)));
+    }
+    else
+    {
+      EXPECT_EQ(map.insert({key, i}).second, expected.insert({key, i}).second);
+    }
+  }
+
+  EXPECT_EQ(map.size(), static_cast<axom::IndexType>(expected.size()));
+  for(const auto& kv : expected)
+  {
+    auto it = map.find(kv.first);
+    ASSERT_TRUE(it != map.end());
+    EXPECT_EQ(it->second, kv.second);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(core_flatmap, bulk_insert_seq) { check_bulk_insert<axom::SEQ_EXEC>(); }
+
+//------------------------------------------------------------------------------
+TEST(core_flatmap, bulk_insert_after_erase_seq)
+{
+  check_bulk_insert_after_erase<axom::SEQ_EXEC>();
+}
+
+//------------------------------------------------------------------------------
+#ifdef AXOM_USE_OPENMP
+TEST(core_flatmap, bulk_insert_omp) { check_bulk_insert<axom::OMP_EXEC>(); }
+
+//------------------------------------------------------------------------------
+TEST(core_flatmap, bulk_insert_after_erase_omp)
+{
+  check_bulk_insert_after_erase<axom::OMP_EXEC>();
+}
+#endif
@@ -11,6 +11,14 @@
   #include "umpire/config.hpp"
   #include "umpire/Allocator.hpp"
   #include "umpire/ResourceManager.hpp"
+#else
+  #include "axom/core/Array.hpp"
+  #include "axom/core/memory/ArenaAllocator.hpp"
+  #include "axom/core/memory/HugePageAllocator.hpp"
+  #include "axom/core/memory/PoolAllocator.hpp"
+
+  #include <thread>  // for std::thread
+  #include <vector>  // for std::vector
 #endif
 
 //------------------------------------------------------------------------------
@@ -126,12 +134,8 @@ private:
   int m_static_dst_array[ARRAY_SIZE];
 };
 
-#ifdef AXOM_USE_UMPIRE
 void check_alloc_and_free(int allocatorID = axom::getDefaultAllocatorID(),
                           bool hostAccessible = true)
-#else
-void check_alloc_and_free(bool hostAccessible = true)
-#endif
 {
   for(int size = 0; size <= ARRAY_SIZE; size = size * 2 + 1)
   {
@@ -144,7 +148,8 @@ void check_alloc_and_free(bool hostAccessible = true)
       EXPECT_EQ(allocatorID, rm.getAllocator(buffer).getId());
     }
 #else
-    int* buffer = axom::allocate<int>(size);
+    int* buffer = axom::allocate<int>(size, allocatorID);
+    EXPECT_EQ(allocatorID, axom::memory::getPointerAllocatorID(buffer));
 #endif
 
     if(hostAccessible)
@@ -165,12 +170,8 @@ void check_alloc_and_free(bool hostAccessible = true)
   }
 }
 
-#ifdef AXOM_USE_UMPIRE
 void check_alloc_realloc_free(int allocatorID = axom::getDefaultAllocatorID(),
                               bool hostAccessible = true)
-#else
-void check_alloc_realloc_free(bool hostAccessible = true)
-#endif
 {
   for(int size = 0; size <= ARRAY_SIZE; size = size * 2 + 1)
   {
@@ -185,7 +186,8 @@ void check_alloc_realloc_free(bool hostAccessible = true)
       ASSERT_EQ(allocatorID, rm.getAllocator(buffer).getId());
     }
 #else
-    int* buffer = axom::allocate<int>(buffer_size);
+    int* buffer = axom::allocate<int>(buffer_size, allocatorID);
+    ASSERT_EQ(allocatorID, axom::memory::getPointerAllocatorID(buffer));
 #endif
 
     if(hostAccessible)
@@ -211,6 +213,8 @@ void check_alloc_realloc_free(bool hostAccessible = true)
     {
       ASSERT_EQ(allocatorID, rm.getAllocator(buffer).getId());
     }
+#else
+    ASSERT_EQ(allocatorID, axom::memory::getPointerAllocatorID(buffer));
 #endif
 
     if(hostAccessible)
@@ -236,6 +240,8 @@ void check_alloc_realloc_free(bool hostAccessible = true)
     {
       ASSERT_EQ(allocatorID, rm.getAllocator(buffer).getId());
     }
+#else
+    ASSERT_EQ(allocatorID, axom::memory::getPointerAllocatorID(buffer));
 #endif
 
     if(hostAccessible)
@@ -483,3 +489,278 @@ TEST(core_memory_management, basic_alloc_realloc_dealloc)
   axom::deallocate<int>(buf);
   EXPECT_EQ(buf, nullptr);
 }
+
+#ifndef AXOM_USE_UMPIRE
+
+namespace memory = axom::memory;
+
+//------------------------------------------------------------------------------
+template <typename AllocatorType, typename... Args>
+int get_or_make_allocator(const std::string& name, Args&&... args)
+{
+  const int id = memory::getAllocatorID(name);
+  return (id != axom::INVALID_ALLOCATOR_ID)
+    ? id
+    : memory::makeAllocator<AllocatorType>(name, std::forward<Args>(args)...);
+}
+
+//------------------------------------------------------------------------------
+TEST(core_memory_management, native_registry)
+{
+  EXPECT_EQ(memory::MALLOC_ALLOCATOR_ID, axom::getDefaultAllocatorID());
+  EXPECT_EQ(memory::MALLOC_ALLOCATOR_ID, memory::getAllocatorID("MALLOC"));
+  EXPECT_EQ(axom::INVALID_ALLOCATOR_ID, memory::getAllocatorID("unknown"));
+  EXPECT_EQ(nullptr, memory::getAllocator(memory::MAX_ALLOCATORS));
+
+  const int poolID =
+    get_or_make_allocator<memory::PoolAllocator>("test_registry_pool");
+  ASSERT_NE(axom::INVALID_ALLOCATOR_ID, poolID);
+  EXPECT_EQ(poolID, memory::getAllocatorID("test_registry_pool"));
+  EXPECT_NE(nullptr, memory::getAllocator<memory::PoolAllocator>(poolID));
+  EXPECT_EQ(nullptr, memory::getAllocator<memory::ArenaAllocator>(poolID));
+
+  // names are unique
+  const int duplicateID =
+    memory::makeAllocator<memory::ArenaAllocator>("test_registry_pool");
+  EXPECT_EQ(axom::INVALID_ALLOCATOR_ID, duplicateID);
+
+  // unknown allocators are not set as default
+  axom::setDefaultAllocator(memory::MAX_ALLOCATORS);
+  EXPECT_EQ(memory::MALLOC_ALLOCATOR_ID, axom::getDefaultAllocatorID());
+
+  axom::setDefaultAllocator(poolID);
+  EXPECT_EQ(poolID, axom::getDefaultAllocatorID());
+  check_alloc_realloc_free();
+  axom::setDefaultAllocator(memory::MALLOC_ALLOCATOR_ID);
+
+  EXPECT_EQ(nullptr, axom::allocate<int>(1, memory::MAX_ALLOCATORS));
+}
+
+//------------------------------------------------------------------------------
+TEST(core_memory_management, native_alloc_realloc_free)
+{
+  const int ids[] = {
+    memory::MALLOC_ALLOCATOR_ID,
+    get_or_make_allocator<memory::PoolAllocator>("test_pool"),
+    get_or_make_allocator<memory::ArenaAllocator>("test_arena", 4096),
+    get_or_make_allocator<memory::HugePageAllocator>("test_huge_pages", 4096)};
+
+  for(int id : ids)
+  {
+    ASSERT_NE(axom::INVALID_ALLOCATOR_ID, id);
+    check_alloc_and_free(id);
+    check_alloc_realloc_free(id);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(core_memory_management, native_array)
+{
+  const int poolID = get_or_make_allocator<memory::PoolAllocator>("test_pool");
+
+  axom::Array<int> array(0, 1, 0, poolID);
+  for(int i = 0; i < ARRAY_SIZE; ++i)
+  {
+    array.append(i);
+  }
+
+  EXPECT_EQ(poolID, array.getAllocatorID());
+  EXPECT_EQ(poolID, memory::getPointerAllocatorID(array.getData()));
+  for(int i = 0; i < ARRAY_SIZE; ++i)
+  {
+    EXPECT_EQ(i, array[i]);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(core_memory_management, pool_size_classes)
+{
+  using memory::PoolAllocator;
+
+  for(int c = 0; c < PoolAllocator::NUM_SIZE_CLASSES; ++c)
+  {
+    const std::size_t bytes = PoolAllocator::getClassBytes(c);
+    EXPECT_EQ(0u, bytes % memory::ALIGNMENT);
+    EXPECT_EQ(c, PoolAllocator::getSizeClass(bytes));
+    EXPECT_EQ(c, PoolAllocator::getSizeClass(bytes - 1));
+    if(c > 0)
+    {
+      const std::size_t prevBytes = PoolAllocator::getClassBytes(c - 1);
+      EXPECT_GT(bytes, prevBytes);
+      EXPECT_EQ(c, PoolAllocator::getSizeClass(prevBytes + 1));
+    }
+  }
+
+  EXPECT_EQ(PoolAllocator::MAX_POOLED_BYTES,
+            PoolAllocator::getClassBytes(PoolAllocator::NUM_SIZE_CLASSES - 1));
+  EXPECT_EQ(-1,
+            PoolAllocator::getSizeClass(PoolAllocator::MAX_POOLED_BYTES + 1));
+}
+
+//------------------------------------------------------------------------------
+TEST(core_memory_management, pool_reuse)
+{
+  memory::PoolAllocator pool;
+
+  // a freed block is handed out again by the next allocation of its class
+  void* first = pool.allocate(100);
+  pool.deallocate(first, 100);
+  void* second = pool.allocate(120);
+  EXPECT_EQ(first, second);
+  pool.deallocate(second, 120);
+
+  pool.deallocate(pool.allocate(64), 64);
+  const std::size_t slabBytes = pool.getSlabBytes();
+  EXPECT_GT(slabBytes, 0u);
+  for(int i = 0; i < 100; ++i)
+  {
+    pool.deallocate(pool.allocate(64), 64);
+  }
+  EXPECT_EQ(slabBytes, pool.getSlabBytes());
+
+  // larger requests are not pooled
+  void* large = pool.allocate(memory::PoolAllocator::MAX_POOLED_BYTES + 1);
+  EXPECT_NE(nullptr, large);
+  pool.deallocate(large, memory::PoolAllocator::MAX_POOLED_BYTES + 1);
+  EXPECT_EQ(slabBytes, pool.getSlabBytes());
+}
+
+//------------------------------------------------------------------------------
+TEST(core_memory_management, pool_threads)
+{
+  const int poolID = get_or_make_allocator<memory::PoolAllocator>("test_pool");
+
+  constexpr int NUM_THREADS = 4;
+  constexpr int NUM_BUFFERS = 1000;
+
+  // Each thread frees half of its buffers and hands the rest to the next
+  // thread, which frees them
+  std::vector<std::vector<int*>> handoff(NUM_THREADS);
+  for(int t = 0; t < NUM_THREADS; ++t)
+  {
+    std::vector<std::thread> threads;
+    threads.emplace_back([&handoff, t, poolID]() {
+      if(t > 0)
+      {
+        for(int* buffer : handoff[t - 1])
+        {
+          EXPECT_EQ(t - 1, buffer[0]);
+          axom::deallocate(buffer);
+        }
+      }
+
+      std::vector<int*> buffers;
+      for(int i = 0; i < NUM_BUFFERS; ++i)
+      {
+        int* buffer = axom::allocate<int>(1 + i % 300, poolID);
+        buffer[0] = t;
+        buffers.push_back(buffer);
+      }
+      for(int i = 0; i < NUM_BUFFERS; i += 2)
+      {
+        EXPECT_EQ(t, buffers[i][0]);
+        axom::deallocate(buffers[i]);
+      }
+      for(int i = 1; i < NUM_BUFFERS; i += 2)
+      {
+        handoff[t].push_back(buffers[i]);
+      }
+    });
+    threads.back().join();
+  }
+
+  for(int* buffer : handoff[NUM_THREADS - 1])
+  {
+    axom::deallocate(buffer);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(core_memory_management, arena_scope)
+{
+  const int arenaID =
+    get_or_make_allocator<memory::ArenaAllocator>("test_scoped_arena", 1024);
+  memory::ArenaAllocator* arena =
+    memory::getAllocator<memory::ArenaAllocator>(arenaID);
+  ASSERT_NE(nullptr, arena);
+  arena->reset();
+
+  double* outer = axom::allocate<double>(8, arenaID);
+  const std::size_t usedBytes = arena->getUsedBytes();
+  EXPECT_GT(usedBytes, 8 * sizeof(double));
+
+  {
+    memory::ArenaScope scope(arenaID);
+    for(int i = 0; i < 100; ++i)
+    {
+      double* scratch = axom::allocate<double>(10 + i, arenaID);
+      scratch[9 + i] = i;
+      axom::deallocate(scratch);
+    }
+    EXPECT_GT(arena->getUsedBytes(), usedBytes);
+
+    {
+      memory::ArenaScope inner(*arena);
+      int* big = axom::allocate<int>(1000, arenaID);
+      big[999] = 1;
+    }
+  }
+  EXPECT_EQ(usedBytes, arena->getUsedBytes());
+
+  // the last block grows in place
+  double* last = axom::allocate<double>(8, arenaID);
+  double* grown = axom::reallocate(last, 16);
+  EXPECT_EQ(last, grown);
+
+  // other blocks are copied
+  outer[7] = 7.;
+  double* moved = axom::reallocate(outer, 16);
+  EXPECT_NE(outer, moved);
+  EXPECT_EQ(7., moved[7]);
+
+  // the chunks are reused after a reset
+  const std::size_t chunkBytes = arena->getChunkBytes();
+  arena->reset();
+  EXPECT_EQ(0u, arena->getUsedBytes());
+  for(int i = 0; i < 10; ++i)
+  {
+    memory::ArenaScope scope(arenaID);
+    axom::allocate<double>(100, arenaID);
+  }
+  EXPECT_EQ(chunkBytes, arena->getChunkBytes());
+
+  arena->release();
+  EXPECT_EQ(0u, arena->getChunkBytes());
+}
+
+//------------------------------------------------------------------------------
+TEST(core_memory_management, huge_pages)
+{
+  using memory::HugePageAllocator;
+  HugePageAllocator allocator;
+
+  const std::size_t bytes = HugePageAllocator::HUGE_PAGE_BYTES + 100;
+  char* ptr = static_cast<char*>(allocator.allocate(bytes));
+  ASSERT_NE(nullptr, ptr);
+  if(HugePageAllocator::isSupported())
+  {
+    EXPECT_EQ(0u,
+              reinterpret_cast<std::uintptr_t>(ptr) %
+                HugePageAllocator::HUGE_PAGE_BYTES);
+  }
+  ptr[0] = 1;
+  ptr[bytes - 1] = 2;
+
+  ptr = static_cast<char*>(allocator.reallocate(ptr, bytes, 2 * bytes));
+  ASSERT_NE(nullptr, ptr);
+  EXPECT_EQ(1, ptr[0]);
+  EXPECT_EQ(2, ptr[bytes - 1]);
+  allocator.deallocate(ptr, 2 * bytes);
+
+  // small blocks are not mapped
+  void* small = allocator.allocate(64);
+  EXPECT_NE(nullptr, small);
+  allocator.deallocate(small, 64);
+}
+
+#endif /* AXOM_USE_UMPIRE */
@@ -8,8 +8,14 @@
 #include "axom/config.hpp"  // for compile-time definitions
 
 #include "core_array.hpp"
+#include "core_array_view.hpp"
+#include "core_execution_atomics.hpp"
 #include "core_execution_for_all.hpp"
+#include "core_execution_reductions.hpp"
+#include "core_execution_scan.hpp"
+#include "core_execution_sort.hpp"
 #include "core_execution_space.hpp"
+#include "core_flatmap.hpp"
 #include "core_memory_management.hpp"
 #include "core_Path.hpp"
 #include "core_stack_array.hpp"
@@ -19,6 +25,7 @@
   #include "core_types.hpp"
 #endif
 
+#include "numerics_batched_solve.hpp"
 #include "numerics_determinants.hpp"
 #include "numerics_eigen_solve.hpp"
 #include "numerics_eigen_sort.hpp"
@@ -34,6 +41,7 @@
 #include "utils_endianness.hpp"
 #include "utils_fileUtilities.hpp"
 #include "utils_nvtx_settings.hpp"
+#include "utils_profiler.hpp"
 #include "utils_utilities.hpp"
 #include "utils_about.hpp"
 
@@ -0,0 +1,287 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "gtest/gtest.h"
+
+#include "axom/core/numerics/batched_solve.hpp"
+#include "axom/core/numerics/jacobi_eigensolve.hpp"
+#include "axom/core/numerics/linear_solve.hpp"
+#include "axom/core/numerics/Matrix.hpp"
+
+// C/C++ includes
+#include <cmath>    // for std::abs()
+#include <cstdlib>  // for srand(), rand()
+#include <vector>
+
+namespace
+{
+//------------------------------------------------------------------------------
+double random_real() { return 2. * rand() / RAND_MAX - 1.; }
+
+//------------------------------------------------------------------------------
+// Fills count random N x N systems in struct-of-arrays layout. Symmetric
+// matrices are diagonally dominant, so that the systems are well-conditioned.
+template <int N>
+void random_systems(int count,
+                    std::vector<double>& A,
+                    std::vector<double>& b,
+                    bool symmetric)
+{
+  A.resize(N * N * count);
+  b.resize(N * count);
+
+  for(int m = 0; m < count; ++m)
+  {
+    for(int i = 0; i < N; ++i)
+    {
+      b[i * count + m] = random_real();
+      for(int j = 0; j < N; ++j)
+      {
+        A[(i * N + j) * count + m] = random_real();
+      }
+    }
+
+    if(symmetric)
+    {
+      for(int i = 0; i < N; ++i)
+      {
+        A[(i * N + i) * count + m] += N;
+        for(int j = 0; j < i; ++j)
+        {
+          A[(i * N + j) * count + m] = A[(j * N + i) * count + m];
+        }
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+template <int N>
+axom::numerics::Matrix<double> get_matrix(const std::vector<double>& A,
+                                          int count,
+                                          int m)
+{
+  axom::numerics::Matrix<double> M(N, N);
+  for(int i = 0; i < N; ++i)
+  {
+    for(int j = 0; j < N; ++j)
+    {
+      M(i, j) = A[(i * N + j) * count + m];
+    }
+  }
+  return M;
+}
+
+//------------------------------------------------------------------------------
+template <int N, typename ExecSpace>
+void check_batched_lu_solve(int count)
+{
+  std::vector<double> A, b;
+  random_systems<N>(count, A, b, false);
+
+  std::vector<double> x(N * count);
+  std::vector<int> status(count, -2);
+  axom::numerics::batched_lu_solve<N, ExecSpace>(count,
+                                                 A.data(),
+                                                 b.data(),
+                                                 x.data(),
+                                                 status.data());
+
+  double bm[N];
+  double xm[N];
+  for(int m = 0; m < count; ++m)
+  {
+    for(int i = 0; i < N; ++i)
+    {
+      bm[i] = b[i * count + m];
+    }
+
+    auto M = get_matrix<N>(A, count, m);
+    const int rc = axom::numerics::linear_solve(M, bm, xm);
+    EXPECT_EQ(rc, status[m]);
+
+    for(int i = 0; i < N; ++i)
+    {
+      EXPECT_NEAR(xm[i], x[i * count + m], 1.e-8);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+template <int N, typename ExecSpace>
+void check_batched_jacobi_eigensolve(int count)
+{
+  constexpr double TOL = 1.e-12;
+
+  std::vector<double> A, b;
+  random_systems<N>(count, A, b, true);
+
+  std::vector<double> V(N * N * count);
+  std::vector<double> lambdas(N * count);
+  std::vector<int> status(count, -2);
+  axom::numerics::batched_jacobi_eigensolve<N, ExecSpace>(count,
+                                                          A.data(),
+                                                          V.data(),
+                                                          lambdas.data(),
+                                                          status.data());
+
+  for(int m = 0; m < count; ++m)
+  {
+    EXPECT_EQ(status[m], axom::numerics::JACOBI_EIGENSOLVE_SUCCESS);
+
+    auto M = get_matrix<N>(A, count, m);
+    axom::numerics::Matrix<double> Vm(N, N);
+    double lm[N];
+    axom::numerics::jacobi_eigensolve(M, Vm, lm);
+
+    for(int j = 0; j < N; ++j)
+    {
+      EXPECT_NEAR(lm[j], lambdas[j * count + m], TOL);
+      if(j > 0)
+      {
+        EXPECT_LE(lambdas[(j - 1) * count + m], lambdas[j * count + m]);
+      }
+
+      // check A v = lambda v for the jth eigenvector
+      for(int i = 0; i < N; ++i)
+      {
+        double Av = 0.;
+        for(int k = 0; k < N; ++k)
+        {
+          Av += M(i, k) * V[(k * N + j) * count + m];
+        }
+        const double lv = lambdas[j * count + m] * V[(i * N + j) * count + m];
+        EXPECT_NEAR(Av, lv, TOL);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(numerics_batched_solve, fixed_size_linear_solve)
+{
+  // clang-format off
+  const double A[9] = {4,  5, -2,
+                       7, -1,  2,
+                       3,  1,  4};
+  // clang-format on
+  const double b[3] = {-14, 42, 28};
+  double x[3];
+
+  EXPECT_EQ(0, axom::numerics::linear_solve<3>(A, b, x));
+  EXPECT_NEAR(4, x[0], 1.e-12);
+  EXPECT_NEAR(-4, x[1], 1.e-12);
+  EXPECT_NEAR(5, x[2], 1.e-12);
+
+  // the input matrix is not modified
+  EXPECT_EQ(4, A[0]);
+
+  const double singular[4] = {1, 2, 2, 4};
+  EXPECT_EQ(-1, axom::numerics::linear_solve<2>(singular, b, x));
+}
+
+//------------------------------------------------------------------------------
+TEST(numerics_batched_solve, fixed_size_jacobi_eigensolve)
+{
+  // clang-format off
+  const double A[9] = {2, 1, 0,
+                       1, 2, 0,
+                       0, 0, 5};
+  // clang-format on
+  double V[9];
+  double lambdas[3];
+
+  EXPECT_EQ(axom::numerics::JACOBI_EIGENSOLVE_SUCCESS,
+            axom::numerics::jacobi_eigensolve<3>(A, V, lambdas));
+  EXPECT_NEAR(1, lambdas[0], 1.e-12);
+  EXPECT_NEAR(3, lambdas[1], 1.e-12);
+  EXPECT_NEAR(5, lambdas[2], 1.e-12);
+
+  // the eigenvector of 5 is the z-axis, up to its sign
+  EXPECT_NEAR(0, V[2], 1.e-12);
+  EXPECT_NEAR(0, V[5], 1.e-12);
+  EXPECT_NEAR(1, std::abs(V[8]), 1.e-12);
+
+  const float Af[4] = {1.f, 0.f, 0.f, -1.f};
+  float Vf[4];
+  float lambdasf[2];
+  EXPECT_EQ(axom::numerics::JACOBI_EIGENSOLVE_SUCCESS,
+            axom::numerics::jacobi_eigensolve<2>(Af, Vf, lambdasf));
+  EXPECT_EQ(-1.f, lambdasf[0]);
+  EXPECT_EQ(1.f, lambdasf[1]);
+}
+
+//------------------------------------------------------------------------------
+TEST(numerics_batched_solve, batched_lu_solve)
+{
+  srand(42);
+
+  // includes counts that are not a multiple of the batch width
+  for(int count : {1, 31, 32, 100})
+  {
+    check_batched_lu_solve<2, axom::SEQ_EXEC>(count);
+    check_batched_lu_solve<3, axom::SEQ_EXEC>(count);
+    check_batched_lu_solve<4, axom::SEQ_EXEC>(count);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(numerics_batched_solve, batched_lu_solve_singular)
+{
+  constexpr int N = 2;
+  constexpr int COUNT = 3;
+
+  // the second system is singular
+  // clang-format off
+  const double A[N * N * COUNT] = {1, 1, 2,
+                                   0, 2, 1,
+                                   0, 4, 1,
+                                   1, 8, 3};
+  const double b[N * COUNT] = {1, 1, 3,
+                               2, 1, -1};
+  // clang-format on
+  double x[N * COUNT];
+  int status[COUNT];
+
+  axom::numerics::batched_lu_solve<N>(COUNT, A, b, x, status);
+  EXPECT_EQ(0, status[0]);
+  EXPECT_EQ(-1, status[1]);
+  EXPECT_EQ(0, status[2]);
+
+  EXPECT_DOUBLE_EQ(1, x[0]);
+  EXPECT_DOUBLE_EQ(2, x[COUNT]);
+  EXPECT_DOUBLE_EQ(0, x[1]);
+  EXPECT_DOUBLE_EQ(0, x[COUNT + 1]);
+  EXPECT_DOUBLE_EQ(2, x[2]);
+  EXPECT_DOUBLE_EQ(-1, x[COUNT + 2]);
+}
+
+//------------------------------------------------------------------------------
+TEST(numerics_batched_solve, batched_jacobi_eigensolve)
+{
+  srand(42);
+
+  for(int count : {1, 31, 32, 100})
+  {
+    check_batched_jacobi_eigensolve<2, axom::SEQ_EXEC>(count);
+    check_batched_jacobi_eigensolve<3, axom::SEQ_EXEC>(count);
+    check_batched_jacobi_eigensolve<4, axom::SEQ_EXEC>(count);
+  }
+}
+
+//------------------------------------------------------------------------------
+#ifdef AXOM_USE_OPENMP
+TEST(numerics_batched_solve, batched_solve_omp)
+{
+  srand(42);
+
+  check_batched_lu_solve<3, axom::OMP_EXEC>(1000);
+  check_batched_jacobi_eigensolve<3, axom::OMP_EXEC>(1000);
+}
+#endif
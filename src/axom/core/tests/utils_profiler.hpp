@@ -0,0 +1,242 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"
+#include "axom/core/utilities/profiler/interface.hpp"
+
+#include "gtest/gtest.h"
+
+// C/C++ includes
+#include <chrono>   // for std::chrono
+#include <sstream>  // for std::ostringstream
+#include <thread>   // for std::this_thread
+
+namespace profiler = axom::profiler;
+
+//------------------------------------------------------------------------------
+// HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+//------------------------------------------------------------------------------
+void sleep_ms(int ms)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+//------------------------------------------------------------------------------
+void leaf()
+{
+  profiler::Region region("leaf");
+  sleep_ms(1);
+}
+
+//------------------------------------------------------------------------------
+const profiler::RegionStats* find_region(
+  const std::vector<profiler::RegionStats>& regions,
+  const std::string& path)
+{
+  for(const auto& region : regions)
+  {
+    if(region.path == path)
+    {
+      return &region;
+    }
+  }
+  return nullptr;
+}
+
+} /* end anonymous namespace */
+
+//------------------------------------------------------------------------------
+// UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(utils_profiler, nested_regions)
+{
+  profiler::reset();
+
+  for(int i = 0; i < 3; ++i)
+  {
+    profiler::Region outer("outer");
+    leaf();
+    {
+      profiler::Region inner(std::string("inner"));
+      leaf();
+      leaf();
+    }
+  }
+  leaf();
+
+  const auto regions = profiler::get_regions();
+  ASSERT_EQ(5u, regions.size());
+
+  // regions are listed depth-first, in the order they were first entered
+  EXPECT_EQ("outer", regions[0].path);
+  EXPECT_EQ("outer/leaf", regions[1].path);
+  EXPECT_EQ("outer/inner", regions[2].path);
+  EXPECT_EQ("outer/inner/leaf", regions[3].path);
+  EXPECT_EQ("leaf", regions[3].name);
+  EXPECT_EQ(2, regions[3].depth);
+  EXPECT_EQ("leaf", regions[4].path);
+  EXPECT_EQ(0, regions[4].depth);
+
+  const auto* outer = find_region(regions, "outer");
+  const auto* outer_leaf = find_region(regions, "outer/leaf");
+  const auto* inner = find_region(regions, "outer/inner");
+  const auto* inner_leaf = find_region(regions, "outer/inner/leaf");
+  ASSERT_NE(nullptr, outer);
+  ASSERT_NE(nullptr, inner_leaf);
+
+  EXPECT_EQ(3, outer->calls);
+  EXPECT_EQ(3, outer_leaf->calls);
+  EXPECT_EQ(3, inner->calls);
+  EXPECT_EQ(6, inner_leaf->calls);
+
+  EXPECT_GE(inner_leaf->inclusive, 0.006);
+  EXPECT_GE(inner->inclusive, inner_leaf->inclusive);
+  EXPECT_GE(outer->inclusive, inner->inclusive + outer_leaf->inclusive);
+  EXPECT_NEAR(outer->exclusive,
+              outer->inclusive - inner->inclusive - outer_leaf->inclusive,
+              1e-9);
+  EXPECT_DOUBLE_EQ(inner_leaf->exclusive, inner_leaf->inclusive);
+
+  profiler::reset();
+  EXPECT_TRUE(profiler::get_regions().empty());
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_profiler, counters)
+{
+  profiler::reset();
+
+  // counters outside of any region are ignored
+  profiler::add_counter("bytes", 1.);
+
+  for(int i = 0; i < 4; ++i)
+  {
+    profiler::Region region("write");
+    profiler::add_counter("bytes", 1024.);
+    profiler::add_counter("items", 2.);
+  }
+
+  const auto regions = profiler::get_regions();
+  ASSERT_EQ(1u, regions.size());
+  ASSERT_EQ(2u, regions[0].counters.size());
+  EXPECT_EQ("bytes", regions[0].counters[0].first);
+  EXPECT_DOUBLE_EQ(4096., regions[0].counters[0].second);
+  EXPECT_EQ("items", regions[0].counters[1].first);
+  EXPECT_DOUBLE_EQ(8., regions[0].counters[1].second);
+
+  profiler::reset();
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_profiler, disable)
+{
+  profiler::reset();
+  EXPECT_TRUE(profiler::is_enabled());
+
+  profiler::set_enabled(false);
+  EXPECT_FALSE(profiler::is_enabled());
+  {
+    profiler::Region region("ignored");
+    profiler::add_counter("bytes", 1.);
+  }
+  EXPECT_TRUE(profiler::get_regions().empty());
+
+  profiler::set_enabled(true);
+  leaf();
+  EXPECT_EQ(1u, profiler::get_regions().size());
+
+  profiler::reset();
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_profiler, reports)
+{
+  profiler::reset();
+  {
+    profiler::Region outer("outer \"quoted\"");
+    profiler::add_counter("bytes", 16.);
+    leaf();
+  }
+
+  std::ostringstream text;
+  profiler::write_text_report(text);
+  EXPECT_NE(std::string::npos, text.str().find("Inclusive (s)"));
+  EXPECT_NE(std::string::npos, text.str().find("outer \"quoted\""));
+  EXPECT_NE(std::string::npos, text.str().find("\n  leaf"));
+  EXPECT_NE(std::string::npos, text.str().find("bytes=16"));
+
+  std::ostringstream json;
+  profiler::write_json_report(json);
+  EXPECT_NE(std::string::npos, json.str().find("\"outer \\\"quoted\\\"\""));
+  EXPECT_NE(std::string::npos, json.str().find("\"bytes\": 16"));
+  EXPECT_NE(std::string::npos, json.str().find("\"children\": []"));
+
+  profiler::reset();
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_profiler, threads)
+{
+  profiler::reset();
+
+  constexpr int NUM_THREADS = 4;
+  std::vector<std::thread> threads;
+  for(int i = 0; i < NUM_THREADS; ++i)
+  {
+    threads.emplace_back([]() {
+      profiler::Region region("worker");
+      leaf();
+    });
+  }
+  for(auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  // the regions of all threads are merged by call path
+  const auto regions = profiler::get_regions();
+  ASSERT_EQ(2u, regions.size());
+  EXPECT_EQ("worker", regions[0].path);
+  EXPECT_EQ(NUM_THREADS, regions[0].calls);
+  EXPECT_EQ(NUM_THREADS, regions[1].calls);
+
+  profiler::reset();
+}
+
+//------------------------------------------------------------------------------
+#ifdef AXOM_USE_MPI
+TEST(utils_profiler, summary)
+{
+  int initialized = 0;
+  MPI_Initialized(&initialized);
+  if(!initialized)
+  {
+    return;
+  }
+
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  profiler::reset();
+  leaf();
+
+  std::ostringstream summary;
+  profiler::write_summary(MPI_COMM_WORLD, summary);
+  if(rank == 0)
+  {
+    EXPECT_NE(std::string::npos, summary.str().find("Max/Avg"));
+    EXPECT_NE(std::string::npos, summary.str().find("leaf"));
+  }
+  else
+  {
+    EXPECT_TRUE(summary.str().empty());
+  }
+
+  profiler::reset();
+}
+#endif
@@ -8,6 +8,7 @@
 #include "axom/core/utilities/Utilities.hpp"
 
 // C/C++ includes
+#include <string>
 #include <type_traits>
 
 //------------------------------------------------------------------------------
@@ -135,3 +136,23 @@ TEST(utils_Utilities, minmax)
     EXPECT_EQ(a, temp_max);
   }
 }
+
+//------------------------------------------------------------------------------
+TEST(utils_Utilities, fnv1aHash)
+{
+  // reference values of the 64-bit FNV-1a hash
+  EXPECT_EQ(0xcbf29ce484222325ULL, axom::utilities::fnv1aHash(nullptr, 0));
+
+  const std::string a = "a";
+  EXPECT_EQ(0xaf63dc4c8601ec8cULL,
+            axom::utilities::fnv1aHash(a.data(), a.size()));
+
+  const std::string foobar = "foobar";
+  EXPECT_EQ(0x85944171f73967e8ULL,
+            axom::utilities::fnv1aHash(foobar.data(), foobar.size()));
+
+  // hashing in two parts hashes the concatenation
+  const axom::uint64 foo = axom::utilities::fnv1aHash(foobar.data(), 3);
+  EXPECT_EQ(0x85944171f73967e8ULL,
+            axom::utilities::fnv1aHash(foobar.data() + 3, 3, foo));
+}
@@ -10,8 +10,20 @@
 
 #ifndef AXOM_USE_CALIPER
   #include "axom/core/utilities/nvtx/interface.hpp"
+  #include "axom/core/utilities/profiler/interface.hpp"
 #endif
 
+/*!
+ * \file
+ *
+ * When Axom is configured with AXOM_ENABLE_ANNOTATIONS, the annotated regions
+ * are timed by the built-in profiler, which keeps a tree of regions per call
+ * path with their calls, inclusive and exclusive times and user counters, and
+ * are also marked as NVTX ranges in CUDA builds.
+ *
+ * \see axom::profiler::write_text_report()
+ */
+
 /*!
  * \def AXOM_PERF_MARK_FUNCTION( name )
  * 
@@ -39,7 +51,8 @@
 #if defined(AXOM_USE_ANNOTATIONS) && defined(AXOM_USE_CALIPER)
   #error "Support for Caliper has not yet been implemented in Axom!"
 #elif defined(AXOM_USE_ANNOTATIONS)
-  #define AXOM_PERF_MARK_FUNCTION(__func_name__) \
+  #define AXOM_PERF_MARK_FUNCTION(__func_name__)              \
+    axom::profiler::Region __func_perf_region(__func_name__); \
     AXOM_NVTX_FUNCTION(__func_name__)
 #else
   #define AXOM_PERF_MARK_FUNCTION(__func_name__)
@@ -88,8 +101,12 @@
 #if defined(AXOM_USE_ANNOTATIONS) && defined(AXOM_USE_CALIPER)
   #error "Support for Caliper has not yet been implemented in Axom!"
 #elif defined(AXOM_USE_ANNOTATIONS)
-  #define AXOM_PERF_MARK_SECTION(__name__, ...) \
-    AXOM_NVTX_SECTION(__name__, __VA_ARGS__)
+  #define AXOM_PERF_MARK_SECTION(__name__, ...)       \
+    do                                                \
+    {                                                 \
+      axom::profiler::Region __perf_region(__name__); \
+      AXOM_NVTX_SECTION(__name__, __VA_ARGS__);       \
+    } while(false)
 #else
   #define AXOM_PERF_MARK_SECTION(__name__, ...) \
     do                                          \
@@ -98,4 +115,32 @@
     } while(false)
 #endif
 
+/*!
+ * \def AXOM_PERF_MARK_COUNTER( name, value )
+ *
+ * \brief The AXOM_PERF_MARK_COUNTER macro adds a value to a user counter, e.g.,
+ *  the number of bytes written, of the enclosing annotated function or section.
+ *
+ * \param [in] name the name of the counter
+ * \param [in] value the value to add to the counter
+ *
+ * Usage Example:
+ * \code
+ *   void write( const char* buffer, std::size_t size )
+ *   {
+ *     AXOM_PERF_MARK_FUNCTION( "write" );
+ *     AXOM_PERF_MARK_COUNTER( "bytes", size );
+ *     ...
+ *   }
+ * \endcode
+ */
+#if defined(AXOM_USE_ANNOTATIONS) && defined(AXOM_USE_CALIPER)
+  #error "Support for Caliper has not yet been implemented in Axom!"
+#elif defined(AXOM_USE_ANNOTATIONS)
+  #define AXOM_PERF_MARK_COUNTER(__name__, __value__) \
+    axom::profiler::add_counter(__name__, static_cast<double>(__value__))
+#else
+  #define AXOM_PERF_MARK_COUNTER(__name__, __value__)
+#endif
+
 #endif
@@ -20,6 +20,7 @@
 
 #include <cassert>  // for assert()
 #include <cmath>    // for log2()
+#include <cstddef>  // for std::size_t
 
 #include <random>       // for random  number generator
 #include <type_traits>  // for std::is_floating_point()
@@ -218,6 +219,28 @@ inline bool isLittleEndian()
   return host_order.value == O32_LITTLE_ENDIAN;
 }
 
+/*!
+ * \brief Computes the 64-bit FNV-1a hash of a sequence of bytes.
+ * \param [in] data pointer to the bytes to hash.
+ * \param [in] num_bytes the number of bytes to hash.
+ * \param [in] hash the hash to start from. Defaults to the FNV offset basis.
+ * \return The hash of the bytes.
+ * \note Passing the hash of one sequence as \a hash to a second call returns
+ *  the hash of the two sequences concatenated.
+ */
+inline axom::uint64 fnv1aHash(const void* data,
+                              std::size_t num_bytes,
+                              axom::uint64 hash = 14695981039346656037ULL)
+{
+  const axom::uint8* bytes = static_cast<const axom::uint8*>(data);
+  for(std::size_t i = 0; i < num_bytes; ++i)
+  {
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
 /*!
  * \brief Swaps the endianness of the input value.
  * \param [in] val The input value.
@@ -0,0 +1,111 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_PROFILER_REGION_HPP_
+#define AXOM_PROFILER_REGION_HPP_
+
+#include "axom/core/Macros.hpp"  // for axom macros
+
+#include <chrono>  // for std::chrono
+#include <string>  // for std::string
+
+namespace axom
+{
+namespace profiler
+{
+namespace internal
+{
+using ClockType = std::chrono::steady_clock;
+
+/*!
+ * \brief A node of the region tree of a thread.
+ * \see interface.cpp
+ */
+struct Node;
+
+/*!
+ * \brief Enters the child region with the given name of the current region of
+ *  the calling thread, creating it on first use.
+ *
+ * \return node the region's node, or nullptr if the profiler is disabled.
+ */
+Node* begin_region(const char* name);
+
+/*!
+ * \brief Leaves the given region of the calling thread, adding the elapsed
+ *  time to its inclusive time and incrementing its number of calls.
+ */
+void end_region(Node* node, ClockType::duration elapsed);
+
+}  // namespace internal
+
+/*!
+ * \class Region
+ *
+ * \brief Region is a scoped timer for the built-in profiler. The lifetime of a
+ *  Region object defines a region of the calling thread's region tree.
+ *
+ *  Regions nest, i.e., a Region created while another Region is alive on the
+ *  same thread is a child of it. A region's node is looked up by name among
+ *  the children of its parent, so repeated calls to a function accumulate into
+ *  one node per call path.
+ *
+ *  Regions are typically created through the AXOM_PERF_MARK_FUNCTION and
+ *  AXOM_PERF_MARK_SECTION macros.
+ *
+ * \see AnnotationMacros.hpp
+ */
+class Region
+{
+public:
+  /*!
+   * \brief Default constructor. Disabled.
+   */
+  Region() = delete;
+
+  /*!
+   * \brief Enters the region with the given name.
+   *
+   * \param [in] name the name of the region
+   *
+   * \pre name != nullptr
+   */
+  explicit Region(const char* name) : m_node(internal::begin_region(name))
+  {
+    if(m_node != nullptr)
+    {
+      m_start = internal::ClockType::now();
+    }
+  }
+
+  /*!
+   * \brief Enters the region with the given name.
+   */
+  explicit Region(const std::string& name) : Region(name.c_str()) { }
+
+  /*!
+   * \brief Destructor. Leaves the region.
+   */
+  ~Region()
+  {
+    if(m_node != nullptr)
+    {
+      internal::end_region(m_node, internal::ClockType::now() - m_start);
+    }
+  }
+
+private:
+  internal::Node* m_node;
+  internal::ClockType::time_point m_start;
+
+  DISABLE_COPY_AND_ASSIGNMENT(Region);
+  DISABLE_MOVE_AND_ASSIGNMENT(Region);
+};
+
+} /* namespace profiler */
+
+} /* namespace axom */
+
+#endif /* AXOM_PROFILER_REGION_HPP_ */
@@ -0,0 +1,510 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/core/utilities/profiler/interface.hpp"
+
+#include "fmt/fmt.hpp"
+
+// C/C++ includes
+#include <algorithm>  // for std::min(), std::max(), std::replace()
+#include <atomic>     // for std::atomic
+#include <map>        // for std::map
+#include <memory>     // for std::unique_ptr
+#include <mutex>      // for std::mutex
+#include <sstream>    // for std::istringstream
+
+namespace axom
+{
+namespace profiler
+{
+namespace internal
+{
+/*!
+ * \brief A node of the region tree of a thread, i.e., a region for a given
+ *  call path.
+ */
+struct Node
+{
+  std::string name;
+  Node* parent;
+  std::vector<std::unique_ptr<Node>> children;
+
+  long calls;               /*!< number of times the region was entered */
+  ClockType::duration time; /*!< inclusive time of all calls */
+  std::vector<std::pair<std::string, double>> counters;
+
+  Node(const char* name_, Node* parent_)
+    : name(name_)
+    , parent(parent_)
+    , calls(0)
+    , time(ClockType::duration::zero())
+  { }
+};
+
+}  // namespace internal
+
+namespace
+{
+using internal::ClockType;
+using internal::Node;
+
+/*!
+ * \brief The region tree of a thread, with the region it is currently in.
+ */
+struct ThreadTree
+{
+  Node root;
+  Node* current;
+
+  ThreadTree() : root("", nullptr), current(&root) { }
+};
+
+/*!
+ * \brief A region merged over the trees of all threads.
+ */
+struct MergedNode
+{
+  std::string name;
+  long calls = 0;
+  ClockType::duration time = ClockType::duration::zero();
+  std::vector<std::pair<std::string, double>> counters;
+  std::vector<std::unique_ptr<MergedNode>> children;
+};
+
+std::atomic<bool> s_enabled(true);
+
+// The trees are owned here rather than by their threads, so that the regions
+// of threads that have exited, e.g., OpenMP threads, are still reported.
+std::mutex s_trees_mutex;
+std::vector<std::unique_ptr<ThreadTree>> s_trees;
+
+thread_local ThreadTree* t_tree = nullptr;
+
+//------------------------------------------------------------------------------
+ThreadTree* get_thread_tree()
+{
+  if(t_tree == nullptr)
+  {
+    std::lock_guard<std::mutex> lock(s_trees_mutex);
+    s_trees.emplace_back(new ThreadTree);
+    t_tree = s_trees.back().get();
+  }
+  return t_tree;
+}
+
+//------------------------------------------------------------------------------
+void add_to(std::vector<std::pair<std::string, double>>& counters,
+            const std::string& name,
+            double value)
+{
+  for(auto& counter : counters)
+  {
+    if(counter.first == name)
+    {
+      counter.second += value;
+      return;
+    }
+  }
+  counters.emplace_back(name, value);
+}
+
+//------------------------------------------------------------------------------
+void merge(const Node& node, MergedNode& merged)
+{
+  for(const auto& child : node.children)
+  {
+    MergedNode* target = nullptr;
+    for(const auto& candidate : merged.children)
+    {
+      if(candidate->name == child->name)
+      {
+        target = candidate.get();
+        break;
+      }
+    }
+
+    if(target == nullptr)
+    {
+      merged.children.emplace_back(new MergedNode);
+      target = merged.children.back().get();
+      target->name = child->name;
+    }
+
+    target->calls += child->calls;
+    target->time += child->time;
+    for(const auto& counter : child->counters)
+    {
+      add_to(target->counters, counter.first, counter.second);
+    }
+
+    merge(*child, *target);
+  }
+}
+
+//------------------------------------------------------------------------------
+void get_merged_tree(MergedNode& root)
+{
+  std::lock_guard<std::mutex> lock(s_trees_mutex);
+  for(const auto& tree : s_trees)
+  {
+    merge(tree->root, root);
+  }
+}
+
+//------------------------------------------------------------------------------
+double to_seconds(ClockType::duration time)
+{
+  return std::chrono::duration<double>(time).count();
+}
+
+//------------------------------------------------------------------------------
+double exclusive_seconds(const MergedNode& node)
+{
+  ClockType::duration time = node.time;
+  for(const auto& child : node.children)
+  {
+    time -= child->time;
+  }
+  return to_seconds(time);
+}
+
+//------------------------------------------------------------------------------
+void flatten(const MergedNode& node,
+             const std::string& path,
+             int depth,
+             std::vector<RegionStats>& regions)
+{
+  for(const auto& child : node.children)
+  {
+    RegionStats stats;
+    stats.name = child->name;
+    stats.path = path.empty() ? child->name : path + "/" + child->name;
+    stats.depth = depth;
+    stats.calls = child->calls;
+    stats.inclusive = to_seconds(child->time);
+    stats.exclusive = exclusive_seconds(*child);
+    stats.counters = child->counters;
+    regions.push_back(stats);
+
+    flatten(*child, stats.path, depth + 1, regions);
+  }
+}
+
+//------------------------------------------------------------------------------
+std::string json_escape(const std::string& str)
+{
+  std::string escaped;
+  for(char c : str)
+  {
+    if(c == '"' || c == '\\')
+    {
+      escaped += '\\';
+      escaped += c;
+    }
+    else if(static_cast<unsigned char>(c) < 0x20)
+    {
+      escaped += fmt::format("\\u{:04x}", static_cast<int>(c));
+    }
+    else
+    {
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
+//------------------------------------------------------------------------------
+void write_json_children(const MergedNode& node, int indent, std::ostream& os)
+{
+  const std::string pad(indent, ' ');
+  os << "[";
+  for(std::size_t i = 0; i < node.children.size(); ++i)
+  {
+    const MergedNode& child = *node.children[i];
+    os << (i > 0 ? "," : "") << "\n" << pad << "  {\n";
+    os << pad << "    \"name\": \"" << json_escape(child.name) << "\",\n";
+    os << pad << "    \"calls\": " << child.calls << ",\n";
+    os << pad << fmt::format("    \"inclusive\": {},\n", to_seconds(child.time));
+    os << pad
+       << fmt::format("    \"exclusive\": {},\n", exclusive_seconds(child));
+
+    os << pad << "    \"counters\": {";
+    for(std::size_t j = 0; j < child.counters.size(); ++j)
+    {
+      os << (j > 0 ? ", " : "")
+         << fmt::format("\"{}\": {}",
+                        json_escape(child.counters[j].first),
+                        child.counters[j].second);
+    }
+    os << "},\n";
+
+    os << pad << "    \"children\": ";
+    write_json_children(child, indent + 4, os);
+    os << "\n" << pad << "  }";
+  }
+  os << (node.children.empty() ? "]" : "\n" + pad + "]");
+}
+
+}  // namespace
+
+namespace internal
+{
+//------------------------------------------------------------------------------
+Node* begin_region(const char* name)
+{
+  if(!s_enabled.load(std::memory_order_relaxed))
+  {
+    return nullptr;
+  }
+
+  ThreadTree* tree = get_thread_tree();
+  Node* parent = tree->current;
+
+  Node* node = nullptr;
+  for(const auto& child : parent->children)
+  {
+    if(child->name == name)
+    {
+      node = child.get();
+      break;
+    }
+  }
+
+  if(node == nullptr)
+  {
+    parent->children.emplace_back(new Node(name, parent));
+    node = parent->children.back().get();
+  }
+
+  tree->current = node;
+  return node;
+}
+
+//------------------------------------------------------------------------------
+void end_region(Node* node, ClockType::duration elapsed)
+{
+  node->time += elapsed;
+  ++node->calls;
+
+  // the calling thread's tree was created when the region was entered
+  t_tree->current = node->parent;
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+// Profiler interface implementation
+//------------------------------------------------------------------------------
+
+void set_enabled(bool enabled) { s_enabled.store(enabled); }
+
+//------------------------------------------------------------------------------
+bool is_enabled() { return s_enabled.load(); }
+
+//------------------------------------------------------------------------------
+void reset()
+{
+  std::lock_guard<std::mutex> lock(s_trees_mutex);
+  for(const auto& tree : s_trees)
+  {
+    tree->root.children.clear();
+    tree->current = &tree->root;
+  }
+}
+
+//------------------------------------------------------------------------------
+void add_counter(const char* name, double value)
+{
+  if(!s_enabled.load(std::memory_order_relaxed))
+  {
+    return;
+  }
+
+  ThreadTree* tree = get_thread_tree();
+  if(tree->current != &tree->root)
+  {
+    add_to(tree->current->counters, name, value);
+  }
+}
+
+//------------------------------------------------------------------------------
+std::vector<RegionStats> get_regions()
+{
+  MergedNode root;
+  get_merged_tree(root);
+
+  std::vector<RegionStats> regions;
+  flatten(root, "", 0, regions);
+  return regions;
+}
+
+//------------------------------------------------------------------------------
+void write_text_report(std::ostream& os)
+{
+  const std::vector<RegionStats> regions = get_regions();
+
+  double total = 0.;
+  for(const auto& region : regions)
+  {
+    total += (region.depth == 0) ? region.inclusive : 0.;
+  }
+
+  os << fmt::format("{:<40} {:>10} {:>14} {:>14} {:>8}\n",
+                    "Region",
+                    "Calls",
+                    "Inclusive (s)",
+                    "Exclusive (s)",
+                    "% Total");
+
+  for(const auto& region : regions)
+  {
+    const std::string label = std::string(2 * region.depth, ' ') + region.name;
+    const double percent = (total > 0.) ? 100. * region.inclusive / total : 0.;
+    os << fmt::format("{:<40} {:>10} {:>14.6f} {:>14.6f} {:>8.2f}",
+                      label,
+                      region.calls,
+                      region.inclusive,
+                      region.exclusive,
+                      percent);
+
+    for(const auto& counter : region.counters)
+    {
+      os << fmt::format("  {}={}", counter.first, counter.second);
+    }
+    os << "\n";
+  }
+}
+
+//------------------------------------------------------------------------------
+void write_json_report(std::ostream& os)
+{
+  MergedNode root;
+  get_merged_tree(root);
+
+  os << "{\n  \"regions\": ";
+  write_json_children(root, 2, os);
+  os << "\n}\n";
+}
+
+//------------------------------------------------------------------------------
+#ifdef AXOM_USE_MPI
+void write_summary(MPI_Comm comm, std::ostream& os)
+{
+  int rank = 0;
+  int nranks = 1;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &nranks);
+
+  // serialize the regions of this rank, one per line
+  std::string local;
+  for(const auto& region : get_regions())
+  {
+    std::string name = region.name;
+    std::string path = region.path;
+    std::replace(name.begin(), name.end(), '\t', ' ');
+    std::replace(name.begin(), name.end(), '\n', ' ');
+    std::replace(path.begin(), path.end(), '\t', ' ');
+    std::replace(path.begin(), path.end(), '\n', ' ');
+    local += fmt::format("{}\t{}\t{}\t{:.9e}\n",
+                         region.depth,
+                         path,
+                         name,
+                         region.inclusive);
+  }
+
+  // gather the regions of all ranks on rank 0
+  int local_size = static_cast<int>(local.size());
+  std::vector<int> sizes(nranks, 0);
+  MPI_Gather(&local_size, 1, MPI_INT, sizes.data(), 1, MPI_INT, 0, comm);
+
+  std::vector<int> offsets(nranks, 0);
+  for(int i = 1; i < nranks; ++i)
+  {
+    offsets[i] = offsets[i - 1] + sizes[i - 1];
+  }
+
+  std::string all(rank == 0 ? offsets.back() + sizes.back() : 0, '\0');
+  MPI_Gatherv(const_cast<char*>(local.data()),
+              local_size,
+              MPI_CHAR,
+              &all[0],
+              sizes.data(),
+              offsets.data(),
+              MPI_CHAR,
+              0,
+              comm);
+
+  if(rank != 0)
+  {
+    return;
+  }
+
+  struct Summary
+  {
+    int depth;
+    std::string name;
+    double min;
+    double max;
+    double sum;
+    int ranks;
+  };
+
+  // merge by call path, in the order of rank 0's regions
+  std::vector<Summary> summaries;
+  std::map<std::string, std::size_t> index;
+
+  std::istringstream lines(all);
+  std::string line;
+  while(std::getline(lines, line))
+  {
+    std::istringstream fields(line);
+    std::string depth, path, name, time;
+    std::getline(fields, depth, '\t');
+    std::getline(fields, path, '\t');
+    std::getline(fields, name, '\t');
+    std::getline(fields, time, '\t');
+    const double seconds = std::stod(time);
+
+    auto it = index.find(path);
+    if(it == index.end())
+    {
+      index[path] = summaries.size();
+      summaries.push_back({std::stoi(depth), name, seconds, seconds, 0., 0});
+      it = index.find(path);
+    }
+
+    Summary& summary = summaries[it->second];
+    summary.min = std::min(summary.min, seconds);
+    summary.max = std::max(summary.max, seconds);
+    summary.sum += seconds;
+    ++summary.ranks;
+  }
+
+  os << fmt::format("{:<40} {:>6} {:>12} {:>12} {:>12} {:>8}\n",
+                    "Region",
+                    "Ranks",
+                    "Min (s)",
+                    "Max (s)",
+                    "Avg (s)",
+                    "Max/Avg");
+
+  for(const auto& summary : summaries)
+  {
+    const std::string label = std::string(2 * summary.depth, ' ') + summary.name;
+    const double avg = summary.sum / summary.ranks;
+    os << fmt::format("{:<40} {:>6} {:>12.6f} {:>12.6f} {:>12.6f} {:>8.2f}\n",
+                      label,
+                      summary.ranks,
+                      summary.min,
+                      summary.max,
+                      avg,
+                      (avg > 0.) ? summary.max / avg : 1.);
+  }
+}
+#endif
+
+} /* namespace profiler */
+
+} /* namespace axom */
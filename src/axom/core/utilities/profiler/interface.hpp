@@ -0,0 +1,117 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_PROFILER_INTERFACE_HPP_
+#define AXOM_PROFILER_INTERFACE_HPP_
+
+#include "axom/config.hpp"  // for compile-time definitions
+#include "axom/core/utilities/profiler/Region.hpp"
+
+#ifdef AXOM_USE_MPI
+  #include <mpi.h>
+#endif
+
+// C/C++ includes
+#include <ostream>  // for std::ostream
+#include <string>   // for std::string
+#include <utility>  // for std::pair
+#include <vector>   // for std::vector
+
+namespace axom
+{
+namespace profiler
+{
+/*!
+ * \brief Holds the measurements of a region, merged over all threads.
+ */
+struct RegionStats
+{
+  std::string name; /*!< the name of the region */
+  std::string path; /*!< the names of the region and its ancestors */
+  int depth;        /*!< the number of ancestors of the region */
+  long calls;       /*!< the number of times the region was entered */
+  double inclusive; /*!< wall time in the region, in seconds */
+  double exclusive; /*!< inclusive time minus that of the child regions */
+
+  /*! the user counters of the region, in the order they were first added */
+  std::vector<std::pair<std::string, double>> counters;
+};
+
+/*!
+ * \brief Enables or disables the profiler at runtime.
+ *
+ *  When the profiler is disabled, entering a region only costs a check of
+ *  this flag. The profiler is enabled by default.
+ */
+void set_enabled(bool enabled);
+
+/*!
+ * \brief Checks if the profiler is enabled.
+ */
+bool is_enabled();
+
+/*!
+ * \brief Discards all regions and counters of all threads.
+ *
+ * \pre No thread is within a region.
+ */
+void reset();
+
+/*!
+ * \brief Adds the given value to the counter with the given name of the
+ *  current region of the calling thread, e.g., to record bytes written or
+ *  items processed.
+ *
+ * \note Counters added outside of any region are ignored.
+ */
+void add_counter(const char* name, double value);
+
+/*!
+ * \brief Returns the regions of all threads, merged by call path, in
+ *  depth-first order.
+ *
+ *  Regions entered on different threads with the same call path, e.g., in an
+ *  OpenMP parallel region, are merged. Their inclusive times are summed, so
+ *  they may exceed the wall time of their parent.
+ *
+ * \pre No thread other than the calling thread is within a region.
+ */
+std::vector<RegionStats> get_regions();
+
+/*!
+ * \brief Writes an indented table of the regions of this process to the given
+ *  stream, with their calls, inclusive and exclusive times and counters.
+ *
+ * \pre No thread other than the calling thread is within a region.
+ */
+void write_text_report(std::ostream& os);
+
+/*!
+ * \brief Writes the region tree of this process to the given stream in JSON
+ *  format, as nested objects with a "children" array.
+ *
+ * \pre No thread other than the calling thread is within a region.
+ */
+void write_json_report(std::ostream& os);
+
+#ifdef AXOM_USE_MPI
+/*!
+ * \brief Writes the minimum, maximum and average inclusive time of each region
+ *  over the ranks of the given communicator to the given stream on rank 0.
+ *
+ *  Regions are matched by call path. A region that was entered on some ranks
+ *  only is averaged over those ranks.
+ *
+ * \note This is a collective operation over comm.
+ * \pre No thread other than the calling thread is within a region.
+ */
+void write_summary(MPI_Comm comm, std::ostream& os);
+#endif
+
+} /* namespace profiler */
+
+} /* namespace axom */
+
+#endif /* AXOM_PROFILER_INTERFACE_HPP_ */
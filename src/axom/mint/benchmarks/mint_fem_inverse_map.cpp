@@ -0,0 +1,152 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+#include "axom/mint.hpp"
+#include "axom/slic.hpp"
+
+namespace mint = axom::mint;
+namespace numerics = axom::numerics;
+using axom::IndexType;
+
+//------------------------------------------------------------------------------
+namespace
+{
+// Nodes of a distorted hexahedron, in the column-major layout expected by
+// both FiniteElement and FiniteElementT
+double HEX_NODES[] = {0.0, 0.0, 0.0, 1.1, 0.1, 0.0, 1.2, 1.0, 0.1,
+                      0.1, 0.9, 0.0, 0.0, 0.1, 1.0, 1.0, 0.0, 1.1,
+                      1.1, 1.2, 1.0, 0.0, 1.0, 0.9};
+
+// Generates npts query points in the bounding box of the hexahedron
+std::vector<double> generatePoints(IndexType npts)
+{
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(-0.1, 1.3);
+
+  std::vector<double> xp(3 * npts);
+  for(double& x : xp)
+  {
+    x = dist(gen);
+  }
+
+  return xp;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// Inverse map of many points with a single FiniteElement
+void inverseMap_dynamic(benchmark::State& state)
+{
+  const IndexType npts = state.range_x();
+  const std::vector<double> xp = generatePoints(npts);
+  std::vector<double> xr(3 * npts);
+  std::vector<int> status(npts);
+
+  numerics::Matrix<double> nodes(3, 8, HEX_NODES, true);
+  mint::FiniteElement fe(nodes, mint::HEX, true);
+  mint::bind_basis<MINT_LAGRANGE_BASIS, mint::HEX>(fe);
+
+  while(state.KeepRunning())
+  {
+    for(IndexType i = 0; i < npts; ++i)
+    {
+      status[i] = fe.computeReferenceCoords(&xp[3 * i], &xr[3 * i]);
+    }
+    benchmark::DoNotOptimize(status.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * npts);
+}
+BENCHMARK(inverseMap_dynamic)->Arg(1 << 10)->Arg(1 << 16);
+
+//------------------------------------------------------------------------------
+// Inverse map of many points with the batched FiniteElementT method
+void inverseMap_fixed(benchmark::State& state)
+{
+  const IndexType npts = state.range_x();
+  const std::vector<double> xp = generatePoints(npts);
+  std::vector<double> xr(3 * npts);
+  std::vector<int> status(npts);
+
+  mint::FiniteElementT<mint::HEX> fe(HEX_NODES);
+
+  while(state.KeepRunning())
+  {
+    fe.computeReferenceCoords(npts, xp.data(), xr.data(), status.data());
+    benchmark::DoNotOptimize(status.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * npts);
+}
+BENCHMARK(inverseMap_fixed)->Arg(1 << 10)->Arg(1 << 16);
+
+//------------------------------------------------------------------------------
+// Point-in-cell style query, constructing a FiniteElement for every point
+void pointInCell_dynamic(benchmark::State& state)
+{
+  const IndexType npts = state.range_x();
+  const std::vector<double> xp = generatePoints(npts);
+  double xr[3];
+
+  while(state.KeepRunning())
+  {
+    IndexType numInside = 0;
+    for(IndexType i = 0; i < npts; ++i)
+    {
+      numerics::Matrix<double> nodes(3, 8, HEX_NODES, true);
+      mint::FiniteElement fe(nodes, mint::HEX, true);
+      mint::bind_basis<MINT_LAGRANGE_BASIS, mint::HEX>(fe);
+
+      const int rc = fe.computeReferenceCoords(&xp[3 * i], xr);
+      numInside += (rc == mint::INSIDE_ELEMENT) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(numInside);
+  }
+
+  state.SetItemsProcessed(state.iterations() * npts);
+}
+BENCHMARK(pointInCell_dynamic)->Arg(1 << 16);
+
+//------------------------------------------------------------------------------
+// Point-in-cell style query, constructing a FiniteElementT for every point
+void pointInCell_fixed(benchmark::State& state)
+{
+  const IndexType npts = state.range_x();
+  const std::vector<double> xp = generatePoints(npts);
+  double xr[3];
+
+  while(state.KeepRunning())
+  {
+    IndexType numInside = 0;
+    for(IndexType i = 0; i < npts; ++i)
+    {
+      mint::FiniteElementT<mint::HEX> fe(HEX_NODES);
+
+      const int rc = fe.computeReferenceCoords(&xp[3 * i], xr);
+      numInside += (rc == mint::INSIDE_ELEMENT) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(numInside);
+  }
+
+  state.SetItemsProcessed(state.iterations() * npts);
+}
+BENCHMARK(pointInCell_fixed)->Arg(1 << 16);
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+
+  axom::slic::SimpleLogger logger;  // create & initialize test logger,
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
@@ -0,0 +1,264 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <type_traits>
+#include <utility>
+
+#include "benchmark/benchmark_api.h"
+#include "axom/config.hpp"
+#include "axom/mint.hpp"
+#include "axom/slic.hpp"
+
+#ifdef AXOM_USE_OPENMP
+  #include <omp.h>
+#endif
+
+namespace mint = axom::mint;
+using axom::IndexType;
+
+//------------------------------------------------------------------------------
+namespace
+{
+const double ALPHA = 0.1;
+
+/*!
+ * \brief Holds the two temperature fields of an explicit heat equation
+ *  solver on an N x N x N node uniform mesh.
+ */
+struct HeatProblem
+{
+  explicit HeatProblem(IndexType N)
+    : lo {0.0, 0.0, 0.0}
+    , hi {1.0, 1.0, 1.0}
+    , mesh(lo, hi, N, N, N)
+  {
+    u = mesh.createField<double>("u", mint::NODE_CENTERED);
+    unew = mesh.createField<double>("unew", mint::NODE_CENTERED);
+
+    const IndexType numNodes = mesh.getNumberOfNodes();
+    for(IndexType i = 0; i < numNodes; ++i)
+    {
+      u[i] = (i % 7) * 0.25;
+      unew[i] = u[i];
+    }
+  }
+
+  // Advances the solution one explicit time step of the 7-point stencil,
+  // visiting the nodes with the given ijk traversal
+  template <typename Traversal>
+  void step(const Traversal& traverse)
+  {
+    const IndexType Ni = mesh.getNodeResolution(mint::I_DIRECTION);
+    const IndexType Nj = mesh.getNodeResolution(mint::J_DIRECTION);
+    const IndexType Nk = mesh.getNodeResolution(mint::K_DIRECTION);
+    const IndexType jp = mesh.nodeJp();
+    const IndexType kp = mesh.nodeKp();
+    const double* in = u;
+    double* out = unew;
+
+    traverse(
+      Ni,
+      Nj,
+      Nk,
+      AXOM_LAMBDA(IndexType i, IndexType j, IndexType k) {
+        const IndexType idx = i + j * jp + k * kp;
+        if(i == 0 || j == 0 || k == 0 || i == Ni - 1 || j == Nj - 1 ||
+           k == Nk - 1)
+        {
+          out[idx] = in[idx];
+          return;
+        }
+
+        const double lap = in[idx - 1] + in[idx + 1] + in[idx - jp] +
+          in[idx + jp] + in[idx - kp] + in[idx + kp] - 6.0 * in[idx];
+        out[idx] = in[idx] + ALPHA * lap;
+      });
+
+    std::swap(u, unew);
+  }
+
+  double lo[3];
+  double hi[3];
+  mint::UniformMesh mesh;
+  double* u;
+  double* unew;
+};
+
+// The ijk traversals compared by the benchmarks
+struct SeqTraversal
+{
+  template <typename KernelType>
+  void operator()(IndexType Ni,
+                  IndexType Nj,
+                  IndexType Nk,
+                  KernelType&& kernel) const
+  {
+    mint::internal::structured_loop3d<axom::SEQ_EXEC>(Ni, Nj, Nk, kernel);
+  }
+};
+
+struct UntiledTraversal
+{
+  template <typename KernelType>
+  void operator()(IndexType Ni,
+                  IndexType Nj,
+                  IndexType Nk,
+                  KernelType&& kernel) const
+  {
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel
+#endif
+    {
+      typename std::decay<KernelType>::type body(kernel);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp for schedule(static)
+#endif
+      for(IndexType k = 0; k < Nk; ++k)
+      {
+        for(IndexType j = 0; j < Nj; ++j)
+        {
+          for(IndexType i = 0; i < Ni; ++i)
+          {
+            body(i, j, k);
+          }
+        }
+      }
+    }
+  }
+};
+
+struct TiledTraversal
+{
+  template <typename KernelType>
+  void operator()(IndexType Ni,
+                  IndexType Nj,
+                  IndexType Nk,
+                  KernelType&& kernel) const
+  {
+    mint::internal::omp_tiled_loop3d(Ni, Nj, Nk, kernel);
+  }
+};
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+struct RajaOmpTraversal
+{
+  template <typename KernelType>
+  void operator()(IndexType Ni,
+                  IndexType Nj,
+                  IndexType Nk,
+                  KernelType&& kernel) const
+  {
+    mint::internal::structured_loop3d<axom::OMP_EXEC>(Ni, Nj, Nk, kernel);
+  }
+};
+#endif
+
+// Sets the number of OpenMP threads for the duration of a benchmark
+void setNumThreads(int nthreads)
+{
+#ifdef AXOM_USE_OPENMP
+  omp_set_num_threads(nthreads);
+#else
+  AXOM_UNUSED_VAR(nthreads);
+#endif
+}
+
+// Registers the mesh sizes and thread counts of the parallel benchmarks
+void ParallelArgs(benchmark::internal::Benchmark* b)
+{
+  const int sizes[] = {64, 256, 512};
+  const int threads[] = {1, 2, 4, 8};
+  for(int N : sizes)
+  {
+    for(int t : threads)
+    {
+      b->ArgPair(N, t);
+    }
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// Time step with the sequential for_all_nodes ijk traversal
+void heat_seq(benchmark::State& state)
+{
+  HeatProblem problem(state.range_x());
+
+  while(state.KeepRunning())
+  {
+    problem.step(SeqTraversal());
+  }
+
+  state.SetItemsProcessed(state.iterations() *
+                          problem.mesh.getNumberOfNodes());
+}
+BENCHMARK(heat_seq)->Arg(64)->Arg(256)->Arg(512);
+
+//------------------------------------------------------------------------------
+// Time step with a plain OpenMP loop over the K planes, without tiling
+void heat_omp_untiled(benchmark::State& state)
+{
+  HeatProblem problem(state.range_x());
+  setNumThreads(state.range_y());
+
+  while(state.KeepRunning())
+  {
+    problem.step(UntiledTraversal());
+  }
+
+  state.SetItemsProcessed(state.iterations() *
+                          problem.mesh.getNumberOfNodes());
+}
+BENCHMARK(heat_omp_untiled)->Apply(ParallelArgs);
+
+//------------------------------------------------------------------------------
+// Time step with the native OpenMP tiled traversal
+void heat_omp_tiled(benchmark::State& state)
+{
+  HeatProblem problem(state.range_x());
+  setNumThreads(state.range_y());
+
+  while(state.KeepRunning())
+  {
+    problem.step(TiledTraversal());
+  }
+
+  state.SetItemsProcessed(state.iterations() *
+                          problem.mesh.getNumberOfNodes());
+}
+BENCHMARK(heat_omp_tiled)->Apply(ParallelArgs);
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+//------------------------------------------------------------------------------
+// Time step with the RAJA OpenMP tiled policy used by for_all_nodes ijk
+void heat_raja_omp(benchmark::State& state)
+{
+  HeatProblem problem(state.range_x());
+  setNumThreads(state.range_y());
+
+  while(state.KeepRunning())
+  {
+    problem.step(RajaOmpTraversal());
+  }
+
+  state.SetItemsProcessed(state.iterations() *
+                          problem.mesh.getNumberOfNodes());
+}
+BENCHMARK(heat_raja_omp)->Apply(ParallelArgs);
+#endif
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+
+  axom::slic::SimpleLogger logger;  // create & initialize test logger,
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
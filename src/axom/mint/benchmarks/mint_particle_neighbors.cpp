@@ -0,0 +1,229 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+#include "axom/mint.hpp"
+#include "axom/slic.hpp"
+
+namespace mint = axom::mint;
+using axom::IndexType;
+
+//------------------------------------------------------------------------------
+namespace
+{
+// Particles are placed in the unit cube, with about 30 particles within the
+// cutoff radius of each particle regardless of the number of particles
+constexpr double NEIGHBORS_PER_PARTICLE = 30.0;
+constexpr double SKIN_FRACTION = 0.2;
+
+double cutoffRadius(IndexType npts)
+{
+  return std::cbrt(3.0 * NEIGHBORS_PER_PARTICLE / (4.0 * M_PI * npts));
+}
+
+mint::ParticleMesh* buildParticles(IndexType npts)
+{
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+  auto particles = new mint::ParticleMesh(3, npts);
+  for(int d = 0; d < 3; ++d)
+  {
+    double* x = particles->getCoordinateArray(d);
+    for(IndexType i = 0; i < npts; ++i)
+    {
+      x[i] = dist(gen);
+    }
+  }
+
+  return particles;
+}
+
+// Adds the force of particle j on particle i if it is within the cutoff
+inline void addForce(const double* x,
+                     const double* y,
+                     const double* z,
+                     IndexType i,
+                     IndexType j,
+                     double r2,
+                     double* f)
+{
+  const double dx = x[j] - x[i];
+  const double dy = y[j] - y[i];
+  const double dz = z[j] - z[i];
+  const double d2 = dx * dx + dy * dy + dz * dz;
+  if(d2 <= r2)
+  {
+    const double invdist = 1.0 / std::sqrt(d2 + 1.e-9);
+    const double invdist3 = invdist * invdist * invdist;
+    f[0] += dx * invdist3;
+    f[1] += dy * invdist3;
+    f[2] += dz * invdist3;
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// Cutoff forces with the double loop over all pairs of particles, as in the
+// mint_nbody_solver example
+void forces_allPairs(benchmark::State& state)
+{
+  const IndexType npts = state.range_x();
+  mint::ParticleMesh* particles = buildParticles(npts);
+  const double* x = particles->getCoordinateArray(mint::X_COORDINATE);
+  const double* y = particles->getCoordinateArray(mint::Y_COORDINATE);
+  const double* z = particles->getCoordinateArray(mint::Z_COORDINATE);
+  const double r = cutoffRadius(npts);
+
+  std::vector<double> f(3 * npts);
+  while(state.KeepRunning())
+  {
+    for(IndexType i = 0; i < npts; ++i)
+    {
+      double fi[3] = {0.0, 0.0, 0.0};
+      for(IndexType j = 0; j < npts; ++j)
+      {
+        if(j != i)
+        {
+          addForce(x, y, z, i, j, r * r, fi);
+        }
+      }
+      std::copy(fi, fi + 3, &f[3 * i]);
+    }
+    benchmark::DoNotOptimize(f.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * npts);
+  delete particles;
+}
+BENCHMARK(forces_allPairs)->Arg(1 << 12)->Arg(1 << 14);
+
+//------------------------------------------------------------------------------
+// Cutoff forces with neighbor lists that are rebuilt on every iteration
+void forces_neighborList(benchmark::State& state)
+{
+  const IndexType npts = state.range_x();
+  mint::ParticleMesh* particles = buildParticles(npts);
+  const double* x = particles->getCoordinateArray(mint::X_COORDINATE);
+  const double* y = particles->getCoordinateArray(mint::Y_COORDINATE);
+  const double* z = particles->getCoordinateArray(mint::Z_COORDINATE);
+  const double r = cutoffRadius(npts);
+
+  mint::ParticleNeighborList neighbors(r);
+
+  std::vector<double> f(3 * npts);
+  while(state.KeepRunning())
+  {
+    neighbors.build(particles);
+    for(IndexType i = 0; i < npts; ++i)
+    {
+      double fi[3] = {0.0, 0.0, 0.0};
+      const IndexType* nbrs = neighbors.getNeighbors(i);
+      for(IndexType k = 0; k < neighbors.getNumberOfNeighbors(i); ++k)
+      {
+        addForce(x, y, z, i, nbrs[k], r * r, fi);
+      }
+      std::copy(fi, fi + 3, &f[3 * i]);
+    }
+    benchmark::DoNotOptimize(f.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * npts);
+  delete particles;
+}
+BENCHMARK(forces_neighborList)->Arg(1 << 12)->Arg(1 << 14)->Arg(1 << 20);
+
+//------------------------------------------------------------------------------
+// Builds the neighbor lists of particles reordered in bin order, which is
+// done once, e.g., after the initial setup of a simulation
+void build_reordered(benchmark::State& state)
+{
+  const IndexType npts = state.range_x();
+  mint::ParticleMesh* particles = buildParticles(npts);
+  const double r = cutoffRadius(npts);
+
+  mint::ParticleNeighborList neighbors(r);
+  neighbors.build(particles, true);
+
+  while(state.KeepRunning())
+  {
+    neighbors.build(particles);
+    benchmark::DoNotOptimize(neighbors.getNeighborsArray());
+  }
+
+  state.SetItemsProcessed(state.iterations() * npts);
+  delete particles;
+}
+BENCHMARK(build_reordered)->Arg(1 << 20);
+
+//------------------------------------------------------------------------------
+// Cutoff forces over a few time steps with a skin distance, the lists are
+// only rebuilt when a particle has moved more than half the skin distance
+void forces_skin(benchmark::State& state)
+{
+  const IndexType npts = state.range_x();
+  mint::ParticleMesh* particles = buildParticles(npts);
+  double* x = particles->getCoordinateArray(mint::X_COORDINATE);
+  const double* y = particles->getCoordinateArray(mint::Y_COORDINATE);
+  const double* z = particles->getCoordinateArray(mint::Z_COORDINATE);
+  const double r = cutoffRadius(npts);
+  const double skin = SKIN_FRACTION * r;
+
+  // each step moves the particles by a tenth of the skin distance, so the
+  // lists are rebuilt every five steps
+  constexpr int NUM_STEPS = 10;
+  const double dx = 0.1 * skin;
+
+  mint::ParticleNeighborList neighbors(r, skin);
+
+  std::vector<double> f(3 * npts);
+  while(state.KeepRunning())
+  {
+    for(int step = 0; step < NUM_STEPS; ++step)
+    {
+      neighbors.update(particles);
+      for(IndexType i = 0; i < npts; ++i)
+      {
+        double fi[3] = {0.0, 0.0, 0.0};
+        const IndexType* nbrs = neighbors.getNeighbors(i);
+        for(IndexType k = 0; k < neighbors.getNumberOfNeighbors(i); ++k)
+        {
+          addForce(x, y, z, i, nbrs[k], r * r, fi);
+        }
+        std::copy(fi, fi + 3, &f[3 * i]);
+      }
+
+      for(IndexType i = 0; i < npts; ++i)
+      {
+        x[i] += dx;
+      }
+    }
+    benchmark::DoNotOptimize(f.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * NUM_STEPS * npts);
+  state.SetLabel("builds=" + std::to_string(neighbors.getNumberOfBuilds()));
+  delete particles;
+}
+BENCHMARK(forces_skin)->Arg(1 << 14)->Arg(1 << 20);
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+
+  axom::slic::SimpleLogger logger;  // create & initialize test logger,
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
@@ -0,0 +1,143 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+#include "axom/mint.hpp"
+#include "axom/slic.hpp"
+
+namespace mint = axom::mint;
+using axom::IndexType;
+
+//------------------------------------------------------------------------------
+namespace
+{
+const int SHUFFLED = -1;
+
+// Creates an N x N x N hex mesh whose nodes and cells are numbered randomly,
+// as they may be after mesh generation or partitioning, then applies the
+// given ordering. The mesh holds a node field and a cell field.
+mint::UnstructuredMesh<mint::SINGLE_SHAPE>* buildMesh(int N, int ordering)
+{
+  const IndexType np = N + 1;
+  auto* mesh = new mint::UnstructuredMesh<mint::SINGLE_SHAPE>(3,
+                                                              mint::HEX,
+                                                              np * np * np,
+                                                              N * N * N);
+
+  for(IndexType k = 0; k < np; ++k)
+  {
+    for(IndexType j = 0; j < np; ++j)
+    {
+      for(IndexType i = 0; i < np; ++i)
+      {
+        mesh->appendNode(i, j, k);
+      }
+    }
+  }
+
+  for(IndexType k = 0; k < N; ++k)
+  {
+    for(IndexType j = 0; j < N; ++j)
+    {
+      for(IndexType i = 0; i < N; ++i)
+      {
+        const IndexType n0 = i + j * np + k * np * np;
+        const IndexType cell[8] = {n0,
+                                   n0 + 1,
+                                   n0 + 1 + np,
+                                   n0 + np,
+                                   n0 + np * np,
+                                   n0 + 1 + np * np,
+                                   n0 + 1 + np + np * np,
+                                   n0 + np + np * np};
+        mesh->appendCell(cell);
+      }
+    }
+  }
+
+  std::mt19937 gen(12345);
+  std::vector<IndexType> node_order(mesh->getNumberOfNodes());
+  std::vector<IndexType> cell_order(mesh->getNumberOfCells());
+  std::iota(node_order.begin(), node_order.end(), 0);
+  std::iota(cell_order.begin(), cell_order.end(), 0);
+  std::shuffle(node_order.begin(), node_order.end(), gen);
+  std::shuffle(cell_order.begin(), cell_order.end(), gen);
+  mesh->renumber(node_order.data(), cell_order.data());
+
+  if(ordering != SHUFFLED)
+  {
+    mint::reorder_mesh(mesh, ordering, node_order, cell_order);
+  }
+
+  double* u = mesh->createField<double>("u", mint::NODE_CENTERED);
+  const double* x = mesh->getCoordinateArray(mint::X_COORDINATE);
+  for(IndexType i = 0; i < mesh->getNumberOfNodes(); ++i)
+  {
+    u[i] = x[i];
+  }
+  mesh->createField<double>("ubar", mint::CELL_CENTERED);
+
+  return mesh;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// Gathers a node field to the cells, with the mesh numbered randomly or by
+// one of the reorderings. Arguments are the number of cells along each axis
+// and the ordering, where -1 leaves the random numbering in place.
+void gatherNodesToCells(benchmark::State& state)
+{
+  const int N = state.range_x();
+  const int ordering = state.range_y();
+
+  mint::UnstructuredMesh<mint::SINGLE_SHAPE>* mesh = buildMesh(N, ordering);
+  const double* u = mesh->getFieldPtr<double>("u", mint::NODE_CENTERED);
+  double* ubar = mesh->getFieldPtr<double>("ubar", mint::CELL_CENTERED);
+
+  while(state.KeepRunning())
+  {
+    mint::for_all_cells<axom::SEQ_EXEC, mint::xargs::nodeids>(
+      mesh,
+      AXOM_LAMBDA(IndexType cellID, const IndexType* nodeIDs, IndexType n) {
+        double sum = 0.0;
+        for(IndexType i = 0; i < n; ++i)
+        {
+          sum += u[nodeIDs[i]];
+        }
+        ubar[cellID] = sum / n;
+      });
+    benchmark::DoNotOptimize(ubar);
+  }
+
+  state.SetItemsProcessed(state.iterations() * mesh->getNumberOfCells());
+  delete mesh;
+}
+BENCHMARK(gatherNodesToCells)
+  ->ArgPair(64, SHUFFLED)
+  ->ArgPair(64, mint::HILBERT_ORDERING)
+  ->ArgPair(64, mint::MORTON_ORDERING)
+  ->ArgPair(64, mint::RCM_ORDERING)
+  ->ArgPair(128, SHUFFLED)
+  ->ArgPair(128, mint::HILBERT_ORDERING)
+  ->ArgPair(128, mint::MORTON_ORDERING)
+  ->ArgPair(128, mint::RCM_ORDERING);
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+
+  axom::slic::SimpleLogger logger;  // create & initialize test logger,
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
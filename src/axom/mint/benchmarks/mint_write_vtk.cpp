@@ -0,0 +1,165 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <cstdio>
+#include <string>
+
+#include "benchmark/benchmark_api.h"
+#include "axom/mint.hpp"
+#include "axom/slic.hpp"
+
+namespace mint = axom::mint;
+using axom::IndexType;
+
+//------------------------------------------------------------------------------
+namespace
+{
+const std::string FILE_PATH = "mint_write_vtk_benchmark";
+
+/*!
+ * \brief Builds a hexahedral UnstructuredMesh with N x N x N cells, with a
+ *  scalar and a vector node-centered field and a scalar cell-centered field.
+ */
+mint::UnstructuredMesh<mint::SINGLE_SHAPE>* buildMesh(IndexType N)
+{
+  const IndexType Nn = N + 1;
+  const IndexType numNodes = Nn * Nn * Nn;
+  const IndexType numCells = N * N * N;
+
+  auto mesh = new mint::UnstructuredMesh<mint::SINGLE_SHAPE>(3,
+                                                             mint::HEX,
+                                                             numNodes,
+                                                             numCells);
+
+  const double h = 1.0 / N;
+  for(IndexType k = 0; k < Nn; ++k)
+  {
+    for(IndexType j = 0; j < Nn; ++j)
+    {
+      for(IndexType i = 0; i < Nn; ++i)
+      {
+        mesh->appendNode(i * h, j * h, k * h);
+      }
+    }
+  }
+
+  for(IndexType k = 0; k < N; ++k)
+  {
+    for(IndexType j = 0; j < N; ++j)
+    {
+      for(IndexType i = 0; i < N; ++i)
+      {
+        const IndexType n0 = i + j * Nn + k * Nn * Nn;
+        const IndexType cell[] = {n0,
+                                  n0 + 1,
+                                  n0 + 1 + Nn,
+                                  n0 + Nn,
+                                  n0 + Nn * Nn,
+                                  n0 + 1 + Nn * Nn,
+                                  n0 + 1 + Nn + Nn * Nn,
+                                  n0 + Nn + Nn * Nn};
+        mesh->appendCell(cell);
+      }
+    }
+  }
+
+  double* u = mesh->createField<double>("u", mint::NODE_CENTERED);
+  double* v = mesh->createField<double>("v", mint::NODE_CENTERED, 3);
+  for(IndexType i = 0; i < numNodes; ++i)
+  {
+    u[i] = 0.5 * i;
+    v[3 * i] = v[3 * i + 1] = v[3 * i + 2] = 0.25 * i;
+  }
+
+  int* id = mesh->createField<int>("id", mint::CELL_CENTERED);
+  for(IndexType i = 0; i < numCells; ++i)
+  {
+    id[i] = static_cast<int>(i);
+  }
+
+  return mesh;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// Writes the mesh in the legacy ASCII VTK format
+void write_legacy_ascii(benchmark::State& state)
+{
+  auto mesh = buildMesh(state.range_x());
+  const std::string path = FILE_PATH + ".vtk";
+
+  while(state.KeepRunning())
+  {
+    mint::write_vtk(mesh, path, mint::VTK_ASCII);
+  }
+
+  std::remove(path.c_str());
+  delete mesh;
+}
+BENCHMARK(write_legacy_ascii)->Arg(32)->Arg(64);
+
+//------------------------------------------------------------------------------
+// Writes the mesh in the legacy binary VTK format
+void write_legacy_binary(benchmark::State& state)
+{
+  auto mesh = buildMesh(state.range_x());
+  const std::string path = FILE_PATH + ".vtk";
+
+  while(state.KeepRunning())
+  {
+    mint::write_vtk(mesh, path, mint::VTK_BINARY);
+  }
+
+  std::remove(path.c_str());
+  delete mesh;
+}
+BENCHMARK(write_legacy_binary)->Arg(32)->Arg(64);
+
+//------------------------------------------------------------------------------
+// Writes the mesh to a VTU file with raw appended data
+void write_vtu_raw(benchmark::State& state)
+{
+  auto mesh = buildMesh(state.range_x());
+  const std::string path = FILE_PATH + ".vtu";
+
+  while(state.KeepRunning())
+  {
+    mint::write_vtu(mesh, path, mint::VTU_RAW);
+  }
+
+  std::remove(path.c_str());
+  delete mesh;
+}
+BENCHMARK(write_vtu_raw)->Arg(32)->Arg(64);
+
+//------------------------------------------------------------------------------
+// Writes the mesh to a VTU file with base64 encoded appended data
+void write_vtu_base64(benchmark::State& state)
+{
+  auto mesh = buildMesh(state.range_x());
+  const std::string path = FILE_PATH + ".vtu";
+
+  while(state.KeepRunning())
+  {
+    mint::write_vtu(mesh, path, mint::VTU_BASE64);
+  }
+
+  std::remove(path.c_str());
+  delete mesh;
+}
+BENCHMARK(write_vtu_base64)->Arg(32)->Arg(64);
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+
+  axom::slic::SimpleLogger logger;  // create & initialize test logger,
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
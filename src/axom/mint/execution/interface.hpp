@@ -127,6 +127,11 @@ namespace mint
  *    { ... }
  *  );
  *
+ *  for_all_nodes< exec, xargs::cellids >( m,
+ *    AXOM_LAMBDA( IndexType nodeIdx, const IndexType* cells, IndexType N)
+ *    { ... }
+ *  );
+ *
  * \endcode
  *
  * \see execution_space.hpp
@@ -67,35 +67,13 @@ inline void for_all_cells_impl(xargs::ij,
   const IndexType Ni = m.getCellResolution(I_DIRECTION);
   const IndexType Nj = m.getCellResolution(J_DIRECTION);
 
-#ifdef AXOM_USE_RAJA
-
-  RAJA::RangeSegment i_range(0, Ni);
-  RAJA::RangeSegment j_range(0, Nj);
-  using exec_pol = typename structured_exec<ExecPolicy>::loop2d_policy;
-
-  RAJA::kernel<exec_pol>(
-    RAJA::make_tuple(i_range, j_range),
+  structured_loop2d<ExecPolicy>(
+    Ni,
+    Nj,
     AXOM_LAMBDA(IndexType i, IndexType j) {
       const IndexType cellID = i + j * jp;
       kernel(cellID, i, j);
     });
-
-#else
-
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType j = 0; j < Nj; ++j)
-  {
-    const IndexType j_offset = j * jp;
-    for(IndexType i = 0; i < Ni; ++i)
-    {
-      const IndexType cellID = i + j_offset;
-      kernel(cellID, i, j);
-    }  // END for all i
-  }    // END for all j
-
-#endif
 }
 
 //------------------------------------------------------------------------------
@@ -125,40 +103,14 @@ inline void for_all_cells_impl(xargs::ijk,
   const IndexType jp = m.cellJp();
   const IndexType kp = m.cellKp();
 
-#ifdef AXOM_USE_RAJA
-
-  RAJA::RangeSegment i_range(0, Ni);
-  RAJA::RangeSegment j_range(0, Nj);
-  RAJA::RangeSegment k_range(0, Nk);
-  using exec_pol = typename structured_exec<ExecPolicy>::loop3d_policy;
-
-  RAJA::kernel<exec_pol>(
-    RAJA::make_tuple(i_range, j_range, k_range),
+  structured_loop3d<ExecPolicy>(
+    Ni,
+    Nj,
+    Nk,
     AXOM_LAMBDA(IndexType i, IndexType j, IndexType k) {
       const IndexType cellID = i + j * jp + k * kp;
       kernel(cellID, i, j, k);
     });
-
-#else
-
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType k = 0; k < Nk; ++k)
-  {
-    const IndexType k_offset = k * kp;
-    for(IndexType j = 0; j < Nj; ++j)
-    {
-      const IndexType j_offset = j * jp;
-      for(IndexType i = 0; i < Ni; ++i)
-      {
-        const IndexType cellID = i + j_offset + k_offset;
-        kernel(cellID, i, j, k);
-      }  // END for all i
-    }    // END for all j
-  }      // END for all k
-
-#endif
 }
 
 //------------------------------------------------------------------------------
@@ -236,37 +188,75 @@ inline void for_all_cells_impl(xargs::nodeids,
 }
 
 //------------------------------------------------------------------------------
-template <typename ExecPolicy, typename KernelType>
+/*!
+ * \brief Presents the node IDs of an unstructured cell as IndexType. IDs
+ *  stored as IndexType are passed through in place, while IDs stored in a
+ *  narrower type are widened into a buffer local to the kernel invocation.
+ */
+template <typename IndexT>
+struct cell_node_ids
+{
+  AXOM_HOST_DEVICE cell_node_ids(const IndexT* ids, IndexType n)
+  {
+    for(IndexType i = 0; i < n; ++i)
+    {
+      m_ids[i] = ids[i];
+    }
+  }
+
+  AXOM_HOST_DEVICE const IndexType* data() const { return m_ids; }
+
+  IndexType m_ids[MAX_CELL_NODES];
+};
+
+template <>
+struct cell_node_ids<IndexType>
+{
+  AXOM_HOST_DEVICE cell_node_ids(const IndexType* ids, IndexType)
+    : m_ids(ids)
+  { }
+
+  AXOM_HOST_DEVICE const IndexType* data() const { return m_ids; }
+
+  const IndexType* m_ids;
+};
+
+//------------------------------------------------------------------------------
+template <typename ExecPolicy, typename IndexT, typename KernelType>
 inline void for_all_cells_impl(xargs::nodeids,
-                               const UnstructuredMesh<MIXED_SHAPE>& m,
+                               const UnstructuredMesh<MIXED_SHAPE, IndexT>& m,
                                KernelType&& kernel)
 {
-  const IndexType* cell_connectivity = m.getCellNodesArray();
-  const IndexType* cell_offsets = m.getCellNodesOffsetsArray();
+  const IndexT* cell_connectivity = m.getCellNodesArray();
+  const IndexT* cell_offsets = m.getCellNodesOffsetsArray();
 
   for_all_cells_impl<ExecPolicy>(
     xargs::index(),
     m,
     AXOM_LAMBDA(IndexType cellID) {
-      const IndexType N = cell_offsets[cellID + 1] - cell_offsets[cellID];
-      kernel(cellID, &cell_connectivity[cell_offsets[cellID]], N);
+      const IndexType offset = cell_offsets[cellID];
+      const IndexType N = cell_offsets[cellID + 1] - offset;
+      const cell_node_ids<IndexT> nodes(&cell_connectivity[offset], N);
+      kernel(cellID, nodes.data(), N);
     });
 }
 
 //------------------------------------------------------------------------------
-template <typename ExecPolicy, typename KernelType>
+template <typename ExecPolicy, typename IndexT, typename KernelType>
 inline void for_all_cells_impl(xargs::nodeids,
-                               const UnstructuredMesh<SINGLE_SHAPE>& m,
+                               const UnstructuredMesh<SINGLE_SHAPE, IndexT>& m,
                                KernelType&& kernel)
 {
-  const IndexType* cell_connectivity = m.getCellNodesArray();
+  const IndexT* cell_connectivity = m.getCellNodesArray();
   const IndexType stride = m.getNumberOfCellNodes();
 
   for_all_cells_impl<ExecPolicy>(
     xargs::index(),
     m,
     AXOM_LAMBDA(IndexType cellID) {
-      kernel(cellID, &cell_connectivity[cellID * stride], stride);
+      const cell_node_ids<IndexT> nodes(&cell_connectivity[cellID * stride],
+                                        stride);
+      kernel(cellID, nodes.data(), stride);
     });
 }
 
@@ -281,6 +271,22 @@ inline void for_all_cells(xargs::nodeids, const Mesh& m, KernelType&& kernel)
                                    sm,
                                    std::forward<KernelType>(kernel));
   }
+  else if(m.hasCompactConnectivity() && m.hasMixedCellTypes())
+  {
+    const UnstructuredMesh<MIXED_SHAPE, int32>& um =
+      static_cast<const UnstructuredMesh<MIXED_SHAPE, int32>&>(m);
+    for_all_cells_impl<ExecPolicy>(xargs::nodeids(),
+                                   um,
+                                   std::forward<KernelType>(kernel));
+  }
+  else if(m.hasCompactConnectivity())
+  {
+    const UnstructuredMesh<SINGLE_SHAPE, int32>& um =
+      static_cast<const UnstructuredMesh<SINGLE_SHAPE, int32>&>(m);
+    for_all_cells_impl<ExecPolicy>(xargs::nodeids(),
+                                   um,
+                                   std::forward<KernelType>(kernel));
+  }
   else if(m.hasMixedCellTypes())
   {
     const UnstructuredMesh<MIXED_SHAPE>& um =
@@ -363,9 +369,9 @@ inline void for_all_cells_impl(xargs::faceids,
 }
 
 //------------------------------------------------------------------------------
-template <typename ExecPolicy, typename KernelType>
+template <typename ExecPolicy, typename IndexT, typename KernelType>
 inline void for_all_cells_impl(xargs::faceids,
-                               const UnstructuredMesh<SINGLE_SHAPE>& m,
+                               const UnstructuredMesh<SINGLE_SHAPE, IndexT>& m,
                                KernelType&& kernel)
 {
   const IndexType* cells_to_faces = m.getCellFacesArray();
@@ -380,9 +386,9 @@ inline void for_all_cells_impl(xargs::faceids,
 }
 
 //------------------------------------------------------------------------------
-template <typename ExecPolicy, typename KernelType>
+template <typename ExecPolicy, typename IndexT, typename KernelType>
 inline void for_all_cells_impl(xargs::faceids,
-                               const UnstructuredMesh<MIXED_SHAPE>& m,
+                               const UnstructuredMesh<MIXED_SHAPE, IndexT>& m,
                                KernelType&& kernel)
 {
   const IndexType* cells_to_faces = m.getCellFacesArray();
@@ -412,6 +418,22 @@ inline void for_all_cells(xargs::faceids, const Mesh& m, KernelType&& kernel)
                                    sm,
                                    std::forward<KernelType>(kernel));
   }
+  else if(m.hasCompactConnectivity() && m.hasMixedCellTypes())
+  {
+    const UnstructuredMesh<MIXED_SHAPE, int32>& um =
+      static_cast<const UnstructuredMesh<MIXED_SHAPE, int32>&>(m);
+    for_all_cells_impl<ExecPolicy>(xargs::faceids(),
+                                   um,
+                                   std::forward<KernelType>(kernel));
+  }
+  else if(m.hasCompactConnectivity())
+  {
+    const UnstructuredMesh<SINGLE_SHAPE, int32>& um =
+      static_cast<const UnstructuredMesh<SINGLE_SHAPE, int32>&>(m);
+    for_all_cells_impl<ExecPolicy>(xargs::faceids(),
+                                   um,
+                                   std::forward<KernelType>(kernel));
+  }
   else if(m.hasMixedCellTypes())
   {
     const UnstructuredMesh<MIXED_SHAPE>& um =
@@ -640,9 +662,12 @@ inline void for_all_cells_impl(xargs::coords,
 }
 
 //------------------------------------------------------------------------------
-template <typename ExecPolicy, typename KernelType, Topology TOPO>
+template <typename ExecPolicy,
+          typename KernelType,
+          Topology TOPO,
+          typename IndexT>
 inline void for_all_cells_impl(xargs::coords,
-                               const UnstructuredMesh<TOPO>& m,
+                               const UnstructuredMesh<TOPO, IndexT>& m,
                                KernelType&& kernel)
 {
   constexpr bool NO_COPY = true;
@@ -734,7 +759,25 @@ inline void for_all_cells(xargs::coords, const Mesh& m, KernelType&& kernel)
   }
   else if(m.getMeshType() == UNSTRUCTURED_MESH)
   {
-    if(m.hasMixedCellTypes())
+    if(m.hasCompactConnectivity() && m.hasMixedCellTypes())
+    {
+      const UnstructuredMesh<MIXED_SHAPE, int32>& um =
+        static_cast<const UnstructuredMesh<MIXED_SHAPE, int32>&>(m);
+
+      for_all_cells_impl<ExecPolicy>(xargs::coords(),
+                                     um,
+                                     std::forward<KernelType>(kernel));
+    }
+    else if(m.hasCompactConnectivity())
+    {
+      const UnstructuredMesh<SINGLE_SHAPE, int32>& um =
+        static_cast<const UnstructuredMesh<SINGLE_SHAPE, int32>&>(m);
+
+      for_all_cells_impl<ExecPolicy>(xargs::coords(),
+                                     um,
+                                     std::forward<KernelType>(kernel));
+    }
+    else if(m.hasMixedCellTypes())
     {
       const UnstructuredMesh<MIXED_SHAPE>& um =
         static_cast<const UnstructuredMesh<MIXED_SHAPE>&>(m);
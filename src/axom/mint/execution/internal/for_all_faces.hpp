@@ -46,35 +46,13 @@ inline void for_all_I_faces(xargs::ij, const StructuredMesh& m, KernelType&& ker
   const IndexType Ni = INodeResolution;
   const IndexType Nj = m.getCellResolution(J_DIRECTION);
 
-#ifdef AXOM_USE_RAJA
-
-  RAJA::RangeSegment i_range(0, Ni);
-  RAJA::RangeSegment j_range(0, Nj);
-
-  using exec_pol = typename structured_exec<ExecPolicy>::loop2d_policy;
-  RAJA::kernel<exec_pol>(
-    RAJA::make_tuple(i_range, j_range),
+  structured_loop2d<ExecPolicy>(
+    Ni,
+    Nj,
     AXOM_LAMBDA(IndexType i, IndexType j) {
       const IndexType faceID = i + j * INodeResolution;
       kernel(faceID, i, j);
     });
-
-#else
-
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType j = 0; j < Nj; ++j)
-  {
-    const IndexType offset = j * INodeResolution;
-    for(IndexType i = 0; i < Ni; ++i)
-    {
-      const IndexType faceID = i + offset;
-      kernel(faceID, i, j);
-    }
-  }
-
-#endif
 }
 
 //------------------------------------------------------------------------------
@@ -90,40 +68,14 @@ inline void for_all_I_faces(xargs::ijk, const StructuredMesh& m, KernelType&& ke
   const IndexType Nj = m.getCellResolution(J_DIRECTION);
   const IndexType Nk = m.getCellResolution(K_DIRECTION);
 
-#ifdef AXOM_USE_RAJA
-
-  RAJA::RangeSegment i_range(0, Ni);
-  RAJA::RangeSegment j_range(0, Nj);
-  RAJA::RangeSegment k_range(0, Nk);
-
-  using exec_pol = typename structured_exec<ExecPolicy>::loop3d_policy;
-  RAJA::kernel<exec_pol>(
-    RAJA::make_tuple(i_range, j_range, k_range),
+  structured_loop3d<ExecPolicy>(
+    Ni,
+    Nj,
+    Nk,
     AXOM_LAMBDA(IndexType i, IndexType j, IndexType k) {
       const IndexType faceID = i + j * INodeResolution + k * numIFacesInKSlice;
       kernel(faceID, i, j, k);
     });
-
-#else
-
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType k = 0; k < Nk; ++k)
-  {
-    const IndexType k_offset = k * numIFacesInKSlice;
-    for(IndexType j = 0; j < Nj; ++j)
-    {
-      const IndexType offset = j * INodeResolution + k_offset;
-      for(IndexType i = 0; i < Ni; ++i)
-      {
-        const IndexType faceID = i + offset;
-        kernel(faceID, i, j, k);
-      }
-    }
-  }
-
-#endif
 }
 
 //------------------------------------------------------------------------------
@@ -137,35 +89,13 @@ inline void for_all_J_faces(xargs::ij, const StructuredMesh& m, KernelType&& ker
   const IndexType Ni = ICellResolution;
   const IndexType Nj = m.getNodeResolution(J_DIRECTION);
 
-#ifdef AXOM_USE_RAJA
-
-  RAJA::RangeSegment i_range(0, Ni);
-  RAJA::RangeSegment j_range(0, Nj);
-
-  using exec_pol = typename structured_exec<ExecPolicy>::loop2d_policy;
-  RAJA::kernel<exec_pol>(
-    RAJA::make_tuple(i_range, j_range),
+  structured_loop2d<ExecPolicy>(
+    Ni,
+    Nj,
     AXOM_LAMBDA(IndexType i, IndexType j) {
       const IndexType faceID = numIFaces + i + j * ICellResolution;
       kernel(faceID, i, j);
     });
-
-#else
-
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType j = 0; j < Nj; ++j)
-  {
-    const IndexType offset = numIFaces + j * ICellResolution;
-    for(IndexType i = 0; i < Ni; ++i)
-    {
-      const IndexType faceID = i + offset;
-      kernel(faceID, i, j);
-    }
-  }
-
-#endif
 }
 
 //------------------------------------------------------------------------------
@@ -182,42 +112,16 @@ inline void for_all_J_faces(xargs::ijk, const StructuredMesh& m, KernelType&& ke
   const IndexType Nj = m.getNodeResolution(J_DIRECTION);
   const IndexType Nk = m.getCellResolution(K_DIRECTION);
 
-#ifdef AXOM_USE_RAJA
-
-  RAJA::RangeSegment i_range(0, Ni);
-  RAJA::RangeSegment j_range(0, Nj);
-  RAJA::RangeSegment k_range(0, Nk);
-
-  using exec_pol = typename structured_exec<ExecPolicy>::loop3d_policy;
-  RAJA::kernel<exec_pol>(
-    RAJA::make_tuple(i_range, j_range, k_range),
+  structured_loop3d<ExecPolicy>(
+    Ni,
+    Nj,
+    Nk,
     AXOM_LAMBDA(IndexType i, IndexType j, IndexType k) {
       const IndexType jp = j * ICellResolution;
       const IndexType kp = k * numJFacesInKSlice;
       const IndexType faceID = numIFaces + i + jp + kp;
       kernel(faceID, i, j, k);
     });
-
-#else
-
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType k = 0; k < Nk; ++k)
-  {
-    const IndexType k_offset = k * numJFacesInKSlice + numIFaces;
-    for(IndexType j = 0; j < Nj; ++j)
-    {
-      const IndexType offset = j * ICellResolution + k_offset;
-      for(IndexType i = 0; i < Ni; ++i)
-      {
-        const IndexType faceID = i + offset;
-        kernel(faceID, i, j, k);
-      }
-    }
-  }
-
-#endif
 }
 
 //------------------------------------------------------------------------------
@@ -234,42 +138,16 @@ inline void for_all_K_faces(xargs::ijk, const StructuredMesh& m, KernelType&& ke
   const IndexType Nj = m.getCellResolution(J_DIRECTION);
   const IndexType Nk = m.getNodeResolution(K_DIRECTION);
 
-#ifdef AXOM_USE_RAJA
-
-  RAJA::RangeSegment i_range(0, Ni);
-  RAJA::RangeSegment j_range(0, Nj);
-  RAJA::RangeSegment k_range(0, Nk);
-
-  using exec_pol = typename structured_exec<ExecPolicy>::loop3d_policy;
-  RAJA::kernel<exec_pol>(
-    RAJA::make_tuple(i_range, j_range, k_range),
+  structured_loop3d<ExecPolicy>(
+    Ni,
+    Nj,
+    Nk,
     AXOM_LAMBDA(IndexType i, IndexType j, IndexType k) {
       const IndexType jp = j * ICellResolution;
       const IndexType kp = k * cellKp;
       const IndexType faceID = numIJFaces + i + jp + kp;
       kernel(faceID, i, j, k);
     });
-
-#else
-
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType k = 0; k < Nk; ++k)
-  {
-    const IndexType k_offset = k * cellKp + numIJFaces;
-    for(IndexType j = 0; j < Nj; ++j)
-    {
-      const IndexType offset = j * ICellResolution + k_offset;
-      for(IndexType i = 0; i < Ni; ++i)
-      {
-        const IndexType faceID = i + offset;
-        kernel(faceID, i, j, k);
-      }
-    }
-  }
-
-#endif
 }
 
 } /* namespace helpers */
@@ -395,9 +273,9 @@ inline void for_all_faces_impl(xargs::nodeids,
 }
 
 //------------------------------------------------------------------------------
-template <typename ExecPolicy, typename KernelType>
+template <typename ExecPolicy, typename IndexT, typename KernelType>
 inline void for_all_faces_impl(xargs::nodeids,
-                               const UnstructuredMesh<SINGLE_SHAPE>& m,
+                               const UnstructuredMesh<SINGLE_SHAPE, IndexT>& m,
                                KernelType&& kernel)
 {
   SLIC_ERROR_IF(m.getNumberOfFaces() <= 0,
@@ -416,9 +294,9 @@ inline void for_all_faces_impl(xargs::nodeids,
 }
 
 //------------------------------------------------------------------------------
-template <typename ExecPolicy, typename KernelType>
+template <typename ExecPolicy, typename IndexT, typename KernelType>
 inline void for_all_faces_impl(xargs::nodeids,
-                               const UnstructuredMesh<MIXED_SHAPE>& m,
+                               const UnstructuredMesh<MIXED_SHAPE, IndexT>& m,
                                KernelType&& kernel)
 {
   SLIC_ERROR_IF(m.getNumberOfFaces() <= 0,
@@ -450,6 +328,22 @@ inline void for_all_faces(xargs::nodeids, const Mesh& m, KernelType&& kernel)
                                    sm,
                                    std::forward<KernelType>(kernel));
   }
+  else if(m.hasCompactConnectivity() && m.hasMixedCellTypes())
+  {
+    const UnstructuredMesh<MIXED_SHAPE, int32>& um =
+      static_cast<const UnstructuredMesh<MIXED_SHAPE, int32>&>(m);
+    for_all_faces_impl<ExecPolicy>(xargs::nodeids(),
+                                   um,
+                                   std::forward<KernelType>(kernel));
+  }
+  else if(m.hasCompactConnectivity())
+  {
+    const UnstructuredMesh<SINGLE_SHAPE, int32>& um =
+      static_cast<const UnstructuredMesh<SINGLE_SHAPE, int32>&>(m);
+    for_all_faces_impl<ExecPolicy>(xargs::nodeids(),
+                                   um,
+                                   std::forward<KernelType>(kernel));
+  }
   else if(m.hasMixedCellTypes())
   {
     const UnstructuredMesh<MIXED_SHAPE>& um =
@@ -587,9 +481,12 @@ inline void for_all_faces_impl(xargs::cellids,
 }
 
 //------------------------------------------------------------------------------
-template <typename ExecPolicy, Topology TOPO, typename KernelType>
+template <typename ExecPolicy,
+          Topology TOPO,
+          typename IndexT,
+          typename KernelType>
 inline void for_all_faces_impl(xargs::cellids,
-                               const UnstructuredMesh<TOPO>& m,
+                               const UnstructuredMesh<TOPO, IndexT>& m,
                                KernelType&& kernel)
 {
   SLIC_ERROR_IF(m.getNumberOfFaces() <= 0,
@@ -620,6 +517,22 @@ inline void for_all_faces(xargs::cellids, const Mesh& m, KernelType&& kernel)
                                    sm,
                                    std::forward<KernelType>(kernel));
   }
+  else if(m.hasCompactConnectivity() && m.hasMixedCellTypes())
+  {
+    const UnstructuredMesh<MIXED_SHAPE, int32>& um =
+      static_cast<const UnstructuredMesh<MIXED_SHAPE, int32>&>(m);
+    for_all_faces_impl<ExecPolicy>(xargs::cellids(),
+                                   um,
+                                   std::forward<KernelType>(kernel));
+  }
+  else if(m.hasCompactConnectivity())
+  {
+    const UnstructuredMesh<SINGLE_SHAPE, int32>& um =
+      static_cast<const UnstructuredMesh<SINGLE_SHAPE, int32>&>(m);
+    for_all_faces_impl<ExecPolicy>(xargs::cellids(),
+                                   um,
+                                   std::forward<KernelType>(kernel));
+  }
   else if(m.hasMixedCellTypes())
   {
     const UnstructuredMesh<MIXED_SHAPE>& um =
@@ -941,9 +854,12 @@ inline void for_all_faces_impl(xargs::coords,
 }
 
 //------------------------------------------------------------------------------
-template <typename ExecPolicy, typename KernelType, Topology TOPO>
+template <typename ExecPolicy,
+          typename KernelType,
+          Topology TOPO,
+          typename IndexT>
 inline void for_all_faces_impl(xargs::coords,
-                               const UnstructuredMesh<TOPO>& m,
+                               const UnstructuredMesh<TOPO, IndexT>& m,
                                KernelType&& kernel)
 {
   constexpr bool NO_COPY = true;
@@ -1024,7 +940,25 @@ inline void for_all_faces(xargs::coords, const Mesh& m, KernelType&& kernel)
   }
   else if(m.getMeshType() == UNSTRUCTURED_MESH)
   {
-    if(m.hasMixedCellTypes())
+    if(m.hasCompactConnectivity() && m.hasMixedCellTypes())
+    {
+      const UnstructuredMesh<MIXED_SHAPE, int32>& um =
+        static_cast<const UnstructuredMesh<MIXED_SHAPE, int32>&>(m);
+
+      for_all_faces_impl<ExecPolicy>(xargs::coords(),
+                                     um,
+                                     std::forward<KernelType>(kernel));
+    }
+    else if(m.hasCompactConnectivity())
+    {
+      const UnstructuredMesh<SINGLE_SHAPE, int32>& um =
+        static_cast<const UnstructuredMesh<SINGLE_SHAPE, int32>&>(m);
+
+      for_all_faces_impl<ExecPolicy>(xargs::coords(),
+                                     um,
+                                     std::forward<KernelType>(kernel));
+    }
+    else if(m.hasMixedCellTypes())
     {
       const UnstructuredMesh<MIXED_SHAPE>& um =
         static_cast<const UnstructuredMesh<MIXED_SHAPE>&>(m);
@@ -12,12 +12,13 @@
 #include "axom/core/execution/for_all.hpp"          // for axom::for_all
 
 // mint includes
-#include "axom/mint/execution/xargs.hpp"       // for xargs
-#include "axom/mint/config.hpp"                // for compile-time definitions
-#include "axom/mint/mesh/Mesh.hpp"             // for mint::Mesh
-#include "axom/mint/mesh/RectilinearMesh.hpp"  // for mint::RectilinearMesh
-#include "axom/mint/mesh/StructuredMesh.hpp"   // for mint::StructuredMesh
-#include "axom/mint/mesh/UniformMesh.hpp"      // for mint::UniformMesh
+#include "axom/mint/execution/xargs.hpp"        // for xargs
+#include "axom/mint/config.hpp"                 // for compile-time definitions
+#include "axom/mint/mesh/Mesh.hpp"              // for mint::Mesh
+#include "axom/mint/mesh/RectilinearMesh.hpp"   // for mint::RectilinearMesh
+#include "axom/mint/mesh/StructuredMesh.hpp"    // for mint::StructuredMesh
+#include "axom/mint/mesh/UniformMesh.hpp"       // for mint::UniformMesh
+#include "axom/mint/mesh/UnstructuredMesh.hpp"  // for mint::UnstructuredMesh
 #include "axom/mint/execution/internal/structured_exec.hpp"
 
 #include "axom/core/StackArray.hpp"  // for axom::StackArray
@@ -61,34 +62,13 @@ inline void for_all_nodes_impl(xargs::ij,
   const IndexType Ni = m.getNodeResolution(I_DIRECTION);
   const IndexType Nj = m.getNodeResolution(J_DIRECTION);
 
-#ifdef AXOM_USE_RAJA
-
-  RAJA::RangeSegment i_range(0, Ni);
-  RAJA::RangeSegment j_range(0, Nj);
-  using exec_pol = typename structured_exec<ExecPolicy>::loop2d_policy;
-
-  RAJA::kernel<exec_pol>(
-    RAJA::make_tuple(i_range, j_range),
+  structured_loop2d<ExecPolicy>(
+    Ni,
+    Nj,
     AXOM_LAMBDA(IndexType i, IndexType j) {
       const IndexType nodeIdx = i + j * jp;
       kernel(nodeIdx, i, j);
     });
-
-#else
-
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType j = 0; j < Nj; ++j)
-  {
-    const IndexType j_offset = j * jp;
-    for(IndexType i = 0; i < Ni; ++i)
-    {
-      const IndexType nodeIdx = i + j_offset;
-      kernel(nodeIdx, i, j);
-    }  // END for all i
-  }    // END for all j
-#endif
 }
 
 //------------------------------------------------------------------------------
@@ -121,40 +101,14 @@ inline void for_all_nodes_impl(xargs::ijk,
   const IndexType Nj = m.getNodeResolution(J_DIRECTION);
   const IndexType Nk = m.getNodeResolution(K_DIRECTION);
 
-#ifdef AXOM_USE_RAJA
-
-  RAJA::RangeSegment i_range(0, Ni);
-  RAJA::RangeSegment j_range(0, Nj);
-  RAJA::RangeSegment k_range(0, Nk);
-  using exec_pol = typename structured_exec<ExecPolicy>::loop3d_policy;
-
-  RAJA::kernel<exec_pol>(
-    RAJA::make_tuple(i_range, j_range, k_range),
+  structured_loop3d<ExecPolicy>(
+    Ni,
+    Nj,
+    Nk,
     AXOM_LAMBDA(IndexType i, IndexType j, IndexType k) {
       const IndexType nodeIdx = i + j * jp + k * kp;
       kernel(nodeIdx, i, j, k);
     });
-
-#else
-
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType k = 0; k < Nk; ++k)
-  {
-    const IndexType k_offset = k * kp;
-    for(IndexType j = 0; j < Nj; ++j)
-    {
-      const IndexType j_offset = j * jp;
-      for(IndexType i = 0; i < Ni; ++i)
-      {
-        const IndexType nodeIdx = i + j_offset + k_offset;
-        kernel(nodeIdx, i, j, k);
-      }  // END for all i
-    }    // END for all j
-  }      // END for all k
-
-#endif
 }
 
 //------------------------------------------------------------------------------
@@ -412,6 +366,165 @@ inline void for_all_nodes(xargs::xyz, const mint::Mesh& m, KernelType&& kernel)
   }
 }
 
+//------------------------------------------------------------------------------
+template <typename ExecPolicy, typename KernelType>
+inline void for_all_nodes_impl(xargs::cellids,
+                               const StructuredMesh& m,
+                               KernelType&& kernel)
+{
+  const int dimension = m.getDimension();
+  const IndexType Ci = m.getCellResolution(I_DIRECTION);
+
+  if(dimension == 1)
+  {
+    for_all_nodes_impl<ExecPolicy>(
+      xargs::index(),
+      m,
+      AXOM_LAMBDA(IndexType nodeID) {
+        IndexType cells[2];
+        IndexType n = 0;
+        if(nodeID > 0)
+        {
+          cells[n++] = nodeID - 1;
+        }
+        if(nodeID < Ci)
+        {
+          cells[n++] = nodeID;
+        }
+        kernel(nodeID, cells, n);
+      });
+  }
+  else if(dimension == 2)
+  {
+    const IndexType Cj = m.getCellResolution(J_DIRECTION);
+    const IndexType cellJp = m.cellJp();
+
+    for_all_nodes_impl<ExecPolicy>(
+      xargs::ij(),
+      m,
+      AXOM_LAMBDA(IndexType nodeID, IndexType i, IndexType j) {
+        IndexType cells[4];
+        IndexType n = 0;
+        for(IndexType jj = j - 1; jj <= j; ++jj)
+        {
+          for(IndexType ii = i - 1; ii <= i; ++ii)
+          {
+            if(ii >= 0 && ii < Ci && jj >= 0 && jj < Cj)
+            {
+              cells[n++] = ii + jj * cellJp;
+            }
+          }
+        }
+        kernel(nodeID, cells, n);
+      });
+  }
+  else
+  {
+    SLIC_ASSERT(dimension == 3);
+
+    const IndexType Cj = m.getCellResolution(J_DIRECTION);
+    const IndexType Ck = m.getCellResolution(K_DIRECTION);
+    const IndexType cellJp = m.cellJp();
+    const IndexType cellKp = m.cellKp();
+
+    for_all_nodes_impl<ExecPolicy>(
+      xargs::ijk(),
+      m,
+      AXOM_LAMBDA(IndexType nodeID, IndexType i, IndexType j, IndexType k) {
+        IndexType cells[8];
+        IndexType n = 0;
+        for(IndexType kk = k - 1; kk <= k; ++kk)
+        {
+          for(IndexType jj = j - 1; jj <= j; ++jj)
+          {
+            for(IndexType ii = i - 1; ii <= i; ++ii)
+            {
+              if(ii >= 0 && ii < Ci && jj >= 0 && jj < Cj && kk >= 0 &&
+                 kk < Ck)
+              {
+                cells[n++] = ii + jj * cellJp + kk * cellKp;
+              }
+            }
+          }
+        }
+        kernel(nodeID, cells, n);
+      });
+  }
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecPolicy,
+          Topology TOPO,
+          typename IndexT,
+          typename KernelType>
+inline void for_all_nodes_impl(xargs::cellids,
+                               const UnstructuredMesh<TOPO, IndexT>& m,
+                               KernelType&& kernel)
+{
+  SLIC_ERROR_IF(!m.hasNodeCellConnectivity(),
+                "No node-to-cell connectivity, perhaps you meant to call "
+                  << "UnstructuredMesh::initializeNodeCellConnectivity first.");
+
+  const IndexType* nodes_to_cells = m.getNodeCellsArray();
+  const IndexType* offsets = m.getNodeCellsOffsetsArray();
+
+  for_all_nodes_impl<ExecPolicy>(
+    xargs::index(),
+    m,
+    AXOM_LAMBDA(IndexType nodeID) {
+      const IndexType num_cells = offsets[nodeID + 1] - offsets[nodeID];
+      kernel(nodeID, nodes_to_cells + offsets[nodeID], num_cells);
+    });
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecPolicy, typename KernelType>
+inline void for_all_nodes(xargs::cellids, const Mesh& m, KernelType&& kernel)
+{
+  SLIC_ERROR_IF(m.getMeshType() == PARTICLE_MESH,
+                "xargs::cellids is not valid for a ParticleMesh");
+
+  if(m.isStructured())
+  {
+    const StructuredMesh& sm = static_cast<const StructuredMesh&>(m);
+    for_all_nodes_impl<ExecPolicy>(xargs::cellids(),
+                                   sm,
+                                   std::forward<KernelType>(kernel));
+  }
+  else if(m.hasCompactConnectivity() && m.hasMixedCellTypes())
+  {
+    const UnstructuredMesh<MIXED_SHAPE, int32>& um =
+      static_cast<const UnstructuredMesh<MIXED_SHAPE, int32>&>(m);
+    for_all_nodes_impl<ExecPolicy>(xargs::cellids(),
+                                   um,
+                                   std::forward<KernelType>(kernel));
+  }
+  else if(m.hasCompactConnectivity())
+  {
+    const UnstructuredMesh<SINGLE_SHAPE, int32>& um =
+      static_cast<const UnstructuredMesh<SINGLE_SHAPE, int32>&>(m);
+    for_all_nodes_impl<ExecPolicy>(xargs::cellids(),
+                                   um,
+                                   std::forward<KernelType>(kernel));
+  }
+  else if(m.hasMixedCellTypes())
+  {
+    const UnstructuredMesh<MIXED_SHAPE>& um =
+      static_cast<const UnstructuredMesh<MIXED_SHAPE>&>(m);
+    for_all_nodes_impl<ExecPolicy>(xargs::cellids(),
+                                   um,
+                                   std::forward<KernelType>(kernel));
+  }
+  else
+  {
+    const UnstructuredMesh<SINGLE_SHAPE>& um =
+      static_cast<const UnstructuredMesh<SINGLE_SHAPE>&>(m);
+    for_all_nodes_impl<ExecPolicy>(xargs::cellids(),
+                                   um,
+                                   std::forward<KernelType>(kernel));
+  }
+}
+
 } /* namespace internal */
 } /* namespace mint     */
 } /* namespace axom     */
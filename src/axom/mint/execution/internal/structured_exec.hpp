@@ -6,7 +6,18 @@
 #ifndef AXOM_MINT_STRUCTURED_EXEC_HPP_
 #define AXOM_MINT_STRUCTURED_EXEC_HPP_
 
-#include "axom/core/execution/execution_space.hpp"
+#include "axom/config.hpp"                          // for AXOM_USE_OPENMP
+#include "axom/core/Macros.hpp"                     // for AXOM_STATIC_ASSERT
+#include "axom/core/Types.hpp"                      // for IndexType
+#include "axom/core/execution/execution_space.hpp"  // for execution_space
+#include "axom/core/utilities/Utilities.hpp"        // for utilities::min
+
+#include <type_traits>  // for std::is_same
+#include <utility>      // for std::forward
+
+#ifdef AXOM_USE_OPENMP
+  #include <omp.h>  // for omp_get_max_threads()
+#endif
 
 // RAJA includes
 #ifdef AXOM_USE_RAJA
@@ -73,6 +84,23 @@ struct structured_exec<SEQ_EXEC>
 #endif
 };
 
+// OpenMP Kernel settings:
+//
+// The OpenMP policies split each I-J plane into tiles of OMP_TILE_I x
+// OMP_TILE_J points, which are distributed over the threads, and sweep each
+// tile along K. A plane of a tile holds 16K doubles (128KB), so a stencil
+// that reads the K-1, K and K+1 planes of a field and writes another keeps
+// its working set (512KB) within the 1-2MB L2 cache of current server cores.
+// The tiles are long along I so that rows of typical meshes are not split,
+// which keeps the innermost loop unit-stride for the hardware prefetchers.
+//
+// In 3D, the K range is also split into blocks, so that each thread gets at
+// least OMP_MIN_TILES_PER_THREAD tile sweeps when the I-J plane has few
+// tiles, e.g., a 128^3 mesh has 4 tiles per plane.
+constexpr int OMP_TILE_I = 512;
+constexpr int OMP_TILE_J = 32;
+constexpr int OMP_MIN_TILES_PER_THREAD = 4;
+
 //--------------------------------------------------------| OMP_EXEC |----------
 #if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
 template <>
@@ -81,24 +109,24 @@ struct structured_exec<OMP_EXEC>
   /* clang-format off */
 
   using loop2d_policy = RAJA::KernelPolicy<
-    RAJA::statement::For< 1, RAJA::omp_parallel_for_exec, // j
-      RAJA::statement::For< 0, RAJA::loop_exec,           // i
-        RAJA::statement::Lambda< 0 >
-     > // END i
-    > // END j
-  >; // END kernel
-
-  using loop3d_policy = RAJA::KernelPolicy<
-    RAJA::statement::For< 2, RAJA::omp_parallel_for_exec, // k
-      RAJA::statement::For< 1, RAJA::loop_exec,           // j
-        RAJA::statement::For< 0, RAJA::loop_exec,         // i
-          RAJA::statement::Lambda< 0 >
-        > // END i
-      > // END j
-    > // END k
+    RAJA::statement::Tile< 1, RAJA::tile_fixed< OMP_TILE_J >,
+                           RAJA::omp_parallel_for_exec,           // j tiles
+      RAJA::statement::Tile< 0, RAJA::tile_fixed< OMP_TILE_I >,
+                             RAJA::loop_exec,                     // i tiles
+        RAJA::statement::For< 1, RAJA::loop_exec,                 // j
+          RAJA::statement::For< 0, RAJA::loop_exec,               // i
+            RAJA::statement::Lambda< 0 >
+          > // END i
+        > // END j
+      > // END i tiles
+    > // END j tiles
   >; // END kernel
 
   /* clang-format on */
+
+  // RAJA::kernel cannot collapse the loops over the tiles, so the 3D
+  // traversals run omp_tiled_loop3d(), which blocks K as well
+  using loop3d_policy = void;
 };
 #endif
 
@@ -198,6 +226,266 @@ struct structured_exec<CUDA_EXEC<BLOCK_SIZE, ASYNC>>
 
 #endif
 
+//------------------------------------------------------------------------------
+/*!
+ * \brief Calls kernel( i, j ) for every (i, j) in [0, Ni) x [0, Nj), one
+ *  OMP_TILE_I x OMP_TILE_J tile at a time.
+ *
+ *  The tiles are distributed over the threads with a collapsed OpenMP loop
+ *  when Axom is built with OpenMP. This is the OpenMP traversal used by
+ *  parallel CPU execution policies when Axom is built without RAJA.
+ */
+template <typename KernelType>
+inline void omp_tiled_loop2d(IndexType Ni, IndexType Nj, KernelType&& kernel)
+{
+  const IndexType ntiles_i = (Ni + OMP_TILE_I - 1) / OMP_TILE_I;
+  const IndexType ntiles_j = (Nj + OMP_TILE_J - 1) / OMP_TILE_J;
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel
+#endif
+  {
+    // A private copy of the kernel lets the compiler keep its captured
+    // values in registers rather than reload them through a shared reference
+    typename std::decay<KernelType>::type body(kernel);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp for collapse(2) schedule(static)
+#endif
+    for(IndexType jt = 0; jt < ntiles_j; ++jt)
+    {
+      for(IndexType it = 0; it < ntiles_i; ++it)
+      {
+        const IndexType jbegin = jt * OMP_TILE_J;
+        const IndexType jend = utilities::min(jbegin + OMP_TILE_J, Nj);
+        const IndexType ibegin = it * OMP_TILE_I;
+        const IndexType iend = utilities::min(ibegin + OMP_TILE_I, Ni);
+
+        for(IndexType j = jbegin; j < jend; ++j)
+        {
+          for(IndexType i = ibegin; i < iend; ++i)
+          {
+            body(i, j);
+          }  // END for all i
+        }    // END for all j
+
+      }  // END for all i tiles
+    }    // END for all j tiles
+  }
+}
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Returns the number of blocks the K range is split into, so that
+ *  the threads share at least OMP_MIN_TILES_PER_THREAD tile sweeps each.
+ *
+ * \param [in] ntiles the number of tiles of an I-J plane.
+ * \param [in] Nk the extent along K.
+ */
+inline IndexType omp_num_k_blocks(IndexType ntiles, IndexType Nk)
+{
+  int nthreads = 1;
+#ifdef AXOM_USE_OPENMP
+  nthreads = omp_get_max_threads();
+#endif
+
+  const IndexType target = OMP_MIN_TILES_PER_THREAD * nthreads;
+  const IndexType nblocks =
+    (ntiles > 0) ? (target + ntiles - 1) / ntiles : IndexType(1);
+  return utilities::clampVal(nblocks,
+                             IndexType(1),
+                             utilities::max(Nk, IndexType(1)));
+}
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Calls kernel( i, j, k ) for every (i, j, k) in
+ *  [0, Ni) x [0, Nj) x [0, Nk), sweeping each OMP_TILE_I x OMP_TILE_J tile of
+ *  the I-J plane along a block of K.
+ *
+ *  The K blocks, J tiles and I tiles are distributed over the threads with a
+ *  collapsed OpenMP loop. There are as many K blocks as needed to give each
+ *  thread OMP_MIN_TILES_PER_THREAD tile sweeps, and a single K block when
+ *  the I-J plane has enough tiles.
+ *
+ * \see omp_tiled_loop2d()
+ */
+template <typename KernelType>
+inline void omp_tiled_loop3d(IndexType Ni,
+                             IndexType Nj,
+                             IndexType Nk,
+                             KernelType&& kernel)
+{
+  const IndexType ntiles_i = (Ni + OMP_TILE_I - 1) / OMP_TILE_I;
+  const IndexType ntiles_j = (Nj + OMP_TILE_J - 1) / OMP_TILE_J;
+  const IndexType nblocks_k = omp_num_k_blocks(ntiles_i * ntiles_j, Nk);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel
+#endif
+  {
+    typename std::decay<KernelType>::type body(kernel);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp for collapse(3) schedule(static)
+#endif
+    for(IndexType kb = 0; kb < nblocks_k; ++kb)
+    {
+      for(IndexType jt = 0; jt < ntiles_j; ++jt)
+      {
+        for(IndexType it = 0; it < ntiles_i; ++it)
+        {
+          const IndexType kbegin = (Nk * kb) / nblocks_k;
+          const IndexType kend = (Nk * (kb + 1)) / nblocks_k;
+          const IndexType jbegin = jt * OMP_TILE_J;
+          const IndexType jend = utilities::min(jbegin + OMP_TILE_J, Nj);
+          const IndexType ibegin = it * OMP_TILE_I;
+          const IndexType iend = utilities::min(ibegin + OMP_TILE_I, Ni);
+
+          for(IndexType k = kbegin; k < kend; ++k)
+          {
+            for(IndexType j = jbegin; j < jend; ++j)
+            {
+              for(IndexType i = ibegin; i < iend; ++i)
+              {
+                body(i, j, k);
+              }  // END for all i
+            }    // END for all j
+          }      // END for all k
+
+        }  // END for all i tiles
+      }    // END for all j tiles
+    }      // END for all k blocks
+  }
+}
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Calls kernel( i, j ) for every (i, j) in [0, Ni) x [0, Nj) with the
+ *  loop2d_policy of the given execution policy.
+ *
+ *  Without RAJA, serial policies run the plain i-j loop nest and parallel
+ *  CPU policies run omp_tiled_loop2d().
+ */
+template <typename ExecPolicy, typename KernelType>
+inline void structured_loop2d(IndexType Ni, IndexType Nj, KernelType&& kernel)
+{
+#ifdef AXOM_USE_RAJA
+
+  RAJA::RangeSegment i_range(0, Ni);
+  RAJA::RangeSegment j_range(0, Nj);
+  using exec_pol = typename structured_exec<ExecPolicy>::loop2d_policy;
+
+  RAJA::kernel<exec_pol>(RAJA::make_tuple(i_range, j_range),
+                         std::forward<KernelType>(kernel));
+
+#else
+
+  AXOM_STATIC_ASSERT(!execution_space<ExecPolicy>::onDevice());
+  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
+
+  if(is_serial)
+  {
+    for(IndexType j = 0; j < Nj; ++j)
+    {
+      for(IndexType i = 0; i < Ni; ++i)
+      {
+        kernel(i, j);
+      }  // END for all i
+    }    // END for all j
+  }
+  else
+  {
+    omp_tiled_loop2d(Ni, Nj, std::forward<KernelType>(kernel));
+  }
+
+#endif
+}
+
+#ifdef AXOM_USE_RAJA
+/*!
+ * \brief Runs the 3D loop with RAJA::kernel and the given kernel policy.
+ */
+template <typename KernelPolicy, typename KernelType>
+inline void raja_loop3d(IndexType Ni,
+                        IndexType Nj,
+                        IndexType Nk,
+                        KernelType&& kernel,
+                        std::false_type AXOM_NOT_USED(is_void))
+{
+  RAJA::RangeSegment i_range(0, Ni);
+  RAJA::RangeSegment j_range(0, Nj);
+  RAJA::RangeSegment k_range(0, Nk);
+
+  RAJA::kernel<KernelPolicy>(RAJA::make_tuple(i_range, j_range, k_range),
+                             std::forward<KernelType>(kernel));
+}
+
+/*!
+ * \brief Runs the 3D loop of a policy without a RAJA kernel policy, i.e.,
+ *  OMP_EXEC, with omp_tiled_loop3d().
+ */
+template <typename KernelPolicy, typename KernelType>
+inline void raja_loop3d(IndexType Ni,
+                        IndexType Nj,
+                        IndexType Nk,
+                        KernelType&& kernel,
+                        std::true_type AXOM_NOT_USED(is_void))
+{
+  omp_tiled_loop3d(Ni, Nj, Nk, std::forward<KernelType>(kernel));
+}
+#endif
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Calls kernel( i, j, k ) for every (i, j, k) in
+ *  [0, Ni) x [0, Nj) x [0, Nk) with the loop3d_policy of the given execution
+ *  policy.
+ *
+ *  Without RAJA, serial policies run the plain i-j-k loop nest. Parallel CPU
+ *  policies run omp_tiled_loop3d(), with or without RAJA.
+ */
+template <typename ExecPolicy, typename KernelType>
+inline void structured_loop3d(IndexType Ni,
+                              IndexType Nj,
+                              IndexType Nk,
+                              KernelType&& kernel)
+{
+#ifdef AXOM_USE_RAJA
+
+  using exec_pol = typename structured_exec<ExecPolicy>::loop3d_policy;
+  raja_loop3d<exec_pol>(Ni,
+                        Nj,
+                        Nk,
+                        std::forward<KernelType>(kernel),
+                        std::is_void<exec_pol>());
+
+#else
+
+  AXOM_STATIC_ASSERT(!execution_space<ExecPolicy>::onDevice());
+  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
+
+  if(is_serial)
+  {
+    for(IndexType k = 0; k < Nk; ++k)
+    {
+      for(IndexType j = 0; j < Nj; ++j)
+      {
+        for(IndexType i = 0; i < Ni; ++i)
+        {
+          kernel(i, j, k);
+        }  // END for all i
+      }    // END for all j
+    }      // END for all k
+  }
+  else
+  {
+    omp_tiled_loop3d(Ni, Nj, Nk, std::forward<KernelType>(kernel));
+  }
+
+#endif
+}
+
 } /* namespace internal */
 
 } /* namespace mint */
@@ -112,9 +112,14 @@ struct faceids
 /*!
  * \brief Indicates that the lambda expression also takes the cell
  *  connectivity information, i.e., the two cell IDs of the face in addition to
- *  the associated face index. 
+ *  the associated face index. For node traversals the lambda expression
+ *  instead takes the IDs of the cells that contain the node, in increasing
+ *  order, and the number of cells.
  *
  * \note This option can be used for face mesh traversals with any mesh.
+ * \note This option can be used for node mesh traversals with structured and
+ *  unstructured meshes. Unstructured meshes must first call
+ *  UnstructuredMesh::initializeNodeCellConnectivity().
  */
 struct cellids
 { };
@@ -0,0 +1,584 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef MINT_FINITEELEMENT_T_HPP_
+#define MINT_FINITEELEMENT_T_HPP_
+
+#include "axom/core/Macros.hpp"      // for AXOM_STATIC_ASSERT
+#include "axom/core/StackArray.hpp"  // for StackArray
+#include "axom/core/Types.hpp"       // for nullptr
+
+#include "axom/core/utilities/Utilities.hpp"  // for abs(), swap(), etc.
+
+#include "axom/mint/config.hpp"             // for axom::IndexType
+#include "axom/mint/fem/FEBasis.hpp"        // for FEBasis traits class
+#include "axom/mint/fem/FiniteElement.hpp"  // for INSIDE_ELEMENT, etc.
+
+// Slic includes
+#include "axom/slic/interface/slic.hpp"
+
+namespace axom
+{
+namespace mint
+{
+namespace detail
+{
+/*!
+ * \brief Solves the 2x2 system \f$ Jx=b \f$ in closed form.
+ *
+ * \param [in] J the column-major 2x2 matrix
+ * \param [in] b the right-hand side vector
+ * \param [out] x the solution vector
+ *
+ * \return status true if the system was solved, false if J is singular.
+ *
+ * \note Uses the same singularity test as numerics::linear_solve().
+ */
+inline bool fe_solve2x2(const double* J, const double* b, double* x)
+{
+  const double det = J[0] * J[3] - J[1] * J[2];
+  if(utilities::isNearlyEqual(det, 0.0))
+  {
+    return false;
+  }
+
+  const double invdet = 1. / det;
+  x[0] = (J[3] * b[0] - J[2] * b[1]) * invdet;
+  x[1] = (-J[1] * b[0] + J[0] * b[1]) * invdet;
+  return true;
+}
+
+/*!
+ * \brief Solves the 3x3 system \f$ Jx=b \f$ with an LU decomposition with
+ *  partial pivoting, unrolled for the fixed size.
+ *
+ * \param [in] J the column-major 3x3 matrix
+ * \param [in] b the right-hand side vector
+ * \param [out] x the solution vector
+ *
+ * \return status true if the system was solved, false if J is singular.
+ *
+ * \note Follows numerics::lu_decompose() and numerics::lu_solve(), so that
+ *  the singularity test, which checks the pivots rather than the
+ *  determinant, and the solution match numerics::linear_solve() for
+ *  elements of any size.
+ */
+inline bool fe_solve3x3(const double* J, const double* b, double* x)
+{
+  // A[ i ][ j ] holds J( i, j )
+  double A[3][3];
+  double rhs[3] = {b[0], b[1], b[2]};
+  for(int i = 0; i < 3; ++i)
+  {
+    for(int j = 0; j < 3; ++j)
+    {
+      A[i][j] = J[j * 3 + i];
+    }
+  }
+
+  for(int i = 0; i < 3; ++i)
+  {
+    // descend down the ith column and find pivot
+    int pivot = i;
+    double max_element = utilities::abs(A[i][i]);
+    for(int j = i + 1; j < 3; ++j)
+    {
+      const double abs_value = utilities::abs(A[j][i]);
+      if(max_element < abs_value)
+      {
+        max_element = abs_value;
+        pivot = j;
+      }
+    }
+
+    if(pivot != i)
+    {
+      for(int j = 0; j < 3; ++j)
+      {
+        utilities::swap(A[i][j], A[pivot][j]);
+      }
+      utilities::swap(rhs[i], rhs[pivot]);
+    }
+
+    if(utilities::isNearlyEqual(A[i][i], 0.0))
+    {
+      return false;
+    }
+
+    const double scale_factor = 1. / A[i][i];
+    for(int j = i + 1; j < 3; ++j)
+    {
+      A[i][j] *= scale_factor;
+    }
+
+    for(int irow = i + 1; irow < 3; ++irow)
+    {
+      for(int jcol = i + 1; jcol < 3; ++jcol)
+      {
+        A[irow][jcol] -= A[irow][i] * A[i][jcol];
+      }
+    }
+  }
+
+  // forward-solve the L part
+  for(int i = 0; i < 3; ++i)
+  {
+    x[i] = rhs[i];
+    for(int j = 0; j < i; ++j)
+    {
+      x[i] -= A[i][j] * x[j];
+    }
+    x[i] /= A[i][i];
+  }
+
+  // back-substitute the U part
+  for(int i = 1; i >= 0; --i)
+  {
+    for(int j = i + 1; j < 3; ++j)
+    {
+      x[i] -= A[i][j] * x[j];
+    }
+  }
+
+  return true;
+}
+
+/*!
+ * \brief Checks if the Newton-Raphson iterate has diverged.
+ * \see FiniteElement::computeReferenceCoords()
+ */
+template <int NDIMS>
+inline bool fe_diverged(const double* xi)
+{
+  const double DIVERGED = 1.e6;
+
+  bool divergence_detected = false;
+  for(int i = 0; i < NDIMS; ++i)
+  {
+    divergence_detected = divergence_detected || (xi[i] > DIVERGED);
+  }
+
+  return divergence_detected;
+}
+
+/*!
+ * \brief Solves the NDIMS x NDIMS system arising in the Newton-Raphson
+ *  iteration of FiniteElementT.
+ */
+template <int NDIMS>
+inline bool fe_solve(const double* J, const double* b, double* x)
+{
+  AXOM_STATIC_ASSERT(NDIMS == 2 || NDIMS == 3);
+  return (NDIMS == 2) ? fe_solve2x2(J, b, x) : fe_solve3x3(J, b, x);
+}
+
+}  // namespace detail
+
+/*!
+ * \brief FiniteElementT is a fixed-size counterpart of FiniteElement, where
+ *  the cell type and basis are given at compile time.
+ *
+ *  The shape functions are called directly from the Lagrange templates
+ *  rather than through function pointers, and the element nodes, shape
+ *  functions and jacobian are kept in fixed-size arrays on the stack. The
+ *  Newton-Raphson iteration for the inverse map uses a closed-form 2x2 solve
+ *  and an unrolled 3x3 LU solve, and otherwise follows
+ *  FiniteElement::computeReferenceCoords(), so both return the same status
+ *  and reference coordinates (to within the Newton-Raphson tolerance).
+ *
+ *  A FiniteElementT is cheap to construct and may be reused across the cells
+ *  of a mesh by calling setPhysicalNodes() for each cell:
+ * \code
+ *  mint::FiniteElementT< mint::HEX > fe;
+ *
+ *  for ( IndexType icell=0; icell < ncells; ++icell ) {
+ *    ...
+ *    fe.setPhysicalNodes( coords );
+ *    fe.computeReferenceCoords( npts, xp, xr, status );
+ *  }
+ * \endcode
+ *
+ * \tparam CELLTYPE the cell type, e.g., mint::QUAD, mint::HEX, etc.
+ * \tparam BasisType the basis type, e.g., MINT_LAGRANGE_BASIS
+ *
+ * \note The physical dimension is equal to the reference dimension.
+ *
+ * \see FiniteElement
+ * \see FEBasis
+ */
+template <CellType CELLTYPE, int BasisType = MINT_LAGRANGE_BASIS>
+class FiniteElementT
+{
+public:
+  using ShapeFunctionType =
+    typename FEBasis<BasisType, CELLTYPE>::ShapeFunctionType;
+
+  static constexpr int NUM_DOFS = ShapeFunctionType::numDofs();
+  static constexpr int NDIMS = ShapeFunctionType::dimension();
+
+  AXOM_STATIC_ASSERT(NDIMS == 2 || NDIMS == 3);
+
+  /*!
+   * \brief Constructs a FiniteElementT with all nodes at the origin.
+   */
+  FiniteElementT()
+    : m_maxNewtonIterations(ShapeFunctionType::maxNewtonIters())
+  {
+    for(int i = 0; i < NDIMS * NUM_DOFS; ++i)
+    {
+      m_xyz[i] = 0.0;
+    }
+  }
+
+  /*!
+   * \brief Constructs a FiniteElementT from the element coordinates.
+   *
+   * \param [in] xyz the (NDIMS x NUM_DOFS) column-major element coordinates
+   *
+   * \pre xyz != nullptr
+   */
+  explicit FiniteElementT(const double* xyz)
+    : m_maxNewtonIterations(ShapeFunctionType::maxNewtonIters())
+  {
+    setPhysicalNodes(xyz);
+  }
+
+  /*!
+   * \brief Copies the given element coordinates into this instance.
+   *
+   * \param [in] xyz the (NDIMS x NUM_DOFS) column-major element coordinates
+   *
+   * \pre xyz != nullptr
+   */
+  void setPhysicalNodes(const double* xyz)
+  {
+    SLIC_ASSERT(xyz != nullptr);
+    for(int i = 0; i < NDIMS * NUM_DOFS; ++i)
+    {
+      m_xyz[i] = xyz[i];
+    }
+  }
+
+  /*!
+   * \brief Returns a pointer to the column-major element coordinates.
+   */
+  const double* getPhysicalNodes() const { return m_xyz; }
+
+  /*!
+   * \brief Overrides the max number of Newton-Raphson iterations.
+   * \see FiniteElement::setMaxSolverIterations()
+   */
+  void setMaxSolverIterations(int numIters)
+  {
+    m_maxNewtonIterations = numIters;
+  }
+
+  /*!
+   * \brief Returns the max number of Newton-Raphson iterations.
+   */
+  int getMaxSolverIterations() const { return m_maxNewtonIterations; }
+
+  /// \name Element Attributes
+  /// @{
+
+  static constexpr CellType getCellType() { return CELLTYPE; }
+  static constexpr int getBasisType() { return BasisType; }
+  static constexpr int getPhysicalDimension() { return NDIMS; }
+  static constexpr int getReferenceDimension() { return NDIMS; }
+  static constexpr int getNumNodes() { return NUM_DOFS; }
+  static constexpr int getNumDofs() { return NUM_DOFS; }
+
+  /// @}
+
+  /*!
+   * \brief Evaluates the shape functions at the given reference coordinates.
+   * \see FiniteElement::evaluateShapeFunctions()
+   */
+  static void evaluateShapeFunctions(const double* xr, double* phi)
+  {
+    ShapeFunctionType::evaluate(xr, phi);
+  }
+
+  /*!
+   * \brief Evaluates the shape function derivatives at the given reference
+   *  coordinates.
+   * \see FiniteElement::evaluateDerivatives()
+   */
+  static void evaluateDerivatives(const double* xr, double* phidot)
+  {
+    ShapeFunctionType::derivatives(xr, phidot);
+  }
+
+  /*!
+   * \brief Computes the jacobian at the given reference coordinates.
+   *
+   * \param [in] xr the reference coordinates
+   * \param [out] J buffer (NDIMS*NDIMS long) to store the column-major
+   *  jacobian
+   *
+   * \see FiniteElement::jacobian()
+   */
+  void jacobian(const double* xr, double* J) const
+  {
+    StackArray<double, NUM_DOFS * NDIMS> phidot;
+    evaluateDerivatives(xr, phidot);
+
+    for(int i = 0; i < NDIMS; ++i)
+    {
+      for(int j = 0; j < NDIMS; ++j)
+      {
+        double sum = 0.0;
+        for(int k = 0; k < NUM_DOFS; ++k)
+        {
+          sum += m_xyz[k * NDIMS + i] * phidot[j * NUM_DOFS + k];
+        }
+        J[j * NDIMS + i] = sum;
+      }
+    }
+  }
+
+  /*!
+   * \brief Maps the given reference coordinates to physical space.
+   * \see FiniteElement::computePhysicalCoords()
+   */
+  void computePhysicalCoords(const double* xr, double* xp) const
+  {
+    SLIC_ASSERT(xr != nullptr);
+    SLIC_ASSERT(xp != nullptr);
+
+    StackArray<double, NUM_DOFS> phi;
+    evaluateShapeFunctions(xr, phi);
+    interpolateCoords(phi, xp);
+  }
+
+  /*!
+   * \brief Computes the reference coordinates of the given physical point.
+   *
+   * \param [in] xp physical coordinates of the point in query.
+   * \param [out] xr computed reference coordinates \f$ \bar{\xi} \f$
+   * \param [in] TOL optional tolerance for Newton-Raphson. Default is 1.e-12.
+   *
+   * \return rc mint::INVERSE_MAP_FAILED, mint::OUTSIDE_ELEMENT or
+   *  mint::INSIDE_ELEMENT
+   *
+   * \see FiniteElement::computeReferenceCoords()
+   */
+  int computeReferenceCoords(const double* xp,
+                             double* xr,
+                             double TOL = 1.e-12) const;
+
+  /// \name Batched Evaluation
+  /// @{
+
+  /*!
+   * \brief Maps a batch of points from reference to physical space.
+   *
+   * \param [in] npts the number of points
+   * \param [in] xr buffer (npts*NDIMS long) of interleaved reference coords
+   * \param [out] xp buffer (npts*NDIMS long) for the physical coordinates
+   */
+  void computePhysicalCoords(IndexType npts, const double* xr, double* xp) const
+  {
+    SLIC_ASSERT(npts == 0 || (xr != nullptr && xp != nullptr));
+    for(IndexType ipt = 0; ipt < npts; ++ipt)
+    {
+      computePhysicalCoords(xr + ipt * NDIMS, xp + ipt * NDIMS);
+    }
+  }
+
+  /*!
+   * \brief Computes the reference coordinates of a batch of points.
+   *
+   * \param [in] npts the number of points
+   * \param [in] xp buffer (npts*NDIMS long) of interleaved physical coords
+   * \param [out] xr buffer (npts*NDIMS long) for the reference coordinates
+   * \param [out] status buffer (npts long) for the return code of each point
+   * \param [in] TOL optional tolerance for Newton-Raphson. Default is 1.e-12.
+   *
+   * \return N the number of points inside the element.
+   */
+  IndexType computeReferenceCoords(IndexType npts,
+                                   const double* xp,
+                                   double* xr,
+                                   int* status,
+                                   double TOL = 1.e-12) const
+  {
+    SLIC_ASSERT(npts == 0 || (xp != nullptr && xr != nullptr));
+    SLIC_ASSERT(npts == 0 || status != nullptr);
+
+    IndexType numInside = 0;
+    for(IndexType ipt = 0; ipt < npts; ++ipt)
+    {
+      status[ipt] =
+        computeReferenceCoords(xp + ipt * NDIMS, xr + ipt * NDIMS, TOL);
+      numInside += (status[ipt] == INSIDE_ELEMENT) ? 1 : 0;
+    }
+
+    return numInside;
+  }
+
+  /*!
+   * \brief Evaluates the shape functions at a batch of points.
+   *
+   * \param [in] npts the number of points
+   * \param [in] xr buffer (npts*NDIMS long) of interleaved reference coords
+   * \param [out] phi buffer (npts*NUM_DOFS long) for the shape functions
+   */
+  static void evaluateShapeFunctions(IndexType npts,
+                                     const double* xr,
+                                     double* phi)
+  {
+    SLIC_ASSERT(npts == 0 || (xr != nullptr && phi != nullptr));
+    for(IndexType ipt = 0; ipt < npts; ++ipt)
+    {
+      evaluateShapeFunctions(xr + ipt * NDIMS, phi + ipt * NUM_DOFS);
+    }
+  }
+
+  /// @}
+
+private:
+  /*!
+   * \brief Computes \f$ \sum\limits_{i=0}^n{N}_i x_i \f$ for the given
+   *  shape functions.
+   */
+  void interpolateCoords(const double* phi, double* xp) const
+  {
+    for(int i = 0; i < NDIMS; ++i)
+    {
+      double sum = 0.0;
+      for(int j = 0; j < NUM_DOFS; ++j)
+      {
+        sum += m_xyz[j * NDIMS + i] * phi[j];
+      }
+      xp[i] = sum;
+    }
+  }
+
+  /*!
+   * \brief Checks if the given reference coordinates are inside the
+   *  reference element.
+   * \see FiniteElement::inReferenceElement()
+   */
+  static bool inReferenceElement(const double* xr, double TOL)
+  {
+    const double LTOL = ShapeFunctionType::min() - TOL;
+    const double HTOL = ShapeFunctionType::max() + TOL;
+
+    const bool useShape = (CELLTYPE == mint::TRIANGLE ||
+                           CELLTYPE == mint::TET || CELLTYPE == mint::PRISM ||
+                           CELLTYPE == mint::PYRAMID);
+
+    bool is_inside = true;
+    if(useShape)
+    {
+      StackArray<double, NUM_DOFS> phi;
+      evaluateShapeFunctions(xr, phi);
+      for(int i = 0; is_inside && (i < NUM_DOFS); ++i)
+      {
+        is_inside = (phi[i] > LTOL) && (phi[i] < HTOL);
+      }
+    }
+    else
+    {
+      for(int i = 0; is_inside && (i < NDIMS); ++i)
+      {
+        is_inside = (xr[i] > LTOL) && (xr[i] < HTOL);
+      }
+    }
+
+    return is_inside;
+  }
+
+  StackArray<double, NDIMS * NUM_DOFS> m_xyz; /*!< element coordinates */
+  int m_maxNewtonIterations; /*!< max newton iterations for inverse map */
+};
+
+//------------------------------------------------------------------------------
+//    IMPLEMENTATION
+//------------------------------------------------------------------------------
+template <CellType CELLTYPE, int BasisType>
+constexpr int FiniteElementT<CELLTYPE, BasisType>::NUM_DOFS;
+
+template <CellType CELLTYPE, int BasisType>
+constexpr int FiniteElementT<CELLTYPE, BasisType>::NDIMS;
+
+//------------------------------------------------------------------------------
+template <CellType CELLTYPE, int BasisType>
+int FiniteElementT<CELLTYPE, BasisType>::computeReferenceCoords(
+  const double* xp,
+  double* xr,
+  double TOL) const
+{
+  SLIC_ASSERT(xp != nullptr);
+  SLIC_ASSERT(xr != nullptr);
+
+  StackArray<double, NUM_DOFS> phi;
+  StackArray<double, NDIMS * NDIMS> J;
+  double x[NDIMS];    // Newton update
+  double psi[NDIMS];  // rhs
+
+  double l1norm = 0.0;
+  bool converged = false;
+
+  // STEP 1: set initial guess for Newton-Raphson at the parametric center
+  ShapeFunctionType::center(xr);
+
+  // STEP 2: Newton-Raphson iteration
+  for(int iter = 0; !converged && (iter < m_maxNewtonIterations); ++iter)
+  {
+    evaluateShapeFunctions(xr, phi);
+    jacobian(xr, J);
+
+    // compute the right-hand side term, -\psi
+    for(int i = 0; i < NDIMS; ++i)
+    {
+      psi[i] = (-1.0) * xp[i];
+      for(int j = 0; j < NUM_DOFS; ++j)
+      {
+        psi[i] += phi[j] * m_xyz[j * NDIMS + i];
+      }
+
+      psi[i] = (-1.0) * psi[i];
+    }
+
+    if(!detail::fe_solve<NDIMS>(J, psi, x))
+    {
+      SLIC_WARNING("Newton-Raphson failed, system appears singular!");
+      return INVERSE_MAP_FAILED;
+    }
+
+    l1norm = 0.0;
+    for(int i = 0; i < NDIMS; ++i)
+    {
+      l1norm += utilities::abs(x[i]);
+      xr[i] += x[i];
+    }
+
+    converged = (l1norm < TOL);
+
+    if(!converged && detail::fe_diverged<NDIMS>(xr))
+    {
+      SLIC_WARNING("Newton-Raphson divergence detected!");
+      SLIC_INFO("l1norm=" << l1norm << " iter= " << iter);
+      break;
+    }
+
+  }  // END newton iterations
+
+  if(!converged)
+  {
+    SLIC_WARNING("Newton-Raphson did not converge!");
+    SLIC_INFO("l1norm=" << l1norm);
+    return INVERSE_MAP_FAILED;
+  }
+
+  return inReferenceElement(xr, TOL) ? INSIDE_ELEMENT : OUTSIDE_ELEMENT;
+}
+
+} /* namespace mint */
+} /* namespace axom */
+
+#endif /* MINT_FINITEELEMENT_T_HPP_ */
@@ -47,7 +47,7 @@ public:
    * \return ndofs the number of degrees of freedom
    * \post ndofs >= 1
    */
-  static int numDofs() { return ShapeType::getNumDofs(); };
+  static constexpr int numDofs() { return ShapeType::getNumDofs(); };
 
   /*!
    * \brief Returns the maximum number of iterations for the Newton-Raphson
@@ -60,7 +60,7 @@ public:
    * \return ndims the dimension of the reference element
    * \post ndims >= 1
    */
-  static int dimension() { return ShapeType::getDimension(); };
+  static constexpr int dimension() { return ShapeType::getDimension(); };
 
   /*!
    * \brief Returns the min coordinate of the reference element
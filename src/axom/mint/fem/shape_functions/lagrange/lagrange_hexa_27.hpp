@@ -71,11 +71,11 @@ public:
 
   static int getType() { return MINT_LAGRANGE_BASIS; }
 
-  static int getNumDofs() { return 27; }
+  static constexpr int getNumDofs() { return 27; }
 
   static int getMaxNewtonIters() { return 16; }
 
-  static int getDimension() { return 3; }
+  static constexpr int getDimension() { return 3; }
 
   static double getMin() { return 0; }
 
@@ -44,11 +44,11 @@ public:
 
   static int getType() { return MINT_LAGRANGE_BASIS; }
 
-  static int getNumDofs() { return 4; }
+  static constexpr int getNumDofs() { return 4; }
 
   static int getMaxNewtonIters() { return 16; }
 
-  static int getDimension() { return 2; }
+  static constexpr int getDimension() { return 2; }
 
   static double getMin() { return 0; }
 
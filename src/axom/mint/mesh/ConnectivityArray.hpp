@@ -23,6 +23,9 @@
   #include "axom/sidre/core/sidre.hpp"
 #endif
 
+// C/C++ includes
+#include <type_traits>  // for std::is_integral, std::is_signed
+
 namespace axom
 {
 namespace mint
@@ -42,7 +45,7 @@ enum ConnectivityType
  *  The ConnectivityArray is a map between IDs and values where each
  *  ID can be a different type and have a different number of values.
  *  A ConnectivityArray with N IDs has IDs from [0, N-1] whereas the values
- *  for each ID can be anything within the range of IndexType.
+ *  for each ID can be anything within the range of IndexT.
  *
  *  The ConnectivityArray object may be constructed using (a) native storage,
  *  (b) external storage, or, (c) Sidre:
@@ -111,15 +114,21 @@ enum ConnectivityType
  *
  * \tparam TYPE the type of the ConnectivityArray this class deals with the
  *  case of TYPE == NO_INDIRECTION.
+ * \tparam IndexT the integral type used to store the values (and offsets),
+ *  IndexType by default. A narrower type such as axom::int32 halves the
+ *  memory footprint of the connectivity when all values fit in its range.
  *
  * \see ConnectivityArray_indirection.hpp
  * \see ConnectivityArray_typed_indirection.hpp
  * \see ConnectivityArray_internal.hpp
  */
-template <ConnectivityType TYPE>
+template <ConnectivityType TYPE, typename IndexT = IndexType>
 class ConnectivityArray
 {
   AXOM_STATIC_ASSERT(TYPE == NO_INDIRECTION);
+  AXOM_STATIC_ASSERT_MSG(std::is_integral<IndexT>::value &&
+                           std::is_signed<IndexT>::value,
+                         "IndexT must be a signed integral type.");
 
 public:
   /*!
@@ -153,7 +162,7 @@ public:
                   "Unknown cell type.");
 
     m_stride = getCellInfo(cell_type).num_nodes;
-    m_values = new Array<IndexType>(axom::internal::ZERO, m_stride, ID_capacity);
+    m_values = new Array<IndexT>(axom::internal::ZERO, m_stride, ID_capacity);
   }
 
   /*!
@@ -173,7 +182,7 @@ public:
   {
     SLIC_ERROR_IF(stride <= 0, "Stride must be greater than zero: " << stride);
 
-    m_values = new Array<IndexType>(axom::internal::ZERO, m_stride, ID_capacity);
+    m_values = new Array<IndexT>(axom::internal::ZERO, m_stride, ID_capacity);
   }
 
   /// @}
@@ -202,7 +211,7 @@ public:
    */
   ConnectivityArray(CellType cell_type,
                     IndexType n_IDs,
-                    IndexType* values,
+                    IndexT* values,
                     IndexType ID_capacity = USE_DEFAULT)
     : m_cell_type(cell_type)
     , m_stride(-1)
@@ -214,7 +223,7 @@ public:
                   "Unknown cell type.");
 
     m_stride = getCellInfo(cell_type).num_nodes;
-    m_values = new Array<IndexType>(values, n_IDs, m_stride, ID_capacity);
+    m_values = new Array<IndexT>(values, n_IDs, m_stride, ID_capacity);
   }
 
   /*!
@@ -238,13 +247,13 @@ public:
    */
   ConnectivityArray(IndexType stride,
                     IndexType n_IDs,
-                    IndexType* values,
+                    IndexT* values,
                     IndexType ID_capacity = USE_DEFAULT)
     : m_cell_type(UNDEFINED_CELL)
     , m_stride(stride)
     , m_values(nullptr)
   {
-    m_values = new Array<IndexType>(values, n_IDs, m_stride, ID_capacity);
+    m_values = new Array<IndexT>(values, n_IDs, m_stride, ID_capacity);
   }
 
   /// @}
@@ -322,7 +331,7 @@ public:
     SLIC_ASSERT(elems_group != nullptr);
 
     sidre::View* connec_view = elems_group->getView("connectivity");
-    m_values = new sidre::Array<IndexType>(connec_view, 0, m_stride, ID_capacity);
+    m_values = new sidre::Array<IndexT>(connec_view, 0, m_stride, ID_capacity);
     SLIC_ASSERT(m_values != nullptr);
   }
 
@@ -360,7 +369,7 @@ public:
     SLIC_ASSERT(elems_group != nullptr);
 
     sidre::View* connec_view = elems_group->getView("connectivity");
-    m_values = new sidre::Array<IndexType>(connec_view, 0, m_stride, ID_capacity);
+    m_values = new sidre::Array<IndexT>(connec_view, 0, m_stride, ID_capacity);
     SLIC_ASSERT(m_values != nullptr);
   }
 
@@ -487,7 +496,7 @@ public:
       return nullptr;
     }
 
-    return static_cast<sidre::Array<IndexType>*>(m_values)
+    return static_cast<sidre::Array<IndexT>*>(m_values)
       ->getView()
       ->getOwningGroup()
       ->getParent();
@@ -532,13 +541,13 @@ public:
    */
   /// @{
 
-  IndexType* operator[](IndexType ID)
+  IndexT* operator[](IndexType ID)
   {
     SLIC_ASSERT((ID >= 0) && (ID < getNumberOfIDs()));
     return m_values->getData() + ID * m_stride;
   }
 
-  const IndexType* operator[](IndexType ID) const
+  const IndexT* operator[](IndexType ID) const
   {
     SLIC_ASSERT((ID >= 0) && (ID < getNumberOfIDs()));
     return m_values->getData() + ID * m_stride;
@@ -552,9 +561,9 @@ public:
    */
   /// @{
 
-  IndexType* getValuePtr() { return m_values->getData(); }
+  IndexT* getValuePtr() { return m_values->getData(); }
 
-  const IndexType* getValuePtr() const { return m_values->getData(); }
+  const IndexT* getValuePtr() const { return m_values->getData(); }
 
   /// @}
 
@@ -565,9 +574,9 @@ public:
    */
   /// @{
 
-  IndexType* getOffsetPtr() { return nullptr; }
+  IndexT* getOffsetPtr() { return nullptr; }
 
-  const IndexType* getOffsetPtr() const { return nullptr; }
+  const IndexT* getOffsetPtr() const { return nullptr; }
 
   /// @}
 
@@ -594,7 +603,7 @@ public:
    *
    * \pre values != nullptr
    */
-  void append(const IndexType* values,
+  void append(const IndexT* values,
               IndexType AXOM_NOT_USED(n_values) = 0,
               CellType AXOM_NOT_USED(type) = UNDEFINED_CELL)
   {
@@ -613,9 +622,9 @@ public:
    * \pre values != nullptr
    * \pre n_IDs >= 0
    */
-  void appendM(const IndexType* values,
+  void appendM(const IndexT* values,
                IndexType n_IDs,
-               const IndexType* AXOM_NOT_USED(offsets) = nullptr,
+               const IndexT* AXOM_NOT_USED(offsets) = nullptr,
                const CellType* AXOM_NOT_USED(types) = nullptr)
   {
     SLIC_ASSERT(values != nullptr);
@@ -633,7 +642,7 @@ public:
    * \pre ID >= 0 && ID < getNumberOfIDs()
    * \pre values != nullptr
    */
-  void set(const IndexType* values, IndexType ID)
+  void set(const IndexT* values, IndexType ID)
   {
     SLIC_ASSERT(ID >= 0);
     SLIC_ASSERT(ID < getNumberOfIDs());
@@ -652,7 +661,7 @@ public:
    * \pre start_ID >= 0 && start_ID + n_IDs < getNumberOfIDs()
    * \pre values != nullptr
    */
-  void setM(const IndexType* values, IndexType start_ID, IndexType n_IDs)
+  void setM(const IndexT* values, IndexType start_ID, IndexType n_IDs)
   {
     SLIC_ASSERT(start_ID >= 0);
     SLIC_ASSERT(start_ID + n_IDs <= getNumberOfIDs());
@@ -672,7 +681,7 @@ public:
    * \pre start_ID >= 0 && start_ID <= getNumberOfIDs()
    * \pre values != nullptr
    */
-  void insert(const IndexType* values,
+  void insert(const IndexT* values,
               IndexType start_ID,
               IndexType AXOM_NOT_USED(n_values) = 0,
               CellType AXOM_NOT_USED(type) = UNDEFINED_CELL)
@@ -694,10 +703,10 @@ public:
    * \pre n_IDs >= 0
    * \pre values != nullptr
    */
-  void insertM(const IndexType* values,
+  void insertM(const IndexT* values,
                IndexType start_ID,
                IndexType n_IDs,
-               const IndexType* AXOM_NOT_USED(offsets) = nullptr,
+               const IndexT* AXOM_NOT_USED(offsets) = nullptr,
                const CellType* AXOM_NOT_USED(types) = nullptr)
   {
     SLIC_ASSERT(start_ID >= 0);
@@ -711,7 +720,7 @@ public:
 private:
   CellType m_cell_type;
   IndexType m_stride;
-  Array<IndexType>* m_values;
+  Array<IndexT>* m_values;
 
   DISABLE_COPY_AND_ASSIGNMENT(ConnectivityArray);
   DISABLE_MOVE_AND_ASSIGNMENT(ConnectivityArray);
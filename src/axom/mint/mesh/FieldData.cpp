@@ -72,6 +72,8 @@ void removeFromSidre(sidre::Group* grp, const std::string& name)
 //  FIELDDATA IMPLEMENTATION
 //------------------------------------------------------------------------------
 
+constexpr int FieldData::INVALID_FIELD_INDEX;
+
 //------------------------------------------------------------------------------
 FieldData::FieldData(int association)
   : m_association(association)
@@ -178,7 +180,7 @@ FieldData::FieldData(int association,
       SLIC_ERROR_IF(field->getNumTuples() != num_tuples,
                     "Inconsistent number of tuples");
 
-      m_fields[name] = field;
+      appendField(field);
     }  // END if centering
   }    // END for all fields
 }
@@ -187,64 +189,59 @@ FieldData::FieldData(int association,
 //------------------------------------------------------------------------------
 void FieldData::clear()
 {
-  const int numFields = getNumFields();
-  for(int i = 0; i < numFields; ++i)
+  for(Field* f : m_fields)
   {
-    delete getField(i);
+    delete f;
   }
 
   m_fields.clear();
+  m_field_index.clear();
 }
 
 //------------------------------------------------------------------------------
 void FieldData::resize(IndexType newNumTuples)
 {
-  const IndexType numFields = getNumFields();
-  for(int i = 0; i < numFields; ++i)
+  for(Field* f : m_fields)
   {
-    getField(i)->resize(newNumTuples);
-  };
+    f->resize(newNumTuples);
+  }
 }
 
 //------------------------------------------------------------------------------
 void FieldData::emplace(IndexType pos, IndexType num_tuples)
 {
-  const IndexType numFields = getNumFields();
-  for(int i = 0; i < numFields; ++i)
+  for(Field* f : m_fields)
   {
-    getField(i)->emplace(pos, num_tuples);
-  };
+    f->emplace(pos, num_tuples);
+  }
 }
 
 //------------------------------------------------------------------------------
 void FieldData::reserve(IndexType newCapacity)
 {
-  const IndexType numFields = getNumFields();
-  for(int i = 0; i < numFields; ++i)
+  for(Field* f : m_fields)
   {
-    getField(i)->reserve(newCapacity);
-  };
+    f->reserve(newCapacity);
+  }
 }
 
 //------------------------------------------------------------------------------
 void FieldData::shrink()
 {
-  const IndexType numFields = getNumFields();
-  for(int i = 0; i < numFields; ++i)
+  for(Field* f : m_fields)
   {
-    getField(i)->shrink();
-  };
+    f->shrink();
+  }
 }
 
 //------------------------------------------------------------------------------
 void FieldData::setResizeRatio(double ratio)
 {
   m_resize_ratio = ratio;
-  const IndexType numFields = getNumFields();
-  for(int i = 0; i < numFields; ++i)
+  for(Field* f : m_fields)
   {
-    getField(i)->setResizeRatio(ratio);
-  };
+    f->setResizeRatio(ratio);
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -280,11 +277,40 @@ bool FieldData::checkConsistency(IndexType num_tuples, IndexType capacity) const
 //------------------------------------------------------------------------------
 void FieldData::removeField(const std::string& name)
 {
-  mint::Field* f = getField(name);
-  SLIC_ERROR_IF(f == nullptr, "field [" << name << "] does not exist!");
+  const int i = getFieldIndex(name);
+  SLIC_ERROR_IF(i == INVALID_FIELD_INDEX,
+                "field [" << name << "] does not exist!");
 
-  m_fields.erase(name);
-  delete f;
+  removeFieldAt(i);
+}
+
+//------------------------------------------------------------------------------
+void FieldData::removeField(int i)
+{
+  SLIC_ERROR_IF(i < 0 || i >= getNumFields(),
+                "field index [" << i << "] is out of bounds!");
+
+  removeFieldAt(i);
+}
+
+//------------------------------------------------------------------------------
+void FieldData::removeFieldAt(int i)
+{
+  SLIC_ASSERT(i >= 0 && i < getNumFields());
+  SLIC_ASSERT(m_fields[i] != nullptr);
+
+  const std::string name = m_fields[i]->getName();
+  delete m_fields[i];
+
+  m_fields.erase(m_fields.begin() + i);
+  m_field_index.erase(name);
+
+  // shift the indices of the fields after the removed field
+  const int numFields = getNumFields();
+  for(int j = i; j < numFields; ++j)
+  {
+    m_field_index[m_fields[j]->getName()] = j;
+  }
 
 #ifdef AXOM_MINT_USE_SIDRE
   if(hasSidreGroup() && m_fields_group->hasChildGroup(name))
@@ -296,11 +322,13 @@ void FieldData::removeField(const std::string& name)
 }
 
 //------------------------------------------------------------------------------
-void FieldData::removeField(int i)
+void FieldData::appendField(Field* field)
 {
-  mint::Field* f = getField(i);
-  removeField(f->getName());
-  f = nullptr;
+  SLIC_ASSERT(field != nullptr);
+  SLIC_ASSERT(!hasField(field->getName()));
+
+  m_field_index[field->getName()] = static_cast<int>(m_fields.size());
+  m_fields.push_back(field);
 }
 
 } /* namespace mint */
@@ -17,14 +17,14 @@
 // Mint includes
 #include "axom/mint/config.hpp"      // for mint compile time definitions
 #include "axom/mint/mesh/Field.hpp"  // for mint::Field definition
+#include "axom/mint/mesh/FieldHandle.hpp"       // for mint::FieldHandle
 #include "axom/mint/mesh/FieldVariable.hpp"     // for mint::FieldVariable
 #include "axom/mint/mesh/FieldAssociation.hpp"  // for mint::FieldAssociation
 
 // C/C++ includes
-#include <iterator>  // for std::advance
-#include <string>    // for std::string
-#include <map>       // for std::map
-#include <vector>    // for std::vector
+#include <string>         // for std::string
+#include <unordered_map>  // for std::unordered_map
+#include <vector>         // for std::vector
 
 namespace axom
 {
@@ -54,6 +54,12 @@ namespace mint
  *   removing fields from the FieldData object is reflected in the associated
  *   Sidre hierarchy by default.
  *
+ *  The fields are stored in a flat array in the order they were added, so
+ *  access by index is constant time, and a hash table maps field names to
+ *  indices. The index of a field changes when a field before it is removed.
+ *  Codes that access the same field repeatedly may instead obtain a
+ *  FieldHandle, which stays valid until that field is removed.
+ *
  * \see Field
  * \see FieldVariable
  */
@@ -160,7 +166,19 @@ public:
    */
   inline bool hasField(const std::string& name) const
   {
-    return (m_fields.find(name) != m_fields.end());
+    return (m_field_index.find(name) != m_field_index.end());
+  }
+
+  /*!
+   * \brief Returns the index of the field with the given name.
+   * \param [in] name the name of the field in query.
+   * \return idx the index of the field, or -1 if the field does not exist.
+   * \post idx == -1 \iff this->hasField( name )==false.
+   */
+  inline int getFieldIndex(const std::string& name) const
+  {
+    auto it = m_field_index.find(name);
+    return (it == m_field_index.end()) ? INVALID_FIELD_INDEX : it->second;
   }
 
   /*!
@@ -294,12 +312,9 @@ public:
 
   inline const Field* getField(int i) const
   {
-    SLIC_ASSERT(i < static_cast<int>(m_fields.size()));
-    std::map<std::string, Field*>::const_iterator it = m_fields.begin();
-    std::advance(it, i);
-    SLIC_ASSERT(it != m_fields.end());
-    SLIC_ASSERT(it->second != nullptr);
-    return it->second;
+    SLIC_ASSERT(i >= 0 && i < static_cast<int>(m_fields.size()));
+    SLIC_ASSERT(m_fields[i] != nullptr);
+    return m_fields[i];
   }
 
   /// @}
@@ -322,20 +337,29 @@ public:
 
   inline const Field* getField(const std::string& name) const
   {
-    std::map<std::string, Field*>::const_iterator it = m_fields.find(name);
-    if(it == m_fields.end())
-    {
-      return nullptr;
-    }
-    else
-    {
-      SLIC_ASSERT(it->second != nullptr);
-      return it->second;
-    }
+    const int i = getFieldIndex(name);
+    return (i == INVALID_FIELD_INDEX) ? nullptr : getField(i);
   }
 
   /// @}
 
+  /*!
+   * \brief Returns a handle to the field with the given name.
+   *
+   * \param [in] name the name of the field in query.
+   * \return h handle to the field in query.
+   *
+   * \note The field type is checked once, when the handle is created.
+   *
+   * \pre hasField( name ) == true
+   * \pre the field holds values of type T
+   * \post h.isValid() == true
+   *
+   * \see FieldHandle
+   */
+  template <typename T>
+  inline FieldHandle<T> getFieldHandle(const std::string& name);
+
   /*!
    * \brief Returns pointer to the buffer of the field with the given name.
    *
@@ -490,16 +514,29 @@ private:
    *
    * \param [in] i the index of the field to remove.
    *
+   * \note The indices of the fields after i are shifted down by one.
+   *
    * \pre i >= 0 && i < m_fields.size()
    * \pre m_fields[ i ]  != nullptr
    */
   void removeFieldAt(int i);
 
+  /*!
+   * \brief Appends the given field to this FieldData instance.
+   *
+   * \param [in] field pointer to the field to append.
+   *
+   * \pre field != nullptr
+   * \pre hasField( field->getName() ) == false
+   */
+  void appendField(Field* field);
+
   /// @}
 
   int m_association;
   double m_resize_ratio;
-  std::map<std::string, Field*> m_fields;
+  std::vector<Field*> m_fields;
+  std::unordered_map<std::string, int> m_field_index;
 
 #ifdef AXOM_MINT_USE_SIDRE
   sidre::Group* m_fields_group;
@@ -615,6 +652,20 @@ inline const T* FieldData::getFieldPtr(const std::string& name,
   return mint::Field::getDataPtr<T>(f);
 }
 
+//------------------------------------------------------------------------------
+template <typename T>
+inline FieldHandle<T> FieldData::getFieldHandle(const std::string& name)
+{
+  Field* f = getField(name);
+  SLIC_ERROR_IF(f == nullptr, "field [" << name << "] does not exist!");
+  SLIC_ERROR_IF(f->getType() != field_traits<T>::type(),
+                "Template argument to FieldData::getFieldHandle() doesn't "
+                "match the type of field ["
+                  << name << "]");
+
+  return FieldHandle<T>(static_cast<FieldVariable<T>*>(f));
+}
+
 //------------------------------------------------------------------------------
 template <typename T>
 inline T* FieldData::createField(const std::string& name,
@@ -659,7 +710,7 @@ inline T* FieldData::createField(const std::string& name,
 
   SLIC_ASSERT(newField != nullptr);
   newField->setResizeRatio(m_resize_ratio);
-  m_fields[name] = newField;
+  appendField(newField);
 
   return (mint::Field::getDataPtr<T>(newField));
 }
@@ -682,7 +733,7 @@ inline T* FieldData::createField(const std::string& name,
 
   Field* field =
     new mint::FieldVariable<T>(name, data, num_tuples, num_components, capacity);
-  m_fields[name] = field;
+  appendField(field);
 
   return (mint::Field::getDataPtr<T>(field));
 }
@@ -0,0 +1,133 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef MINT_FIELDHANDLE_HPP_
+#define MINT_FIELDHANDLE_HPP_
+
+// Mint includes
+#include "axom/mint/config.hpp"              // for mint::IndexType
+#include "axom/mint/mesh/FieldVariable.hpp"  // for mint::FieldVariable
+
+// Slic includes
+#include "axom/slic/interface/slic.hpp"  // for slic macros
+
+// C/C++ includes
+#include <string>  // for std::string
+
+namespace axom
+{
+namespace mint
+{
+/*!
+ * \class FieldHandle
+ *
+ * \brief Provides repeated, type-checked access to a field of a FieldData
+ *  instance without looking up the field by name each time.
+ *
+ *  A FieldHandle is obtained from FieldData::getFieldHandle() or
+ *  Mesh::getFieldHandle(), which check the field type once. The handle
+ *  remains valid when fields are added or removed and when the field is
+ *  resized, since getData() always returns the current buffer of the field.
+ *  It is invalidated when the field itself is removed.
+ *
+ *  Example:
+ *  \code
+ *    FieldHandle< double > h =
+ *      mesh->getFieldHandle< double >( "u", NODE_CENTERED );
+ *
+ *    for ( int cycle=0; cycle < ncycles; ++cycle )
+ *    {
+ *      double* u = h.getData();
+ *      ...
+ *    }
+ *  \endcode
+ *
+ * \tparam T the type of the field values.
+ *
+ * \see FieldData
+ */
+template <typename T>
+class FieldHandle
+{
+public:
+  /*!
+   * \brief Creates an invalid FieldHandle.
+   *
+   * \post isValid() == false
+   */
+  FieldHandle() : m_field(nullptr) { }
+
+  /*!
+   * \brief Creates a FieldHandle to the given field.
+   *
+   * \param [in] field pointer to the field.
+   */
+  explicit FieldHandle(FieldVariable<T>* field) : m_field(field) { }
+
+  /*!
+   * \brief Returns true if the handle refers to a field.
+   */
+  inline bool isValid() const { return (m_field != nullptr); }
+
+  /*!
+   * \brief Returns a pointer to the field.
+   */
+  inline FieldVariable<T>* getField() const { return m_field; }
+
+  /*!
+   * \brief Returns the name of the field.
+   *
+   * \pre isValid() == true
+   */
+  inline const std::string& getName() const
+  {
+    SLIC_ASSERT(isValid());
+    return m_field->getName();
+  }
+
+  /*!
+   * \brief Returns the number of tuples of the field.
+   *
+   * \pre isValid() == true
+   */
+  inline IndexType getNumTuples() const
+  {
+    SLIC_ASSERT(isValid());
+    return m_field->getNumTuples();
+  }
+
+  /*!
+   * \brief Returns the number of components per tuple of the field.
+   *
+   * \pre isValid() == true
+   */
+  inline IndexType getNumComponents() const
+  {
+    SLIC_ASSERT(isValid());
+    return m_field->getNumComponents();
+  }
+
+  /*!
+   * \brief Returns a pointer to the current buffer of the field.
+   *
+   * \note The buffer may change when the field is resized, the handle does
+   *  not.
+   *
+   * \pre isValid() == true
+   */
+  inline T* getData() const
+  {
+    SLIC_ASSERT(isValid());
+    return m_field->getFieldVariablePtr();
+  }
+
+private:
+  FieldVariable<T>* m_field;
+};
+
+} /* namespace mint */
+} /* namespace axom */
+
+#endif /* MINT_FIELDHANDLE_HPP_ */
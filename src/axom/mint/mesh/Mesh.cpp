@@ -55,7 +55,18 @@ Mesh* getMesh(sidre::Group* group, const std::string& topo)
     m = new UniformMesh(group, topo);
     break;
   case UNSTRUCTURED_MESH:
-    if(blueprint::hasMixedCellTypes(group, topo))
+    if(blueprint::hasCompactConnectivity(group, topo))
+    {
+      if(blueprint::hasMixedCellTypes(group, topo))
+      {
+        m = new UnstructuredMesh<MIXED_SHAPE, int32>(group, topo);
+      }
+      else
+      {
+        m = new UnstructuredMesh<SINGLE_SHAPE, int32>(group, topo);
+      }
+    }
+    else if(blueprint::hasMixedCellTypes(group, topo))
     {
       m = new UnstructuredMesh<MIXED_SHAPE>(group, topo);
     }
@@ -88,6 +99,7 @@ Mesh::Mesh(int ndims, int type)
   , m_explicit_coords(false)
   , m_explicit_connectivity(false)
   , m_has_mixed_topology(false)
+  , m_has_compact_connectivity(false)
 #ifdef AXOM_MINT_USE_SIDRE
   , m_group(nullptr)
   , m_topology()
@@ -110,6 +122,7 @@ Mesh::Mesh(sidre::Group* group, const std::string& topo)
   , m_explicit_coords(false)
   , m_explicit_connectivity(false)
   , m_has_mixed_topology(false)
+  , m_has_compact_connectivity(false)
   , m_group(group)
   , m_topology(topo)
   , m_coordset()
@@ -160,6 +173,7 @@ Mesh::Mesh(int ndims,
   , m_explicit_coords(false)
   , m_explicit_connectivity(false)
   , m_has_mixed_topology(false)
+  , m_has_compact_connectivity(false)
   , m_group(group)
   , m_topology(topo)
   , m_coordset()
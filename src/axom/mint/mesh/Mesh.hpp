@@ -507,6 +507,16 @@ public:
    */
   inline bool hasMixedCellTypes() const { return m_has_mixed_topology; }
 
+  /*!
+   * \brief Checks if the mesh stores its cell connectivity as 32-bit integers
+   *  while IndexType is 64-bit, i.e., it is an UnstructuredMesh< TOPO, int32 >.
+   * \return status true iff the cell connectivity is stored as axom::int32.
+   */
+  inline bool hasCompactConnectivity() const
+  {
+    return m_has_compact_connectivity;
+  }
+
   /*!
    * \brief Returns true if the mesh type is structured.
    * \return status true if the mesh type is structured, else, false.
@@ -703,6 +713,25 @@ public:
   inline const T* getFieldPtr(const std::string& name, int association) const;
   /// @}
 
+  /*!
+   * \brief Returns a handle to the field with the given name and specified
+   *  mesh field association.
+   *
+   * \param [in] name the name of the requested field.
+   * \param [in] association the mesh field association.
+   *
+   * \return h handle to the requested field.
+   *
+   * \pre name.empty() == false
+   * \pre hasField( name )
+   * \pre association >= 0 && association < NUM_FIELD_ASSOCIATION
+   *
+   * \see FieldHandle
+   */
+  template <typename T>
+  inline FieldHandle<T> getFieldHandle(const std::string& name,
+                                       int association);
+
   /// @}
 
 protected:
@@ -717,6 +746,7 @@ protected:
   bool m_explicit_coords;
   bool m_explicit_connectivity;
   bool m_has_mixed_topology;
+  bool m_has_compact_connectivity;
 
   FieldData* m_mesh_fields[NUM_FIELD_ASSOCIATIONS];
 
@@ -1013,6 +1043,17 @@ inline const T* Mesh::getFieldPtr(const std::string& name,
   return (ptr);
 }
 
+//------------------------------------------------------------------------------
+template <typename T>
+inline FieldHandle<T> Mesh::getFieldHandle(const std::string& name,
+                                           int association)
+{
+  FieldData* fd = const_cast<FieldData*>(getFieldData(association));
+  SLIC_ASSERT(fd != nullptr);
+
+  return fd->getFieldHandle<T>(name);
+}
+
 //------------------------------------------------------------------------------
 inline void Mesh::getFieldInfo(int association,
                                IndexType& num_tuples,
@@ -0,0 +1,393 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+#include "axom/mint/mesh/ParticleNeighborList.hpp"
+
+#include "axom/mint/mesh/FieldData.hpp"     // for mint::FieldData
+#include "axom/mint/mesh/ParticleMesh.hpp"  // for mint::ParticleMesh
+
+#include "axom/mint/mesh/internal/MeshHelpers.hpp"  // for permuteTuples()
+
+// C/C++ includes
+#include <algorithm>  // for std::min, std::max
+#include <cmath>      // for std::floor
+#include <limits>     // for std::numeric_limits
+#include <numeric>    // for std::iota
+
+namespace axom
+{
+namespace mint
+{
+//------------------------------------------------------------------------------
+// INTERNAL HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+/*!
+ * \brief Visits the candidate neighbors of a particle, i.e., the particles in
+ *  its own bin and the adjacent bins, and calls the functor with each
+ *  candidate that is within the given distance.
+ *
+ * \param [in] k the position of the particle in bin order.
+ * \param [in] sorted the particle coordinate arrays, in bin order.
+ * \param [in] ndims the dimension of the particles.
+ * \param [in] r2 the square of the search radius.
+ * \param [in] origin the lower corner of the bins.
+ * \param [in] width the width of the bins in each dimension.
+ * \param [in] nbins the number of bins in each dimension.
+ * \param [in] bin_offsets the offset of each bin in bin_particles.
+ * \param [in] bin_particles the particles sorted by bin.
+ * \param [in] visit the functor to call with the index of each neighbor.
+ *
+ * \note The candidates are read from the sorted copy of the coordinates, so
+ *  the particles of a bin are contiguous in memory even when the particles
+ *  themselves are not stored in bin order.
+ */
+template <typename FunctorType>
+inline void visitNeighbors(IndexType k,
+                           const double* const sorted[3],
+                           int ndims,
+                           double r2,
+                           const double origin[3],
+                           const double width[3],
+                           const IndexType nbins[3],
+                           const IndexType* bin_offsets,
+                           const IndexType* bin_particles,
+                           FunctorType&& visit)
+{
+  double xk[3] = {0.0, 0.0, 0.0};
+  IndexType lo[3] = {0, 0, 0};
+  IndexType hi[3] = {0, 0, 0};
+  for(int d = 0; d < ndims; ++d)
+  {
+    xk[d] = sorted[d][k];
+    const IndexType b =
+      std::min(nbins[d] - 1,
+               static_cast<IndexType>((xk[d] - origin[d]) / width[d]));
+    lo[d] = std::max(b - 1, IndexType(0));
+    hi[d] = std::min(b + 1, nbins[d] - 1);
+  }
+
+  for(IndexType bk = lo[2]; bk <= hi[2]; ++bk)
+  {
+    for(IndexType bj = lo[1]; bj <= hi[1]; ++bj)
+    {
+      // the bins along i are contiguous in bin order
+      const IndexType row = nbins[0] * (bj + nbins[1] * bk);
+      const IndexType first = bin_offsets[row + lo[0]];
+      const IndexType last = bin_offsets[row + hi[0] + 1];
+
+      for(IndexType m = first; m < last; ++m)
+      {
+        double d2 = 0.0;
+        for(int d = 0; d < ndims; ++d)
+        {
+          const double dx = sorted[d][m] - xk[d];
+          d2 += dx * dx;
+        }
+
+        if(d2 <= r2 && m != k)
+        {
+          visit(bin_particles[m]);
+        }
+      }  // END for all particles in the bins
+    }
+  }
+}
+
+} /* end anonymous namespace */
+
+//------------------------------------------------------------------------------
+ParticleNeighborList::ParticleNeighborList(double cutoff, double skin)
+  : m_cutoff(cutoff)
+  , m_skin(skin)
+  , m_num_particles(0)
+  , m_num_builds(0)
+  , m_ndims(0)
+  , m_origin {0.0, 0.0, 0.0}
+  , m_bin_width {1.0, 1.0, 1.0}
+  , m_num_bins {1, 1, 1}
+{
+  SLIC_ERROR_IF(m_cutoff <= 0.0, "cutoff radius must be positive");
+  SLIC_ERROR_IF(m_skin < 0.0, "skin distance must not be negative");
+}
+
+//------------------------------------------------------------------------------
+void ParticleNeighborList::build(ParticleMesh* particles, bool reorder)
+{
+  SLIC_ASSERT(particles != nullptr);
+
+  m_ndims = particles->getDimension();
+  m_num_particles = particles->getNumberOfNodes();
+  const IndexType N = m_num_particles;
+
+  binParticles(particles);
+
+  // STEP 0: optionally, store the particles in bin order
+  m_order.clear();
+  if(reorder)
+  {
+    m_order = m_bin_particles;
+
+    for(int d = 0; d < m_ndims; ++d)
+    {
+      internal::permuteTuples(particles->getCoordinateArray(d),
+                              N,
+                              1,
+                              m_order.data());
+    }
+
+    FieldData* fd =
+      const_cast<FieldData*>(particles->getFieldData(NODE_CENTERED));
+    internal::permuteFields(fd, m_order.data());
+
+    std::iota(m_bin_particles.begin(), m_bin_particles.end(), 0);
+  }
+
+  const double* coords[3] = {nullptr, nullptr, nullptr};
+  for(int d = 0; d < m_ndims; ++d)
+  {
+    coords[d] = particles->getCoordinateArray(d);
+  }
+
+  const double radius = m_cutoff + m_skin;
+  const double r2 = radius * radius;
+  const IndexType* bin_offsets = m_bin_offsets.data();
+  const IndexType* bin_particles = m_bin_particles.data();
+
+  // STEP 1: gather the coordinates in bin order
+  std::vector<double> sorted_coords(m_ndims * N);
+  const double* sorted[3] = {nullptr, nullptr, nullptr};
+  for(int d = 0; d < m_ndims; ++d)
+  {
+    double* x = sorted_coords.data() + d * N;
+    const double* src = coords[d];
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+    for(IndexType k = 0; k < N; ++k)
+    {
+      x[k] = src[bin_particles[k]];
+    }
+
+    sorted[d] = x;
+  }
+
+  // STEP 2: count the neighbors of each particle
+  m_offsets.resize(N + 1);
+  m_offsets[0] = 0;
+  IndexType* offsets = m_offsets.data();
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(dynamic, 256)
+#endif
+  for(IndexType k = 0; k < N; ++k)
+  {
+    IndexType count = 0;
+    visitNeighbors(k,
+                   sorted,
+                   m_ndims,
+                   r2,
+                   m_origin,
+                   m_bin_width,
+                   m_num_bins,
+                   bin_offsets,
+                   bin_particles,
+                   [&count](IndexType) { ++count; });
+    offsets[bin_particles[k] + 1] = count;
+  }
+
+  for(IndexType i = 0; i < N; ++i)
+  {
+    offsets[i + 1] += offsets[i];
+  }
+
+  // STEP 3: fill the neighbor lists
+  m_neighbors.resize(offsets[N]);
+  IndexType* neighbors = m_neighbors.data();
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(dynamic, 256)
+#endif
+  for(IndexType k = 0; k < N; ++k)
+  {
+    IndexType* nbrs = neighbors + offsets[bin_particles[k]];
+    visitNeighbors(k,
+                   sorted,
+                   m_ndims,
+                   r2,
+                   m_origin,
+                   m_bin_width,
+                   m_num_bins,
+                   bin_offsets,
+                   bin_particles,
+                   [&nbrs](IndexType j) { *nbrs++ = j; });
+  }
+
+  // STEP 4: store the positions, used to check the displacement on update
+  m_positions.resize(m_ndims * N);
+  for(int d = 0; d < m_ndims; ++d)
+  {
+    std::copy(coords[d], coords[d] + N, m_positions.begin() + d * N);
+  }
+
+  ++m_num_builds;
+}
+
+//------------------------------------------------------------------------------
+bool ParticleNeighborList::update(ParticleMesh* particles, bool reorder)
+{
+  SLIC_ASSERT(particles != nullptr);
+
+  if(!needsRebuild(particles))
+  {
+    return false;
+  }
+
+  build(particles, reorder);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool ParticleNeighborList::needsRebuild(const ParticleMesh* particles) const
+{
+  SLIC_ASSERT(particles != nullptr);
+
+  if(empty() || particles->getDimension() != m_ndims ||
+     particles->getNumberOfNodes() != m_num_particles)
+  {
+    return true;
+  }
+
+  const IndexType N = m_num_particles;
+  const double* coords[3] = {nullptr, nullptr, nullptr};
+  for(int d = 0; d < m_ndims; ++d)
+  {
+    coords[d] = particles->getCoordinateArray(d);
+  }
+
+  const int ndims = m_ndims;
+  const double* positions = m_positions.data();
+  double max_d2 = 0.0;
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static) reduction(max : max_d2)
+#endif
+  for(IndexType i = 0; i < N; ++i)
+  {
+    double d2 = 0.0;
+    for(int d = 0; d < ndims; ++d)
+    {
+      const double dx = coords[d][i] - positions[d * N + i];
+      d2 += dx * dx;
+    }
+    max_d2 = std::max(max_d2, d2);
+  }
+
+  const double half_skin = 0.5 * m_skin;
+  return max_d2 > half_skin * half_skin;
+}
+
+//------------------------------------------------------------------------------
+void ParticleNeighborList::binParticles(const ParticleMesh* particles)
+{
+  const IndexType N = m_num_particles;
+  const double width = m_cutoff + m_skin;
+
+  // STEP 0: compute the bounding box and the bin resolution
+  IndexType num_bins = 1;
+  for(int d = 0; d < 3; ++d)
+  {
+    m_origin[d] = 0.0;
+    m_bin_width[d] = width;
+    m_num_bins[d] = 1;
+
+    if(d >= m_ndims || N == 0)
+    {
+      continue;
+    }
+
+    const double* x = particles->getCoordinateArray(d);
+    double lo = std::numeric_limits<double>::max();
+    double hi = std::numeric_limits<double>::lowest();
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static) reduction(min : lo) \
+    reduction(max : hi)
+#endif
+    for(IndexType i = 0; i < N; ++i)
+    {
+      lo = std::min(lo, x[i]);
+      hi = std::max(hi, x[i]);
+    }
+
+    // bins are at least as wide as the search radius
+    m_origin[d] = lo;
+    const IndexType n = static_cast<IndexType>(std::floor((hi - lo) / width));
+    m_num_bins[d] = std::max(IndexType(1), n);
+    m_bin_width[d] = std::max(width, (hi - lo) / m_num_bins[d]);
+    num_bins *= m_num_bins[d];
+  }
+
+  // limit the number of bins to the number of particles in sparse domains
+  while(num_bins > std::max(N, IndexType(1)))
+  {
+    num_bins = 1;
+    for(int d = 0; d < m_ndims; ++d)
+    {
+      const double extent = m_bin_width[d] * m_num_bins[d];
+      m_num_bins[d] = std::max(IndexType(1), m_num_bins[d] / 2);
+      m_bin_width[d] = extent / m_num_bins[d];
+      num_bins *= m_num_bins[d];
+    }
+  }
+
+  // STEP 1: compute the bin of each particle
+  const double* coords[3] = {nullptr, nullptr, nullptr};
+  for(int d = 0; d < m_ndims; ++d)
+  {
+    coords[d] = particles->getCoordinateArray(d);
+  }
+
+  std::vector<IndexType> bins(N);
+  const int ndims = m_ndims;
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(IndexType i = 0; i < N; ++i)
+  {
+    IndexType b[3] = {0, 0, 0};
+    for(int d = 0; d < ndims; ++d)
+    {
+      b[d] = std::min(
+        m_num_bins[d] - 1,
+        static_cast<IndexType>((coords[d][i] - m_origin[d]) / m_bin_width[d]));
+    }
+    bins[i] = b[0] + m_num_bins[0] * (b[1] + m_num_bins[1] * b[2]);
+  }
+
+  // STEP 2: counting sort, particles in a bin stay in increasing order
+  m_bin_offsets.assign(num_bins + 1, 0);
+  for(IndexType i = 0; i < N; ++i)
+  {
+    ++m_bin_offsets[bins[i] + 1];
+  }
+
+  for(IndexType b = 0; b < num_bins; ++b)
+  {
+    m_bin_offsets[b + 1] += m_bin_offsets[b];
+  }
+
+  std::vector<IndexType> next(m_bin_offsets.begin(), m_bin_offsets.end() - 1);
+  m_bin_particles.resize(N);
+  for(IndexType i = 0; i < N; ++i)
+  {
+    m_bin_particles[next[bins[i]]++] = i;
+  }
+}
+
+} /* namespace mint */
+} /* namespace axom */
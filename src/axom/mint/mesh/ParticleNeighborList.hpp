@@ -0,0 +1,270 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef MINT_PARTICLENEIGHBORLIST_HPP_
+#define MINT_PARTICLENEIGHBORLIST_HPP_
+
+#include "axom/core/Macros.hpp"  // for axom macros
+
+#include "axom/mint/config.hpp"  // for mint compile-time definitions
+
+#include "axom/slic/interface/slic.hpp"  // for slic Macros
+
+#include <vector>  // for std::vector
+
+namespace axom
+{
+namespace mint
+{
+// Mint Forward Declarations
+class ParticleMesh;
+
+/*!
+ * \class ParticleNeighborList
+ *
+ * \brief Builds and stores the cutoff-radius neighbor lists of the particles
+ *  in a ParticleMesh.
+ *
+ *  The particles are counting-sorted into a uniform grid of bins whose width
+ *  is at least the cutoff radius plus a skin distance, so the candidates of a
+ *  particle are found in its own bin and the adjacent bins. The neighbor
+ *  lists are stored in compressed row form: the neighbors of particle i are
+ *  getNeighbors(i)[0..getNumberOfNeighbors(i)-1]. The lists are full, i.e.,
+ *  if j is a neighbor of i, then i is a neighbor of j, and a particle is not
+ *  its own neighbor.
+ *
+ *  Pairs are recorded within the cutoff radius plus the skin distance, which
+ *  makes the lists a Verlet list that stays valid as long as no particle has
+ *  moved more than half the skin distance since the last build. update()
+ *  checks this condition and only rebuilds the lists when needed, so callers
+ *  still have to check the actual distance of each pair against the cutoff.
+ *
+ *  Optionally, build() and update() physically reorder the particle
+ *  coordinates and node-centered fields of the ParticleMesh in bin order,
+ *  which places particles that are close in space close in memory.
+ *
+ *  Example:
+ *  \code
+ *    mint::ParticleNeighborList neighbors(cutoff, skin);
+ *
+ *    for(int cycle = 0; cycle < ncycles; ++cycle)
+ *    {
+ *      neighbors.update(&particles);
+ *
+ *      for(IndexType i = 0; i < particles.getNumberOfNodes(); ++i)
+ *      {
+ *        const IndexType* nbrs = neighbors.getNeighbors(i);
+ *        for(IndexType k = 0; k < neighbors.getNumberOfNeighbors(i); ++k)
+ *        {
+ *          // interaction of i with nbrs[k]
+ *        }
+ *      }
+ *
+ *      // move the particles
+ *    }
+ *  \endcode
+ *
+ * \note The bins, the neighbor counts and the neighbor lists are computed in
+ *  parallel when Axom is built with OpenMP.
+ *
+ * \see mint::ParticleMesh
+ */
+class ParticleNeighborList
+{
+public:
+  /*!
+   * \brief Default constructor. Disabled.
+   */
+  ParticleNeighborList() = delete;
+
+  /*!
+   * \brief Creates an empty ParticleNeighborList.
+   *
+   * \param [in] cutoff the interaction cutoff radius.
+   * \param [in] skin the extra distance added to the cutoff (optional).
+   *
+   * \pre cutoff > 0.0
+   * \pre skin >= 0.0
+   *
+   * \post empty() == true
+   */
+  ParticleNeighborList(double cutoff, double skin = 0.0);
+
+  /*!
+   * \brief Destructor.
+   */
+  ~ParticleNeighborList() = default;
+
+  /// \name Build Methods
+  /// @{
+
+  /*!
+   * \brief Builds the neighbor lists of the given particles.
+   *
+   * \param [in,out] particles pointer to the ParticleMesh.
+   * \param [in] reorder if true, the particle coordinates and node-centered
+   *  fields are reordered in bin order before the lists are built.
+   *
+   * \note When the particles are reordered, the particle stored at new
+   *  index i was stored at index getParticleOrder()[ i ] before the call.
+   *
+   * \pre particles != nullptr
+   *
+   * \post empty() == false
+   */
+  void build(ParticleMesh* particles, bool reorder = false);
+
+  /*!
+   * \brief Rebuilds the neighbor lists if needsRebuild() is true.
+   *
+   * \param [in,out] particles pointer to the ParticleMesh.
+   * \param [in] reorder if true, the particles are reordered on a rebuild.
+   *
+   * \return true if the lists were rebuilt, else false.
+   *
+   * \pre particles != nullptr
+   *
+   * \see build(), needsRebuild()
+   */
+  bool update(ParticleMesh* particles, bool reorder = false);
+
+  /*!
+   * \brief Checks if the neighbor lists are no longer valid for the given
+   *  particles.
+   *
+   * \param [in] particles pointer to the ParticleMesh.
+   *
+   * \return true if the lists were never built, the number of particles has
+   *  changed, or a particle has moved more than half the skin distance since
+   *  the last build.
+   *
+   * \pre particles != nullptr
+   */
+  bool needsRebuild(const ParticleMesh* particles) const;
+
+  /// @}
+
+  /// \name Attribute get Methods
+  /// @{
+
+  /*!
+   * \brief Returns the cutoff radius.
+   */
+  double getCutoff() const { return m_cutoff; }
+
+  /*!
+   * \brief Returns the skin distance.
+   */
+  double getSkin() const { return m_skin; }
+
+  /*!
+   * \brief Returns true if the neighbor lists have not been built.
+   */
+  bool empty() const { return m_offsets.empty(); }
+
+  /*!
+   * \brief Returns the number of particles the lists were built for.
+   */
+  IndexType getNumberOfParticles() const { return m_num_particles; }
+
+  /*!
+   * \brief Returns the total number of neighbors over all particles.
+   */
+  IndexType getTotalNumberOfNeighbors() const
+  {
+    return static_cast<IndexType>(m_neighbors.size());
+  }
+
+  /*!
+   * \brief Returns the number of times the lists were built.
+   */
+  IndexType getNumberOfBuilds() const { return m_num_builds; }
+
+  /// @}
+
+  /// \name Data Accessor Methods
+  /// @{
+
+  /*!
+   * \brief Returns the number of neighbors of the given particle.
+   *
+   * \param [in] i the index of the particle.
+   *
+   * \pre 0 <= i < getNumberOfParticles()
+   */
+  inline IndexType getNumberOfNeighbors(IndexType i) const
+  {
+    SLIC_ASSERT(i >= 0 && i < m_num_particles);
+    return m_offsets[i + 1] - m_offsets[i];
+  }
+
+  /*!
+   * \brief Returns a pointer to the neighbors of the given particle.
+   *
+   * \param [in] i the index of the particle.
+   *
+   * \pre 0 <= i < getNumberOfParticles()
+   */
+  inline const IndexType* getNeighbors(IndexType i) const
+  {
+    SLIC_ASSERT(i >= 0 && i < m_num_particles);
+    return m_neighbors.data() + m_offsets[i];
+  }
+
+  /*!
+   * \brief Returns a pointer to the neighbor offsets array, of length
+   *  getNumberOfParticles() + 1.
+   */
+  const IndexType* getOffsetsArray() const { return m_offsets.data(); }
+
+  /*!
+   * \brief Returns a pointer to the neighbors array, of length
+   *  getTotalNumberOfNeighbors().
+   */
+  const IndexType* getNeighborsArray() const { return m_neighbors.data(); }
+
+  /*!
+   * \brief Returns the old index of each particle after the last build that
+   *  reordered the particles, or an empty vector if it did not reorder them.
+   */
+  const std::vector<IndexType>& getParticleOrder() const { return m_order; }
+
+  /// @}
+
+private:
+  /*!
+   * \brief Counting-sorts the particles into the bins.
+   *
+   * \param [in] particles pointer to the ParticleMesh.
+   *
+   * \post m_bin_offsets and m_bin_particles hold the particles of each bin.
+   */
+  void binParticles(const ParticleMesh* particles);
+
+  double m_cutoff;
+  double m_skin;
+  IndexType m_num_particles;
+  IndexType m_num_builds;
+  int m_ndims;
+
+  double m_origin[3];
+  double m_bin_width[3];
+  IndexType m_num_bins[3];
+
+  std::vector<IndexType> m_bin_offsets;
+  std::vector<IndexType> m_bin_particles;
+  std::vector<IndexType> m_offsets;
+  std::vector<IndexType> m_neighbors;
+  std::vector<IndexType> m_order;
+  std::vector<double> m_positions;
+
+  DISABLE_COPY_AND_ASSIGNMENT(ParticleNeighborList);
+  DISABLE_MOVE_AND_ASSIGNMENT(ParticleNeighborList);
+};
+
+} /* namespace mint */
+} /* namespace axom */
+
+#endif /* MINT_PARTICLENEIGHBORLIST_HPP_ */
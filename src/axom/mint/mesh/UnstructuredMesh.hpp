@@ -23,7 +23,12 @@
 #include "axom/slic/interface/slic.hpp"
 
 // C/C++ includes
-#include <cstring>  // for std::memcpy
+#include <algorithm>      // for std::copy
+#include <cstring>        // for std::memcpy
+#include <string>         // for std::string
+#include <type_traits>    // for std::is_same
+#include <unordered_map>  // for std::unordered_map
+#include <vector>         // for std::vector
 
 namespace axom
 {
@@ -55,6 +60,83 @@ struct topology_traits<MIXED_SHAPE>
   constexpr static ConnectivityType face_to_nodes = TYPED_INDIRECTION;
 };
 
+namespace internal
+{
+/*!
+ * \brief Creates the empty face connectivity of an UnstructuredMesh with the
+ *  given topology. The face relations do not depend on the storage type of
+ *  the cell connectivity.
+ */
+template <Topology TOPO>
+struct face_connectivity
+{ };
+
+template <>
+struct face_connectivity<SINGLE_SHAPE>
+{
+  using CellToFace =
+    ConnectivityArray<topology_traits<SINGLE_SHAPE>::cell_to_faces>;
+  using FaceToNode =
+    ConnectivityArray<topology_traits<SINGLE_SHAPE>::face_to_nodes>;
+
+  /*!
+   * \brief Return a new CellToFaceConnectivity. If the mesh has cell type
+   *  VERTEX or SEGMENT then the stride of the returned connectivity is 1
+   *  instead of 0 which is the proper number of cell faces, this avoids an
+   *  error with 0 stride.
+   *
+   * \param [in] cell_type the cell_type of the mesh.
+   */
+  static CellToFace* newCellToFace(CellType cell_type)
+  {
+    IndexType num_faces = getCellInfo(cell_type).num_faces;
+    if(num_faces == 0)
+    {
+      num_faces = 1;
+    }
+
+    return new CellToFace(num_faces, 0);
+  }
+
+  /*!
+   * \brief Return a new FaceToNodeConnectivity. If the mesh has cell type
+   *  VERTEX or SEGMENT then the cell type of the returned ConnectivityArray is
+   *  UNDEFINED_CELL with stride 1.
+   *
+   * \param [in] cell_type the cell_type of the mesh.
+   */
+  static FaceToNode* newFaceToNode(CellType cell_type)
+  {
+    const CellType face_type = getCellInfo(cell_type).face_types[0];
+    if(face_type == UNDEFINED_CELL)
+    {
+      return new FaceToNode(1, 0);
+    }
+
+    return new FaceToNode(face_type, 0);
+  }
+};
+
+template <>
+struct face_connectivity<MIXED_SHAPE>
+{
+  using CellToFace =
+    ConnectivityArray<topology_traits<MIXED_SHAPE>::cell_to_faces>;
+  using FaceToNode =
+    ConnectivityArray<topology_traits<MIXED_SHAPE>::face_to_nodes>;
+
+  /*! \brief Return a new CellToFaceConnectivity. */
+  static CellToFace* newCellToFace(CellType)
+  {
+    return new CellToFace(UNDEFINED_CELL, 0, 0);
+  }
+
+  /*! \brief Return a new FaceToNodeConnectivity. */
+  static FaceToNode* newFaceToNode(CellType) { return new FaceToNode(0, 0); }
+};
+
+} /* namespace internal */
+
 /*!
  * \class UnstructuredMesh
  *
@@ -119,13 +201,28 @@ struct topology_traits<MIXED_SHAPE>
  *    associated storage as needed. However, Sidre owns all the memory. Once the
  *    mesh object goes out-of-scope, the data remains persistent in Sidre.
  *
+ *  By default the cell connectivity (and offsets) is stored as IndexType.
+ *  When IndexType is 64-bit and the mesh has fewer than 2^31 nodes and
+ *  connectivity entries, an UnstructuredMesh< TOPO, axom::int32 > stores it
+ *  in half the memory. All connectivity pointers returned by, and passed to,
+ *  such a mesh are of type axom::int32, whereas the virtual Mesh interface
+ *  and the mint execution traversals widen the node IDs to IndexType. The
+ *  face, node-to-cell and cell-to-cell relations are always IndexType.
+ *
+ * \tparam TOPO the topology of the mesh, SINGLE_SHAPE or MIXED_SHAPE.
+ * \tparam IndexT the cell connectivity storage type, IndexType or
+ *  axom::int32.
+ *
  * \see mint::Mesh
  * \see mint::CellTypes
  */
-template <Topology TOPO>
+template <Topology TOPO, typename IndexT = IndexType>
 class UnstructuredMesh : public Mesh
 {
   AXOM_STATIC_ASSERT(TOPO == SINGLE_SHAPE || TOPO == MIXED_SHAPE);
+  AXOM_STATIC_ASSERT_MSG((std::is_same<IndexT, IndexType>::value ||
+                          std::is_same<IndexT, int32>::value),
+                         "IndexT must be IndexType or axom::int32.");
 
 public:
   /*! \brief The types for face-cell and cell-face connectivity.
@@ -139,12 +236,14 @@ public:
    * Face types are stored in the face-node connectivity.
    */
   using CellToNodeConnectivity =
-    ConnectivityArray<topology_traits<TOPO>::cell_to_nodes>;
+    ConnectivityArray<topology_traits<TOPO>::cell_to_nodes, IndexT>;
   using CellToFaceConnectivity =
     ConnectivityArray<topology_traits<TOPO>::cell_to_faces>;
   using FaceToCellConnectivity = ConnectivityArray<NO_INDIRECTION>;
   using FaceToNodeConnectivity =
     ConnectivityArray<topology_traits<TOPO>::face_to_nodes>;
+  using NodeToCellConnectivity = ConnectivityArray<INDIRECTION>;
+  using CellToCellConnectivity = ConnectivityArray<INDIRECTION>;
 
   /*!
    * \brief Default constructor. Disabled.
@@ -178,6 +277,10 @@ public:
     , m_cell_to_face(initializeCellToFace(cell_type))
     , m_face_to_cell(new FaceToCellConnectivity(2, 0))
     , m_face_to_node(initializeFaceToNode(cell_type))
+    , m_node_to_cell(new NodeToCellConnectivity(UNDEFINED_CELL, 0, 0))
+    , m_cell_to_cell(new CellToCellConnectivity(UNDEFINED_CELL, 0, 0))
+    , m_cell_face_neighbors(
+        new CellToCellConnectivity(UNDEFINED_CELL, 0, 0))
   {
     AXOM_STATIC_ASSERT_MSG(
       TOPO == SINGLE_SHAPE,
@@ -216,6 +319,10 @@ public:
     , m_cell_to_face(initializeCellToFace())
     , m_face_to_cell(new FaceToCellConnectivity(2, 0))
     , m_face_to_node(initializeFaceToNode())
+    , m_node_to_cell(new NodeToCellConnectivity(UNDEFINED_CELL, 0, 0))
+    , m_cell_to_cell(new CellToCellConnectivity(UNDEFINED_CELL, 0, 0))
+    , m_cell_face_neighbors(
+        new CellToCellConnectivity(UNDEFINED_CELL, 0, 0))
   {
     AXOM_STATIC_ASSERT_MSG(
       TOPO == MIXED_SHAPE,
@@ -261,7 +368,7 @@ public:
   UnstructuredMesh(CellType cell_type,
                    IndexType n_cells,
                    IndexType cell_capacity,
-                   IndexType* connectivity,
+                   IndexT* connectivity,
                    IndexType n_nodes,
                    IndexType node_capacity,
                    double* x,
@@ -274,6 +381,10 @@ public:
     , m_cell_to_face(initializeCellToFace(cell_type))
     , m_face_to_cell(new FaceToCellConnectivity(2, 0))
     , m_face_to_node(initializeFaceToNode(cell_type))
+    , m_node_to_cell(new NodeToCellConnectivity(UNDEFINED_CELL, 0, 0))
+    , m_cell_to_cell(new CellToCellConnectivity(UNDEFINED_CELL, 0, 0))
+    , m_cell_face_neighbors(
+        new CellToCellConnectivity(UNDEFINED_CELL, 0, 0))
   {
     AXOM_STATIC_ASSERT_MSG(
       TOPO == SINGLE_SHAPE,
@@ -313,7 +424,7 @@ public:
    */
   UnstructuredMesh(CellType cell_type,
                    IndexType n_cells,
-                   IndexType* connectivity,
+                   IndexT* connectivity,
                    IndexType n_nodes,
                    double* x,
                    double* y = nullptr,
@@ -362,8 +473,8 @@ public:
   UnstructuredMesh(IndexType n_cells,
                    IndexType cell_capacity,
                    IndexType connectivity_capacity,
-                   IndexType* connectivity,
-                   IndexType* offsets,
+                   IndexT* connectivity,
+                   IndexT* offsets,
                    CellType* types,
                    IndexType n_nodes,
                    IndexType node_capacity,
@@ -381,6 +492,10 @@ public:
     , m_cell_to_face(initializeCellToFace())
     , m_face_to_cell(new FaceToCellConnectivity(2, 0))
     , m_face_to_node(initializeFaceToNode())
+    , m_node_to_cell(new NodeToCellConnectivity(UNDEFINED_CELL, 0, 0))
+    , m_cell_to_cell(new CellToCellConnectivity(UNDEFINED_CELL, 0, 0))
+    , m_cell_face_neighbors(
+        new CellToCellConnectivity(UNDEFINED_CELL, 0, 0))
   {
     AXOM_STATIC_ASSERT_MSG(
       TOPO == MIXED_SHAPE,
@@ -422,8 +537,8 @@ public:
    */
   UnstructuredMesh(IndexType n_cells,
                    IndexType connectivity_size,
-                   IndexType* connectivity,
-                   IndexType* offsets,
+                   IndexT* connectivity,
+                   IndexT* offsets,
                    CellType* types,
                    IndexType n_nodes,
                    double* x,
@@ -473,6 +588,10 @@ public:
     , m_cell_to_face(nullptr)
     , m_face_to_cell(new FaceToCellConnectivity(2, 0))
     , m_face_to_node(nullptr)
+    , m_node_to_cell(new NodeToCellConnectivity(UNDEFINED_CELL, 0, 0))
+    , m_cell_to_cell(new CellToCellConnectivity(UNDEFINED_CELL, 0, 0))
+    , m_cell_face_neighbors(
+        new CellToCellConnectivity(UNDEFINED_CELL, 0, 0))
   {
     SLIC_ERROR_IF(
       m_type != UNSTRUCTURED_MESH,
@@ -542,6 +661,10 @@ public:
     , m_cell_to_face(initializeCellToFace(cell_type))
     , m_face_to_cell(new FaceToCellConnectivity(2, 0))
     , m_face_to_node(initializeFaceToNode(cell_type))
+    , m_node_to_cell(new NodeToCellConnectivity(UNDEFINED_CELL, 0, 0))
+    , m_cell_to_cell(new CellToCellConnectivity(UNDEFINED_CELL, 0, 0))
+    , m_cell_face_neighbors(
+        new CellToCellConnectivity(UNDEFINED_CELL, 0, 0))
   {
     AXOM_STATIC_ASSERT_MSG(
       TOPO == SINGLE_SHAPE,
@@ -579,6 +702,10 @@ public:
     , m_cell_to_face(initializeCellToFace())
     , m_face_to_cell(new FaceToCellConnectivity(2, 0))
     , m_face_to_node(initializeFaceToNode())
+    , m_node_to_cell(new NodeToCellConnectivity(UNDEFINED_CELL, 0, 0))
+    , m_cell_to_cell(new CellToCellConnectivity(UNDEFINED_CELL, 0, 0))
+    , m_cell_face_neighbors(
+        new CellToCellConnectivity(UNDEFINED_CELL, 0, 0))
   {
     AXOM_STATIC_ASSERT_MSG(
       TOPO == MIXED_SHAPE,
@@ -630,6 +757,15 @@ public:
 
     delete m_face_to_node;
     m_face_to_node = nullptr;
+
+    delete m_node_to_cell;
+    m_node_to_cell = nullptr;
+
+    delete m_cell_to_cell;
+    m_cell_to_cell = nullptr;
+
+    delete m_cell_face_neighbors;
+    m_cell_face_neighbors = nullptr;
   }
 
   /// \name Cells
@@ -695,7 +831,8 @@ public:
   {
     SLIC_ASSERT(nodes != nullptr);
     const IndexType n_nodes = getNumberOfCellNodes(cellID);
-    std::memcpy(nodes, getCellNodeIDs(cellID), n_nodes * sizeof(IndexType));
+    const IndexT* cell_nodes = getCellNodeIDs(cellID);
+    std::copy(cell_nodes, cell_nodes + n_nodes, nodes);
     return n_nodes;
   }
 
@@ -990,13 +1127,18 @@ public:
    *  mesh instance to hold the specified number of cells.
    *
    * \param [in] cell_size the number of cells to resize to.
+   * \param [in] connectivity_size the size of the connectivity array. Ignored
+   *  if TOPO == SINGLE_SHAPE.
    *
    * \post getNumberOfCells() == cell_size
    */
-  void resizeCells(IndexType cell_size)
+  void resizeCells(IndexType cell_size,
+                   IndexType connectivity_size = USE_DEFAULT)
   {
-    IndexType connectivity_size =
-      (hasMixedCellTypes()) ? USE_DEFAULT : getNumberOfCellNodes() * cell_size;
+    if(!hasMixedCellTypes())
+    {
+      connectivity_size = getNumberOfCellNodes() * cell_size;
+    }
     m_cell_to_node->resize(cell_size, connectivity_size);
     m_mesh_fields[CELL_CENTERED]->resize(cell_size);
   }
@@ -1143,6 +1285,8 @@ public:
    *
    * \param [in] node_size the desired number of nodes
    * \param [in] cell_size the desired number of cells
+   * \param [in] connectivity_size the size of the connectivity array. Ignored
+   *  if TOPO == SINGLE_SHAPE.
    *
    * \note This method will also resize the node-centered and cell-centered
    *  fields accordingly.
@@ -1153,10 +1297,12 @@ public:
    * \see resizeNodes()
    * \see resizeCells()
    */
-  void resize(IndexType node_size, IndexType cell_size)
+  void resize(IndexType node_size,
+              IndexType cell_size,
+              IndexType connectivity_size = USE_DEFAULT)
   {
     resizeNodes(node_size);
-    resizeCells(cell_size);
+    resizeCells(cell_size, connectivity_size);
   }
 
   /*!
@@ -1237,12 +1383,12 @@ public:
    */
   /// @{
 
-  IndexType* getCellNodeIDs(IndexType cellID)
+  IndexT* getCellNodeIDs(IndexType cellID)
   {
     return (*m_cell_to_node)[cellID];
   }
 
-  const IndexType* getCellNodeIDs(IndexType cellID) const
+  const IndexT* getCellNodeIDs(IndexType cellID) const
   {
     return (*m_cell_to_node)[cellID];
   }
@@ -1273,15 +1419,33 @@ public:
 
   /// @}
 
+  /*!
+   * \brief Return a pointer to the cells across each face of the given cell,
+   *  in the same order as getCellFaceIDs( cellID ). The buffer is guaranteed
+   *  to be of length at least getNumberOfCellFaces( cellID ). The entry for
+   *  a face on the boundary of the mesh is -1.
+   *
+   * \param [in] cellID the ID of the cell in question.
+   *
+   * \note Codes must call initializeFaceConnectivity() before calling
+   *       this method.
+   *
+   * \pre 0 <= cellID < getNumberOfCells()
+   */
+  const IndexType* getCellFaceNeighborIDs(IndexType cellID) const
+  {
+    return (*m_cell_face_neighbors)[cellID];
+  }
+
   /*!
    * \brief Return a pointer to the cell nodes array, of length
    *  getCellNodesSize().
    */
   /// @{
 
-  IndexType* getCellNodesArray() { return m_cell_to_node->getValuePtr(); }
+  IndexT* getCellNodesArray() { return m_cell_to_node->getValuePtr(); }
 
-  const IndexType* getCellNodesArray() const
+  const IndexT* getCellNodesArray() const
   {
     return m_cell_to_node->getValuePtr();
   }
@@ -1295,12 +1459,12 @@ public:
    */
   /// @{
 
-  IndexType* getCellNodesOffsetsArray()
+  IndexT* getCellNodesOffsetsArray()
   {
     return m_cell_to_node->getOffsetPtr();
   }
 
-  const IndexType* getCellNodesOffsetsArray() const
+  const IndexT* getCellNodesOffsetsArray() const
   {
     return m_cell_to_node->getOffsetPtr();
   }
@@ -1356,6 +1520,103 @@ public:
 
   /// @}
 
+  /*!
+   * \brief Sets up the cell-to-cell connectivity, which lists the cells that
+   *  share at least one node with each cell, and the node-to-cell
+   *  connectivity it is built from.
+   *
+   * \param [in] force re-initialize the cell-to-cell connectivity, even if it
+   *             has already been done.
+   *
+   * \note The neighbors of each cell are listed in increasing order and do
+   *  not include the cell itself. To find the cells that share a face with a
+   *  cell, use initializeFaceConnectivity() and getCellFaceNeighborIDs().
+   *
+   * \see initializeNodeCellConnectivity()
+   */
+  void initializeCellNeighborConnectivity(bool force = false)
+  {
+    if(!force && m_cell_to_cell->getNumberOfIDs() > 0)
+    {
+      return;
+    }
+
+    initializeNodeCellConnectivity(force);
+    m_cell_to_cell->resize(0, 0);
+
+    const IndexType cellCount = getNumberOfCells();
+    const IndexType stride =
+      (TOPO == SINGLE_SHAPE) ? getNumberOfCellNodes() : 0;
+    IndexType* c2coffsets = nullptr;
+    IndexType* c2cdata = nullptr;
+
+    internal::initCellNeighbors(cellCount,
+                                getCellNodesOffsetsArray(),
+                                stride,
+                                getCellNodesArray(),
+                                getNodeCellsOffsetsArray(),
+                                getNodeCellsArray(),
+                                c2coffsets,
+                                c2cdata);
+
+    m_cell_to_cell->reserve(cellCount, c2coffsets[cellCount]);
+    m_cell_to_cell->appendM(c2cdata, cellCount, c2coffsets);
+
+    delete[] c2coffsets;
+    delete[] c2cdata;
+  }
+
+  /*!
+   * \brief Return the number of cells that share at least one node with the
+   *  given cell.
+   *
+   * \param [in] cellID the ID of the cell in question.
+   *
+   * \note Codes must call initializeCellNeighborConnectivity() before calling
+   *       this method.
+   *
+   * \pre 0 <= cellID < getNumberOfCells()
+   */
+  IndexType getNumberOfCellNeighbors(IndexType cellID) const
+  {
+    return m_cell_to_cell->getNumberOfValuesForID(cellID);
+  }
+
+  /*!
+   * \brief Return a pointer to the cells that share at least one node with
+   *  the given cell. The buffer is guaranteed to be of length at least
+   *  getNumberOfCellNeighbors( cellID ).
+   *
+   * \param [in] cellID the ID of the cell in question.
+   *
+   * \note Codes must call initializeCellNeighborConnectivity() before calling
+   *       this method.
+   *
+   * \pre 0 <= cellID < getNumberOfCells()
+   */
+  const IndexType* getCellNeighborIDs(IndexType cellID) const
+  {
+    return (*m_cell_to_cell)[cellID];
+  }
+
+  /*!
+   * \brief Return a pointer to the cell neighbors array, of length
+   *  getCellNeighborsOffsetsArray()[ getNumberOfCells() ].
+   */
+  const IndexType* getCellNeighborsArray() const
+  {
+    return m_cell_to_cell->getValuePtr();
+  }
+
+  /*!
+   * \brief Return a pointer to the cell neighbors offset array, of length
+   *  getNumberOfCells() + 1.
+   */
+  const IndexType* getCellNeighborsOffsetsArray() const
+  {
+    return m_cell_to_cell->getOffsetPtr();
+  }
+
   /*!
    * \brief Append a cell to the mesh.
    *
@@ -1365,7 +1626,7 @@ public:
    *
    * \pre connec != nullptr
    */
-  void appendCell(const IndexType* connec, CellType type = UNDEFINED_CELL)
+  void appendCell(const IndexT* connec, CellType type = UNDEFINED_CELL)
   {
     IndexType n_values =
       (type == UNDEFINED_CELL) ? 0 : getCellInfo(type).num_nodes;
@@ -1386,9 +1647,9 @@ public:
    * \pre connec != nullptr
    * \pre n_cells >= 0
    */
-  void appendCells(const IndexType* connec,
+  void appendCells(const IndexT* connec,
                    IndexType n_cells,
-                   const IndexType* offsets = nullptr,
+                   const IndexT* offsets = nullptr,
                    const CellType* types = nullptr)
   {
     m_cell_to_node->appendM(connec, n_cells, offsets, types);
@@ -1408,7 +1669,7 @@ public:
    * \pre connec != nullptr
    * \pre 0 <= ID <= getNumberOfCells()
    */
-  void insertCell(const IndexType* connec,
+  void insertCell(const IndexT* connec,
                   IndexType ID,
                   CellType type = UNDEFINED_CELL)
   {
@@ -1432,10 +1693,10 @@ public:
    * \pre connec != nullptr
    * \pre 0 <= start_ID <= getNumberOfCells()
    */
-  void insertCells(const IndexType* connec,
+  void insertCells(const IndexT* connec,
                    IndexType start_ID,
                    IndexType n_cells,
-                   const IndexType* offsets = nullptr,
+                   const IndexT* offsets = nullptr,
                    const CellType* types = nullptr)
   {
     m_cell_to_node->insertM(connec, start_ID, n_cells, offsets, types);
@@ -1680,13 +1941,116 @@ public:
 
   /// @}
 
+  /*!
+   * \brief Sets up the node-to-cell connectivity, which lists the cells
+   *  that contain each node.
+   *
+   * \param [in] force re-initialize the node-to-cell connectivity, even if it
+   *             has already been done.
+   *
+   * \note The relation is the transpose of the cell-to-node connectivity,
+   *  built with a parallel counting sort when Axom is built with OpenMP.
+   *  The cells of each node are listed in increasing order.
+   */
+  void initializeNodeCellConnectivity(bool force = false)
+  {
+    if(!force && m_node_to_cell->getNumberOfIDs() > 0)
+    {
+      return;
+    }
+
+    m_node_to_cell->resize(0, 0);
+
+    const IndexType nodeCount = getNumberOfNodes();
+    const IndexType stride =
+      (TOPO == SINGLE_SHAPE) ? getNumberOfCellNodes() : 0;
+    IndexType* n2coffsets = nullptr;
+    IndexType* n2cdata = nullptr;
+
+    internal::transposeRelation(getNumberOfCells(),
+                                getCellNodesOffsetsArray(),
+                                stride,
+                                getCellNodesArray(),
+                                nodeCount,
+                                n2coffsets,
+                                n2cdata);
+
+    m_node_to_cell->reserve(nodeCount, n2coffsets[nodeCount]);
+    m_node_to_cell->appendM(n2cdata, nodeCount, n2coffsets);
+
+    delete[] n2coffsets;
+    delete[] n2cdata;
+  }
+
+  /*!
+   * \brief Returns true iff the node-to-cell connectivity is set up for all
+   *  the nodes of the mesh.
+   *
+   * \see initializeNodeCellConnectivity()
+   */
+  bool hasNodeCellConnectivity() const
+  {
+    return m_node_to_cell->getNumberOfIDs() == getNumberOfNodes();
+  }
+
+  /*!
+   * \brief Return the number of cells that contain the given node.
+   *
+   * \param [in] nodeID the ID of the node in question.
+   *
+   * \note Codes must call initializeNodeCellConnectivity() before calling
+   *       this method.
+   *
+   * \pre 0 <= nodeID < getNumberOfNodes()
+   */
+  IndexType getNumberOfNodeCells(IndexType nodeID) const
+  {
+    return m_node_to_cell->getNumberOfValuesForID(nodeID);
+  }
+
+  /*!
+   * \brief Return a pointer to the cells that contain the given node. The
+   *  buffer is guaranteed to be of length at least
+   *  getNumberOfNodeCells( nodeID ).
+   *
+   * \param [in] nodeID the ID of the node in question.
+   *
+   * \note Codes must call initializeNodeCellConnectivity() before calling
+   *       this method.
+   *
+   * \pre 0 <= nodeID < getNumberOfNodes()
+   */
+  const IndexType* getNodeCellIDs(IndexType nodeID) const
+  {
+    return (*m_node_to_cell)[nodeID];
+  }
+
+  /*!
+   * \brief Return a pointer to the node cells array, of length
+   *  getNodeCellsOffsetsArray()[ getNumberOfNodes() ].
+   */
+  const IndexType* getNodeCellsArray() const
+  {
+    return m_node_to_cell->getValuePtr();
+  }
+
+  /*!
+   * \brief Return a pointer to the node cells offset array, of length
+   *  getNumberOfNodes() + 1.
+   */
+  const IndexType* getNodeCellsOffsetsArray() const
+  {
+    return m_node_to_cell->getOffsetPtr();
+  }
+
   /// @}
 
   /// \name Faces
   /// @{
 
   /*!
-   * \brief Sets up cell-face, face-cell, and face-node connectivity.
+   * \brief Sets up cell-face, face-cell, and face-node connectivity, along
+   *  with the neighbor across each cell face.
    *
    * \param [in] force re-initialize face-related connectivity, even if it
    *             has already been done.
@@ -1708,6 +2072,7 @@ public:
       m_cell_to_face->resize(0, 0);
       m_face_to_cell->resize(0, 0);
       m_face_to_node->resize(0, 0);
+      m_cell_face_neighbors->resize(0, 0);
     }
 
     IndexType facecount = 0;
@@ -1736,6 +2101,9 @@ public:
       m_cell_to_face->reserve(cellCount, c2foffsets[cellCount]);
       m_cell_to_face->appendM(c2fdata, cellCount, c2foffsets);
 
+      m_cell_face_neighbors->reserve(cellCount, c2foffsets[cellCount]);
+      m_cell_face_neighbors->appendM(c2ndata, cellCount, c2foffsets);
+
       m_face_to_cell->reserve(facecount);
       m_face_to_cell->appendM(f2cdata, facecount);
 
@@ -1832,6 +2200,151 @@ public:
 
   /// @}
 
+  /// \name Renumbering
+  /// @{
+
+  /*!
+   * \brief Renumber the nodes and cells of the mesh.
+   *
+   * \param [in] node_order the old ID of each new node, of length
+   *  getNumberOfNodes(), or nullptr to keep the node numbering.
+   * \param [in] cell_order the old ID of each new cell, of length
+   *  getNumberOfCells(), or nullptr to keep the cell numbering.
+   *
+   * The nodal coordinates, the cell connectivity and all node-centered and
+   * cell-centered fields are permuted consistently. Face, node-cell and
+   * cell-neighbor connectivity that has been initialized is rebuilt, and
+   * face-centered fields are permuted to follow the new face numbering.
+   *
+   * \note reorder_mesh() computes node and cell orderings that improve the
+   *  memory locality of the mesh.
+   *
+   * \pre node_order is nullptr or a permutation of [0, getNumberOfNodes())
+   * \pre cell_order is nullptr or a permutation of [0, getNumberOfCells())
+   */
+  void renumber(const IndexType* node_order, const IndexType* cell_order)
+  {
+    const IndexType nodeCount = getNumberOfNodes();
+    const IndexType cellCount = getNumberOfCells();
+    const bool hasFaces = getNumberOfFaces() > 0;
+    const bool hasNodeCells = m_node_to_cell->getNumberOfIDs() > 0;
+    const bool hasNeighbors = m_cell_to_cell->getNumberOfIDs() > 0;
+
+    std::vector<IndexType> newNodeIDs;
+    if(node_order != nullptr)
+    {
+      newNodeIDs.resize(nodeCount);
+      for(IndexType i = 0; i < nodeCount; ++i)
+      {
+        newNodeIDs[node_order[i]] = i;
+      }
+    }
+
+    // Faces are numbered by their node IDs, so record each face's nodes in
+    // the new node numbering in order to carry face-centered fields over.
+    std::vector<std::string> faceKeys;
+    const bool permuteFaceFields = hasFaces && node_order != nullptr &&
+      !m_mesh_fields[FACE_CENTERED]->empty();
+    if(permuteFaceFields)
+    {
+      faceKeys.resize(getNumberOfFaces());
+      for(IndexType f = 0; f < getNumberOfFaces(); ++f)
+      {
+        IndexType nodes[MAX_FACE_NODES];
+        const IndexType n_nodes = getFaceNodeIDs(f, nodes);
+        for(IndexType i = 0; i < n_nodes; ++i)
+        {
+          nodes[i] = newNodeIDs[nodes[i]];
+        }
+        faceKeys[f] = internal::make_face_key(n_nodes, nodes, ' ');
+      }
+    }
+
+    if(node_order != nullptr)
+    {
+      for(int dim = 0; dim < getDimension(); ++dim)
+      {
+        internal::permuteTuples(getCoordinateArray(dim),
+                                nodeCount,
+                                1,
+                                node_order);
+      }
+      internal::permuteFields(m_mesh_fields[NODE_CENTERED], node_order);
+    }
+
+    IndexT* values = getCellNodesArray();
+    if(cell_order != nullptr)
+    {
+      IndexT* offsets = getCellNodesOffsetsArray();
+      if(offsets == nullptr)
+      {
+        internal::permuteTuples(values,
+                                cellCount,
+                                getNumberOfCellNodes(),
+                                cell_order);
+      }
+      else
+      {
+        const std::vector<IndexT> oldOffsets(offsets, offsets + cellCount + 1);
+        const std::vector<IndexT> oldValues(values,
+                                            values + offsets[cellCount]);
+        for(IndexType c = 0; c < cellCount; ++c)
+        {
+          const IndexT* begin = oldValues.data() + oldOffsets[cell_order[c]];
+          const IndexT* end = oldValues.data() + oldOffsets[cell_order[c] + 1];
+          offsets[c + 1] = static_cast<IndexT>(offsets[c] + (end - begin));
+          std::copy(begin, end, values + offsets[c]);
+        }
+        internal::permuteTuples(getCellTypesArray(), cellCount, 1, cell_order);
+      }
+      internal::permuteFields(m_mesh_fields[CELL_CENTERED], cell_order);
+    }
+
+    if(node_order != nullptr)
+    {
+      const IndexType n_values = getCellNodesSize();
+      for(IndexType i = 0; i < n_values; ++i)
+      {
+        values[i] = static_cast<IndexT>(newNodeIDs[values[i]]);
+      }
+    }
+
+    if(hasFaces)
+    {
+      initializeFaceConnectivity(true);
+    }
+
+    if(permuteFaceFields)
+    {
+      const IndexType faceCount = getNumberOfFaces();
+      std::unordered_map<std::string, IndexType> newFaceIDs;
+      for(IndexType f = 0; f < faceCount; ++f)
+      {
+        IndexType nodes[MAX_FACE_NODES];
+        const IndexType n_nodes = getFaceNodeIDs(f, nodes);
+        newFaceIDs[internal::make_face_key(n_nodes, nodes, ' ')] = f;
+      }
+
+      std::vector<IndexType> faceOrder(faceCount);
+      for(IndexType f = 0; f < faceCount; ++f)
+      {
+        faceOrder[newFaceIDs[faceKeys[f]]] = f;
+      }
+      internal::permuteFields(m_mesh_fields[FACE_CENTERED], faceOrder.data());
+    }
+
+    if(hasNeighbors)
+    {
+      initializeCellNeighborConnectivity(true);
+    }
+    else if(hasNodeCells)
+    {
+      initializeNodeCellConnectivity(true);
+    }
+  }
+
+  /// @}
+
   /// @}
 
 private:
@@ -1840,11 +2353,17 @@ private:
 
   /*! \brief Return a new empty CellToFaceConnectivty instance. */
   CellToFaceConnectivity* initializeCellToFace(
-    CellType cell_type = UNDEFINED_CELL) const;
+    CellType cell_type = UNDEFINED_CELL) const
+  {
+    return internal::face_connectivity<TOPO>::newCellToFace(cell_type);
+  }
 
   /*! \brief Return a new empty FaceToNodeConnectivity instance. */
   FaceToNodeConnectivity* initializeFaceToNode(
-    CellType cell_type = UNDEFINED_CELL) const;
+    CellType cell_type = UNDEFINED_CELL) const
+  {
+    return internal::face_connectivity<TOPO>::newFaceToNode(cell_type);
+  }
 
   /*!
    * \brief Update the connectivity given an nodal insert at position pos of
@@ -1858,14 +2377,14 @@ private:
     SLIC_ASSERT(0 <= pos && pos < getNumberOfNodes());
 
     const IndexType n_values = getCellNodesSize();
-    IndexType* values = getCellNodesArray();
+    IndexT* values = getCellNodesArray();
     SLIC_ASSERT(n_values == 0 || values != nullptr);
 
     for(IndexType i = 0; i < n_values; ++i)
     {
       if(values[i] >= pos)
       {
-        values[i] += n;
+        values[i] = static_cast<IndexT>(values[i] + n);
       }
     }
   }
@@ -1877,6 +2396,7 @@ private:
   {
     m_explicit_coords = true;
     m_explicit_connectivity = true;
+    m_has_compact_connectivity = !std::is_same<IndexT, IndexType>::value;
     m_mesh_fields[NODE_CENTERED]->setResizeRatio(getNodeResizeRatio());
     m_mesh_fields[CELL_CENTERED]->setResizeRatio(getCellResizeRatio());
     m_mesh_fields[FACE_CENTERED]->setResizeRatio(getFaceResizeRatio());
@@ -1904,74 +2424,18 @@ private:
   /*! \brief Each face's nodes */
   FaceToNodeConnectivity* m_face_to_node;
 
-  DISABLE_COPY_AND_ASSIGNMENT(UnstructuredMesh);
-  DISABLE_MOVE_AND_ASSIGNMENT(UnstructuredMesh);
-};
-
-/*!
- * \brief Return a new CellToFaceConnectivity. This instance is for
- *  SINGLE_SHAPE meshes. If the mesh has cell type VERTEX or SEGMENT then the
- *  stride of the returned connectivity is 1 instead of 0 which is the proper
- *  number of cell faces, this avoids an error with 0 stride.
- *
- * \param [in] cell_type the cell_type of the mesh.
- */
-template <>
-inline UnstructuredMesh<SINGLE_SHAPE>::CellToFaceConnectivity*
-UnstructuredMesh<SINGLE_SHAPE>::initializeCellToFace(CellType cell_type) const
-{
-  IndexType num_faces = getCellInfo(cell_type).num_faces;
-  if(num_faces == 0)
-  {
-    num_faces = 1;
-  }
+  /*! \brief Each node's cells */
+  NodeToCellConnectivity* m_node_to_cell;
 
-  return new UnstructuredMesh<SINGLE_SHAPE>::CellToFaceConnectivity(num_faces, 0);
-}
+  /*! \brief The cells that share at least one node with each cell */
+  CellToCellConnectivity* m_cell_to_cell;
 
-/*!
- * \brief Return a new CellToFaceConnectivity. This instance is for
- *  MIXED_SHAPE meshes.
- */
-template <>
-inline UnstructuredMesh<MIXED_SHAPE>::CellToFaceConnectivity*
-  UnstructuredMesh<MIXED_SHAPE>::initializeCellToFace(CellType) const
-{
-  return new UnstructuredMesh<MIXED_SHAPE>::CellToFaceConnectivity(UNDEFINED_CELL,
-                                                                   0,
-                                                                   0);
-}
+  /*! \brief The cell across each of a cell's faces, or -1 */
+  CellToCellConnectivity* m_cell_face_neighbors;
 
-/*!
- * \brief Return a new FaceToNodeConnectivity. This instance is for
- *  SINGLE_SHAPE meshes. If the mesh has cell type VERTEX or SEGMENT then the
- *  cell type of the returned ConnectivityArray is UNDEFINED_CELL with stride 1.
- *
- * \param [in] cell_type the cell_type of the mesh.
- */
-template <>
-inline UnstructuredMesh<SINGLE_SHAPE>::FaceToNodeConnectivity*
-UnstructuredMesh<SINGLE_SHAPE>::initializeFaceToNode(CellType cell_type) const
-{
-  const CellType face_type = getCellInfo(cell_type).face_types[0];
-  if(face_type == UNDEFINED_CELL)
-  {
-    return new UnstructuredMesh<SINGLE_SHAPE>::FaceToNodeConnectivity(1, 0);
-  }
-
-  return new UnstructuredMesh<SINGLE_SHAPE>::FaceToNodeConnectivity(face_type, 0);
-}
-
-/*!
- * \brief Return a new FaceToNodeConnectivity. This instance is for
- *  MIXED_SHAPE meshes.
- */
-template <>
-inline UnstructuredMesh<MIXED_SHAPE>::FaceToNodeConnectivity*
-  UnstructuredMesh<MIXED_SHAPE>::initializeFaceToNode(CellType) const
-{
-  return new UnstructuredMesh<MIXED_SHAPE>::FaceToNodeConnectivity(0, 0);
-}
+  DISABLE_COPY_AND_ASSIGNMENT(UnstructuredMesh);
+  DISABLE_MOVE_AND_ASSIGNMENT(UnstructuredMesh);
+};
 
 } /* namespace mint */
 } /* namespace axom */
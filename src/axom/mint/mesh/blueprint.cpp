@@ -335,6 +335,34 @@ bool hasMixedCellTypes(const sidre::Group* group, const std::string& topo)
   }
 }
 
+//------------------------------------------------------------------------------
+bool hasCompactConnectivity(const sidre::Group* group, const std::string& topo)
+{
+  SLIC_ERROR_IF(!blueprint::isValidRootGroup(group),
+                "supplied group does not conform to the blueprint!");
+
+  const sidre::Group* topology = blueprint::getTopologyGroup(group, topo);
+  SLIC_ERROR_IF(!blueprint::isValidTopologyGroup(topology),
+                "mesh topology does not conform to the blueprint!");
+
+  if(topology->getView("type")->getString() != std::string("unstructured"))
+  {
+    return false;
+  }
+
+  SLIC_ERROR_IF(!topology->hasChildGroup("elements"),
+                "Unstructured topology has no 'elements' group.");
+
+  const sidre::Group* elems_group = topology->getGroup("elements");
+
+  SLIC_ERROR_IF(!elems_group->hasChildView("connectivity"),
+                "elements group has no 'connectivity' view.");
+
+  const sidre::View* connec_view = elems_group->getView("connectivity");
+  return sizeof(IndexType) > sizeof(int32) &&
+    connec_view->getTypeID() == sidre::INT32_ID;
+}
+
 //------------------------------------------------------------------------------
 void getStructuredMeshProperties(int dimension,
                                  IndexType node_dims[3],
@@ -193,6 +193,21 @@ void getMeshTypeAndDimension(int& mesh_type,
  */
 bool hasMixedCellTypes(const sidre::Group* group, const std::string& topo = "");
 
+/*!
+ * \brief Return whether the connectivity of an unstructured mesh is stored
+ *  as 32-bit integers while IndexType is 64-bit.
+ *
+ * \param [in] group pointer to the root group.
+ * \param [in] topo optional argument corresponding to the mesh topology.
+ *
+ * \note If a topology is not specified, the code assumes that the first group
+ *  under the 'topologies' group corresponds to the mesh topology.
+ *
+ * \see UnstructuredMesh
+ */
+bool hasCompactConnectivity(const sidre::Group* group,
+                            const std::string& topo = "");
+
 /*!
  * \brief Get the nodal dimensions and the global node extent of a
  *  StructuredMesh from sidre.
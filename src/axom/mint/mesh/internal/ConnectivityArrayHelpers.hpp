@@ -43,12 +43,15 @@ namespace internal
  *  check that the appropriate views exist.
  * \note the given Group must conform to a single Blueprint topology.
  *
+ * \note the connectivity and offsets views must hold values of type IndexT.
+ *
  * \pre group != nullptr
  * \pre m_values != nullptr
  */
+template <typename IndexT>
 inline CellType initializeFromGroup(sidre::Group* group,
-                                    Array<IndexType>** m_values,
-                                    Array<IndexType>** m_offsets = nullptr,
+                                    Array<IndexT>** m_values,
+                                    Array<IndexT>** m_offsets = nullptr,
                                     Array<CellType>** m_types = nullptr)
 {
   SLIC_ERROR_IF(group == nullptr, "sidre::Group pointer must not be null.");
@@ -114,7 +117,7 @@ inline CellType initializeFromGroup(sidre::Group* group,
                   << "does not have a child view 'connectivity'.");
 
   sidre::View* connec_view = elems_group->getView("connectivity");
-  *m_values = new sidre::Array<IndexType>(connec_view);
+  *m_values = new sidre::Array<IndexT>(connec_view);
   SLIC_ERROR_IF(*m_values == nullptr, "Error in Array allocation.");
 
   if(m_offsets != nullptr)
@@ -124,7 +127,7 @@ inline CellType initializeFromGroup(sidre::Group* group,
                                   << " does not conform to mesh blueprint.");
 
     sidre::View* offsets_view = elems_group->getView("offsets");
-    *m_offsets = new sidre::Array<IndexType>(offsets_view);
+    *m_offsets = new sidre::Array<IndexT>(offsets_view);
 
     SLIC_ERROR_IF(*m_offsets == nullptr, "Error in Array allocation.");
     SLIC_ERROR_IF((*m_offsets)->numComponents() != 1,
@@ -258,11 +261,12 @@ inline IndexType getStride(const sidre::Group* group)
  * \pre m_values != nullptr
  * \pre m_offsets != nullptr
  */
+template <typename IndexT>
 inline void append(IndexType n_IDs,
-                   const IndexType* values,
-                   const IndexType* offsets,
-                   Array<IndexType>* m_values,
-                   Array<IndexType>* m_offsets)
+                   const IndexT* values,
+                   const IndexT* offsets,
+                   Array<IndexT>* m_values,
+                   Array<IndexT>* m_offsets)
 {
   SLIC_ASSERT(values != nullptr);
   SLIC_ASSERT(offsets != nullptr);
@@ -277,8 +281,8 @@ inline void append(IndexType n_IDs,
   m_values->append(values, n_values_to_add);
 
   /* Correct the appended offsets. */
-  IndexType* m_offsets_ptr = m_offsets->getData();
-  const IndexType correction = old_n_values - offsets[0];
+  IndexT* m_offsets_ptr = m_offsets->getData();
+  const IndexT correction = static_cast<IndexT>(old_n_values - offsets[0]);
   for(IndexType i = 0; i < n_IDs; ++i)
   {
     m_offsets_ptr[old_n_offsets + i] += correction;
@@ -299,11 +303,12 @@ inline void append(IndexType n_IDs,
  * \pre values != nullptr
  * \pre m_values != nullptr
  */
+template <typename IndexT>
 inline void set(IndexType start_ID,
-                const IndexType* values,
+                const IndexT* values,
                 IndexType n_IDs,
-                Array<IndexType>* m_values,
-                Array<IndexType>* m_offsets)
+                Array<IndexT>* m_values,
+                Array<IndexT>* m_offsets)
 {
   SLIC_ASSERT(start_ID >= 0);
   SLIC_ASSERT(start_ID + n_IDs <= m_offsets->size() - 1);
@@ -336,12 +341,13 @@ inline void set(IndexType start_ID,
  * \pre m_values != nullptr
  * \pre m_offsets != nullptr
  */
+template <typename IndexT>
 inline void insert(IndexType start_ID,
                    IndexType n_IDs,
-                   const IndexType* values,
-                   const IndexType* offsets,
-                   Array<IndexType>* m_values,
-                   Array<IndexType>* m_offsets)
+                   const IndexT* values,
+                   const IndexT* offsets,
+                   Array<IndexT>* m_values,
+                   Array<IndexT>* m_offsets)
 {
   SLIC_ASSERT(start_ID >= 0);
   SLIC_ASSERT(start_ID <= m_offsets->size() - 1);
@@ -351,9 +357,9 @@ inline void insert(IndexType start_ID,
   SLIC_ASSERT(m_values != nullptr);
   SLIC_ASSERT(m_offsets != nullptr);
 
-  IndexType n_values = offsets[n_IDs] - offsets[0];
-  IndexType* m_offsets_ptr = m_offsets->getData();
-  IndexType insert_pos = m_offsets_ptr[start_ID];
+  const IndexT n_values = offsets[n_IDs] - offsets[0];
+  IndexT* m_offsets_ptr = m_offsets->getData();
+  const IndexT insert_pos = m_offsets_ptr[start_ID];
 
   /* Increment the offsets after the insertion position. */
   IndexType n_offsets = m_offsets->size();
@@ -367,7 +373,7 @@ inline void insert(IndexType start_ID,
 
   /* Correct the inserted offsets. */
   m_offsets_ptr = m_offsets->getData();
-  const IndexType correction = insert_pos - offsets[0];
+  const IndexT correction = insert_pos - offsets[0];
   for(IndexType i = 0; i < n_IDs; ++i)
   {
     m_offsets_ptr[start_ID + 1 + i] += correction;
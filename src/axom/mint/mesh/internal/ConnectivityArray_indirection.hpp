@@ -40,8 +40,8 @@ namespace mint
  * \see ConnectivityArray_typed_indirection.hpp
  * \see ConnectivityArray_internal.hpp
  */
-template <>
-class ConnectivityArray<INDIRECTION>
+template <typename IndexT>
+class ConnectivityArray<INDIRECTION, IndexT>
 {
 public:
   /*!
@@ -72,14 +72,14 @@ public:
                     IndexType value_capacity = USE_DEFAULT)
     : m_cell_type(cell_type)
     , m_values(nullptr)
-    , m_offsets(new Array<IndexType>(
+    , m_offsets(new Array<IndexT>(
         axom::internal::ZERO,
         1,
         (ID_capacity == USE_DEFAULT) ? USE_DEFAULT : ID_capacity + 1))
   {
     IndexType new_value_capacity =
       internal::calcValueCapacity(0, getIDCapacity(), 0, value_capacity);
-    m_values = new Array<IndexType>(axom::internal::ZERO, 1, new_value_capacity);
+    m_values = new Array<IndexT>(axom::internal::ZERO, 1, new_value_capacity);
 
     m_offsets->append(0);
   }
@@ -119,8 +119,8 @@ public:
    */
   ConnectivityArray(CellType cell_type,
                     IndexType n_IDs,
-                    IndexType* values,
-                    IndexType* offsets,
+                    IndexT* values,
+                    IndexT* offsets,
                     IndexType ID_capacity = USE_DEFAULT,
                     IndexType value_capacity = USE_DEFAULT)
     : m_cell_type(cell_type)
@@ -129,7 +129,7 @@ public:
   {
     SLIC_ERROR_IF(n_IDs < 0,
                   "Number of IDs must be positive, not " << n_IDs << ".");
-    m_offsets = new Array<IndexType>(
+    m_offsets = new Array<IndexT>(
       offsets,
       n_IDs + 1,
       1,
@@ -144,7 +144,7 @@ public:
                     << "Expected item 0 to be 0 not " << (*m_offsets)[0] << ".");
 
     IndexType n_values = (*m_offsets)[n_IDs];
-    m_values = new Array<IndexType>(values, n_values, 1, value_capacity);
+    m_values = new Array<IndexT>(values, n_values, 1, value_capacity);
   }
 
   /// @}
@@ -214,7 +214,7 @@ public:
     SLIC_ASSERT(elems_group != nullptr);
 
     sidre::View* offsets_view = elems_group->getView("offsets");
-    m_offsets = new sidre::Array<IndexType>(
+    m_offsets = new sidre::Array<IndexT>(
       offsets_view,
       0,
       1,
@@ -225,7 +225,7 @@ public:
     IndexType new_value_capacity =
       internal::calcValueCapacity(0, getIDCapacity(), 0, value_capacity);
     sidre::View* connec_view = elems_group->getView("connectivity");
-    m_values = new sidre::Array<IndexType>(connec_view, 0, 1, new_value_capacity);
+    m_values = new sidre::Array<IndexT>(connec_view, 0, 1, new_value_capacity);
     SLIC_ASSERT(m_values != nullptr);
   }
 
@@ -401,7 +401,7 @@ public:
       return nullptr;
     }
 
-    return static_cast<sidre::Array<IndexType>*>(m_values)
+    return static_cast<sidre::Array<IndexT>*>(m_values)
       ->getView()
       ->getOwningGroup()
       ->getParent();
@@ -447,13 +447,13 @@ public:
    */
   /// @{
 
-  IndexType* operator[](IndexType ID)
+  IndexT* operator[](IndexType ID)
   {
     SLIC_ASSERT((ID >= 0) && (ID < getNumberOfIDs()));
     return m_values->getData() + (*m_offsets)[ID];
   }
 
-  const IndexType* operator[](IndexType ID) const
+  const IndexT* operator[](IndexType ID) const
   {
     SLIC_ASSERT((ID >= 0) && (ID < getNumberOfIDs()));
     return m_values->getData() + (*m_offsets)[ID];
@@ -467,9 +467,9 @@ public:
    */
   /// @{
 
-  IndexType* getValuePtr() { return m_values->getData(); }
+  IndexT* getValuePtr() { return m_values->getData(); }
 
-  const IndexType* getValuePtr() const { return m_values->getData(); }
+  const IndexT* getValuePtr() const { return m_values->getData(); }
 
   /// @}
 
@@ -479,9 +479,9 @@ public:
    */
   /// @{
 
-  IndexType* getOffsetPtr() { return m_offsets->getData(); }
+  IndexT* getOffsetPtr() { return m_offsets->getData(); }
 
-  const IndexType* getOffsetPtr() const { return m_offsets->getData(); }
+  const IndexT* getOffsetPtr() const { return m_offsets->getData(); }
 
   /// @}
 
@@ -508,13 +508,13 @@ public:
    *
    * \pre values != nullptr
    */
-  void append(const IndexType* values,
+  void append(const IndexT* values,
               IndexType n_values,
               CellType AXOM_NOT_USED(type) = UNDEFINED_CELL)
   {
     SLIC_ASSERT(values != nullptr);
     m_values->append(values, n_values);
-    m_offsets->append(getNumberOfValues());
+    m_offsets->append(static_cast<IndexT>(getNumberOfValues()));
   }
 
   /*!
@@ -533,9 +533,9 @@ public:
    * \pre values != nullptr
    * \pre offsets != nullptr
    */
-  void appendM(const IndexType* values,
+  void appendM(const IndexT* values,
                IndexType n_IDs,
-               const IndexType* offsets,
+               const IndexT* offsets,
                const CellType* AXOM_NOT_USED(types) = nullptr)
   {
     internal::append(n_IDs, values, offsets, m_values, m_offsets);
@@ -554,7 +554,7 @@ public:
    * \pre ID >= 0 && ID < getNumberOfIDs()
    * \pre values != nullptr
    */
-  void set(const IndexType* values, IndexType ID) { setM(values, ID, 1); }
+  void set(const IndexT* values, IndexType ID) { setM(values, ID, 1); }
 
   /*!
    * \brief Sets the values of multiple IDs starting with the given ID.
@@ -570,7 +570,7 @@ public:
    * \pre start_ID >= 0 && start_ID + n_IDs < getNumberOfIDs()
    * \pre values != nullptr
    */
-  void setM(const IndexType* values, IndexType start_ID, IndexType n_IDs)
+  void setM(const IndexT* values, IndexType start_ID, IndexType n_IDs)
   {
     internal::set(start_ID, values, n_IDs, m_values, m_offsets);
   }
@@ -589,14 +589,14 @@ public:
    * \pre values != nullptr
    * \pre offsets != nullptr
    */
-  void insert(const IndexType* values,
+  void insert(const IndexT* values,
               IndexType start_ID,
               IndexType n_values,
               CellType AXOM_NOT_USED(type) = UNDEFINED_CELL)
   {
-    IndexType offsets[2];
+    IndexT offsets[2];
     offsets[0] = 0;
-    offsets[1] = n_values;
+    offsets[1] = static_cast<IndexT>(n_values);
     insertM(values, start_ID, 1, offsets);
   }
 
@@ -618,10 +618,10 @@ public:
    * \pre values != nullptr
    * \pre offsets != nullptr
    */
-  void insertM(const IndexType* values,
+  void insertM(const IndexT* values,
                IndexType start_ID,
                IndexType n_IDs,
-               const IndexType* offsets,
+               const IndexT* offsets,
                const CellType* AXOM_NOT_USED(types) = nullptr)
   {
     internal::insert(start_ID, n_IDs, values, offsets, m_values, m_offsets);
@@ -631,8 +631,8 @@ public:
 
 private:
   CellType m_cell_type;
-  Array<IndexType>* m_values;
-  Array<IndexType>* m_offsets;
+  Array<IndexT>* m_values;
+  Array<IndexT>* m_offsets;
 
   DISABLE_COPY_AND_ASSIGNMENT(ConnectivityArray);
   DISABLE_MOVE_AND_ASSIGNMENT(ConnectivityArray);
@@ -41,8 +41,8 @@ namespace mint
  * \see ConnectivityArray_internal.hpp
  */
 
-template <>
-class ConnectivityArray<TYPED_INDIRECTION>
+template <typename IndexT>
+class ConnectivityArray<TYPED_INDIRECTION, IndexT>
 {
 public:
   /// \name Native Storage ConnectivityArray Constructors
@@ -64,11 +64,11 @@ public:
     : m_values(nullptr)
     , m_types(new Array<CellType>(axom::internal::ZERO, 1, ID_capacity))
     , m_offsets(
-        new Array<IndexType>(axom::internal::ZERO, 1, m_types->capacity() + 1))
+        new Array<IndexT>(axom::internal::ZERO, 1, m_types->capacity() + 1))
   {
     IndexType new_value_capacity =
       internal::calcValueCapacity(0, getIDCapacity(), 0, value_capacity);
-    m_values = new Array<IndexType>(axom::internal::ZERO, 1, new_value_capacity);
+    m_values = new Array<IndexT>(axom::internal::ZERO, 1, new_value_capacity);
 
     m_offsets->append(0);
   }
@@ -106,15 +106,15 @@ public:
    * \post getNumberOfValues() == offsets[ n_IDs ]
    */
   ConnectivityArray(IndexType n_IDs,
-                    IndexType* values,
-                    IndexType* offsets,
+                    IndexT* values,
+                    IndexT* offsets,
                     CellType* types,
                     IndexType ID_capacity = USE_DEFAULT,
                     IndexType value_capacity = USE_DEFAULT)
     : m_values(nullptr)
     , m_types(new Array<CellType>(types, n_IDs, 1, ID_capacity))
     , m_offsets(
-        new Array<IndexType>(offsets, n_IDs + 1, 1, m_types->capacity() + 1))
+        new Array<IndexT>(offsets, n_IDs + 1, 1, m_types->capacity() + 1))
   {
     SLIC_ERROR_IF(n_IDs < 0,
                   "Number of IDs must be positive, not " << n_IDs << ".");
@@ -128,7 +128,7 @@ public:
                     << "Expected item 0 to be 0 not " << (*m_offsets)[0] << ".");
 
     IndexType n_values = (*m_offsets)[n_IDs];
-    m_values = new Array<IndexType>(values, n_values, 1, value_capacity);
+    m_values = new Array<IndexT>(values, n_values, 1, value_capacity);
   }
 
   /// @}
@@ -203,7 +203,7 @@ public:
     SLIC_ASSERT(elems_group != nullptr);
 
     sidre::View* offsets_view = elems_group->getView("offsets");
-    m_offsets = new sidre::Array<IndexType>(
+    m_offsets = new sidre::Array<IndexT>(
       offsets_view,
       1,
       1,
@@ -218,7 +218,7 @@ public:
     IndexType new_value_capacity =
       internal::calcValueCapacity(0, getIDCapacity(), 0, value_capacity);
     sidre::View* connec_view = elems_group->getView("connectivity");
-    m_values = new sidre::Array<IndexType>(connec_view, 0, 1, new_value_capacity);
+    m_values = new sidre::Array<IndexT>(connec_view, 0, 1, new_value_capacity);
     SLIC_ASSERT(m_values != nullptr);
   }
 
@@ -406,7 +406,7 @@ public:
       return nullptr;
     }
 
-    return static_cast<sidre::Array<IndexType>*>(m_values)
+    return static_cast<sidre::Array<IndexT>*>(m_values)
       ->getView()
       ->getOwningGroup()
       ->getParent();
@@ -454,13 +454,13 @@ public:
    */
   /// @{
 
-  IndexType* operator[](IndexType ID)
+  IndexT* operator[](IndexType ID)
   {
     SLIC_ASSERT((ID >= 0) && (ID < getNumberOfIDs()));
     return m_values->getData() + (*m_offsets)[ID];
   }
 
-  const IndexType* operator[](IndexType ID) const
+  const IndexT* operator[](IndexType ID) const
   {
     SLIC_ASSERT((ID >= 0) && (ID < getNumberOfIDs()));
     return m_values->getData() + (*m_offsets)[ID];
@@ -474,9 +474,9 @@ public:
    */
   /// @{
 
-  IndexType* getValuePtr() { return m_values->getData(); }
+  IndexT* getValuePtr() { return m_values->getData(); }
 
-  const IndexType* getValuePtr() const { return m_values->getData(); }
+  const IndexT* getValuePtr() const { return m_values->getData(); }
 
   /// @}
 
@@ -486,9 +486,9 @@ public:
    */
   /// @{
 
-  IndexType* getOffsetPtr() { return m_offsets->getData(); }
+  IndexT* getOffsetPtr() { return m_offsets->getData(); }
 
-  const IndexType* getOffsetPtr() const { return m_offsets->getData(); }
+  const IndexT* getOffsetPtr() const { return m_offsets->getData(); }
 
   /// @}
 
@@ -514,12 +514,12 @@ public:
    *
    * \pre values != nullptr
    */
-  void append(const IndexType* values, IndexType n_values, CellType type)
+  void append(const IndexT* values, IndexType n_values, CellType type)
   {
     SLIC_ASSERT(values != nullptr);
     SLIC_ASSERT(type != UNDEFINED_CELL);
     m_values->append(values, n_values);
-    m_offsets->append(getNumberOfValues());
+    m_offsets->append(static_cast<IndexT>(getNumberOfValues()));
     m_types->append(type);
   }
 
@@ -539,9 +539,9 @@ public:
    * \pre values != nullptr
    * \pre offsets != nullptr
    */
-  void appendM(const IndexType* values,
+  void appendM(const IndexT* values,
                IndexType n_IDs,
-               const IndexType* offsets,
+               const IndexT* offsets,
                const CellType* types)
   {
     internal::append(n_IDs, values, offsets, m_values, m_offsets);
@@ -561,7 +561,7 @@ public:
    * \pre ID >= 0 && ID < getNumberOfIDs()
    * \pre values != nullptr
    */
-  void set(const IndexType* values, IndexType ID) { setM(values, ID, 1); }
+  void set(const IndexT* values, IndexType ID) { setM(values, ID, 1); }
 
   /*!
    * \brief Sets the values of multiple IDs starting with the given ID.
@@ -577,7 +577,7 @@ public:
    * \pre start_ID >= 0 && start_ID + n_IDs < getNumberOfIDs()
    * \pre values != nullptr
    */
-  void setM(const IndexType* values, IndexType start_ID, IndexType n_IDs)
+  void setM(const IndexT* values, IndexType start_ID, IndexType n_IDs)
   {
     internal::set(start_ID, values, n_IDs, m_values, m_offsets);
   }
@@ -595,7 +595,7 @@ public:
    * \pre n_values >= 0
    * \pre values != nullptr
    */
-  void insert(const IndexType* values,
+  void insert(const IndexT* values,
               IndexType start_ID,
               IndexType n_values,
               CellType type)
@@ -605,9 +605,9 @@ public:
     SLIC_ASSERT(start_ID <= getNumberOfIDs());
     SLIC_ASSERT(values != nullptr);
 
-    IndexType offsets[2];
+    IndexT offsets[2];
     offsets[0] = 0;
-    offsets[1] = n_values;
+    offsets[1] = static_cast<IndexT>(n_values);
     insertM(values, start_ID, 1, offsets, &type);
   }
 
@@ -630,10 +630,10 @@ public:
    * \pre values != nullptr
    * \pre offsets != nullptr
    */
-  void insertM(const IndexType* values,
+  void insertM(const IndexT* values,
                IndexType start_ID,
                IndexType n_IDs,
-               const IndexType* offsets,
+               const IndexT* offsets,
                const CellType* types)
   {
     internal::insert(start_ID, n_IDs, values, offsets, m_values, m_offsets);
@@ -643,9 +643,9 @@ public:
   /// @}
 
 private:
-  Array<IndexType>* m_values;
+  Array<IndexT>* m_values;
   Array<CellType>* m_types;
-  Array<IndexType>* m_offsets;
+  Array<IndexT>* m_offsets;
 
   DISABLE_COPY_AND_ASSIGNMENT(ConnectivityArray);
   DISABLE_MOVE_AND_ASSIGNMENT(ConnectivityArray);
@@ -5,12 +5,21 @@
 
 #include "axom/mint/mesh/internal/MeshHelpers.hpp"
 #include "axom/mint/mesh/Mesh.hpp"
+#include "axom/mint/mesh/Field.hpp"
+#include "axom/mint/mesh/FieldData.hpp"
+#include "axom/slic/interface/slic.hpp"
 #include "axom/core/utilities/Utilities.hpp"
+#include "axom/config.hpp"
 
 #include <algorithm>
-#include <unordered_map>
+#include <cstdint>
+#include <sstream>
 #include <vector>
 
+#ifdef AXOM_USE_OPENMP
+  #include <omp.h>
+#endif
+
 namespace axom
 {
 namespace mint
@@ -50,23 +59,184 @@ IndexType otherSide(IndexType* f2c, IndexType thisSide)
   return (f2c[0] != thisSide) ? f2c[0] : f2c[1];
 }
 
+namespace
+{
+//------------------------------------------------------------------------------
+// A face key packs the sorted node IDs of a face into a fixed number of
+// 64-bit words.  Each ID is stored plus one, so that zeros pad faces with
+// fewer nodes, and the smallest ID occupies the most significant bits.
+// Keys therefore sort in the lexicographic order of the sorted node lists.
+// Word 0 holds the least significant bits.
+//------------------------------------------------------------------------------
+using KeyWord = std::uint64_t;
+constexpr int KEY_WORD_BITS = 64;
+
+// Number of key bits sorted by each radix sort pass
+constexpr int RADIX_BITS = 11;
+constexpr int RADIX_BUCKETS = 1 << RADIX_BITS;
+
+//------------------------------------------------------------------------------
+inline void setKeyBits(KeyWord* key, int pos, KeyWord value, int nbits)
+{
+  const int word = pos / KEY_WORD_BITS;
+  const int shift = pos % KEY_WORD_BITS;
+  key[word] |= value << shift;
+  if(shift + nbits > KEY_WORD_BITS)
+  {
+    key[word + 1] |= value >> (KEY_WORD_BITS - shift);
+  }
+}
+
+//------------------------------------------------------------------------------
+inline int getKeyDigit(const KeyWord* key, int pos, int nwords)
+{
+  const int word = pos / KEY_WORD_BITS;
+  const int shift = pos % KEY_WORD_BITS;
+  KeyWord bits = key[word] >> shift;
+  if(shift + RADIX_BITS > KEY_WORD_BITS && word + 1 < nwords)
+  {
+    bits |= key[word + 1] << (KEY_WORD_BITS - shift);
+  }
+  return static_cast<int>(bits & (RADIX_BUCKETS - 1));
+}
+
+//------------------------------------------------------------------------------
+inline bool sameKey(const KeyWord* a, const KeyWord* b, int nwords)
+{
+  for(int w = 0; w < nwords; ++w)
+  {
+    if(a[w] != b[w])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Sorts a short array in place; faces and cells have few entries.
+template <typename T>
+inline void insertionSort(T* values, int count)
+{
+  for(int i = 1; i < count; ++i)
+  {
+    T v = values[i];
+    int j = i - 1;
+    for(; j >= 0 && values[j] > v; --j)
+    {
+      values[j + 1] = values[j];
+    }
+    values[j + 1] = v;
+  }
+}
+
+//------------------------------------------------------------------------------
+inline int getNumSortThreads()
+{
+#ifdef AXOM_USE_OPENMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Stable LSD radix sort of the face keys and their slot IDs, considering
+// only the low nbits bits of each key.  Each pass histograms and scatters
+// one chunk of the keys per thread.  Passes whose digit is the same for
+// every key are skipped.
 //------------------------------------------------------------------------------
-struct FaceTypeCellsNodes
+void radixSortFaceKeys(std::vector<KeyWord>& keys,
+                       std::vector<IndexType>& slots,
+                       int nwords,
+                       int nbits)
 {
-  FaceTypeCellsNodes() : facetype(UNDEFINED_CELL) { }
+  const IndexType n = static_cast<IndexType>(slots.size());
+  const int nchunks = getNumSortThreads();
 
-  FaceTypeCellsNodes(CellType ftype,
-                     std::vector<IndexType>& fcells,
-                     std::vector<IndexType>& fnodes)
-    : facetype(ftype)
-    , facecells(fcells)
-    , facenodes(fnodes)
-  { }
+  std::vector<KeyWord> keys_tmp(keys.size());
+  std::vector<IndexType> slots_tmp(slots.size());
+  std::vector<IndexType> offsets(nchunks * RADIX_BUCKETS);
 
-  CellType facetype;
-  std::vector<IndexType> facecells;
-  std::vector<IndexType> facenodes;
-};
+  for(int pos = 0; pos < nbits; pos += RADIX_BITS)
+  {
+    std::fill(offsets.begin(), offsets.end(), 0);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel num_threads(nchunks)
+#endif
+    {
+#ifdef AXOM_USE_OPENMP
+      const int first = omp_get_thread_num();
+      const int stride = omp_get_num_threads();
+#else
+      const int first = 0;
+      const int stride = 1;
+#endif
+      for(int t = first; t < nchunks; t += stride)
+      {
+        IndexType* counts = &offsets[t * RADIX_BUCKETS];
+        const IndexType begin = n * t / nchunks;
+        const IndexType end = n * (t + 1) / nchunks;
+        for(IndexType i = begin; i < end; ++i)
+        {
+          ++counts[getKeyDigit(&keys[i * nwords], pos, nwords)];
+        }
+      }
+    }
+
+    // Convert counts to scatter offsets, ordered by bucket then chunk so
+    // that the scatter is stable
+    IndexType sum = 0;
+    bool single_bucket = false;
+    for(int b = 0; b < RADIX_BUCKETS; ++b)
+    {
+      const IndexType bucket_start = sum;
+      for(int t = 0; t < nchunks; ++t)
+      {
+        const IndexType count = offsets[t * RADIX_BUCKETS + b];
+        offsets[t * RADIX_BUCKETS + b] = sum;
+        sum += count;
+      }
+      single_bucket = single_bucket || (sum - bucket_start == n);
+    }
+    if(single_bucket)
+    {
+      continue;
+    }
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel num_threads(nchunks)
+#endif
+    {
+#ifdef AXOM_USE_OPENMP
+      const int first = omp_get_thread_num();
+      const int stride = omp_get_num_threads();
+#else
+      const int first = 0;
+      const int stride = 1;
+#endif
+      for(int t = first; t < nchunks; t += stride)
+      {
+        IndexType* dest = &offsets[t * RADIX_BUCKETS];
+        const IndexType begin = n * t / nchunks;
+        const IndexType end = n * (t + 1) / nchunks;
+        for(IndexType i = begin; i < end; ++i)
+        {
+          const KeyWord* key = &keys[i * nwords];
+          const IndexType d = dest[getKeyDigit(key, pos, nwords)]++;
+          std::copy(key, key + nwords, &keys_tmp[d * nwords]);
+          slots_tmp[d] = slots[i];
+        }
+      }
+    }
+
+    keys.swap(keys_tmp);
+    slots.swap(slots_tmp);
+  }
+}
+
+}  // end anonymous namespace
 
 //------------------------------------------------------------------------------
 bool initFaces(Mesh* mesh,
@@ -79,8 +249,6 @@ bool initFaces(Mesh* mesh,
                IndexType*& f2noffsets,
                CellType*& f2ntypes)
 {
-  bool success = true;
-
   facecount = 0;
   f2c = nullptr;
   c2f = nullptr;
@@ -90,174 +258,252 @@ bool initFaces(Mesh* mesh,
   f2noffsets = nullptr;
   f2ntypes = nullptr;
 
-  using IDtoKeyType = std::unordered_map<IndexType, std::vector<IndexType>>;
-  using FaceBuilderType = std::map<std::vector<IndexType>,
-                                   FaceTypeCellsNodes,
-                                   utilities::LexiComparator<IndexType>>;
-  FaceBuilderType workface;
-
-  // Iterate over each cell.
   const IndexType cellcount = mesh->getNumberOfCells();
-  for(int c = 0; c < cellcount; ++c)
+
+  // Step 1. Every (cell, local face) pair is a "slot".  The slots of a
+  // cell are contiguous, starting at c2foffsets[cell].
+  c2foffsets = new IndexType[cellcount + 1];
+  int maxFaceNodes = 0;
+  {
+    bool typeUsed[NUM_CELL_TYPES] = {false};
+    IndexType slotcount = 0;
+    for(IndexType c = 0; c < cellcount; ++c)
+    {
+      const CellType celltype = mesh->getCellType(c);
+      typeUsed[cellTypeToInt(celltype)] = true;
+      c2foffsets[c] = slotcount;
+      slotcount += getCellInfo(celltype).num_faces;
+    }
+    c2foffsets[cellcount] = slotcount;
+
+    for(int t = 0; t < NUM_CELL_TYPES; ++t)
+    {
+      const CellInfo& info = cell_info[t];
+      for(int f = 0; typeUsed[t] && f < info.num_faces; ++f)
+      {
+        maxFaceNodes = utilities::max(maxFaceNodes, info.face_nodecount[f]);
+      }
+    }
+  }
+  const IndexType slotcount = c2foffsets[cellcount];
+
+  // Step 2. Pack the sorted nodes of each slot's face into a key, using
+  // just enough bits per node to hold (number of nodes + 1) distinct
+  // values.
+  int nodeBits = 1;
+  while(nodeBits < KEY_WORD_BITS - 1 &&
+        (static_cast<KeyWord>(mesh->getNumberOfNodes()) >> nodeBits) != 0)
+  {
+    ++nodeBits;
+  }
+  const int keyBits = utilities::max(nodeBits * maxFaceNodes, 1);
+  const int keyWords = (keyBits + KEY_WORD_BITS - 1) / KEY_WORD_BITS;
+
+  std::vector<KeyWord> keys(slotcount * keyWords, 0);
+  std::vector<IndexType> slots(slotcount);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(IndexType c = 0; c < cellcount; ++c)
   {
-    // Step 1. For every cell, get the nodes.
     IndexType nodes[MAX_CELL_NODES];
     mesh->getCellNodeIDs(c, nodes);
-    const CellType celltype = mesh->getCellType(c);
-    const CellInfo thisCell = getCellInfo(celltype);
+    const CellInfo& thisCell = getCellInfo(mesh->getCellType(c));
 
     int base = 0;
     for(int f = 0; f < thisCell.num_faces; ++f)
     {
-      // Step 2. The cell nodes will be in "VTK Order," as specified by
-      // https://www.vtk.org/wp-content/uploads/2015/04/file-formats.pdf.
-      // This routine selects the face nodes as listed in the registered
-      // cell info to make sure that face normals point outward.
-      //
-      // For every face, sort the node IDs and join them together in a
-      // string with '.' delimiters.  This is the key for an associative
-      // array whose value is a list of cell IDs.
-      int num_face_nodes = thisCell.face_nodecount[f];
-      std::vector<IndexType> inorder_facenodes(num_face_nodes);
-      const IndexType* face_node_offsets = thisCell.face_nodes + base;
+      const IndexType slot = c2foffsets[c] + f;
+      const int num_face_nodes = thisCell.face_nodecount[f];
+
+      IndexType facenodes[MAX_FACE_NODES];
       for(int fn = 0; fn < num_face_nodes; ++fn)
       {
-        inorder_facenodes[fn] = nodes[face_node_offsets[fn]];
+        facenodes[fn] = nodes[thisCell.face_nodes[base + fn]];
       }
       base += num_face_nodes;
+      insertionSort(facenodes, num_face_nodes);
 
-      std::vector<IndexType> sorted_facenodes(inorder_facenodes);
-      std::sort(sorted_facenodes.begin(), sorted_facenodes.end());
-
-      FaceTypeCellsNodes cells_of_face;
-      if(workface.count(sorted_facenodes) > 0)
-      {
-        cells_of_face = workface[sorted_facenodes];
-      }
-      else
+      KeyWord* key = &keys[slot * keyWords];
+      for(int fn = 0; fn < num_face_nodes; ++fn)
       {
-        cells_of_face.facetype = thisCell.face_types[f];
-        cells_of_face.facenodes = inorder_facenodes;
+        const int pos = (maxFaceNodes - 1 - fn) * nodeBits;
+        setKeyBits(key, pos, static_cast<KeyWord>(facenodes[fn] + 1), nodeBits);
       }
-      cells_of_face.facecells.push_back(c);
-      workface[sorted_facenodes] = cells_of_face;
+      slots[slot] = slot;
     }
   }
 
-  // Step 3. For each face, record its incident cells.
-  // Here we use ConnectivityArray::reserve() and then append() each
-  // face.  This means the kth inserted face gets ID k.
-  IndexType faceID = 0;
-  IndexType faceNodeTotal = 0;
-  IDtoKeyType keys;
-  f2c = new IndexType[2 * workface.size()];
-  for(FaceBuilderType::value_type v : workface)
-  {
-    FaceTypeCellsNodes theFace = v.second;
-    faceNodeTotal += static_cast<IndexType>(theFace.facenodes.size());
-    int faceCellCount = static_cast<int>(theFace.facecells.size());
-    IndexType* faceCells = theFace.facecells.data();
+  // Step 3. Sort the keys.  Slots that share a face become adjacent, in
+  // increasing cell order since the sort is stable.
+  radixSortFaceKeys(keys, slots, keyWords, keyBits);
 
-    if(faceCellCount < 1 || faceCellCount > 2)
+  // Step 4. Each run of equal keys is a face.  Number the faces in sorted
+  // order and check that no face has more than two incident cells.
+  std::vector<IndexType> faceStart(slotcount + 1);
+  IndexType numFaces = 0;
+  bool success = true;
+  for(IndexType i = 0; i < slotcount; ++i)
+  {
+    if(i == 0 ||
+       !sameKey(&keys[i * keyWords], &keys[(i - 1) * keyWords], keyWords))
     {
-      success = false;
+      faceStart[numFaces++] = i;
     }
-    else
+    else if(i - faceStart[numFaces - 1] >= 2)
     {
-      f2c[2 * faceID] = faceCells[0];
-      f2c[2 * faceID + 1] = (faceCellCount > 1 ? faceCells[1] : -1);
+      success = false;
     }
-
-    keys[faceID] = v.first;
-
-    faceID += 1;
   }
+  faceStart[numFaces] = slotcount;
+  keys.clear();
+  keys.shrink_to_fit();
 
-  // If we have any face with less than one or more than two incident cells,
-  // clean up and return failure.  We won't do any more work here.
+  // If we have any face with more than two incident cells, clean up and
+  // return failure.  We won't do any more work here.
   if(!success)
   {
-    delete[] f2c;
-    f2c = nullptr;
+    delete[] c2foffsets;
+    c2foffsets = nullptr;
     return success;
   }
 
   // Record how many faces we have in this mesh.
-  facecount = faceID;
+  facecount = numFaces;
 
-  // Now that we have a count of all the face-nodes, and we know we have no
-  // faces with more than two nodes, record the face-node relations.
-  f2n = new IndexType[faceNodeTotal];
-  f2noffsets = new IndexType[facecount + 1];
+  // Step 5. Record face-cell, face-type and face-node counts.  A face's
+  // nodes are taken in order from its first incident cell, so that its
+  // normal points out of that cell.
+  f2c = new IndexType[2 * facecount];
   f2ntypes = new CellType[facecount];
-  int faceNodeOffset = 0;
-  for(int fidx = 0; fidx < facecount; ++fidx)
+  f2noffsets = new IndexType[facecount + 1];
+  std::vector<IndexType> slotFace(slotcount);
+  std::vector<IndexType> faceCell(facecount);
+
+  auto slotCell = [&](IndexType slot) {
+    return static_cast<IndexType>(
+      std::upper_bound(c2foffsets, c2foffsets + cellcount + 1, slot) -
+      c2foffsets - 1);
+  };
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(IndexType f = 0; f < facecount; ++f)
   {
-    FaceTypeCellsNodes theFace = workface[keys[fidx]];
-    std::vector<IndexType>& faceNodes = theFace.facenodes;
-    std::copy(faceNodes.begin(), faceNodes.end(), f2n + faceNodeOffset);
-    f2noffsets[fidx] = faceNodeOffset;
-    f2ntypes[fidx] = theFace.facetype;
-    faceNodeOffset += static_cast<int>(faceNodes.size());
+    const IndexType first = faceStart[f];
+    const IndexType slot = slots[first];
+    const IndexType cell = slotCell(slot);
+    const bool shared = (faceStart[f + 1] - first) > 1;
+
+    f2c[2 * f] = cell;
+    f2c[2 * f + 1] = shared ? slotCell(slots[first + 1]) : -1;
+
+    slotFace[slot] = f;
+    if(shared)
+    {
+      slotFace[slots[first + 1]] = f;
+    }
+
+    const CellInfo& info = getCellInfo(mesh->getCellType(cell));
+    const int localFace = static_cast<int>(slot - c2foffsets[cell]);
+    f2ntypes[f] = info.face_types[localFace];
+    f2noffsets[f] = info.face_nodecount[localFace];
+    faceCell[f] = cell;
+  }
+
+  IndexType faceNodeOffset = 0;
+  for(IndexType f = 0; f < facecount; ++f)
+  {
+    const IndexType count = f2noffsets[f];
+    f2noffsets[f] = faceNodeOffset;
+    faceNodeOffset += count;
   }
   f2noffsets[facecount] = faceNodeOffset;
 
-  // Step 4. Now that we have face IDs, record cell-to-face relation.
-  typedef std::unordered_map<IndexType, std::vector<IndexType>> CellFaceBuilderType;
+  // Step 6. Record the face-node relation.
+  f2n = new IndexType[faceNodeOffset];
 
-  CellFaceBuilderType cell_to_face;
-  int cellFaceCount = 0;
-  for(int f = 0; f < facecount; ++f)
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(IndexType f = 0; f < facecount; ++f)
   {
-    for(IndexType c : workface[keys[f]].facecells)
+    const IndexType cell = faceCell[f];
+    const int localFace =
+      static_cast<int>(slots[faceStart[f]] - c2foffsets[cell]);
+
+    IndexType nodes[MAX_CELL_NODES];
+    mesh->getCellNodeIDs(cell, nodes);
+    const CellInfo& info = getCellInfo(mesh->getCellType(cell));
+
+    int base = 0;
+    for(int lf = 0; lf < localFace; ++lf)
     {
-      std::vector<IndexType> cell_faces;
-      if(cell_to_face.count(c) > 0)
-      {
-        cell_faces = cell_to_face[c];
-      }
-      cellFaceCount += 1;
-      cell_faces.push_back(f);
-      cell_to_face[c] = cell_faces;
+      base += info.face_nodecount[lf];
+    }
+    for(int fn = 0; fn < info.face_nodecount[localFace]; ++fn)
+    {
+      f2n[f2noffsets[f] + fn] = nodes[info.face_nodes[base + fn]];
     }
   }
 
-  // Step 4b. Put cell-to-face relation into output arrays.
-  c2f = new IndexType[cellFaceCount];
-  c2n = new IndexType[cellFaceCount];
-  c2foffsets = new IndexType[cellcount + 1];
-  cellFaceCount = 0;
+  // Step 7. Record the cell-face relation, listing each cell's faces in
+  // increasing face ID order, and the cell neighbor across each face.
+  c2f = new IndexType[slotcount];
+  c2n = new IndexType[slotcount];
 
-  for(IndexType cellID = 0; cellID < cellcount; ++cellID)
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(IndexType c = 0; c < cellcount; ++c)
   {
-    // For the current cell ID, set its type and value offset
-    //  cellTypes[cellID] = m_cell_connectivity->getIDType(cellID);
-    c2foffsets[cellID] = cellFaceCount;
+    const IndexType begin = c2foffsets[c];
+    const int count = static_cast<int>(c2foffsets[c + 1] - begin);
 
-    if(cell_to_face.count(cellID) > 0)
-    {
-      // If we have faces for the current cell (which we certainly
-      // *SHOULD* have), copy them in.
-      std::vector<IndexType>& theCells = cell_to_face[cellID];
-      IndexType* faceIDs = theCells.data();
-      int thisCellFaceCount = static_cast<int>(theCells.size());
-
-      // Copy in values
-      for(int f = 0; f < thisCellFaceCount; ++f)
-      {
-        c2f[cellFaceCount + f] = faceIDs[f];
-        c2n[cellFaceCount + f] = otherSide(&f2c[2 * faceIDs[f]], cellID);
-      }
+    std::copy(&slotFace[begin], &slotFace[begin] + count, c2f + begin);
+    insertionSort(c2f + begin, count);
 
-      // Maintain offset
-      cellFaceCount += thisCellFaceCount;
+    for(int f = 0; f < count; ++f)
+    {
+      c2n[begin + f] = otherSide(&f2c[2 * c2f[begin + f]], c);
     }
   }
-  c2foffsets[cellcount] = cellFaceCount;
 
   return success;
 }
 
+//------------------------------------------------------------------------------
+void permuteFields(FieldData* fd, const IndexType* order)
+{
+  const int numFields = fd->getNumFields();
+  for(int i = 0; i < numFields; ++i)
+  {
+    Field* field = fd->getField(i);
+    const IndexType n = field->getNumTuples();
+    const IndexType ncomp = field->getNumComponents();
+
+    switch(field->getType())
+    {
+    case FLOAT_FIELD_TYPE:
+      permuteTuples(Field::getDataPtr<float>(field), n, ncomp, order);
+      break;
+    case DOUBLE_FIELD_TYPE:
+      permuteTuples(Field::getDataPtr<double>(field), n, ncomp, order);
+      break;
+    case INT32_FIELD_TYPE:
+      permuteTuples(Field::getDataPtr<int32>(field), n, ncomp, order);
+      break;
+    case INT64_FIELD_TYPE:
+      permuteTuples(Field::getDataPtr<int64>(field), n, ncomp, order);
+      break;
+    default:
+      SLIC_ERROR("Field [" << field->getName() << "] has an unsupported type");
+    }
+  }
+}
+
 } /* namespace internal */
 } /* namespace mint */
 } /* namespace axom */
@@ -10,13 +10,16 @@
 #include "axom/mint/config.hpp"          // for mint compile-time type
 #include "axom/mint/mesh/CellTypes.hpp"  // for CellType
 
+#include <algorithm>  // for std::copy, std::sort
 #include <string>
+#include <vector>
 
 namespace axom
 {
 namespace mint
 {
-class Mesh;  // forward declaration
+class Mesh;       // forward declaration
+class FieldData;  // forward declaration
 
 namespace internal
 {
@@ -55,10 +58,14 @@ std::string make_face_key(int vcount, IndexType* values, char sep);
  * to 0.
  *
  * This routine visits each of the cells of the mesh.  For each cell face, it
- * retrieves the face's nodes and joins the sorted node IDs to make a unique
- * hash key.  The incident cells are recorded in a list for each face's hash
- * key.  The final face-cell and cell-face relations are constructed from this
- * data structure.
+ * packs the face's sorted node IDs into a fixed-width key.  The keys are
+ * radix sorted, so that the keys of a face shared by two cells become
+ * adjacent, and each run of equal keys is numbered as one face.  The
+ * face-cell, face-node and cell-face relations are written directly from the
+ * sorted keys.  Faces are numbered in the lexicographic order of their sorted
+ * node IDs, and the faces of each cell are listed in increasing order.  When
+ * Axom is built with OpenMP, the key construction, sort and output are done
+ * in parallel.
  *
  * This routine is intended to be used in constructing an UnstructuredMesh's
  * face relations, though it will give correct results for any Mesh.
@@ -73,6 +80,247 @@ bool initFaces(Mesh* m,
                IndexType*& f2noffsets,
                CellType*& f2ntypes);
 
+/*! \brief Transpose a relation from source entities to target entities,
+ *         such as cell-to-node, into a target-to-source relation.
+ *
+ * \param [in] nsources the number of source entities.
+ * \param [in] offsets the offset in values of the first target of each
+ *             source, of length nsources + 1, or nullptr if every source has
+ *             stride targets.
+ * \param [in] stride the number of targets of each source, ignored unless
+ *             offsets is nullptr.
+ * \param [in] values the targets of each source, each in [0, ntargets).
+ * \param [in] ntargets the number of target entities.
+ * \param [out] toffsets the offset in tvalues of the first source of each
+ *              target, of length ntargets + 1.
+ * \param [out] tvalues the sources of target t stored contiguously starting
+ *              at tvalues[toffsets[t]], in increasing order.
+ *
+ * \note The output arrays toffsets and tvalues are allocated in this routine.
+ * It is the caller's responsibility to free this memory.
+ *
+ * The transpose is a counting sort: the sources of each target are counted,
+ * the counts are scanned into offsets and each source is then written into
+ * the rows of its targets.  When Axom is built with OpenMP the count and
+ * fill are done in parallel with atomic updates, and each row is sorted
+ * afterwards so that the result does not depend on the thread schedule.
+ *
+ * \tparam IndexT the type of offsets and values, IndexType or axom::int32.
+ */
+template <typename IndexT>
+void transposeRelation(IndexType nsources,
+                       const IndexT* offsets,
+                       IndexType stride,
+                       const IndexT* values,
+                       IndexType ntargets,
+                       IndexType*& toffsets,
+                       IndexType*& tvalues)
+{
+  auto rowBegin = [=](IndexType s) {
+    return (offsets != nullptr) ? offsets[s] : s * stride;
+  };
+
+  // Step 1. Count the sources of each target, shifted by one so that the
+  // scan below leaves the offsets in place.
+  toffsets = new IndexType[ntargets + 1];
+  std::fill(toffsets, toffsets + ntargets + 1, 0);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(IndexType s = 0; s < nsources; ++s)
+  {
+    const IndexType end = rowBegin(s + 1);
+    for(IndexType i = rowBegin(s); i < end; ++i)
+    {
+#ifdef AXOM_USE_OPENMP
+  #pragma omp atomic
+#endif
+      ++toffsets[values[i] + 1];
+    }
+  }
+
+  // Step 2. Scan the counts into offsets.
+  for(IndexType t = 0; t < ntargets; ++t)
+  {
+    toffsets[t + 1] += toffsets[t];
+  }
+
+  // Step 3. Write each source into the rows of its targets.
+  std::vector<IndexType> cursor(toffsets, toffsets + ntargets);
+  tvalues = new IndexType[toffsets[ntargets]];
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(IndexType s = 0; s < nsources; ++s)
+  {
+    const IndexType end = rowBegin(s + 1);
+    for(IndexType i = rowBegin(s); i < end; ++i)
+    {
+      IndexType pos;
+#ifdef AXOM_USE_OPENMP
+  #pragma omp atomic capture
+#endif
+      pos = cursor[values[i]]++;
+      tvalues[pos] = s;
+    }
+  }
+
+#ifdef AXOM_USE_OPENMP
+  // Step 4. The parallel fill leaves each row in an arbitrary order, so
+  // restore increasing source order.  A serial fill is already sorted.
+  #pragma omp parallel for schedule(static)
+  for(IndexType t = 0; t < ntargets; ++t)
+  {
+    std::sort(tvalues + toffsets[t], tvalues + toffsets[t + 1]);
+  }
+#endif
+}
+
+/*! \brief Record the cells that share at least one node with each cell.
+ *
+ * \param [in] cellcount the number of cells.
+ * \param [in] c2noffsets the offset in c2n of the first node of each cell,
+ *             or nullptr if every cell has c2nstride nodes.
+ * \param [in] c2nstride the number of nodes of each cell, ignored unless
+ *             c2noffsets is nullptr.
+ * \param [in] c2n the nodes of each cell.
+ * \param [in] n2coffsets the offset in n2c of the first cell of each node.
+ * \param [in] n2c the cells of each node, as computed by transposeRelation().
+ * \param [out] c2coffsets the offset in c2c of the first neighbor of each
+ *              cell, of length cellcount + 1.
+ * \param [out] c2c the neighbors of cell c stored contiguously starting at
+ *              c2c[c2coffsets[c]], in increasing order.  A cell is not its
+ *              own neighbor.
+ *
+ * \note The output arrays c2coffsets and c2c are allocated in this routine.
+ * It is the caller's responsibility to free this memory.
+ *
+ * \tparam IndexT the type of c2noffsets and c2n, IndexType or axom::int32.
+ */
+template <typename IndexT>
+void initCellNeighbors(IndexType cellcount,
+                       const IndexT* c2noffsets,
+                       IndexType c2nstride,
+                       const IndexT* c2n,
+                       const IndexType* n2coffsets,
+                       const IndexType* n2c,
+                       IndexType*& c2coffsets,
+                       IndexType*& c2c)
+{
+  // Gathers the sorted, unique neighbors of cell c into cells.
+  auto gatherNeighbors = [=](IndexType c, std::vector<IndexType>& cells) {
+    const IndexType begin =
+      (c2noffsets != nullptr) ? c2noffsets[c] : c * c2nstride;
+    const IndexType end =
+      (c2noffsets != nullptr) ? c2noffsets[c + 1] : begin + c2nstride;
+
+    cells.clear();
+    for(IndexType i = begin; i < end; ++i)
+    {
+      const IndexType node = c2n[i];
+      cells.insert(cells.end(),
+                   n2c + n2coffsets[node],
+                   n2c + n2coffsets[node + 1]);
+    }
+    std::sort(cells.begin(), cells.end());
+    cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+
+    auto self = std::lower_bound(cells.begin(), cells.end(), c);
+    if(self != cells.end() && *self == c)
+    {
+      cells.erase(self);
+    }
+  };
+
+  // Step 1. Count the neighbors of each cell, then scan into offsets.
+  c2coffsets = new IndexType[cellcount + 1];
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel
+#endif
+  {
+    std::vector<IndexType> cells;
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp for schedule(static)
+#endif
+    for(IndexType c = 0; c < cellcount; ++c)
+    {
+      gatherNeighbors(c, cells);
+      c2coffsets[c] = static_cast<IndexType>(cells.size());
+    }
+  }
+
+  IndexType offset = 0;
+  for(IndexType c = 0; c < cellcount; ++c)
+  {
+    const IndexType count = c2coffsets[c];
+    c2coffsets[c] = offset;
+    offset += count;
+  }
+  c2coffsets[cellcount] = offset;
+
+  // Step 2. Gather the neighbors again, this time writing them out.
+  c2c = new IndexType[offset];
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel
+#endif
+  {
+    std::vector<IndexType> cells;
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp for schedule(static)
+#endif
+    for(IndexType c = 0; c < cellcount; ++c)
+    {
+      gatherNeighbors(c, cells);
+      std::copy(cells.begin(), cells.end(), c2c + c2coffsets[c]);
+    }
+  }
+}
+
+/*! \brief Reorder the tuples of an array in place.
+ *
+ * \param [in,out] data the array, of length n * ncomp.
+ * \param [in] n the number of tuples.
+ * \param [in] ncomp the number of components of each tuple.
+ * \param [in] order the old index of each new tuple, of length n.
+ *
+ * After the call, tuple i holds the values tuple order[i] held before.
+ */
+template <typename T>
+void permuteTuples(T* data,
+                   IndexType n,
+                   IndexType ncomp,
+                   const IndexType* order)
+{
+  T* old = new T[n * ncomp];
+  std::copy(data, data + n * ncomp, old);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(IndexType i = 0; i < n; ++i)
+  {
+    const T* src = old + order[i] * ncomp;
+    std::copy(src, src + ncomp, data + i * ncomp);
+  }
+
+  delete[] old;
+}
+
+/*! \brief Reorder the tuples of every field in a FieldData in place.
+ *
+ * \param [in,out] fd the FieldData, whose fields all have n tuples.
+ * \param [in] order the old index of each new tuple.
+ *
+ * \see permuteTuples()
+ */
+void permuteFields(FieldData* fd, const IndexType* order);
+
 } /* namespace internal */
 } /* namespace mint */
 } /* namespace axom */
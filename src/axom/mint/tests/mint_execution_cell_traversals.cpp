@@ -21,6 +21,14 @@
 // gtest includes
 #include "gtest/gtest.h"  // for gtest
 
+// C/C++ includes
+#include <algorithm>  // for std::copy
+#include <vector>     // for std::vector
+
+#ifdef AXOM_USE_OPENMP
+  #include <omp.h>  // for omp_get_thread_num()
+#endif
+
 namespace axom
 {
 namespace mint
@@ -343,6 +351,76 @@ void check_for_all_cell_faces(int dimension)
   test_mesh = nullptr;
 }
 
+//------------------------------------------------------------------------------
+template <typename ExecPolicy, Topology TOPO>
+void check_for_all_cell_nodes_int32(UnstructuredMesh<TOPO, int32>& test_mesh)
+{
+  const int dimension = test_mesh.getDimension();
+  SLIC_INFO("dimension=" << dimension
+                         << ", policy=" << execution_space<ExecPolicy>::name()
+                         << ", int32 connectivity");
+
+  const IndexType Ni = 20;
+  const IndexType Nj = (dimension >= 2) ? Ni : -1;
+  const IndexType Nk = (dimension == 3) ? Ni : -1;
+
+  const double lo[] = {-10, -10, -10};
+  const double hi[] = {10, 10, 10};
+  UniformMesh uniform_mesh(lo, hi, Ni, Nj, Nk);
+
+  Mesh* ref_mesh = internal::create_mesh<UNSTRUCTURED_MESH, TOPO>(uniform_mesh);
+
+  /* copy the reference mesh, narrowing its connectivity to int32 */
+  const IndexType numNodes = ref_mesh->getNumberOfNodes();
+  for(IndexType nodeID = 0; nodeID < numNodes; ++nodeID)
+  {
+    double pt[3];
+    ref_mesh->getNode(nodeID, pt);
+    test_mesh.appendNodes(pt);
+  }
+
+  const IndexType numCells = ref_mesh->getNumberOfCells();
+  IndexType cellNodes[MAX_CELL_NODES];
+  int32 narrowNodes[MAX_CELL_NODES];
+  for(IndexType cellID = 0; cellID < numCells; ++cellID)
+  {
+    const IndexType N = ref_mesh->getCellNodeIDs(cellID, cellNodes);
+    std::copy(cellNodes, cellNodes + N, narrowNodes);
+    test_mesh.appendCell(narrowNodes, ref_mesh->getCellType(cellID));
+  }
+
+  EXPECT_EQ(test_mesh.hasCompactConnectivity(),
+            sizeof(IndexType) > sizeof(int32));
+
+  IndexType* conn = test_mesh.template createField<IndexType>("conn",
+                                                              CELL_CENTERED,
+                                                              MAX_CELL_NODES);
+
+  /* traverse through the base class to exercise the runtime dispatch */
+  const Mesh* mesh = &test_mesh;
+  for_all_cells<ExecPolicy, xargs::nodeids>(
+    mesh,
+    AXOM_LAMBDA(IndexType cellID, const IndexType* nodes, IndexType N) {
+      for(int i = 0; i < N; ++i)
+      {
+        conn[cellID * MAX_CELL_NODES + i] = nodes[i];
+      }  // END for all cell nodes
+    });
+
+  for(IndexType cellID = 0; cellID < numCells; ++cellID)
+  {
+    const IndexType N = ref_mesh->getCellNodeIDs(cellID, cellNodes);
+    for(int i = 0; i < N; ++i)
+    {
+      EXPECT_EQ(conn[cellID * MAX_CELL_NODES + i], cellNodes[i]);
+    }
+  }  // END for all cells
+
+  /* clean up */
+  delete ref_mesh;
+  ref_mesh = nullptr;
+}
+
 } /* end anonymous namespace */
 
 //------------------------------------------------------------------------------
@@ -361,8 +439,7 @@ AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_nodeids)
     check_for_all_cell_nodes<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(i);
     check_for_all_cell_nodes<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(i);
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#ifdef AXOM_USE_OPENMP
 
     using omp_exec = axom::OMP_EXEC;
     check_for_all_cell_nodes<omp_exec, STRUCTURED_UNIFORM_MESH>(i);
@@ -406,8 +483,7 @@ AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_coords)
     check_for_all_cell_coords<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(i);
     check_for_all_cell_coords<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(i);
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#ifdef AXOM_USE_OPENMP
 
     using omp_exec = axom::OMP_EXEC;
     check_for_all_cell_coords<omp_exec, STRUCTURED_UNIFORM_MESH>(i);
@@ -451,8 +527,7 @@ AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_faceids)
     check_for_all_cell_faces<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(i);
     check_for_all_cell_faces<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(i);
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#ifdef AXOM_USE_OPENMP
 
     using omp_exec = axom::OMP_EXEC;
     check_for_all_cell_faces<omp_exec, STRUCTURED_UNIFORM_MESH>(i);
@@ -492,8 +567,7 @@ AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_ij)
   check_for_all_cells_ij<seq_exec, STRUCTURED_CURVILINEAR_MESH>();
   check_for_all_cells_ij<seq_exec, STRUCTURED_RECTILINEAR_MESH>();
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#ifdef AXOM_USE_OPENMP
 
   using omp_exec = axom::OMP_EXEC;
   check_for_all_cells_ij<omp_exec, STRUCTURED_UNIFORM_MESH>();
@@ -527,8 +601,7 @@ AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_ijk)
   check_for_all_cells_ijk<seq_exec, STRUCTURED_CURVILINEAR_MESH>();
   check_for_all_cells_ijk<seq_exec, STRUCTURED_RECTILINEAR_MESH>();
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#ifdef AXOM_USE_OPENMP
 
   using omp_exec = axom::OMP_EXEC;
   check_for_all_cells_ijk<omp_exec, STRUCTURED_UNIFORM_MESH>();
@@ -567,8 +640,7 @@ AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_index)
     check_for_all_cells_idx<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(i);
     check_for_all_cells_idx<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(i);
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#ifdef AXOM_USE_OPENMP
 
     using omp_exec = axom::OMP_EXEC;
     check_for_all_cells_idx<omp_exec, STRUCTURED_UNIFORM_MESH>(i);
@@ -600,6 +672,100 @@ AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_index)
   }  // END for all dimensions
 }
 
+//------------------------------------------------------------------------------
+TEST(mint_execution_cell_traversals, omp_tiled_loops)
+{
+  // extents that leave partial tiles along I and J
+  const IndexType Ni = internal::OMP_TILE_I + 3;
+  const IndexType Nj = 2 * internal::OMP_TILE_J + 5;
+  const IndexType Nk = 3;
+
+  std::vector<int> visits(Ni * Nj * Nk, 0);
+  int* v = visits.data();
+
+  internal::omp_tiled_loop2d(Ni, Nj, [=](IndexType i, IndexType j) {
+    v[i + j * Ni] += 1;
+  });
+
+  for(IndexType idx = 0; idx < Ni * Nj; ++idx)
+  {
+    EXPECT_EQ(visits[idx], 1);
+  }
+
+  internal::omp_tiled_loop3d(
+    Ni,
+    Nj,
+    Nk,
+    [=](IndexType i, IndexType j, IndexType k) {
+      v[i + j * Ni + k * Ni * Nj] += 1;
+    });
+
+  for(IndexType idx = 0; idx < Ni * Nj * Nk; ++idx)
+  {
+    EXPECT_EQ(visits[idx], (idx < Ni * Nj) ? 2 : 1);
+  }
+}
+
+//------------------------------------------------------------------------------
+#ifdef AXOM_USE_OPENMP
+TEST(mint_execution_cell_traversals, omp_tiled_loop3d_threads)
+{
+  // a single tile per I-J plane, so only blocks of K give threads work
+  constexpr int NTHREADS = 4;
+  const IndexType Ni = 128;
+  const IndexType Nj = internal::OMP_TILE_J;
+  const IndexType Nk = 37;
+
+  const int max_threads = omp_get_max_threads();
+  omp_set_num_threads(NTHREADS);
+
+  std::vector<int> visits(Ni * Nj * Nk, 0);
+  std::vector<IndexType> counts(NTHREADS, 0);
+  int* v = visits.data();
+  IndexType* c = counts.data();
+
+  internal::omp_tiled_loop3d(
+    Ni,
+    Nj,
+    Nk,
+    [=](IndexType i, IndexType j, IndexType k) {
+      v[i + j * Ni + k * Ni * Nj] += 1;
+      c[omp_get_thread_num()] += 1;
+    });
+
+  omp_set_num_threads(max_threads);
+
+  for(IndexType idx = 0; idx < Ni * Nj * Nk; ++idx)
+  {
+    EXPECT_EQ(visits[idx], 1);
+  }
+
+  // each thread sweeps at least one block of K
+  for(int t = 0; t < NTHREADS; ++t)
+  {
+    EXPECT_GE(counts[t], Ni * Nj);
+  }
+}
+#endif
+
+//------------------------------------------------------------------------------
+TEST(mint_execution_cell_traversals, for_all_cells_nodeids_int32)
+{
+  using seq_exec = axom::SEQ_EXEC;
+
+  UnstructuredMesh<SINGLE_SHAPE, int32> quad_mesh(2, QUAD);
+  check_for_all_cell_nodes_int32<seq_exec>(quad_mesh);
+
+  UnstructuredMesh<SINGLE_SHAPE, int32> hex_mesh(3, HEX);
+  check_for_all_cell_nodes_int32<seq_exec>(hex_mesh);
+
+  for(int dim = 2; dim <= 3; ++dim)
+  {
+    UnstructuredMesh<MIXED_SHAPE, int32> mixed_mesh(dim);
+    check_for_all_cell_nodes_int32<seq_exec>(mixed_mesh);
+  }
+}
+
 } /* namespace mint */
 } /* namespace axom */
 
@@ -20,6 +20,9 @@
 // gtest includes
 #include "gtest/gtest.h"  // for gtest
 
+// C/C++ includes
+#include <vector>  // for std::vector
+
 namespace axom
 {
 namespace mint
@@ -316,6 +319,95 @@ void check_for_all_nodes_x()
   axom::deallocate(x);
 }
 
+//------------------------------------------------------------------------------
+template <typename MeshType>
+void initialize_node_cells(MeshType* AXOM_NOT_USED(mesh))
+{ }
+
+//------------------------------------------------------------------------------
+template <Topology TOPO>
+void initialize_node_cells(UnstructuredMesh<TOPO>* mesh)
+{
+  mesh->initializeNodeCellConnectivity();
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecPolicy, int MeshType, int Topology = SINGLE_SHAPE>
+void check_for_all_nodes_cellids(int dimension)
+{
+  constexpr char* mesh_name = internal::mesh_type<MeshType, Topology>::name();
+  SLIC_INFO("dimension=" << dimension
+                         << ", policy=" << execution_space<ExecPolicy>::name()
+                         << ", mesh_type=" << mesh_name);
+
+  const IndexType Ni = 8;
+  const IndexType Nj = (dimension >= 2) ? 7 : -1;
+  const IndexType Nk = (dimension == 3) ? 6 : -1;
+
+  const double lo[] = {-10, -10, -10};
+  const double hi[] = {10, 10, 10};
+  UniformMesh uniform_mesh(lo, hi, Ni, Nj, Nk);
+
+  // STEP 0: create the test mesh
+  using MESH = typename internal::mesh_type<MeshType, Topology>::MeshType;
+  MESH* test_mesh =
+    dynamic_cast<MESH*>(internal::create_mesh<MeshType, Topology>(uniform_mesh));
+  EXPECT_TRUE(test_mesh != nullptr);
+  initialize_node_cells(test_mesh);
+
+  // STEP 1: record the number of cells, the sum of the cell IDs and whether
+  // the cell IDs are increasing for each node
+  const IndexType numNodes = test_mesh->getNumberOfNodes();
+  IndexType* count = axom::allocate<IndexType>(numNodes);
+  IndexType* sum = axom::allocate<IndexType>(numNodes);
+  IndexType* sorted = axom::allocate<IndexType>(numNodes);
+
+  for_all_nodes<ExecPolicy, xargs::cellids>(
+    test_mesh,
+    AXOM_LAMBDA(IndexType nodeID, const IndexType* cells, IndexType N) {
+      count[nodeID] = N;
+      sum[nodeID] = 0;
+      sorted[nodeID] = 1;
+      for(IndexType i = 0; i < N; ++i)
+      {
+        sum[nodeID] += cells[i];
+        if(i > 0 && cells[i - 1] >= cells[i])
+        {
+          sorted[nodeID] = 0;
+        }
+      }
+    });
+
+  // STEP 2: compute the expected values from the cell connectivity
+  std::vector<IndexType> expected_count(numNodes, 0);
+  std::vector<IndexType> expected_sum(numNodes, 0);
+  const IndexType numCells = test_mesh->getNumberOfCells();
+  for(IndexType icell = 0; icell < numCells; ++icell)
+  {
+    IndexType nodes[MAX_CELL_NODES];
+    const IndexType n = test_mesh->getCellNodeIDs(icell, nodes);
+    for(IndexType i = 0; i < n; ++i)
+    {
+      ++expected_count[nodes[i]];
+      expected_sum[nodes[i]] += icell;
+    }
+  }
+
+  for(IndexType inode = 0; inode < numNodes; ++inode)
+  {
+    EXPECT_EQ(count[inode], expected_count[inode]);
+    EXPECT_EQ(sum[inode], expected_sum[inode]);
+    EXPECT_EQ(sorted[inode], 1);
+  }
+
+  // STEP 3: clean up
+  delete test_mesh;
+  test_mesh = nullptr;
+  axom::deallocate(count);
+  axom::deallocate(sum);
+  axom::deallocate(sorted);
+}
+
 } /* end anonymous namespace */
 
 //------------------------------------------------------------------------------
@@ -332,8 +424,7 @@ AXOM_CUDA_TEST(mint_execution_node_traversals, for_all_nodes_xyz)
   check_for_all_nodes_xyz<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>();
   check_for_all_nodes_xyz<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>();
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#ifdef AXOM_USE_OPENMP
 
   using openmp_exec = axom::OMP_EXEC;
   check_for_all_nodes_xyz<openmp_exec, STRUCTURED_UNIFORM_MESH>();
@@ -376,8 +467,7 @@ AXOM_CUDA_TEST(mint_execution_node_traversals, for_all_nodes_xy)
   check_for_all_nodes_xy<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>();
   check_for_all_nodes_xy<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>();
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#ifdef AXOM_USE_OPENMP
 
   using openmp_exec = axom::OMP_EXEC;
   check_for_all_nodes_xy<openmp_exec, STRUCTURED_UNIFORM_MESH>();
@@ -420,8 +510,7 @@ AXOM_CUDA_TEST(mint_execution_node_traversals, for_all_nodes_x)
   check_for_all_nodes_x<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>();
   check_for_all_nodes_x<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>();
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#ifdef AXOM_USE_OPENMP
 
   using openmp_exec = axom::OMP_EXEC;
   check_for_all_nodes_x<openmp_exec, STRUCTURED_UNIFORM_MESH>();
@@ -461,8 +550,7 @@ AXOM_CUDA_TEST(mint_execution_node_traversals, for_all_nodes_ijk)
   check_for_all_nodes_ijk<seq_exec, STRUCTURED_CURVILINEAR_MESH>();
   check_for_all_nodes_ijk<seq_exec, STRUCTURED_RECTILINEAR_MESH>();
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#ifdef AXOM_USE_OPENMP
 
   using openmp_exec = axom::OMP_EXEC;
   check_for_all_nodes_ijk<openmp_exec, STRUCTURED_UNIFORM_MESH>();
@@ -496,8 +584,7 @@ AXOM_CUDA_TEST(mint_execution_node_traversals, for_all_nodes_ij)
   check_for_all_nodes_ij<seq_exec, STRUCTURED_CURVILINEAR_MESH>();
   check_for_all_nodes_ij<seq_exec, STRUCTURED_RECTILINEAR_MESH>();
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#ifdef AXOM_USE_OPENMP
 
   using openmp_exec = axom::OMP_EXEC;
   check_for_all_nodes_ij<openmp_exec, STRUCTURED_UNIFORM_MESH>();
@@ -523,6 +610,53 @@ AXOM_CUDA_TEST(mint_execution_node_traversals, for_all_nodes_ij)
 #endif
 }
 
+//------------------------------------------------------------------------------
+AXOM_CUDA_TEST(mint_execution_node_traversals, for_all_nodes_cellids)
+{
+  constexpr int NDIMS = 3;
+  for(int i = 1; i <= NDIMS; ++i)
+  {
+    using seq_exec = axom::SEQ_EXEC;
+    check_for_all_nodes_cellids<seq_exec, STRUCTURED_UNIFORM_MESH>(i);
+    check_for_all_nodes_cellids<seq_exec, STRUCTURED_CURVILINEAR_MESH>(i);
+    check_for_all_nodes_cellids<seq_exec, STRUCTURED_RECTILINEAR_MESH>(i);
+    check_for_all_nodes_cellids<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(i);
+    check_for_all_nodes_cellids<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(i);
+
+#ifdef AXOM_USE_OPENMP
+
+    using omp_exec = axom::OMP_EXEC;
+    check_for_all_nodes_cellids<omp_exec, STRUCTURED_UNIFORM_MESH>(i);
+    check_for_all_nodes_cellids<omp_exec, STRUCTURED_CURVILINEAR_MESH>(i);
+    check_for_all_nodes_cellids<omp_exec, STRUCTURED_RECTILINEAR_MESH>(i);
+    check_for_all_nodes_cellids<omp_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(i);
+    check_for_all_nodes_cellids<omp_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(i);
+
+#endif
+
+  }  // END for all dimensions
+}
+
+//------------------------------------------------------------------------------
+TEST(mint_execution_node_traversals_DeathTest, cellids_without_node_cells)
+{
+  const char* IGNORE_OUTPUT = ".*";
+  const double lo[] = {-10, -10};
+  const double hi[] = {10, 10};
+  UniformMesh uniform_mesh(lo, hi, 5, 5);
+
+  Mesh* test_mesh =
+    internal::create_mesh<UNSTRUCTURED_MESH, SINGLE_SHAPE>(uniform_mesh);
+  auto traverse_cellids = [=]() {
+    for_all_nodes<axom::SEQ_EXEC, xargs::cellids>(
+      test_mesh,
+      [](IndexType, const IndexType*, IndexType) {});
+  };
+  EXPECT_DEATH_IF_SUPPORTED(traverse_cellids(), IGNORE_OUTPUT);
+
+  delete test_mesh;
+}
+
 //------------------------------------------------------------------------------
 AXOM_CUDA_TEST(mint_execution_node_traversals, for_all_nodes_index)
 {
@@ -537,8 +671,7 @@ AXOM_CUDA_TEST(mint_execution_node_traversals, for_all_nodes_index)
     check_for_all_nodes_idx<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(i);
     check_for_all_nodes_idx<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(i);
 
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
-  defined(RAJA_ENABLE_OPENMP)
+#ifdef AXOM_USE_OPENMP
 
     using omp_exec = axom::OMP_EXEC;
     check_for_all_nodes_idx<omp_exec, STRUCTURED_UNIFORM_MESH>(i);
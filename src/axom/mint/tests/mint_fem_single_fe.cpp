@@ -20,6 +20,7 @@
 #include "axom/mint/mesh/FieldData.hpp"
 #include "axom/mint/mesh/FieldVariable.hpp"
 #include "axom/mint/fem/FiniteElement.hpp"
+#include "axom/mint/fem/FiniteElementT.hpp"
 #include "axom/mint/fem/shape_functions/Lagrange.hpp"
 #include "axom/mint/mesh/Mesh.hpp"
 #include "axom/mint/fem/shape_functions/ShapeFunction.hpp"
@@ -30,7 +31,8 @@
 #include "axom/slic/interface/slic.hpp"
 
 // C/C++ includes
-#include <cmath>  // for sin(), cos(), sqrt(), etc.
+#include <cmath>   // for sin(), cos(), sqrt(), etc.
+#include <vector>  // for std::vector
 
 //#define MINT_FEM_DEBUG
 
@@ -807,6 +809,193 @@ void check_interp(double TOL = 1.e-9)
   delete[] wgts;
 }
 
+/*!
+ * \brief Checks that the fixed-size FiniteElementT agrees with the dynamic
+ *  FiniteElement for the forward map, the jacobian and the inverse map at a
+ *  lattice of points inside and outside of the element.
+ *
+ * \param [in] TOL optional user-supplied tolerance. Default is 1.e-9.
+ *
+ * \tparam BasisType basis bound to the FiniteElemen, e.g., MINT_LAGRANGE_BASIS
+ * \tparam CELLTYPE the corresponding cell type, e.g., MINT_QUAD
+ */
+template <int BasisType, mint::CellType CELLTYPE>
+void check_fixed_size_fe(double TOL = 1.e-9)
+{
+  using FixedFEType = mint::FiniteElementT<CELLTYPE, BasisType>;
+  constexpr int NDIMS = FixedFEType::NDIMS;
+  constexpr int NUM_DOFS = FixedFEType::NUM_DOFS;
+
+  SLIC_INFO("checking " << mint::basis_name[BasisType] << " / "
+                        << mint::getCellInfo(CELLTYPE).name);
+
+  // STEP 0: construct the dynamic and the fixed-size finite elements
+  mint::FiniteElement* fe = nullptr;
+  get_single_fe<BasisType, CELLTYPE>(fe);
+  EXPECT_TRUE(fe != nullptr);
+
+  FixedFEType fixed_fe(fe->getPhysicalNodes());
+  EXPECT_EQ(fixed_fe.getCellType(), fe->getCellType());
+  EXPECT_EQ(fixed_fe.getBasisType(), fe->getBasisType());
+  EXPECT_EQ(fixed_fe.getNumDofs(), fe->getNumDofs());
+  EXPECT_EQ(fixed_fe.getReferenceDimension(), fe->getReferenceDimension());
+  EXPECT_EQ(fixed_fe.getMaxSolverIterations(), fe->getMaxSolverIterations());
+
+  // STEP 1: generate a lattice of reference points around the element,
+  // staying below the apex of the pyramid where the jacobian is singular
+  const double samples[] = {-0.2, 0.1, 0.45, 0.8, 1.2};
+  const int NSAMPLES = sizeof(samples) / sizeof(double);
+
+  std::vector<double> xr;
+  for(int k = 0; k < ((NDIMS == 3) ? NSAMPLES : 1); ++k)
+  {
+    if(CELLTYPE == mint::PYRAMID && samples[k] > 0.9)
+    {
+      continue;
+    }
+
+    for(int j = 0; j < NSAMPLES; ++j)
+    {
+      for(int i = 0; i < NSAMPLES; ++i)
+      {
+        xr.push_back(samples[i]);
+        xr.push_back(samples[j]);
+        if(NDIMS == 3)
+        {
+          xr.push_back(samples[k]);
+        }
+      }
+    }
+  }
+  const IndexType npts = static_cast<IndexType>(xr.size()) / NDIMS;
+
+  // STEP 2: check the forward map and the jacobian
+  std::vector<double> xp(xr.size());
+  fixed_fe.computePhysicalCoords(npts, xr.data(), xp.data());
+
+  numerics::Matrix<double> J(NDIMS, NDIMS);
+  double fixed_J[NDIMS * NDIMS];
+  double expected_xp[NDIMS];
+  for(IndexType ipt = 0; ipt < npts; ++ipt)
+  {
+    fe->computePhysicalCoords(&xr[ipt * NDIMS], expected_xp);
+    fe->jacobian(&xr[ipt * NDIMS], J);
+    fixed_fe.jacobian(&xr[ipt * NDIMS], fixed_J);
+
+    for(int i = 0; i < NDIMS; ++i)
+    {
+      EXPECT_NEAR(expected_xp[i], xp[ipt * NDIMS + i], TOL);
+      for(int j = 0; j < NDIMS; ++j)
+      {
+        EXPECT_NEAR(J(i, j), fixed_J[j * NDIMS + i], TOL);
+      }
+    }
+  }
+
+  // STEP 3: check the batched inverse map against the dynamic inverse map
+  std::vector<double> fixed_xr(xr.size());
+  std::vector<int> status(npts);
+  const IndexType numInside = fixed_fe.computeReferenceCoords(npts,
+                                                              xp.data(),
+                                                              fixed_xr.data(),
+                                                              status.data());
+
+  IndexType expectedInside = 0;
+  double expected_xr[NDIMS];
+  for(IndexType ipt = 0; ipt < npts; ++ipt)
+  {
+    const int rc = fe->computeReferenceCoords(&xp[ipt * NDIMS], expected_xr);
+    EXPECT_EQ(rc, status[ipt]);
+    expectedInside += (rc == mint::INSIDE_ELEMENT) ? 1 : 0;
+
+    if(rc == mint::INVERSE_MAP_FAILED)
+    {
+      continue;
+    }
+
+    for(int i = 0; i < NDIMS; ++i)
+    {
+      EXPECT_NEAR(expected_xr[i], fixed_xr[ipt * NDIMS + i], TOL);
+    }
+  }
+
+  EXPECT_EQ(expectedInside, numInside);
+  EXPECT_GT(numInside, 0);
+  EXPECT_LT(numInside, npts);
+
+  // STEP 4: check the batched shape functions at the reference points
+  std::vector<double> phi(npts * NUM_DOFS);
+  FixedFEType::evaluateShapeFunctions(npts, fixed_xr.data(), phi.data());
+
+  double expected_phi[NUM_DOFS];
+  for(IndexType ipt = 0; ipt < npts; ++ipt)
+  {
+    fe->evaluateShapeFunctions(&fixed_xr[ipt * NDIMS], expected_phi);
+    for(int i = 0; i < NUM_DOFS; ++i)
+    {
+      EXPECT_NEAR(expected_phi[i], phi[ipt * NUM_DOFS + i], TOL);
+    }
+  }
+
+  // STEP 5: clean up
+  delete fe;
+}
+
+/*!
+ * \brief Checks that the fixed-size FiniteElementT inverts the map of a
+ *  small element, whose jacobian has a tiny determinant, like the dynamic
+ *  FiniteElement.
+ *
+ * \param [in] h the size of the element.
+ *
+ * \tparam BasisType basis bound to the FiniteElemen, e.g., MINT_LAGRANGE_BASIS
+ * \tparam CELLTYPE the corresponding cell type, e.g., MINT_QUAD
+ */
+template <int BasisType, mint::CellType CELLTYPE>
+void check_small_fixed_size_fe(double h)
+{
+  using FixedFEType = mint::FiniteElementT<CELLTYPE, BasisType>;
+  using ShapeFunctionType = typename FixedFEType::ShapeFunctionType;
+  constexpr int NDIMS = FixedFEType::NDIMS;
+  constexpr int NUM_DOFS = FixedFEType::NUM_DOFS;
+
+  SLIC_INFO("checking " << mint::getCellInfo(CELLTYPE).name
+                        << " of size " << h);
+
+  // STEP 0: construct the reference element scaled by h
+  double nodes[NUM_DOFS * NDIMS];
+  ShapeFunctionType::coords(nodes);
+  for(int i = 0; i < NUM_DOFS * NDIMS; ++i)
+  {
+    nodes[i] *= h;
+  }
+
+  numerics::Matrix<double> m(NDIMS, NUM_DOFS, nodes, true);
+  mint::FiniteElement fe(m, CELLTYPE);
+  mint::bind_basis<BasisType, CELLTYPE>(fe);
+
+  FixedFEType fixed_fe(nodes);
+
+  // STEP 1: invert the map at the center of the element
+  double center[NDIMS];
+  ShapeFunctionType::center(center);
+
+  double xp[NDIMS];
+  fe.computePhysicalCoords(center, xp);
+
+  double expected_xr[NDIMS];
+  double xr[NDIMS];
+  const int rc = fe.computeReferenceCoords(xp, expected_xr);
+  EXPECT_EQ(rc, mint::INSIDE_ELEMENT);
+  EXPECT_EQ(fixed_fe.computeReferenceCoords(xp, xr), rc);
+
+  for(int i = 0; i < NDIMS; ++i)
+  {
+    EXPECT_NEAR(center[i], xr[i], 1.e-9);
+    EXPECT_NEAR(expected_xr[i], xr[i], 1.e-9);
+  }
+}
+
 } /* end anonymous namespace */
 
 //------------------------------------------------------------------------------
@@ -999,6 +1188,28 @@ TEST(mint_fem_single_fe, check_fe_interp)
   check_interp<MINT_LAGRANGE_BASIS, mint::HEX27>(1.e-24);
 }
 
+//------------------------------------------------------------------------------
+TEST(mint_fem_single_fe, check_fixed_size_fe)
+{
+  check_fixed_size_fe<MINT_LAGRANGE_BASIS, mint::QUAD>();
+  check_fixed_size_fe<MINT_LAGRANGE_BASIS, mint::TRIANGLE>();
+  check_fixed_size_fe<MINT_LAGRANGE_BASIS, mint::TET>();
+  check_fixed_size_fe<MINT_LAGRANGE_BASIS, mint::HEX>();
+  check_fixed_size_fe<MINT_LAGRANGE_BASIS, mint::PRISM>();
+  check_fixed_size_fe<MINT_LAGRANGE_BASIS, mint::PYRAMID>();
+
+  check_fixed_size_fe<MINT_LAGRANGE_BASIS, mint::QUAD9>();
+  check_fixed_size_fe<MINT_LAGRANGE_BASIS, mint::HEX27>();
+}
+
+//------------------------------------------------------------------------------
+TEST(mint_fem_single_fe, check_small_fixed_size_fe)
+{
+  check_small_fixed_size_fe<MINT_LAGRANGE_BASIS, mint::HEX>(1.e-3);
+  check_small_fixed_size_fe<MINT_LAGRANGE_BASIS, mint::TET>(1.e-3);
+  check_small_fixed_size_fe<MINT_LAGRANGE_BASIS, mint::HEX27>(1.e-3);
+}
+
 //------------------------------------------------------------------------------
 #include "axom/slic/core/SimpleLogger.hpp"
 using axom::slic::SimpleLogger;
@@ -5,8 +5,9 @@
 #include "axom/mint/mesh/blueprint.hpp"
 
 // Mint includes
-#include "axom/mint/config.hpp"          // for compile-time definitions
-#include "axom/mint/mesh/MeshTypes.hpp"  // for MeshTypes enum
+#include "axom/mint/config.hpp"                 // for compile-time definitions
+#include "axom/mint/mesh/MeshTypes.hpp"         // for MeshTypes enum
+#include "axom/mint/mesh/UnstructuredMesh.hpp"  // for UnstructuredMesh
 
 // gtest includes
 #include "gtest/gtest.h"
@@ -366,6 +367,50 @@ TEST(mint_mesh_blueprint, get_set_uniform_mesh)
   }
 }
 
+//------------------------------------------------------------------------------
+TEST(mint_mesh_blueprint, has_compact_connectivity)
+{
+  const bool compact = sizeof(axom::IndexType) > sizeof(mint::int32);
+  const mint::int32 tri[] = {0, 1, 2};
+
+  sidre::DataStore ds;
+  sidre::Group* root = ds.getRoot();
+  sidre::Group* compact_group = root->createGroup("compact");
+  sidre::Group* wide_group = root->createGroup("wide");
+
+  {
+    using CompactMesh = mint::UnstructuredMesh<mint::SINGLE_SHAPE, mint::int32>;
+    CompactMesh mesh(2, mint::TRIANGLE, compact_group);
+    mesh.appendNode(0.0, 0.0);
+    mesh.appendNode(1.0, 0.0);
+    mesh.appendNode(0.0, 1.0);
+    mesh.appendCell(tri);
+    EXPECT_EQ(mesh.hasCompactConnectivity(), compact);
+
+    mint::UnstructuredMesh<mint::SINGLE_SHAPE> wide_mesh(2,
+                                                         mint::TRIANGLE,
+                                                         wide_group);
+    EXPECT_FALSE(wide_mesh.hasCompactConnectivity());
+  }
+
+  EXPECT_EQ(mint::blueprint::hasCompactConnectivity(compact_group), compact);
+  EXPECT_FALSE(mint::blueprint::hasCompactConnectivity(wide_group));
+
+  // restore the mesh from sidre, the storage type is detected from the group
+  mint::Mesh* mesh = mint::getMesh(compact_group);
+  EXPECT_EQ(mesh->hasCompactConnectivity(), compact);
+  EXPECT_EQ(mesh->getNumberOfCells(), 1);
+
+  axom::IndexType nodes[3];
+  EXPECT_EQ(mesh->getCellNodeIDs(0, nodes), 3);
+  for(int i = 0; i < 3; ++i)
+  {
+    EXPECT_EQ(nodes[i], tri[i]);
+  }
+
+  delete mesh;
+}
+
 #endif /* AXOM_MINT_USE_SIDRE */
 
 //------------------------------------------------------------------------------
@@ -2062,6 +2062,103 @@ TEST(mint_connectivity_array_DeathTest, IndirectionSidreCapacity)
 #endif /* AXOM_MINT_USE_SIDRE */
 }
 
+//------------------------------------------------------------------------------
+TEST(mint_connectivity_array, NoIndirectionInt32)
+{
+  const int32 hex0[] = {0, 1, 2, 3, 4, 5, 6, 7};
+  const int32 hex1[] = {8, 9, 10, 11, 12, 13, 14, 15};
+  const int32 hex2[] = {16, 17, 18, 19, 20, 21, 22, 23};
+
+  ConnectivityArray<NO_INDIRECTION, int32> native_hex(HEX);
+  native_hex.append(hex0);
+  native_hex.append(hex2);
+  native_hex.insert(hex1, 1);
+  EXPECT_EQ(native_hex.getNumberOfIDs(), 3);
+  EXPECT_EQ(native_hex.getNumberOfValues(), 3 * hex_stride);
+
+  const int32* values = native_hex.getValuePtr();
+  for(IndexType i = 0; i < 3 * hex_stride; ++i)
+  {
+    EXPECT_EQ(values[i], i);
+  }
+
+  native_hex.set(hex0, 2);
+  EXPECT_TRUE(std::equal(hex0, hex0 + hex_stride, native_hex[2]));
+
+  /* Wrap the same values in an external ConnectivityArray. */
+  int32 buffer[3 * hex_stride];
+  std::copy(values, values + 3 * hex_stride, buffer);
+  ConnectivityArray<NO_INDIRECTION, int32> external_hex(HEX, 3, buffer);
+  EXPECT_TRUE(external_hex.isExternal());
+  EXPECT_EQ(external_hex.getNumberOfIDs(), 3);
+  EXPECT_EQ(external_hex[1], buffer + hex_stride);
+  EXPECT_EQ(external_hex[1][0], 8);
+}
+
+//------------------------------------------------------------------------------
+TEST(mint_connectivity_array, IndirectionInt32)
+{
+  const int32 values[] = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+  const int32 offsets[] = {0, 3, 7, 9};
+
+  ConnectivityArray<INDIRECTION, int32> native_vertex(VERTEX);
+  native_vertex.appendM(values, 2, offsets);
+  native_vertex.insert(values + 7, 1, 2);
+  EXPECT_EQ(native_vertex.getNumberOfIDs(), 3);
+  EXPECT_EQ(native_vertex.getNumberOfValues(), 9);
+  EXPECT_EQ(native_vertex.getNumberOfValuesForID(1), 2);
+  EXPECT_EQ(native_vertex[1][0], 7);
+  EXPECT_EQ(native_vertex[2][0], 3);
+
+  const int32* native_offsets = native_vertex.getOffsetPtr();
+  EXPECT_EQ(native_offsets[0], 0);
+  EXPECT_EQ(native_offsets[1], 3);
+  EXPECT_EQ(native_offsets[2], 5);
+  EXPECT_EQ(native_offsets[3], 9);
+
+  native_vertex.set(values + 4, 2);
+  EXPECT_EQ(native_vertex[2][0], 4);
+}
+
+//------------------------------------------------------------------------------
+TEST(mint_connectivity_array, TypedIndirectionInt32)
+{
+  const int32 quad[] = {0, 1, 2, 3};
+  const int32 tri[] = {4, 5, 6};
+
+  ConnectivityArray<TYPED_INDIRECTION, int32> native_mixed;
+  native_mixed.append(quad, 4, QUAD);
+  native_mixed.append(tri, 3, TRIANGLE);
+  native_mixed.insert(tri, 0, 3, TRIANGLE);
+  EXPECT_EQ(native_mixed.getNumberOfIDs(), 3);
+  EXPECT_EQ(native_mixed.getNumberOfValues(), 10);
+  EXPECT_EQ(native_mixed.getIDType(0), TRIANGLE);
+  EXPECT_EQ(native_mixed.getIDType(1), QUAD);
+  EXPECT_EQ(native_mixed.getNumberOfValuesForID(1), 4);
+  EXPECT_TRUE(std::equal(quad, quad + 4, native_mixed[1]));
+  EXPECT_EQ(native_mixed.getOffsetPtr()[3], 10);
+
+#ifdef AXOM_MINT_USE_SIDRE
+  sidre::DataStore ds;
+  sidre::Group* group = ds.getRoot()->createGroup("mixed");
+  {
+    ConnectivityArray<TYPED_INDIRECTION, int32> sidre_mixed(group, "test");
+    sidre_mixed.appendM(native_mixed.getValuePtr(),
+                        3,
+                        native_mixed.getOffsetPtr(),
+                        native_mixed.getTypePtr());
+  }
+
+  sidre::View* connec_view = group->getView("elements/connectivity");
+  EXPECT_EQ(connec_view->getTypeID(), sidre::INT32_ID);
+
+  ConnectivityArray<TYPED_INDIRECTION, int32> restored(group);
+  EXPECT_EQ(restored.getNumberOfIDs(), 3);
+  EXPECT_EQ(restored.getIDType(1), QUAD);
+  EXPECT_TRUE(std::equal(quad, quad + 4, restored[1]));
+#endif /* AXOM_MINT_USE_SIDRE */
+}
+
 } /* end namespace mint */
 } /* end namespace axom */
 
@@ -13,6 +13,7 @@
 
 #include "gtest/gtest.h" /* for TEST and EXPECT_* macros */
 
+#include <algorithm>
 #include <string>
 #include <sstream>
 #include <vector>
@@ -1439,6 +1440,89 @@ TEST(mint_mesh_face_relation, correct_construction)
   }
 }
 
+//------------------------------------------------------------------------------
+/*
+ * Builds the faces of a block of hexahedra, large enough that faces are
+ * found by sorting many keys, and checks the counts and the consistency of
+ * the face-cell and cell-face relations.
+ */
+TEST(mint_mesh_face_relation, hex_block)
+{
+  using namespace axom::mint;
+
+  constexpr int N = 6;
+  constexpr IndexType NP = N + 1;
+  UnstructuredMesh<SINGLE_SHAPE> mesh(3, HEX, NP * NP * NP, N * N * N);
+
+  for(int k = 0; k < NP; ++k)
+  {
+    for(int j = 0; j < NP; ++j)
+    {
+      for(int i = 0; i < NP; ++i)
+      {
+        mesh.appendNode(i, j, k);
+      }
+    }
+  }
+
+  auto node = [=](IndexType i, IndexType j, IndexType k) {
+    return i + NP * (j + NP * k);
+  };
+  for(int k = 0; k < N; ++k)
+  {
+    for(int j = 0; j < N; ++j)
+    {
+      for(int i = 0; i < N; ++i)
+      {
+        IndexType cell[8] = {node(i, j, k),
+                             node(i + 1, j, k),
+                             node(i + 1, j + 1, k),
+                             node(i, j + 1, k),
+                             node(i, j, k + 1),
+                             node(i + 1, j, k + 1),
+                             node(i + 1, j + 1, k + 1),
+                             node(i, j + 1, k + 1)};
+        mesh.appendCell(cell);
+      }
+    }
+  }
+
+  ASSERT_TRUE(mesh.initializeFaceConnectivity());
+  EXPECT_EQ(mesh.getNumberOfFaces(), 3 * N * N * (N + 1));
+
+  int boundaryFaces = 0;
+  for(IndexType f = 0; f < mesh.getNumberOfFaces(); ++f)
+  {
+    EXPECT_EQ(mesh.getFaceType(f), QUAD);
+
+    IndexType c1, c2;
+    mesh.getFaceCellIDs(f, c1, c2);
+    ASSERT_GE(c1, 0);
+    EXPECT_NE(c1, c2);
+    boundaryFaces += (c2 == -1) ? 1 : 0;
+
+    // Each incident cell lists the face, with the other cell as neighbor
+    for(IndexType c : {c1, c2})
+    {
+      if(c == -1)
+      {
+        continue;
+      }
+      const IndexType* faces = mesh.getCellFaceIDs(c);
+      const IndexType* end = faces + mesh.getNumberOfCellFaces(c);
+      EXPECT_NE(std::find(faces, end, f), end);
+    }
+  }
+  EXPECT_EQ(boundaryFaces, 6 * N * N);
+
+  for(IndexType c = 0; c < mesh.getNumberOfCells(); ++c)
+  {
+    ASSERT_EQ(mesh.getNumberOfCellFaces(c), 6);
+    const IndexType* faces = mesh.getCellFaceIDs(c);
+    EXPECT_TRUE(std::is_sorted(faces, faces + 6));
+  }
+}
+
 //------------------------------------------------------------------------------
 #include "axom/slic/core/SimpleLogger.hpp"
 using axom::slic::SimpleLogger;
@@ -322,6 +322,12 @@ TEST(mint_mesh_field_data_DeathTest, invalid_operations)
 
   // remove field that does not exist should fail
   EXPECT_DEATH_IF_SUPPORTED(field_data.removeField("foo"), IGNORE_OUTPUT);
+
+  // getting a handle of the wrong type or to a missing field should fail
+  EXPECT_DEATH_IF_SUPPORTED(field_data.getFieldHandle<double>("test"),
+                            IGNORE_OUTPUT);
+  EXPECT_DEATH_IF_SUPPORTED(field_data.getFieldHandle<int>("foo"),
+                            IGNORE_OUTPUT);
 }
 
 //------------------------------------------------------------------------------
@@ -600,6 +606,51 @@ TEST(mint_mesh_field_data, remove_field)
 #endif
 }
 
+//------------------------------------------------------------------------------
+TEST(mint_mesh_field_data, field_index_and_handle)
+{
+  constexpr int NUM_TUPLES = 4;
+
+  mint::FieldData field_data(mint::NODE_CENTERED);
+  field_data.createField<double>("a", NUM_TUPLES);
+  field_data.createField<int>("b", NUM_TUPLES, 2);
+  field_data.createField<double>("c", NUM_TUPLES);
+
+  EXPECT_EQ(field_data.getFieldIndex("a"), 0);
+  EXPECT_EQ(field_data.getFieldIndex("b"), 1);
+  EXPECT_EQ(field_data.getFieldIndex("c"), 2);
+  EXPECT_EQ(field_data.getFieldIndex("foo"), -1);
+
+  mint::FieldHandle<int> hb = field_data.getFieldHandle<int>("b");
+  mint::FieldHandle<double> hc = field_data.getFieldHandle<double>("c");
+  EXPECT_TRUE(hb.isValid());
+  EXPECT_EQ(hb.getName(), "b");
+  EXPECT_EQ(hb.getNumTuples(), NUM_TUPLES);
+  EXPECT_EQ(hb.getNumComponents(), 2);
+  EXPECT_EQ(hb.getData(), field_data.getFieldPtr<int>("b"));
+  EXPECT_FALSE(mint::FieldHandle<double>().isValid());
+
+  // removing a field shifts the indices of the fields after it, but the
+  // handles remain valid
+  field_data.removeField("a");
+  EXPECT_EQ(field_data.getFieldIndex("a"), -1);
+  EXPECT_EQ(field_data.getFieldIndex("b"), 0);
+  EXPECT_EQ(field_data.getFieldIndex("c"), 1);
+  EXPECT_EQ(field_data.getField(1)->getName(), "c");
+  EXPECT_EQ(hc.getData(), field_data.getFieldPtr<double>("c"));
+
+  // the handles follow the buffers of the fields when they are resized
+  field_data.resize(100 * NUM_TUPLES);
+  EXPECT_EQ(hb.getNumTuples(), 100 * NUM_TUPLES);
+  EXPECT_EQ(hb.getData(), field_data.getFieldPtr<int>("b"));
+  EXPECT_EQ(hc.getData(), field_data.getFieldPtr<double>("c"));
+
+  // a removed field can be added back at the end
+  field_data.createField<double>("a", 100 * NUM_TUPLES);
+  EXPECT_EQ(field_data.getFieldIndex("a"), 2);
+  EXPECT_EQ(field_data.getNumFields(), 3);
+}
+
 //------------------------------------------------------------------------------
 TEST(mint_mesh_field_data, resize)
 {
@@ -0,0 +1,246 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+#include "axom/mint/config.hpp"  // for compile-time type definitions
+
+#include "axom/mint/mesh/ParticleMesh.hpp"          // for ParticleMesh
+#include "axom/mint/mesh/ParticleNeighborList.hpp"  // for ParticleNeighborList
+
+#include "axom/slic/interface/slic.hpp"  // for slic macros
+
+#include "gtest/gtest.h"  // for gtest macros
+
+// C/C++ includes
+#include <algorithm>  // for std::sort
+#include <random>     // for std::mt19937
+#include <vector>     // for std::vector
+
+// namespace aliases
+namespace mint = axom::mint;
+using axom::IndexType;
+
+namespace
+{
+//------------------------------------------------------------------------------
+//  HELPER METHODS
+//------------------------------------------------------------------------------
+void fill_random(mint::ParticleMesh& particles, double lo, double hi)
+{
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(lo, hi);
+
+  const IndexType numParticles = particles.getNumberOfNodes();
+  for(int d = 0; d < particles.getDimension(); ++d)
+  {
+    double* x = particles.getCoordinateArray(d);
+    for(IndexType i = 0; i < numParticles; ++i)
+    {
+      x[i] = dist(gen);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+std::vector<IndexType> brute_force_neighbors(
+  const mint::ParticleMesh& particles,
+  IndexType i,
+  double radius)
+{
+  std::vector<IndexType> neighbors;
+
+  double xi[3];
+  double xj[3];
+  particles.getNode(i, xi);
+
+  const IndexType numParticles = particles.getNumberOfNodes();
+  for(IndexType j = 0; j < numParticles; ++j)
+  {
+    particles.getNode(j, xj);
+
+    double d2 = 0.0;
+    for(int d = 0; d < particles.getDimension(); ++d)
+    {
+      d2 += (xj[d] - xi[d]) * (xj[d] - xi[d]);
+    }
+
+    if(j != i && d2 <= radius * radius)
+    {
+      neighbors.push_back(j);
+    }
+  }
+
+  return neighbors;
+}
+
+//------------------------------------------------------------------------------
+void check_neighbors(const mint::ParticleMesh& particles,
+                     const mint::ParticleNeighborList& neighbors)
+{
+  const IndexType numParticles = particles.getNumberOfNodes();
+  const double radius = neighbors.getCutoff() + neighbors.getSkin();
+
+  EXPECT_FALSE(neighbors.empty());
+  EXPECT_EQ(neighbors.getNumberOfParticles(), numParticles);
+
+  const IndexType* offsets = neighbors.getOffsetsArray();
+  EXPECT_EQ(offsets[0], 0);
+  EXPECT_EQ(offsets[numParticles], neighbors.getTotalNumberOfNeighbors());
+
+  for(IndexType i = 0; i < numParticles; ++i)
+  {
+    const IndexType* nbrs = neighbors.getNeighbors(i);
+    const IndexType N = neighbors.getNumberOfNeighbors(i);
+    std::vector<IndexType> actual(nbrs, nbrs + N);
+    std::sort(actual.begin(), actual.end());
+
+    EXPECT_EQ(actual, brute_force_neighbors(particles, i, radius));
+  }
+}
+
+} /* end anonymous namespace */
+
+//------------------------------------------------------------------------------
+//  UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(mint_particle_neighbor_list, build)
+{
+  constexpr IndexType NUM_PARTICLES = 500;
+  constexpr double CUTOFF = 0.15;
+
+  for(int dim = 1; dim <= 3; ++dim)
+  {
+    mint::ParticleMesh particles(dim, NUM_PARTICLES);
+    fill_random(particles, -1.0, 1.0);
+
+    mint::ParticleNeighborList neighbors(CUTOFF);
+    EXPECT_TRUE(neighbors.empty());
+    EXPECT_TRUE(neighbors.needsRebuild(&particles));
+
+    neighbors.build(&particles);
+    EXPECT_EQ(neighbors.getNumberOfBuilds(), 1);
+    EXPECT_TRUE(neighbors.getParticleOrder().empty());
+    check_neighbors(particles, neighbors);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(mint_particle_neighbor_list, sparse_particles)
+{
+  // particles far apart compared to the cutoff, exercises the bin limit
+  constexpr IndexType NUM_PARTICLES = 50;
+  constexpr double CUTOFF = 1.e-3;
+
+  mint::ParticleMesh particles(3, NUM_PARTICLES);
+  fill_random(particles, -1.e3, 1.e3);
+
+  // place particle 1 right next to particle 0
+  for(int d = 0; d < 3; ++d)
+  {
+    double* x = particles.getCoordinateArray(d);
+    x[1] = x[0] + 0.25 * CUTOFF;
+  }
+
+  mint::ParticleNeighborList neighbors(CUTOFF);
+  neighbors.build(&particles);
+  check_neighbors(particles, neighbors);
+  EXPECT_EQ(neighbors.getNumberOfNeighbors(0), 1);
+  EXPECT_EQ(neighbors.getNeighbors(0)[0], 1);
+}
+
+//------------------------------------------------------------------------------
+TEST(mint_particle_neighbor_list, reorder)
+{
+  constexpr IndexType NUM_PARTICLES = 400;
+  constexpr double CUTOFF = 0.2;
+
+  mint::ParticleMesh particles(2, NUM_PARTICLES);
+  fill_random(particles, 0.0, 1.0);
+
+  const double* x = particles.getCoordinateArray(mint::X_COORDINATE);
+  const double* y = particles.getCoordinateArray(mint::Y_COORDINATE);
+  const std::vector<double> x0(x, x + NUM_PARTICLES);
+  const std::vector<double> y0(y, y + NUM_PARTICLES);
+
+  IndexType* id = particles.createField<IndexType>("id", mint::NODE_CENTERED);
+  double* v = particles.createField<double>("v", mint::NODE_CENTERED, 2);
+  for(IndexType i = 0; i < NUM_PARTICLES; ++i)
+  {
+    id[i] = i;
+    v[2 * i] = x[i];
+    v[2 * i + 1] = y[i];
+  }
+
+  mint::ParticleNeighborList neighbors(CUTOFF);
+  neighbors.build(&particles, true);
+
+  const std::vector<IndexType>& order = neighbors.getParticleOrder();
+  ASSERT_EQ(static_cast<IndexType>(order.size()), NUM_PARTICLES);
+
+  // coordinates and fields are permuted consistently
+  for(IndexType i = 0; i < NUM_PARTICLES; ++i)
+  {
+    EXPECT_EQ(id[i], order[i]);
+    EXPECT_DOUBLE_EQ(x[i], x0[order[i]]);
+    EXPECT_DOUBLE_EQ(y[i], y0[order[i]]);
+    EXPECT_DOUBLE_EQ(v[2 * i], x[i]);
+    EXPECT_DOUBLE_EQ(v[2 * i + 1], y[i]);
+  }
+
+  check_neighbors(particles, neighbors);
+}
+
+//------------------------------------------------------------------------------
+TEST(mint_particle_neighbor_list, update_with_skin)
+{
+  constexpr IndexType NUM_PARTICLES = 300;
+  constexpr double CUTOFF = 0.1;
+  constexpr double SKIN = 0.02;
+
+  mint::ParticleMesh particles(3, NUM_PARTICLES);
+  fill_random(particles, 0.0, 1.0);
+
+  mint::ParticleNeighborList neighbors(CUTOFF, SKIN);
+  EXPECT_TRUE(neighbors.update(&particles));
+  EXPECT_EQ(neighbors.getNumberOfBuilds(), 1);
+  check_neighbors(particles, neighbors);
+
+  // moving a particle by less than half the skin keeps the lists valid
+  double* x = particles.getCoordinateArray(mint::X_COORDINATE);
+  x[0] += 0.4 * SKIN;
+  EXPECT_FALSE(neighbors.needsRebuild(&particles));
+  EXPECT_FALSE(neighbors.update(&particles));
+  EXPECT_EQ(neighbors.getNumberOfBuilds(), 1);
+
+  // moving it further requires a rebuild
+  x[0] += 0.2 * SKIN;
+  EXPECT_TRUE(neighbors.needsRebuild(&particles));
+  EXPECT_TRUE(neighbors.update(&particles));
+  EXPECT_EQ(neighbors.getNumberOfBuilds(), 2);
+  check_neighbors(particles, neighbors);
+
+  // so does changing the number of particles
+  particles.append(0.5, 0.5, 0.5);
+  EXPECT_TRUE(neighbors.update(&particles));
+  EXPECT_EQ(neighbors.getNumberOfParticles(), NUM_PARTICLES + 1);
+  check_neighbors(particles, neighbors);
+}
+
+//------------------------------------------------------------------------------
+#include "axom/slic/core/SimpleLogger.hpp"
+using axom::slic::SimpleLogger;
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  SimpleLogger logger;  // create & initialize test logger,
+
+  // finalized when exiting main scope
+
+  result = RUN_ALL_TESTS();
+
+  return result;
+}
@@ -22,7 +22,9 @@
 #include <algorithm> /* for std::fill_n */
 #include <string>
 #include <sstream>
+#include <set>
 #include <unordered_map>
+#include <vector>
 
 namespace axom
 {
@@ -2496,6 +2498,73 @@ void check_faces(UnstructuredMesh<SINGLE_SHAPE>* d_mesh, UniformMesh* s_mesh)
   }
 }
 
+/*!
+ * \brief Check the node-cell and cell-neighbor connectivity of an
+ * UnstructuredMesh against a brute force computation.
+ *
+ * \param [in] mesh the UnstructuredMesh, whose face connectivity has been
+ *  initialized.
+ */
+template <Topology TOPO>
+void check_cell_neighbors(UnstructuredMesh<TOPO>* mesh)
+{
+  const IndexType nodecount = mesh->getNumberOfNodes();
+  const IndexType cellcount = mesh->getNumberOfCells();
+
+  // check the cell across each face
+  for(IndexType c = 0; c < cellcount; ++c)
+  {
+    const IndexType* faces = mesh->getCellFaceIDs(c);
+    const IndexType* neighbors = mesh->getCellFaceNeighborIDs(c);
+    for(IndexType f = 0; f < mesh->getNumberOfCellFaces(c); ++f)
+    {
+      IndexType cellIDOne, cellIDTwo;
+      mesh->getFaceCellIDs(faces[f], cellIDOne, cellIDTwo);
+      EXPECT_EQ(neighbors[f], (cellIDOne == c) ? cellIDTwo : cellIDOne);
+    }
+  }
+
+  // compute the cells of each node, in increasing order
+  std::vector<std::vector<IndexType>> node_cells(nodecount);
+  for(IndexType c = 0; c < cellcount; ++c)
+  {
+    const IndexType* nodes = mesh->getCellNodeIDs(c);
+    for(IndexType n = 0; n < mesh->getNumberOfCellNodes(c); ++n)
+    {
+      node_cells[nodes[n]].push_back(c);
+    }
+  }
+
+  EXPECT_FALSE(mesh->hasNodeCellConnectivity());
+  mesh->initializeCellNeighborConnectivity();
+  EXPECT_TRUE(mesh->hasNodeCellConnectivity());
+
+  for(IndexType n = 0; n < nodecount; ++n)
+  {
+    const std::vector<IndexType>& expected = node_cells[n];
+    ASSERT_EQ(mesh->getNumberOfNodeCells(n),
+              static_cast<IndexType>(expected.size()));
+    const IndexType* cells = mesh->getNodeCellIDs(n);
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), cells));
+  }
+
+  for(IndexType c = 0; c < cellcount; ++c)
+  {
+    std::set<IndexType> expected;
+    const IndexType* nodes = mesh->getCellNodeIDs(c);
+    for(IndexType n = 0; n < mesh->getNumberOfCellNodes(c); ++n)
+    {
+      expected.insert(node_cells[nodes[n]].begin(), node_cells[nodes[n]].end());
+    }
+    expected.erase(c);
+
+    ASSERT_EQ(mesh->getNumberOfCellNeighbors(c),
+              static_cast<IndexType>(expected.size()));
+    const IndexType* neighbors = mesh->getCellNeighborIDs(c);
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), neighbors));
+  }
+}
+
 } /* end namespace internal */
 
 /*******************************************************************************
@@ -3169,6 +3238,27 @@ TEST(mint_mesh_unstructured_mesh, resize_mesh_single_topology)
   }
 }
 
+//------------------------------------------------------------------------------
+TEST(mint_mesh_unstructured_mesh, resize_mesh_mixed_topology_connectivity)
+{
+  constexpr int NDIMS = 2;
+  constexpr IndexType N_NODES = 6;
+  constexpr IndexType N_CELLS = 3;
+  constexpr IndexType CONNECTIVITY_SIZE = 10;
+
+  mint::UnstructuredMesh<MIXED_SHAPE> mesh(NDIMS);
+  mesh.resize(N_NODES, N_CELLS, CONNECTIVITY_SIZE);
+  EXPECT_EQ(mesh.getNumberOfNodes(), N_NODES);
+  EXPECT_EQ(mesh.getNumberOfCells(), N_CELLS);
+  EXPECT_EQ(mesh.getCellNodesSize(), CONNECTIVITY_SIZE);
+  EXPECT_EQ(mesh.getCellNodesOffsetsArray()[0], 0);
+
+  // the connectivity size is ignored for a single cell type
+  mint::UnstructuredMesh<SINGLE_SHAPE> quads(NDIMS, mint::QUAD);
+  quads.resize(N_NODES, N_CELLS, CONNECTIVITY_SIZE);
+  EXPECT_EQ(quads.getCellNodesSize(), 4 * N_CELLS);
+}
+
 //------------------------------------------------------------------------------
 TEST(mint_mesh_unstructured_mesh, resize_mesh_mixed_topology)
 {
@@ -3365,6 +3455,50 @@ TEST(mint_mesh_unstructured_mesh, check_face_connectivity)
   }
 }
 
+//------------------------------------------------------------------------------
+TEST(mint_mesh_unstructured_mesh, check_cell_neighbor_connectivity)
+{
+  constexpr IndexType RESOLUTION = 6;
+  constexpr int DIM_STEPS = 2;
+  constexpr int DIMENSIONS[] = {2, 3};
+
+  for(int idim = 0; idim < DIM_STEPS; ++idim)
+  {
+    const int dimension = DIMENSIONS[idim];
+
+    UniformMesh* source_mesh = nullptr;
+    UnstructuredMesh<SINGLE_SHAPE>* test_mesh = nullptr;
+    internal::createMeshesForFace(test_mesh,
+                                  source_mesh,
+                                  RESOLUTION,
+                                  dimension);
+
+    UnstructuredMesh<MIXED_SHAPE>* mixed_mesh =
+      static_cast<UnstructuredMesh<MIXED_SHAPE>*>(
+        internal::create_mesh<UNSTRUCTURED_MESH, MIXED_SHAPE>(*source_mesh));
+
+    EXPECT_TRUE(test_mesh->initializeFaceConnectivity());
+    internal::check_cell_neighbors(test_mesh);
+
+    EXPECT_TRUE(mixed_mesh->initializeFaceConnectivity());
+    internal::check_cell_neighbors(mixed_mesh);
+
+    // Appending a cell and forcing a rebuild picks up the new cell
+    IndexType cell_nodes[MAX_CELL_NODES];
+    test_mesh->getCellNodeIDs(0, cell_nodes);
+    const IndexType new_cell = test_mesh->getNumberOfCells();
+    test_mesh->appendCell(cell_nodes);
+    test_mesh->initializeCellNeighborConnectivity(true);
+    EXPECT_EQ(test_mesh->getNodeCellIDs(cell_nodes[0])[1], new_cell);
+    const IndexType num_neighbors = test_mesh->getNumberOfCellNeighbors(0);
+    EXPECT_EQ(test_mesh->getCellNeighborIDs(0)[num_neighbors - 1], new_cell);
+
+    delete source_mesh;
+    delete test_mesh;
+    delete mixed_mesh;
+  }
+}
+
 } /* end namespace mint */
 } /* end namespace axom */
 
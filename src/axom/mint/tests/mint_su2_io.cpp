@@ -16,7 +16,9 @@
 #include "gtest/gtest.h" /* for gtest macros */
 
 // C/C++ includes
-#include <cstdio> /* for std::remove() */
+#include <cstdio>  /* for std::remove() */
+#include <cstdlib> /* for std::strtod() */
+#include <fstream> /* for std::ofstream */
 
 namespace mint = axom::mint;
 
@@ -219,6 +221,155 @@ TEST(mint_su2_io, write_read_single_cell_topology_mesh)
   std::remove(su2File.c_str());
 }
 
+//------------------------------------------------------------------------------
+TEST(mint_su2_io, read_hand_written_file)
+{
+  // nodes in the formats found in SU2 files, parsed as by std::strtod
+  const char* coords[][3] = {{"0", "0.0", "-0.0"},
+                             {"1.5e-3", "-2.25E+01", ".5"},
+                             {"3.000000000000000e+00", "1", "+2"},
+                             {"0.1", "1.2345678901234567890123", "1e-30"},
+                             {"-7.5", "123456789012345678", "2.5e300"},
+                             {"9007199254740993", "4.9e-324", "1e22"}};
+  constexpr int NNODES = 6;
+
+  const std::string su2File = "hand_written_mesh.su2";
+  std::ofstream ofs(su2File.c_str());
+  ofs << "% a comment\n\n";
+  ofs << "NDIME= 3\r\n";
+  ofs << "NELEM= 3\n";
+  ofs << "10 0 1 2 3 0\n";
+  ofs << "\n";
+  ofs << "  12\t0 1 2 3 4 5 0 1 1\r\n";
+  ofs << "14 1 2 3 4 5 2\n";
+  ofs << "NPOIN= 6 6\n";
+  for(int i = 0; i < NNODES; ++i)
+  {
+    ofs << coords[i][0] << " " << coords[i][1] << "\t" << coords[i][2] << " "
+        << i << "\n";
+  }
+  ofs << "NMARK= 1\n";
+  ofs << "MARKER_TAG= wall\n";
+  ofs << "MARKER_ELEMS= 1\n";
+  ofs << "5 0 1 2\n";
+  ofs.close();
+
+  mint::Mesh* mesh = nullptr;
+  int rc = mint::read_su2(su2File, mesh);
+  EXPECT_EQ(rc, 0);
+  ASSERT_TRUE(mesh != nullptr);
+
+  EXPECT_EQ(mesh->getDimension(), 3);
+  EXPECT_EQ(mesh->getNumberOfNodes(), NNODES);
+  EXPECT_EQ(mesh->getNumberOfCells(), 3);
+  EXPECT_TRUE(mesh->hasMixedCellTypes());
+
+  for(int inode = 0; inode < NNODES; ++inode)
+  {
+    double node[3];
+    mesh->getNode(inode, node);
+    for(int idim = 0; idim < 3; ++idim)
+    {
+      EXPECT_EQ(node[idim], std::strtod(coords[inode][idim], nullptr));
+    }
+  }
+
+  const mint::CellType types[] = {mint::TET, mint::HEX, mint::PYRAMID};
+  const axom::IndexType cells[][8] = {{0, 1, 2, 3},
+                                      {0, 1, 2, 3, 4, 5, 0, 1},
+                                      {1, 2, 3, 4, 5}};
+  axom::IndexType cell[mint::MAX_CELL_NODES];
+  for(axom::IndexType icell = 0; icell < 3; ++icell)
+  {
+    EXPECT_EQ(mesh->getCellType(icell), types[icell]);
+
+    const axom::IndexType nnodes = mesh->getCellNodeIDs(icell, cell);
+    EXPECT_EQ(nnodes, mint::getCellInfo(types[icell]).num_nodes);
+    for(axom::IndexType inode = 0; inode < nnodes; ++inode)
+    {
+      EXPECT_EQ(cell[inode], cells[icell][inode]);
+    }
+  }
+
+  delete mesh;
+  std::remove(su2File.c_str());
+}
+
+//------------------------------------------------------------------------------
+TEST(mint_su2_io, read_truncated_file)
+{
+  const std::string su2File = "truncated_mesh.su2";
+  std::ofstream ofs(su2File.c_str());
+  ofs << "NDIME= 2\n";
+  ofs << "NELEM= 1\n";
+  ofs << "5 0 1 2\n";
+  ofs << "NPOIN= 3\n";
+  ofs << "0.0 0.0\n";
+  ofs << "1.0 0.0\n";
+  ofs.close();
+
+  mint::Mesh* mesh = nullptr;
+  int rc = mint::read_su2(su2File, mesh);
+  EXPECT_TRUE(rc != 0);
+  EXPECT_TRUE(mesh == nullptr);
+
+  std::remove(su2File.c_str());
+}
+
+//------------------------------------------------------------------------------
+TEST(mint_su2_io, write_read_large_mesh)
+{
+  // large enough for the sections to be parsed in several chunks
+  constexpr axom::IndexType N = 100;
+  const double lo[] = {0.0, 0.0};
+  const double hi[] = {10.0, 10.0};
+  mint::UniformMesh uniform_mesh(lo, hi, N + 1, N + 1);
+
+  mint::UnstructuredMesh<mint::MIXED_SHAPE> mesh(2);
+  const axom::IndexType nnodes = uniform_mesh.getNumberOfNodes();
+  for(axom::IndexType inode = 0; inode < nnodes; ++inode)
+  {
+    double node[2];
+    uniform_mesh.getNode(inode, node);
+    mesh.appendNode(node[0], node[1]);
+  }
+
+  // split every other quad in two triangles
+  axom::IndexType cell[mint::MAX_CELL_NODES];
+  const axom::IndexType ncells = uniform_mesh.getNumberOfCells();
+  for(axom::IndexType icell = 0; icell < ncells; ++icell)
+  {
+    uniform_mesh.getCellNodeIDs(icell, cell);
+    if(icell % 2 == 0)
+    {
+      mesh.appendCell(cell, mint::QUAD);
+    }
+    else
+    {
+      const axom::IndexType t0[] = {cell[0], cell[1], cell[2]};
+      const axom::IndexType t1[] = {cell[0], cell[2], cell[3]};
+      mesh.appendCell(t0, mint::TRIANGLE);
+      mesh.appendCell(t1, mint::TRIANGLE);
+    }
+  }
+
+  const std::string su2File = "large_mesh.su2";
+  int rc = mint::write_su2(&mesh, su2File);
+  EXPECT_EQ(rc, 0);
+
+  mint::Mesh* test_mesh = nullptr;
+  rc = mint::read_su2(su2File, test_mesh);
+  EXPECT_EQ(rc, 0);
+  ASSERT_TRUE(test_mesh != nullptr);
+  EXPECT_TRUE(test_mesh->hasMixedCellTypes());
+
+  check_nodes(&mesh, test_mesh);
+  check_cell_connectivity(&mesh, test_mesh);
+
+  delete test_mesh;
+  std::remove(su2File.c_str());
+}
+
 //------------------------------------------------------------------------------
 using axom::slic::SimpleLogger;
 
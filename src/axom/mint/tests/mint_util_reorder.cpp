@@ -0,0 +1,304 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+// Mint includes
+#include "axom/mint/mesh/UniformMesh.hpp"      /* for UniformMesh */
+#include "axom/mint/mesh/UnstructuredMesh.hpp" /* for UnstructuredMesh */
+#include "axom/mint/utils/reorder_utils.hpp"   /* for reorder_mesh */
+
+#include "mint_test_utilities.hpp" /* for create_mesh */
+
+// Slic includes
+#include "axom/slic/interface/slic.hpp"    /* for slic macros */
+#include "axom/slic/core/SimpleLogger.hpp" /* for SimpleLogger */
+
+// gtest includes
+#include "gtest/gtest.h" /* for gtest macros */
+
+// C/C++ includes
+#include <algorithm> /* for std::sort, std::shuffle */
+#include <numeric>   /* for std::iota */
+#include <random>    /* for std::mt19937 */
+#include <vector>    /* for std::vector */
+
+namespace axom
+{
+namespace mint
+{
+//------------------------------------------------------------------------------
+// HELPER FUNCTIONS
+//------------------------------------------------------------------------------
+namespace
+{
+constexpr IndexType RESOLUTION = 8;
+constexpr int ORDERINGS[] = {HILBERT_ORDERING, MORTON_ORDERING, RCM_ORDERING};
+
+//------------------------------------------------------------------------------
+template <Topology TOPO>
+Mesh* create_shuffled_mesh(int dimension)
+{
+  const double lo[] = {-1.0, -1.0, -1.0};
+  const double hi[] = {1.0, 1.0, 1.0};
+  UniformMesh* uniform_mesh = (dimension == 3)
+    ? new UniformMesh(lo, hi, RESOLUTION, RESOLUTION, RESOLUTION)
+    : new UniformMesh(lo, hi, RESOLUTION, RESOLUTION);
+
+  auto* mesh = static_cast<UnstructuredMesh<TOPO>*>(
+    internal::create_mesh<UNSTRUCTURED_MESH, TOPO>(*uniform_mesh));
+  delete uniform_mesh;
+
+  std::mt19937 gen(42);
+  std::vector<IndexType> node_order(mesh->getNumberOfNodes());
+  std::vector<IndexType> cell_order(mesh->getNumberOfCells());
+  std::iota(node_order.begin(), node_order.end(), 0);
+  std::iota(cell_order.begin(), cell_order.end(), 0);
+  std::shuffle(node_order.begin(), node_order.end(), gen);
+  std::shuffle(cell_order.begin(), cell_order.end(), gen);
+  mesh->renumber(node_order.data(), cell_order.data());
+
+  return mesh;
+}
+
+//------------------------------------------------------------------------------
+double face_value(const Mesh* mesh, IndexType faceID)
+{
+  IndexType nodes[MAX_FACE_NODES];
+  const IndexType n_nodes = mesh->getFaceNodeIDs(faceID, nodes);
+
+  double value = 0.0;
+  for(IndexType i = 0; i < n_nodes; ++i)
+  {
+    double scale = 1.0;
+    for(int d = 0; d < mesh->getDimension(); ++d)
+    {
+      value += scale * mesh->getCoordinateArray(d)[nodes[i]];
+      scale *= 10.0;
+    }
+  }
+
+  return value / n_nodes;
+}
+
+//------------------------------------------------------------------------------
+void add_fields(Mesh* mesh)
+{
+  double* node_x = mesh->createField<double>("node_x", NODE_CENTERED, 2);
+  const double* x = mesh->getCoordinateArray(X_COORDINATE);
+  for(IndexType i = 0; i < mesh->getNumberOfNodes(); ++i)
+  {
+    node_x[2 * i] = x[i];
+    node_x[2 * i + 1] = -x[i];
+  }
+
+  IndexType* cell_id = mesh->createField<IndexType>("cell_id", CELL_CENTERED);
+  for(IndexType i = 0; i < mesh->getNumberOfCells(); ++i)
+  {
+    cell_id[i] = i;
+  }
+
+  double* face_val = mesh->createField<double>("face_val", FACE_CENTERED);
+  for(IndexType i = 0; i < mesh->getNumberOfFaces(); ++i)
+  {
+    face_val[i] = face_value(mesh, i);
+  }
+}
+
+//------------------------------------------------------------------------------
+double mean_cell_spread(const Mesh* mesh)
+{
+  double spread = 0.0;
+  IndexType nodes[MAX_CELL_NODES];
+  for(IndexType c = 0; c < mesh->getNumberOfCells(); ++c)
+  {
+    const IndexType n_nodes = mesh->getCellNodeIDs(c, nodes);
+    const auto range = std::minmax_element(nodes, nodes + n_nodes);
+    spread += *range.second - *range.first;
+  }
+
+  return spread / mesh->getNumberOfCells();
+}
+
+//------------------------------------------------------------------------------
+void check_permutation(const std::vector<IndexType>& order, IndexType n)
+{
+  ASSERT_EQ(static_cast<IndexType>(order.size()), n);
+
+  std::vector<IndexType> sorted(order);
+  std::sort(sorted.begin(), sorted.end());
+  for(IndexType i = 0; i < n; ++i)
+  {
+    EXPECT_EQ(sorted[i], i);
+  }
+}
+
+//------------------------------------------------------------------------------
+template <Topology TOPO>
+void check_reorder(int dimension, int ordering)
+{
+  Mesh* ref = create_shuffled_mesh<TOPO>(dimension);
+  Mesh* mesh = create_shuffled_mesh<TOPO>(dimension);
+  add_fields(ref);
+  add_fields(mesh);
+
+  auto* umesh = static_cast<UnstructuredMesh<TOPO>*>(mesh);
+  umesh->initializeNodeCellConnectivity();
+
+  std::vector<IndexType> node_order;
+  std::vector<IndexType> cell_order;
+  EXPECT_EQ(reorder_mesh(mesh, ordering, node_order, cell_order), 0);
+
+  const IndexType numNodes = ref->getNumberOfNodes();
+  const IndexType numCells = ref->getNumberOfCells();
+  ASSERT_EQ(mesh->getNumberOfNodes(), numNodes);
+  ASSERT_EQ(mesh->getNumberOfCells(), numCells);
+  check_permutation(node_order, numNodes);
+  check_permutation(cell_order, numCells);
+
+  // check nodes and node-centered fields
+  const double* ref_node_x = ref->getFieldPtr<double>("node_x", NODE_CENTERED);
+  const double* node_x = mesh->getFieldPtr<double>("node_x", NODE_CENTERED);
+  for(IndexType i = 0; i < numNodes; ++i)
+  {
+    const IndexType old = node_order[i];
+    for(int d = 0; d < dimension; ++d)
+    {
+      EXPECT_DOUBLE_EQ(mesh->getCoordinateArray(d)[i],
+                       ref->getCoordinateArray(d)[old]);
+    }
+    EXPECT_DOUBLE_EQ(node_x[2 * i], ref_node_x[2 * old]);
+    EXPECT_DOUBLE_EQ(node_x[2 * i + 1], ref_node_x[2 * old + 1]);
+  }
+
+  // check cells and cell-centered fields
+  const IndexType* cell_id = mesh->getFieldPtr<IndexType>("cell_id",
+                                                           CELL_CENTERED);
+  IndexType nodes[MAX_CELL_NODES];
+  IndexType ref_nodes[MAX_CELL_NODES];
+  for(IndexType c = 0; c < numCells; ++c)
+  {
+    const IndexType old = cell_order[c];
+    EXPECT_EQ(cell_id[c], old);
+    EXPECT_EQ(mesh->getCellType(c), ref->getCellType(old));
+
+    const IndexType n_nodes = mesh->getCellNodeIDs(c, nodes);
+    ASSERT_EQ(n_nodes, ref->getCellNodeIDs(old, ref_nodes));
+    for(IndexType i = 0; i < n_nodes; ++i)
+    {
+      EXPECT_EQ(node_order[nodes[i]], ref_nodes[i]);
+    }
+  }
+
+  // check faces and face-centered fields
+  ASSERT_EQ(mesh->getNumberOfFaces(), ref->getNumberOfFaces());
+  const double* face_val = mesh->getFieldPtr<double>("face_val", FACE_CENTERED);
+  for(IndexType f = 0; f < mesh->getNumberOfFaces(); ++f)
+  {
+    EXPECT_NEAR(face_val[f], face_value(mesh, f), 1.e-12);
+  }
+
+  // the node-cell relation is rebuilt in the new numbering
+  for(IndexType n = 0; n < numNodes; ++n)
+  {
+    const IndexType* cells = umesh->getNodeCellIDs(n);
+    for(IndexType i = 0; i < umesh->getNumberOfNodeCells(n); ++i)
+    {
+      const IndexType n_nodes = mesh->getCellNodeIDs(cells[i], nodes);
+      EXPECT_NE(std::find(nodes, nodes + n_nodes, n), nodes + n_nodes);
+    }
+  }
+
+  // the reordered cells reference nearby nodes
+  EXPECT_LT(mean_cell_spread(mesh), mean_cell_spread(ref));
+
+  delete ref;
+  delete mesh;
+}
+
+} /* end anonymous namespace */
+
+//------------------------------------------------------------------------------
+// UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(mint_util_reorder, reorder_single_shape)
+{
+  for(int dimension = 2; dimension <= 3; ++dimension)
+  {
+    for(int ordering : ORDERINGS)
+    {
+      SLIC_INFO("dimension=" << dimension << " ordering=" << ordering);
+      check_reorder<SINGLE_SHAPE>(dimension, ordering);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(mint_util_reorder, reorder_mixed_shape)
+{
+  for(int dimension = 2; dimension <= 3; ++dimension)
+  {
+    for(int ordering : ORDERINGS)
+    {
+      SLIC_INFO("dimension=" << dimension << " ordering=" << ordering);
+      check_reorder<MIXED_SHAPE>(dimension, ordering);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(mint_util_reorder, compute_ordering_leaves_mesh_unchanged)
+{
+  Mesh* ref = create_shuffled_mesh<SINGLE_SHAPE>(3);
+  Mesh* mesh = create_shuffled_mesh<SINGLE_SHAPE>(3);
+
+  std::vector<IndexType> node_order;
+  std::vector<IndexType> cell_order;
+  const int rc =
+    compute_mesh_ordering(mesh, HILBERT_ORDERING, node_order, cell_order);
+  EXPECT_EQ(rc, 0);
+  check_permutation(node_order, mesh->getNumberOfNodes());
+  check_permutation(cell_order, mesh->getNumberOfCells());
+
+  IndexType nodes[MAX_CELL_NODES];
+  IndexType ref_nodes[MAX_CELL_NODES];
+  for(IndexType c = 0; c < mesh->getNumberOfCells(); ++c)
+  {
+    const IndexType n_nodes = mesh->getCellNodeIDs(c, nodes);
+    ref->getCellNodeIDs(c, ref_nodes);
+    for(IndexType i = 0; i < n_nodes; ++i)
+    {
+      EXPECT_EQ(nodes[i], ref_nodes[i]);
+    }
+  }
+
+  delete ref;
+  delete mesh;
+}
+
+//------------------------------------------------------------------------------
+TEST(mint_util_reorder, reorder_structured_mesh)
+{
+  const double lo[] = {0.0, 0.0};
+  const double hi[] = {1.0, 1.0};
+  UniformMesh mesh(lo, hi, RESOLUTION, RESOLUTION);
+
+  std::vector<IndexType> node_order;
+  std::vector<IndexType> cell_order;
+  EXPECT_NE(reorder_mesh(&mesh, HILBERT_ORDERING, node_order, cell_order), 0);
+}
+
+} /* end namespace mint */
+} /* end namespace axom */
+
+//------------------------------------------------------------------------------
+using axom::slic::SimpleLogger;
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+  ::testing::InitGoogleTest(&argc, argv);
+  SimpleLogger logger;
+  result = RUN_ALL_TESTS();
+  return result;
+}
@@ -27,13 +27,17 @@
 #include "axom/slic/core/SimpleLogger.hpp" /* for SimpleLogger */
 
 // C/C++ includes
+#include <algorithm> /* for std::equal */
 #include <cmath>   /* for std::exp */
+#include <cstdint> /* for std::int32_t, std::uint64_t */
 #include <cstdio>  /* for std::remove */
+#include <cstring> /* for std::memcpy */
 #include <fstream> /* for std::ifstream */
 #include <iomanip> /* for std::setfill, std::setw */
 #include <string>  /* for std::string */
 #include <sstream> /* for std::stringstream */
 #include <set>     /* for std::set */
+#include <vector>  /* for std::vector */
 
 // gtest includes
 #include "gtest/gtest.h" /* for TEST and EXPECT_* macros */
@@ -826,6 +830,451 @@ void test_mesh(MeshType* mesh, const std::string& path)
 #endif
 }
 
+/*!
+ * \brief Reads n big-endian values of type T from a legacy binary VTK file,
+ *  followed by the newline that ends the payload.
+ * \param [in] file the file to parse.
+ * \param [in] n the number of values to read.
+ * \param [out] values the values in host byte order.
+ */
+template <typename T>
+void read_big_endian(std::ifstream& file, IndexType n, std::vector<T>& values)
+{
+  values.resize(n);
+  for(IndexType i = 0; i < n; ++i)
+  {
+    unsigned char bytes[sizeof(T)];
+    file.read(reinterpret_cast<char*>(bytes), sizeof(T));
+
+    std::uint64_t raw = 0;
+    for(std::size_t j = 0; j < sizeof(T); ++j)
+    {
+      raw = (raw << 8) | bytes[j];
+    }
+
+    T value;
+    if(sizeof(T) == 8)
+    {
+      std::memcpy(&value, &raw, sizeof(T));
+    }
+    else
+    {
+      const std::uint32_t raw32 = static_cast<std::uint32_t>(raw);
+      std::memcpy(&value, &raw32, sizeof(T));
+    }
+    values[i] = value;
+  }
+
+  EXPECT_EQ(file.get(), '\n');
+}
+
+/*!
+ * \brief Checks that a line of a legacy binary VTK file matches.
+ * \param [in] file the file to parse.
+ * \param [in] expected the expected line.
+ */
+void check_line(std::ifstream& file, const std::string& expected)
+{
+  std::string buffer;
+  std::getline(file, buffer);
+  EXPECT_EQ(buffer, expected);
+}
+
+/*!
+ * \brief Checks the components [first, first + count) of a field written to
+ *  a legacy binary VTK file, padded with zeros up to width values per tuple.
+ */
+template <typename T>
+void check_binary_values(const Field* field,
+                         int first,
+                         int count,
+                         int width,
+                         std::ifstream& file)
+{
+  const IndexType num_values = field->getNumTuples();
+  const int num_components = field->getNumComponents();
+  const T* data_ptr = Field::getDataPtr<T>(field);
+
+  std::vector<T> values;
+  read_big_endian(file, num_values * width, values);
+  for(IndexType i = 0; i < num_values; ++i)
+  {
+    for(int j = 0; j < width; ++j)
+    {
+      const T expected =
+        (j < count) ? data_ptr[i * num_components + first + j] : T(0);
+      EXPECT_EQ(values[i * width + j], expected);
+    }
+  }
+}
+
+/*!
+ * \brief Checks the fields of a FieldData written to a legacy binary VTK
+ *  file.
+ * \param [in] field_data the fields to check against.
+ * \param [in] file the file to parse.
+ */
+void check_binary_fieldData(const FieldData* field_data, std::ifstream& file)
+{
+  const int numFields = field_data->getNumFields();
+  for(int i = 0; i < numFields; ++i)
+  {
+    const Field* field = field_data->getField(i);
+    const int num_components = field->getNumComponents();
+    const bool is_double = (field->getType() == DOUBLE_FIELD_TYPE);
+    const std::string type = is_double ? "double" : "int";
+
+    if(num_components == 1 || num_components > 3)
+    {
+      for(int comp = 0; comp < num_components; ++comp)
+      {
+        std::stringstream name;
+        name << field->getName();
+        if(num_components > 1)
+        {
+          name << "_" << std::setfill('0') << std::setw(3) << comp;
+        }
+
+        check_line(file, "SCALARS " + name.str() + " " + type);
+        check_line(file, "LOOKUP_TABLE default");
+        if(is_double)
+        {
+          check_binary_values<double>(field, comp, 1, 1, file);
+        }
+        else
+        {
+          check_binary_values<int>(field, comp, 1, 1, file);
+        }
+      }
+    }
+    else
+    {
+      check_line(file, "VECTORS " + field->getName() + " " + type);
+      if(is_double)
+      {
+        check_binary_values<double>(field, 0, num_components, 3, file);
+      }
+      else
+      {
+        check_binary_values<int>(field, 0, num_components, 3, file);
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Writes an unstructured or particle mesh in the legacy binary VTK
+ *  format and reads it back in to check for correctness.
+ * \param [in] mesh the mesh to write out, deleted on return.
+ * \param [in] path the path of the file to be written.
+ */
+void test_binary_mesh(Mesh* mesh, const std::string& path)
+{
+  create_scalar_data(mesh);
+  create_vector_data(mesh);
+  create_multidim_data(mesh);
+  EXPECT_EQ(write_vtk(mesh, path, VTK_BINARY), 0);
+
+  std::ifstream file(path.c_str(), std::ios::binary);
+  ASSERT_TRUE(file);
+  check_line(file, "# vtk DataFile Version 3.0");
+  check_line(file, "Mesh generated by axom::mint::write_vtk");
+  check_line(file, "BINARY");
+  check_line(file, "DATASET UNSTRUCTURED_GRID");
+
+  const IndexType num_nodes = mesh->getNumberOfNodes();
+  check_line(file, "POINTS " + std::to_string(num_nodes) + " double");
+
+  std::vector<double> coords;
+  read_big_endian(file, 3 * num_nodes, coords);
+  for(IndexType idx = 0; idx < num_nodes; ++idx)
+  {
+    double xyz[] = {0, 0, 0};
+    mesh->getNode(idx, xyz);
+    EXPECT_EQ(coords[3 * idx + 0], xyz[0]);
+    EXPECT_EQ(coords[3 * idx + 1], xyz[1]);
+    EXPECT_EQ(coords[3 * idx + 2], xyz[2]);
+  }
+
+  const IndexType num_cells = mesh->getNumberOfCells();
+  IndexType total_size = num_cells;
+  for(IndexType cellIdx = 0; cellIdx < num_cells; ++cellIdx)
+  {
+    total_size += mesh->getNumberOfCellNodes(cellIdx);
+  }
+
+  check_line(file,
+             "CELLS " + std::to_string(num_cells) + " " +
+               std::to_string(total_size));
+
+  std::vector<std::int32_t> cells;
+  read_big_endian(file, total_size, cells);
+  IndexType pos = 0;
+  for(IndexType cellIdx = 0; cellIdx < num_cells; ++cellIdx)
+  {
+    IndexType cell_nodes[MAX_CELL_NODES];
+    const IndexType num_cell_nodes = mesh->getCellNodeIDs(cellIdx, cell_nodes);
+    EXPECT_EQ(cells[pos++], num_cell_nodes);
+    for(IndexType i = 0; i < num_cell_nodes; ++i)
+    {
+      EXPECT_EQ(cells[pos++], cell_nodes[i]);
+    }
+  }
+
+  check_line(file, "CELL_TYPES " + std::to_string(num_cells));
+  std::vector<std::int32_t> types;
+  read_big_endian(file, num_cells, types);
+  for(IndexType cellIdx = 0; cellIdx < num_cells; ++cellIdx)
+  {
+    EXPECT_EQ(types[cellIdx], getCellInfo(mesh->getCellType(cellIdx)).vtk_type);
+  }
+
+  check_line(file, "POINT_DATA " + std::to_string(num_nodes));
+  check_binary_fieldData(mesh->getFieldData(NODE_CENTERED), file);
+
+  if(mesh->getMeshType() != PARTICLE_MESH)
+  {
+    check_line(file, "CELL_DATA " + std::to_string(num_cells));
+    check_binary_fieldData(mesh->getFieldData(CELL_CENTERED), file);
+  }
+
+  EXPECT_EQ(file.peek(), std::ifstream::traits_type::eof());
+
+  file.close();
+  delete mesh;
+#if DELETE_VTK_FILES
+  std::remove(path.c_str());
+#endif
+}
+
+/*!
+ * \brief Reads the whole contents of a file.
+ */
+std::string read_file(const std::string& path)
+{
+  std::ifstream file(path.c_str(), std::ios::binary);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  return contents.str();
+}
+
+/*!
+ * \brief Returns the values of all the offset attributes of a VTU file.
+ */
+std::vector<std::uint64_t> get_vtu_offsets(const std::string& contents)
+{
+  std::vector<std::uint64_t> offsets;
+  const std::string key = "offset=\"";
+  std::string::size_type pos = contents.find(key);
+  while(pos != std::string::npos)
+  {
+    pos += key.size();
+    offsets.push_back(std::stoull(contents.substr(pos)));
+    pos = contents.find(key, pos);
+  }
+  return offsets;
+}
+
+/*!
+ * \brief Returns the appended data of a VTU file, i.e., the contents after
+ *  the leading underscore up to the closing AppendedData tag.
+ */
+std::string get_appended_data(const std::string& contents)
+{
+  const std::string::size_type tag = contents.find("<AppendedData");
+  const std::string::size_type begin = contents.find("_", tag);
+  const std::string::size_type end = contents.rfind("\n  </AppendedData>");
+  EXPECT_NE(begin, std::string::npos);
+  EXPECT_NE(end, std::string::npos);
+  return contents.substr(begin + 1, end - begin - 1);
+}
+
+/*!
+ * \brief Decodes a padded base64 string.
+ */
+std::string decode_base64(const std::string& encoded)
+{
+  const std::string alphabet =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+  std::string decoded;
+  unsigned int bits = 0;
+  int num_bits = 0;
+  for(char c : encoded)
+  {
+    if(c == '=')
+    {
+      break;
+    }
+
+    bits = (bits << 6) | static_cast<unsigned int>(alphabet.find(c));
+    num_bits += 6;
+    if(num_bits >= 8)
+    {
+      num_bits -= 8;
+      decoded.push_back(static_cast<char>((bits >> num_bits) & 0xff));
+    }
+  }
+  return decoded;
+}
+
+/*!
+ * \brief Returns the payload of the raw appended data block at the given
+ *  offset, checking the size in its header.
+ */
+template <typename T>
+std::vector<T> get_vtu_block(const std::string& data,
+                             std::uint64_t offset,
+                             IndexType expected_size)
+{
+  std::uint64_t nbytes = 0;
+  std::memcpy(&nbytes, data.data() + offset, sizeof(std::uint64_t));
+  EXPECT_EQ(nbytes, expected_size * sizeof(T));
+
+  std::vector<T> values(expected_size);
+  const char* payload = data.data() + offset + sizeof(std::uint64_t);
+  std::memcpy(values.data(), payload, nbytes);
+  return values;
+}
+
+/*!
+ * \brief Checks the raw appended data of a VTU file against its mesh.
+ * \param [in] mesh the mesh to check against.
+ * \param [in] contents the contents of the VTU file.
+ */
+void check_vtu(const Mesh* mesh, const std::string& contents)
+{
+  const IndexType num_nodes = mesh->getNumberOfNodes();
+  const IndexType num_cells = mesh->getNumberOfCells();
+  const std::string data = get_appended_data(contents);
+  const std::vector<std::uint64_t> offsets = get_vtu_offsets(contents);
+
+  std::vector<const Field*> fields;
+  const FieldData* node_data = mesh->getFieldData(NODE_CENTERED);
+  for(int i = 0; i < node_data->getNumFields(); ++i)
+  {
+    fields.push_back(node_data->getField(i));
+  }
+
+  if(mesh->getMeshType() != PARTICLE_MESH)
+  {
+    const FieldData* cell_data = mesh->getFieldData(CELL_CENTERED);
+    for(int i = 0; i < cell_data->getNumFields(); ++i)
+    {
+      fields.push_back(cell_data->getField(i));
+    }
+  }
+
+  // one block per field, followed by the points and the three cell arrays
+  const std::size_t num_fields = fields.size();
+  ASSERT_EQ(offsets.size(), num_fields + 4);
+
+  for(std::size_t i = 0; i < num_fields; ++i)
+  {
+    const Field* field = fields[i];
+    const IndexType n = field->getNumTuples() * field->getNumComponents();
+    if(field->getType() == DOUBLE_FIELD_TYPE)
+    {
+      const double* expected = Field::getDataPtr<double>(field);
+      const std::vector<double> values =
+        get_vtu_block<double>(data, offsets[i], n);
+      EXPECT_TRUE(std::equal(values.begin(), values.end(), expected));
+    }
+    else
+    {
+      const int* expected = Field::getDataPtr<int>(field);
+      const std::vector<int> values = get_vtu_block<int>(data, offsets[i], n);
+      EXPECT_TRUE(std::equal(values.begin(), values.end(), expected));
+    }
+  }
+
+  const std::vector<double> coords =
+    get_vtu_block<double>(data, offsets[num_fields], 3 * num_nodes);
+  for(IndexType idx = 0; idx < num_nodes; ++idx)
+  {
+    double xyz[] = {0, 0, 0};
+    mesh->getNode(idx, xyz);
+    EXPECT_EQ(coords[3 * idx + 0], xyz[0]);
+    EXPECT_EQ(coords[3 * idx + 1], xyz[1]);
+    EXPECT_EQ(coords[3 * idx + 2], xyz[2]);
+  }
+
+  std::vector<std::int64_t> connectivity;
+  for(IndexType cellIdx = 0; cellIdx < num_cells; ++cellIdx)
+  {
+    IndexType cell_nodes[MAX_CELL_NODES];
+    const IndexType num_cell_nodes = mesh->getCellNodeIDs(cellIdx, cell_nodes);
+    connectivity.insert(connectivity.end(),
+                        cell_nodes,
+                        cell_nodes + num_cell_nodes);
+  }
+
+  const IndexType conn_size = static_cast<IndexType>(connectivity.size());
+  EXPECT_EQ(
+    get_vtu_block<std::int64_t>(data, offsets[num_fields + 1], conn_size),
+    connectivity);
+
+  const std::vector<std::int64_t> cell_ends =
+    get_vtu_block<std::int64_t>(data, offsets[num_fields + 2], num_cells);
+  const std::vector<std::uint8_t> types =
+    get_vtu_block<std::uint8_t>(data, offsets[num_fields + 3], num_cells);
+  std::int64_t end = 0;
+  for(IndexType cellIdx = 0; cellIdx < num_cells; ++cellIdx)
+  {
+    end += mesh->getNumberOfCellNodes(cellIdx);
+    EXPECT_EQ(cell_ends[cellIdx], end);
+    EXPECT_EQ(types[cellIdx], getCellInfo(mesh->getCellType(cellIdx)).vtk_type);
+  }
+
+  // the last block ends the appended data
+  EXPECT_EQ(offsets.back() + sizeof(std::uint64_t) + num_cells, data.size());
+}
+
+/*!
+ * \brief Writes a mesh to a VTU file with raw and base64 appended data and
+ *  checks both files for correctness.
+ * \param [in] mesh the mesh to write out, deleted on return.
+ * \param [in] path the path of the files to be written, without extension.
+ */
+void test_vtu_mesh(Mesh* mesh, const std::string& path)
+{
+  create_scalar_data(mesh);
+  create_vector_data(mesh);
+  create_multidim_data(mesh);
+
+  const std::string raw_path = path + "_raw.vtu";
+  const std::string base64_path = path + "_base64.vtu";
+  EXPECT_EQ(write_vtu(mesh, raw_path, VTU_RAW), 0);
+  EXPECT_EQ(write_vtu(mesh, base64_path, VTU_BASE64), 0);
+
+  const std::string raw = read_file(raw_path);
+  EXPECT_NE(raw.find("<AppendedData encoding=\"raw\">"), std::string::npos);
+  check_vtu(mesh, raw);
+
+  // each base64 block decodes to the corresponding raw block
+  const std::string base64 = read_file(base64_path);
+  EXPECT_NE(base64.find("<AppendedData encoding=\"base64\">"),
+            std::string::npos);
+
+  const std::string encoded = get_appended_data(base64);
+  std::vector<std::uint64_t> offsets = get_vtu_offsets(base64);
+  offsets.push_back(encoded.size());
+
+  std::string decoded;
+  for(std::size_t i = 0; i + 1 < offsets.size(); ++i)
+  {
+    decoded += decode_base64(
+      encoded.substr(offsets[i], offsets[i + 1] - offsets[i]));
+  }
+  EXPECT_EQ(decoded, get_appended_data(raw));
+
+  delete mesh;
+#if DELETE_VTK_FILES
+  std::remove(raw_path.c_str());
+  std::remove(base64_path.c_str());
+#endif
+}
+
 } /* end namespace internal */
 
 //------------------------------------------------------------------------------
@@ -933,6 +1382,90 @@ TEST(mint_util_write_vtk, ParticleMesh)
   }
 }
 
+/*!
+ * \brief Writes unstructured and particle meshes in the legacy binary VTK
+ *  format and reads them back in to check for correctness.
+ */
+TEST(mint_util_write_vtk, BinaryMesh)
+{
+  for(int dim = 1; dim <= 3; ++dim)
+  {
+    const std::string suffix = std::to_string(dim) + "D.vtk";
+
+    internal::test_binary_mesh(
+      internal::build_mesh<UNSTRUCTURED_MESH, SINGLE_SHAPE>(dim),
+      "binaryUnstructuredMesh" + suffix);
+    internal::test_binary_mesh(
+      internal::build_mesh<UNSTRUCTURED_MESH, MIXED_SHAPE>(dim),
+      "binaryUnstructuredMixedMesh" + suffix);
+    internal::test_binary_mesh(internal::build_mesh<PARTICLE_MESH>(dim),
+                               "binaryParticleMesh" + suffix);
+  }
+}
+
+/*!
+ * \brief Writes meshes of each type to VTU files with raw and base64
+ *  appended data and reads them back in to check for correctness.
+ */
+TEST(mint_util_write_vtk, VTUMesh)
+{
+  for(int dim = 1; dim <= 3; ++dim)
+  {
+    const std::string suffix = std::to_string(dim) + "D";
+
+    internal::test_vtu_mesh(
+      internal::build_mesh<STRUCTURED_UNIFORM_MESH>(dim),
+      "uniformMesh" + suffix);
+    internal::test_vtu_mesh(
+      internal::build_mesh<STRUCTURED_CURVILINEAR_MESH>(dim),
+      "curvilinearMesh" + suffix);
+    internal::test_vtu_mesh(
+      internal::build_mesh<UNSTRUCTURED_MESH, MIXED_SHAPE>(dim),
+      "unstructuredMixedMesh" + suffix);
+    internal::test_vtu_mesh(internal::build_mesh<PARTICLE_MESH>(dim),
+                            "particleMesh" + suffix);
+  }
+}
+
+/*!
+ * \brief Writes the pieces of a mesh distributed over two ranks and checks
+ *  that each rank writes its piece and that rank 0 writes the index.
+ */
+TEST(mint_util_write_vtk, PVTUMesh)
+{
+  const std::string path = "pvtuMesh.pvtu";
+  const std::string pieces[] = {"pvtuMesh_000000.vtu", "pvtuMesh_000001.vtu"};
+
+  for(int rank = 0; rank < 2; ++rank)
+  {
+    Mesh* mesh = internal::build_mesh<UNSTRUCTURED_MESH, MIXED_SHAPE>(3);
+    internal::create_scalar_data(mesh);
+    EXPECT_EQ(write_pvtu(mesh, path, rank, 2, VTU_BASE64), 0);
+    delete mesh;
+
+    EXPECT_TRUE(std::ifstream(pieces[rank].c_str()).good());
+  }
+
+  const std::string index = internal::read_file(path);
+  EXPECT_NE(index.find("<VTKFile type=\"PUnstructuredGrid\""),
+            std::string::npos);
+  EXPECT_NE(index.find("Name=\"node_scalars_double\""), std::string::npos);
+  EXPECT_NE(index.find("Name=\"cell_scalars_int\""), std::string::npos);
+  for(const std::string& piece : pieces)
+  {
+    EXPECT_NE(index.find("<Piece Source=\"" + piece + "\"/>"),
+              std::string::npos);
+  }
+
+#if DELETE_VTK_FILES
+  std::remove(path.c_str());
+  for(const std::string& piece : pieces)
+  {
+    std::remove(piece.c_str());
+  }
+#endif
+}
+
 } /* end namespace mint */
 } /* end namespace axom */
 
@@ -0,0 +1,593 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/mint/utils/reorder_utils.hpp"
+
+#include "axom/mint/mesh/Mesh.hpp"                 /* for Mesh base class */
+#include "axom/mint/mesh/UnstructuredMesh.hpp"     /* for UnstructuredMesh */
+#include "axom/mint/mesh/internal/MeshHelpers.hpp" /* for transposeRelation */
+
+#include "axom/slic/interface/slic.hpp"
+
+// C/C++ includes
+#include <algorithm>  // for std::sort, std::min
+#include <cstdint>    // for std::uint32_t, std::uint64_t
+#include <limits>     // for std::numeric_limits
+#include <utility>    // for std::pair
+
+namespace axom
+{
+namespace mint
+{
+//------------------------------------------------------------------------------
+// INTERNAL HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+using KeyType = std::uint64_t;
+using KeyAndID = std::pair<KeyType, IndexType>;
+
+/*!
+ * \brief Holds the cell-to-node relation of a mesh in compressed row form.
+ */
+struct CellNodes
+{
+  std::vector<IndexType> offsets;
+  std::vector<IndexType> values;
+};
+
+//------------------------------------------------------------------------------
+void getCellNodes(const Mesh* mesh, CellNodes& c2n)
+{
+  const IndexType cellCount = mesh->getNumberOfCells();
+
+  c2n.offsets.resize(cellCount + 1);
+  c2n.offsets[0] = 0;
+  for(IndexType c = 0; c < cellCount; ++c)
+  {
+    c2n.offsets[c + 1] = c2n.offsets[c] + mesh->getNumberOfCellNodes(c);
+  }
+
+  c2n.values.resize(c2n.offsets[cellCount]);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(IndexType c = 0; c < cellCount; ++c)
+  {
+    mesh->getCellNodeIDs(c, &c2n.values[c2n.offsets[c]]);
+  }
+}
+
+//------------------------------------------------------------------------------
+void orderByKey(std::vector<KeyAndID>& keys, std::vector<IndexType>& order)
+{
+  std::sort(keys.begin(), keys.end());
+
+  const IndexType n = static_cast<IndexType>(keys.size());
+  order.resize(n);
+  for(IndexType i = 0; i < n; ++i)
+  {
+    order[i] = keys[i].second;
+  }
+}
+
+/// \name Space-Filling Curves
+/// @{
+
+/*!
+ * \brief Interleaves the bits of the given coordinates into a single key,
+ *  taking the most significant bit of x[0] first.
+ */
+KeyType interleave(const std::uint32_t* x, int dim, int bits)
+{
+  KeyType key = 0;
+  for(int b = bits - 1; b >= 0; --b)
+  {
+    for(int i = 0; i < dim; ++i)
+    {
+      key = (key << 1) | ((x[i] >> b) & 1u);
+    }
+  }
+  return key;
+}
+
+/*!
+ * \brief Converts the given coordinates into the transposed form of their
+ *  Hilbert index, after J. Skilling, "Programming the Hilbert curve",
+ *  AIP Conf. Proc. 707 (2004).
+ */
+void axesToTranspose(std::uint32_t* x, int dim, int bits)
+{
+  const std::uint32_t M = 1u << (bits - 1);
+
+  // inverse undo
+  for(std::uint32_t Q = M; Q > 1; Q >>= 1)
+  {
+    const std::uint32_t P = Q - 1;
+    for(int i = 0; i < dim; ++i)
+    {
+      if(x[i] & Q)
+      {
+        x[0] ^= P;
+      }
+      else
+      {
+        const std::uint32_t t = (x[0] ^ x[i]) & P;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for(int i = 1; i < dim; ++i)
+  {
+    x[i] ^= x[i - 1];
+  }
+
+  std::uint32_t t = 0;
+  for(std::uint32_t Q = M; Q > 1; Q >>= 1)
+  {
+    if(x[dim - 1] & Q)
+    {
+      t ^= Q - 1;
+    }
+  }
+
+  for(int i = 0; i < dim; ++i)
+  {
+    x[i] ^= t;
+  }
+}
+
+/*!
+ * \brief Maps points in a bounding box to their index along a Hilbert or
+ *  Morton curve.
+ */
+class CurveKey
+{
+public:
+  CurveKey(const Mesh* mesh, bool hilbert)
+    : m_dim(mesh->getDimension())
+    , m_bits(std::min(32, 63 / m_dim))
+    , m_hilbert(hilbert)
+  {
+    const IndexType nodeCount = mesh->getNumberOfNodes();
+    const double maxq = static_cast<double>((KeyType(1) << m_bits) - 1);
+
+    for(int d = 0; d < m_dim; ++d)
+    {
+      const double* x = mesh->getCoordinateArray(d);
+      double lo = std::numeric_limits<double>::max();
+      double hi = std::numeric_limits<double>::lowest();
+      for(IndexType i = 0; i < nodeCount; ++i)
+      {
+        lo = std::min(lo, x[i]);
+        hi = std::max(hi, x[i]);
+      }
+
+      m_lo[d] = lo;
+      m_scale[d] = (hi > lo) ? maxq / (hi - lo) : 0.0;
+    }
+  }
+
+  KeyType operator()(const double* pt) const
+  {
+    const double maxq = static_cast<double>((KeyType(1) << m_bits) - 1);
+
+    std::uint32_t q[3] = {0, 0, 0};
+    for(int d = 0; d < m_dim; ++d)
+    {
+      double v = (pt[d] - m_lo[d]) * m_scale[d];
+      v = (v < 0.0) ? 0.0 : ((v > maxq) ? maxq : v);
+      q[d] = static_cast<std::uint32_t>(v);
+    }
+
+    if(m_hilbert)
+    {
+      axesToTranspose(q, m_dim, m_bits);
+    }
+
+    return interleave(q, m_dim, m_bits);
+  }
+
+private:
+  int m_dim;
+  int m_bits;
+  bool m_hilbert;
+  double m_lo[3];
+  double m_scale[3];
+};
+
+//------------------------------------------------------------------------------
+void computeCurveOrdering(const Mesh* mesh,
+                          bool hilbert,
+                          std::vector<IndexType>& node_order,
+                          std::vector<IndexType>& cell_order)
+{
+  const int dim = mesh->getDimension();
+  const IndexType nodeCount = mesh->getNumberOfNodes();
+  const IndexType cellCount = mesh->getNumberOfCells();
+  const CurveKey key(mesh, hilbert);
+
+  const double* coords[3] = {nullptr, nullptr, nullptr};
+  for(int d = 0; d < dim; ++d)
+  {
+    coords[d] = mesh->getCoordinateArray(d);
+  }
+
+  std::vector<KeyAndID> keys(nodeCount);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(IndexType i = 0; i < nodeCount; ++i)
+  {
+    double pt[3];
+    for(int d = 0; d < dim; ++d)
+    {
+      pt[d] = coords[d][i];
+    }
+    keys[i] = KeyAndID(key(pt), i);
+  }
+
+  orderByKey(keys, node_order);
+
+  CellNodes c2n;
+  getCellNodes(mesh, c2n);
+  keys.resize(cellCount);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(IndexType c = 0; c < cellCount; ++c)
+  {
+    double pt[3] = {0.0, 0.0, 0.0};
+    const IndexType begin = c2n.offsets[c];
+    const IndexType end = c2n.offsets[c + 1];
+    for(IndexType j = begin; j < end; ++j)
+    {
+      for(int d = 0; d < dim; ++d)
+      {
+        pt[d] += coords[d][c2n.values[j]];
+      }
+    }
+
+    for(int d = 0; d < dim; ++d)
+    {
+      pt[d] /= static_cast<double>(end - begin);
+    }
+    keys[c] = KeyAndID(key(pt), c);
+  }
+
+  orderByKey(keys, cell_order);
+}
+
+/// @}
+
+/// \name Reverse Cuthill-McKee
+/// @{
+
+/*!
+ * \brief Holds the node graph of a mesh in compressed row form.
+ */
+class NodeGraph
+{
+public:
+  NodeGraph(IndexType nodeCount, const CellNodes& c2n)
+    : m_num_nodes(nodeCount)
+    , m_offsets(nullptr)
+    , m_adjacent(nullptr)
+  {
+    const IndexType cellCount =
+      static_cast<IndexType>(c2n.offsets.size()) - 1;
+
+    IndexType* n2coffsets = nullptr;
+    IndexType* n2c = nullptr;
+    internal::transposeRelation(cellCount,
+                                c2n.offsets.data(),
+                                0,
+                                c2n.values.data(),
+                                nodeCount,
+                                n2coffsets,
+                                n2c);
+
+    // Two nodes are adjacent if they share a cell, which is the cell
+    // neighbor relation with the roles of the nodes and cells swapped.
+    internal::initCellNeighbors(nodeCount,
+                                n2coffsets,
+                                0,
+                                n2c,
+                                c2n.offsets.data(),
+                                c2n.values.data(),
+                                m_offsets,
+                                m_adjacent);
+
+    delete[] n2coffsets;
+    delete[] n2c;
+  }
+
+  ~NodeGraph()
+  {
+    delete[] m_offsets;
+    delete[] m_adjacent;
+  }
+
+  IndexType getNumberOfNodes() const { return m_num_nodes; }
+
+  IndexType getDegree(IndexType n) const
+  {
+    return m_offsets[n + 1] - m_offsets[n];
+  }
+
+  const IndexType* begin(IndexType n) const
+  {
+    return m_adjacent + m_offsets[n];
+  }
+
+  const IndexType* end(IndexType n) const
+  {
+    return m_adjacent + m_offsets[n + 1];
+  }
+
+private:
+  IndexType m_num_nodes;
+  IndexType* m_offsets;
+  IndexType* m_adjacent;
+
+  DISABLE_COPY_AND_ASSIGNMENT(NodeGraph);
+  DISABLE_MOVE_AND_ASSIGNMENT(NodeGraph);
+};
+
+/*!
+ * \brief Appends the nodes reachable from root to order in breadth-first
+ *  order, visiting the neighbors of each node in order of increasing degree.
+ *
+ * \param [out] depth the number of levels below the root.
+ *
+ * \return the index in order of the first node of the last level.
+ */
+IndexType breadthFirst(const NodeGraph& graph,
+                       IndexType root,
+                       std::vector<bool>& visited,
+                       std::vector<IndexType>& order,
+                       IndexType& depth)
+{
+  std::vector<std::pair<IndexType, IndexType>> next;
+
+  IndexType head = static_cast<IndexType>(order.size());
+  IndexType levelBegin = head;
+  IndexType levelEnd = head + 1;
+  IndexType lastLevel = head;
+  depth = 0;
+
+  visited[root] = true;
+  order.push_back(root);
+
+  while(head < static_cast<IndexType>(order.size()))
+  {
+    if(head == levelEnd)
+    {
+      levelBegin = levelEnd;
+      levelEnd = static_cast<IndexType>(order.size());
+      ++depth;
+    }
+    lastLevel = levelBegin;
+
+    const IndexType n = order[head++];
+    next.clear();
+    for(const IndexType* it = graph.begin(n); it != graph.end(n); ++it)
+    {
+      if(!visited[*it])
+      {
+        visited[*it] = true;
+        next.push_back(std::make_pair(graph.getDegree(*it), *it));
+      }
+    }
+
+    std::sort(next.begin(), next.end());
+    for(const auto& p : next)
+    {
+      order.push_back(p.second);
+    }
+  }
+
+  return lastLevel;
+}
+
+/*!
+ * \brief Finds a pseudo-peripheral node of the component holding seed, after
+ *  N. Gibbs, W. Poole and P. Stockmeyer, SIAM J. Numer. Anal. 13 (1976).
+ */
+IndexType findPseudoPeripheralNode(const NodeGraph& graph,
+                                   IndexType seed,
+                                   std::vector<bool>& visited)
+{
+  std::vector<IndexType> level;
+  IndexType root = seed;
+  IndexType eccentricity = -1;
+
+  for(;;)
+  {
+    level.clear();
+    IndexType depth = 0;
+    const IndexType lastLevel =
+      breadthFirst(graph, root, visited, level, depth);
+    for(IndexType n : level)
+    {
+      visited[n] = false;
+    }
+
+    if(depth <= eccentricity)
+    {
+      break;
+    }
+    eccentricity = depth;
+
+    // restart from the node of least degree in the last level
+    IndexType candidate = level[lastLevel];
+    for(IndexType i = lastLevel + 1; i < static_cast<IndexType>(level.size());
+        ++i)
+    {
+      if(graph.getDegree(level[i]) < graph.getDegree(candidate))
+      {
+        candidate = level[i];
+      }
+    }
+
+    if(candidate == root)
+    {
+      break;
+    }
+    root = candidate;
+  }
+
+  return root;
+}
+
+//------------------------------------------------------------------------------
+void computeRCMOrdering(const Mesh* mesh,
+                        std::vector<IndexType>& node_order,
+                        std::vector<IndexType>& cell_order)
+{
+  const IndexType nodeCount = mesh->getNumberOfNodes();
+  const IndexType cellCount = mesh->getNumberOfCells();
+
+  CellNodes c2n;
+  getCellNodes(mesh, c2n);
+  const NodeGraph graph(nodeCount, c2n);
+
+  // Seed each connected component from its node of least degree.
+  std::vector<KeyAndID> seeds(nodeCount);
+  for(IndexType i = 0; i < nodeCount; ++i)
+  {
+    seeds[i] = KeyAndID(graph.getDegree(i), i);
+  }
+  std::sort(seeds.begin(), seeds.end());
+
+  std::vector<bool> visited(nodeCount, false);
+  node_order.clear();
+  node_order.reserve(nodeCount);
+  for(const KeyAndID& seed : seeds)
+  {
+    if(!visited[seed.second])
+    {
+      const IndexType root =
+        findPseudoPeripheralNode(graph, seed.second, visited);
+      IndexType depth = 0;
+      breadthFirst(graph, root, visited, node_order, depth);
+    }
+  }
+
+  std::reverse(node_order.begin(), node_order.end());
+
+  // Order the cells by their lowest new node ID.
+  std::vector<IndexType> newNodeIDs(nodeCount);
+  for(IndexType i = 0; i < nodeCount; ++i)
+  {
+    newNodeIDs[node_order[i]] = i;
+  }
+
+  std::vector<KeyAndID> keys(cellCount);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(IndexType c = 0; c < cellCount; ++c)
+  {
+    IndexType lowest = nodeCount;
+    for(IndexType j = c2n.offsets[c]; j < c2n.offsets[c + 1]; ++j)
+    {
+      lowest = std::min(lowest, newNodeIDs[c2n.values[j]]);
+    }
+    keys[c] = KeyAndID(lowest, c);
+  }
+
+  orderByKey(keys, cell_order);
+}
+
+/// @}
+
+} /* end anonymous namespace */
+
+//------------------------------------------------------------------------------
+// PUBLIC API IMPLEMENTATION
+//------------------------------------------------------------------------------
+int compute_mesh_ordering(const Mesh* mesh,
+                          int ordering,
+                          std::vector<IndexType>& node_order,
+                          std::vector<IndexType>& cell_order)
+{
+  SLIC_ERROR_IF(mesh == nullptr, "supplied mesh is null!");
+
+  if(!mesh->isUnstructured())
+  {
+    SLIC_WARNING("mesh reordering requires an unstructured mesh!");
+    return -1;
+  }
+
+  switch(ordering)
+  {
+  case HILBERT_ORDERING:
+    computeCurveOrdering(mesh, true, node_order, cell_order);
+    break;
+  case MORTON_ORDERING:
+    computeCurveOrdering(mesh, false, node_order, cell_order);
+    break;
+  case RCM_ORDERING:
+    computeRCMOrdering(mesh, node_order, cell_order);
+    break;
+  default:
+    SLIC_WARNING("unknown mesh ordering [" << ordering << "]!");
+    return -1;
+  }
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+int reorder_mesh(Mesh* mesh,
+                 int ordering,
+                 std::vector<IndexType>& node_order,
+                 std::vector<IndexType>& cell_order)
+{
+  const int rc = compute_mesh_ordering(mesh, ordering, node_order, cell_order);
+  if(rc != 0)
+  {
+    return rc;
+  }
+
+  if(mesh->hasCompactConnectivity() && mesh->hasMixedCellTypes())
+  {
+    static_cast<UnstructuredMesh<MIXED_SHAPE, int32>*>(mesh)->renumber(
+      node_order.data(),
+      cell_order.data());
+  }
+  else if(mesh->hasCompactConnectivity())
+  {
+    static_cast<UnstructuredMesh<SINGLE_SHAPE, int32>*>(mesh)->renumber(
+      node_order.data(),
+      cell_order.data());
+  }
+  else if(mesh->hasMixedCellTypes())
+  {
+    static_cast<UnstructuredMesh<MIXED_SHAPE>*>(mesh)->renumber(
+      node_order.data(),
+      cell_order.data());
+  }
+  else
+  {
+    static_cast<UnstructuredMesh<SINGLE_SHAPE>*>(mesh)->renumber(
+      node_order.data(),
+      cell_order.data());
+  }
+
+  return 0;
+}
+
+} /* namespace mint */
+
+} /* namespace axom */
@@ -0,0 +1,88 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef MINT_UTILS_REORDER_UTILS_HPP_
+#define MINT_UTILS_REORDER_UTILS_HPP_
+
+#include "axom/mint/config.hpp"  // for IndexType
+
+#include <vector>  // for std::vector
+
+namespace axom
+{
+namespace mint
+{
+// Forward Declarations
+class Mesh;
+
+/*!
+ * \brief Enumerates the orderings computed by compute_mesh_ordering().
+ */
+enum ReorderingType
+{
+  HILBERT_ORDERING,  ///< nodes and cell centroids along a Hilbert curve
+  MORTON_ORDERING,   ///< nodes and cell centroids along a Morton curve
+  RCM_ORDERING       ///< reverse Cuthill-McKee ordering of the node graph
+};
+
+/*!
+ * \brief Computes node and cell orderings of an unstructured mesh that
+ *  improve its memory locality.
+ *
+ * \param [in] mesh pointer to the mesh.
+ * \param [in] ordering the ordering to compute, see ReorderingType.
+ * \param [out] node_order the old ID of each new node.
+ * \param [out] cell_order the old ID of each new cell.
+ *
+ * \return status error code, zero on success
+ *
+ * With HILBERT_ORDERING and MORTON_ORDERING, nodes are sorted by the
+ * position of their coordinates along a space-filling curve through the
+ * bounding box of the mesh, and cells by the position of their centroids.
+ * With RCM_ORDERING, nodes are numbered by the reverse Cuthill-McKee
+ * ordering of the graph in which two nodes are adjacent if they share a cell,
+ * which reduces the bandwidth of node-based sparse matrices, and cells are
+ * sorted by their lowest new node ID.
+ *
+ * \note The mesh is not modified.
+ *
+ * \pre mesh != nullptr
+ * \pre mesh->isUnstructured()==true
+ */
+int compute_mesh_ordering(const Mesh* mesh,
+                          int ordering,
+                          std::vector<IndexType>& node_order,
+                          std::vector<IndexType>& cell_order);
+
+/*!
+ * \brief Renumbers the nodes and cells of an unstructured mesh to improve
+ *  its memory locality.
+ *
+ * \param [in,out] mesh pointer to the mesh.
+ * \param [in] ordering the ordering to apply, see ReorderingType.
+ * \param [out] node_order the old ID of each new node.
+ * \param [out] cell_order the old ID of each new cell.
+ *
+ * \return status error code, zero on success
+ *
+ * The orderings are computed by compute_mesh_ordering() and applied with
+ * UnstructuredMesh::renumber(), which permutes the coordinates, the cell
+ * connectivity and the node, cell and face-centered fields consistently.
+ * A value stored at new node i was stored at node node_order[ i ] before
+ * the call, and likewise for cells.
+ *
+ * \pre mesh != nullptr
+ * \pre mesh->isUnstructured()==true
+ */
+int reorder_mesh(Mesh* mesh,
+                 int ordering,
+                 std::vector<IndexType>& node_order,
+                 std::vector<IndexType>& cell_order);
+
+} /* namespace mint */
+
+} /* namespace axom */
+
+#endif /* MINT_UTILS_REORDER_UTILS_HPP_ */
@@ -5,12 +5,33 @@
 
 #include "axom/mint/utils/su2_utils.hpp"
 
+#include "axom/config.hpp"                   /* for AXOM_USE_OPENMP */
+#include "axom/core/utilities/Utilities.hpp" /* for utilities::max */
+
 #include "axom/mint/mesh/Mesh.hpp"             /* for Mesh base class */
 #include "axom/mint/mesh/UnstructuredMesh.hpp" /* for UnstructuredMesh */
 #include "axom/mint/mesh/CellTypes.hpp"
 
+#ifdef AXOM_USE_OPENMP
+  #include <omp.h>
+#endif
+
 // C/C++ includes
-#include <fstream>  // for std::ifstream
+#include <cstdint>  // for std::uint64_t
+#include <cstdlib>  // for std::strtod
+#include <cstring>  // for std::memchr, std::strncmp
+#include <fstream>  // for std::ifstream, std::ofstream
+#include <string>   // for std::string
+#include <vector>   // for std::vector
+
+#ifdef WIN32
+  #include <iterator>  // for std::istreambuf_iterator
+#else
+  #include <fcntl.h>     // for open
+  #include <sys/mman.h>  // for mmap, munmap
+  #include <sys/stat.h>  // for fstat
+  #include <unistd.h>    // for close
+#endif
 
 namespace axom
 {
@@ -100,128 +121,581 @@ int getSU2CellType(mint::CellType mint_type)
 }
 
 //------------------------------------------------------------------------------
-void read_points(double* points, int npoin, int ndime, std::ifstream& ifs)
+int get_max_threads()
 {
-  SLIC_ASSERT(points != nullptr);
+#ifdef AXOM_USE_OPENMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
 
-  if(npoin <= 0)
+/*!
+ * \brief Read-only view of the contents of a file.
+ *
+ *  The file is memory-mapped where supported. Otherwise, its contents are
+ *  read into a buffer.
+ */
+class MappedFile
+{
+public:
+  explicit MappedFile(const std::string& path)
+    : m_data(nullptr)
+    , m_size(0)
+    , m_valid(false)
   {
-    return;
+#ifdef WIN32
+    std::ifstream ifs(path.c_str(), std::ios::binary);
+    if(ifs.is_open())
+    {
+      m_buffer.assign(std::istreambuf_iterator<char>(ifs),
+                      std::istreambuf_iterator<char>());
+      m_data = m_buffer.data();
+      m_size = m_buffer.size();
+      m_valid = true;
+    }
+#else
+    const int fd = open(path.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+      return;
+    }
+
+    struct stat sb;
+    if(fstat(fd, &sb) == 0)
+    {
+      m_size = static_cast<std::size_t>(sb.st_size);
+      m_valid = true;
+
+      if(m_size > 0)
+      {
+        void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        m_valid = (data != MAP_FAILED);
+        m_data = m_valid ? static_cast<const char*>(data) : nullptr;
+      }
+    }
+
+    close(fd);
+#endif
   }
 
-  std::string line = "";
-  for(int ipoint = 0; ipoint < npoin; ++ipoint)
+  ~MappedFile()
   {
-    const int offset = ipoint * ndime;
-    for(int idim = 0; idim < ndime; ++idim)
+#ifndef WIN32
+    if(m_data != nullptr)
     {
-      ifs >> points[offset + idim];
+      munmap(const_cast<char*>(m_data), m_size);
     }
+#endif
+  }
 
-    std::getline(ifs, line);
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  bool isValid() const { return m_valid; }
+  const char* begin() const { return m_data; }
+  const char* end() const { return m_data + m_size; }
+
+private:
+  const char* m_data;
+  std::size_t m_size;
+  bool m_valid;
+#ifdef WIN32
+  std::vector<char> m_buffer;
+#endif
+};
+
+/*!
+ * \brief Returns a pointer past the end of the line that contains p.
+ */
+inline const char* next_line(const char* p, const char* end)
+{
+  const void* eol = std::memchr(p, '\n', end - p);
+  return (eol != nullptr) ? static_cast<const char*>(eol) + 1 : end;
+}
 
-  }  // END for all points
+/*!
+ * \brief Returns a pointer to the first character at or after p that is not a
+ *  space, a tab or a carriage return.
+ */
+inline const char* skip_blanks(const char* p, const char* end)
+{
+  while(p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+  {
+    ++p;
+  }
+  return p;
 }
 
-//------------------------------------------------------------------------------
-void read_connectivity(axom::IndexType* connectivity,
-                       mint::CellType* cellTypes,
-                       int nelem,
-                       bool& isMixed,
-                       std::ifstream& ifs)
+/*!
+ * \brief Returns true if the line that starts at p has data on it.
+ */
+inline bool is_record(const char* p, const char* end)
 {
-  SLIC_ASSERT(cellTypes != nullptr);
-  SLIC_ASSERT(connectivity != nullptr);
+  p = skip_blanks(p, end);
+  return (p < end && *p != '\n');
+}
 
-  if(nelem <= 0)
+/*!
+ * \brief Parses an integer, skipping leading blanks.
+ *
+ * \return pointer past the parsed characters, nullptr if there is no integer.
+ */
+inline const char* parse_int(const char* p, const char* end, IndexType& value)
+{
+  p = skip_blanks(p, end);
+
+  const bool negative = (p < end && *p == '-');
+  if(p < end && (*p == '-' || *p == '+'))
   {
-    return;
+    ++p;
   }
 
-  std::string line = "";
-  int ctype;
-  for(int icell = 0; icell < nelem; ++icell)
+  const char* digits = p;
+  IndexType v = 0;
+  for(; p < end && *p >= '0' && *p <= '9'; ++p)
+  {
+    v = 10 * v + (*p - '0');
+  }
+
+  value = negative ? -v : v;
+  return (p != digits) ? p : nullptr;
+}
+
+/*!
+ * \brief Parses a floating point number, skipping leading blanks.
+ *
+ *  Numbers with at most 19 significant digits that fit exactly in a double
+ *  and have a decimal exponent within [-22, 22] are computed with a single
+ *  correctly rounded multiplication or division. Other numbers fall back to
+ *  std::strtod, so the result always matches std::strtod.
+ *
+ * \return pointer past the parsed characters, nullptr if there is no number.
+ */
+inline const char* parse_double(const char* p, const char* end, double& value)
+{
+  static const double POW10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                 1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                 1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                 1e18, 1e19, 1e20, 1e21, 1e22};
+  constexpr std::uint64_t MAX_EXACT = std::uint64_t(1) << 53;
+
+  p = skip_blanks(p, end);
+  const char* token = p;
+
+  const bool negative = (p < end && *p == '-');
+  if(p < end && (*p == '-' || *p == '+'))
   {
-    ifs >> ctype;
-    mint::CellType c = getMintCellType(ctype);
-    SLIC_ASSERT(c != mint::UNDEFINED_CELL);
-    cellTypes[icell] = c;
+    ++p;
+  }
 
-    if(!isMixed)
+  std::uint64_t mantissa = 0;
+  int num_digits = 0;
+  int exponent = 0;
+  bool exact = true;
+  bool has_digits = false;
+
+  for(; p < end && *p >= '0' && *p <= '9'; ++p)
+  {
+    has_digits = true;
+    if(num_digits < 19)
     {
-      isMixed = ((icell > 0) && (cellTypes[icell - 1] != c)) ? true : false;
+      mantissa = 10 * mantissa + (*p - '0');
+      num_digits += (mantissa != 0) ? 1 : 0;
     }
+    else
+    {
+      exact = false;
+    }
+  }
 
-    const int offset = icell * mint::MAX_CELL_NODES;
-    const int numNodes = mint::getCellInfo(c).num_nodes;
-    for(int inode = 0; inode < numNodes; ++inode)
+  if(p < end && *p == '.')
+  {
+    for(++p; p < end && *p >= '0' && *p <= '9'; ++p)
     {
-      ifs >> connectivity[offset + inode];
+      has_digits = true;
+      if(num_digits < 19)
+      {
+        mantissa = 10 * mantissa + (*p - '0');
+        num_digits += (mantissa != 0) ? 1 : 0;
+        --exponent;
+      }
+      else
+      {
+        exact = false;
+      }
     }
+  }
 
-    std::getline(ifs, line);
+  if(has_digits && p < end && (*p == 'e' || *p == 'E'))
+  {
+    const char* q = p + 1;
+    const bool negative_exponent = (q < end && *q == '-');
+    if(q < end && (*q == '-' || *q == '+'))
+    {
+      ++q;
+    }
 
-  }  // END for all cells
+    if(q < end && *q >= '0' && *q <= '9')
+    {
+      int e = 0;
+      for(; q < end && *q >= '0' && *q <= '9'; ++q)
+      {
+        e = (e < 10000) ? 10 * e + (*q - '0') : e;
+      }
+
+      exponent += negative_exponent ? -e : e;
+      p = q;
+    }
+  }
+
+  if(has_digits && exact && mantissa <= MAX_EXACT && exponent >= -22 &&
+     exponent <= 22)
+  {
+    const double v = static_cast<double>(mantissa);
+    value = (exponent < 0) ? v / POW10[-exponent] : v * POW10[exponent];
+    value = negative ? -value : value;
+    return p;
+  }
+
+  // fall back to std::strtod, which stops at the blank after the token
+  const char* token_end = token;
+  while(token_end < end && *token_end != ' ' && *token_end != '\t' &&
+        *token_end != '\r' && *token_end != '\n')
+  {
+    ++token_end;
+  }
+
+  if(token_end == token)
+  {
+    return nullptr;
+  }
+
+  char* parsed_end = nullptr;
+  if(token_end < end)
+  {
+    value = std::strtod(token, &parsed_end);
+    return (parsed_end != token) ? parsed_end : nullptr;
+  }
+
+  // the token ends the file, parse a null-terminated copy
+  const std::string copy(token, token_end);
+  value = std::strtod(copy.c_str(), &parsed_end);
+  return (parsed_end != copy.c_str()) ? token + (parsed_end - copy.c_str())
+                                      : nullptr;
+}
+
+/*!
+ * \brief The records that follow an NPOIN= or NELEM= keyword.
+ */
+struct Section
+{
+  const char* begin;
+  const char* end;
+  IndexType size;
+};
+
+/*!
+ * \brief A range of whole lines of a section, parsed by a single task.
+ */
+struct Chunk
+{
+  const char* begin;
+  const char* end;
+  IndexType num_records;   // number of records in the chunk
+  IndexType num_values;    // number of cell nodes in the chunk
+  IndexType first_record;  // index of the first record of the chunk
+  IndexType first_value;   // connectivity offset of the first record
+  CellType cell_type;      // type of the first cell of the chunk
+  bool mixed;              // true if the chunk has more than one cell type
+  bool valid;              // false if a record could not be parsed
+};
+
+//------------------------------------------------------------------------------
+inline bool starts_with(const char* p, const char* end, const char* prefix)
+{
+  const std::size_t n = std::strlen(prefix);
+  return (static_cast<std::size_t>(end - p) >= n) &&
+    (std::strncmp(p, prefix, n) == 0);
+}
+
+//------------------------------------------------------------------------------
+const char* skip_records(const char* p,
+                         const char* end,
+                         IndexType n,
+                         IndexType& found)
+{
+  found = 0;
+  while(found < n && p < end)
+  {
+    found += is_record(p, end) ? 1 : 0;
+    p = next_line(p, end);
+  }
+  return p;
 }
 
 //------------------------------------------------------------------------------
-void read_data(std::ifstream& ifs,
-               int& ndime,
-               int& nelem,
-               int& npoin,
-               bool& isMixed,
-               double*& points,
-               axom::IndexType*& connectivity,
-               mint::CellType*& cellTypes)
+bool read_section(const char* line,
+                  const char* line_end,
+                  const char* end,
+                  Section& section)
 {
-  // sanity checks
-  SLIC_ASSERT(points == nullptr);
-  SLIC_ASSERT(connectivity == nullptr);
-  SLIC_ASSERT(cellTypes == nullptr);
+  IndexType size = -1;
+  if(parse_int(line + 6, line_end, size) == nullptr || size < 0)
+  {
+    return false;
+  }
 
-  std::string line = "";
-  while(std::getline(ifs, line))
+  IndexType found = 0;
+  section.begin = line_end;
+  section.end = skip_records(line_end, end, size, found);
+  section.size = size;
+  return (found == size);
+}
+
+//------------------------------------------------------------------------------
+bool find_sections(const MappedFile& su2,
+                   int& ndime,
+                   Section& points,
+                   Section& cells)
+{
+  const char* end = su2.end();
+  const char* p = su2.begin();
+  while(p < end)
   {
-    if(line.substr(0, 1) == "%" || line.length() == 0)
+    const char* line = p;
+    p = next_line(line, end);
+
+    if(*line == '%' || !is_record(line, p))
     {
       // skip empty lines and comments
       continue;
     }
 
-    if(line.substr(0, 6) == "NDIME=")
+    if(starts_with(line, end, "NDIME="))
     {
-      ndime = std::stoi(line.substr(6, line.length()));
+      IndexType value = -1;
+      parse_int(line + 6, p, value);
+      ndime = static_cast<int>(value);
       SLIC_ERROR_IF((ndime < 2) || (ndime > 3),
                     "mesh dimension must be 2 or 3!");
     }
-    else if(line.substr(0, 6) == "NPOIN=")
+    else if(starts_with(line, end, "NPOIN="))
     {
       SLIC_ERROR_IF(ndime == -1,
                     "dimension must be set prior to parsing the mesh points!");
 
-      npoin = std::stoi(line.substr(6, line.length()));
-      points = axom::allocate<double>(npoin * ndime);
-      read_points(points, npoin, ndime, ifs);
+      if(!read_section(line, p, end, points))
+      {
+        return false;
+      }
+      p = points.end;
     }
-    else if(line.substr(0, 6) == "NELEM=")
+    else if(starts_with(line, end, "NELEM="))
     {
       SLIC_ERROR_IF(
         ndime == -1,
         "dimension must be set prior to parsing mesh connectivity!");
 
-      nelem = std::stoi(line.substr(6, line.length()));
-      connectivity =
-        axom::allocate<axom::IndexType>(nelem * mint::MAX_CELL_NODES);
-      cellTypes = axom::allocate<mint::CellType>(nelem);
-      read_connectivity(connectivity, cellTypes, nelem, isMixed, ifs);
+      if(!read_section(line, p, end, cells))
+      {
+        return false;
+      }
+      p = cells.end;
     }
 
   }  // END while
 
-  // sanity checks
-  SLIC_ASSERT(points != nullptr);
-  SLIC_ASSERT(connectivity != nullptr);
-  SLIC_ASSERT(cellTypes != nullptr);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+std::vector<Chunk> split_section(const Section& section)
+{
+  constexpr std::ptrdiff_t MIN_CHUNK_BYTES = 1 << 16;
+
+  const std::ptrdiff_t nbytes = section.end - section.begin;
+  const std::ptrdiff_t max_chunks = 4 * get_max_threads();
+  const int nchunks = static_cast<int>(utilities::clampVal(
+    nbytes / MIN_CHUNK_BYTES, std::ptrdiff_t(1), max_chunks));
+
+  std::vector<Chunk> chunks(nchunks);
+  const char* p = section.begin;
+  for(int i = 0; i < nchunks; ++i)
+  {
+    const char* q = section.begin + (i + 1) * nbytes / nchunks;
+    if(q < section.end && q > p && q[-1] != '\n')
+    {
+      // move the end of the chunk to the start of the next line
+      q = next_line(q, section.end);
+    }
+
+    Chunk& chunk = chunks[i];
+    chunk.begin = p;
+    chunk.end = utilities::max(p, q);
+    chunk.num_records = 0;
+    chunk.num_values = 0;
+    chunk.first_record = 0;
+    chunk.first_value = 0;
+    chunk.cell_type = mint::UNDEFINED_CELL;
+    chunk.mixed = false;
+    chunk.valid = true;
+
+    p = chunk.end;
+  }
+
+  return chunks;
+}
+
+//------------------------------------------------------------------------------
+void count_records(std::vector<Chunk>& chunks, bool cells)
+{
+  const int nchunks = static_cast<int>(chunks.size());
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(dynamic, 1)
+#endif
+  for(int i = 0; i < nchunks; ++i)
+  {
+    Chunk& chunk = chunks[i];
+    for(const char* p = chunk.begin; p < chunk.end; p = next_line(p, chunk.end))
+    {
+      if(!is_record(p, chunk.end))
+      {
+        continue;
+      }
+
+      if(!cells)
+      {
+        ++chunk.num_records;
+        continue;
+      }
+
+      IndexType ctype = -1;
+      parse_int(p, chunk.end, ctype);
+      const mint::CellType c = getMintCellType(static_cast<int>(ctype));
+      if(c == mint::UNDEFINED_CELL)
+      {
+        chunk.valid = false;
+        break;
+      }
+
+      if(chunk.num_records == 0)
+      {
+        chunk.cell_type = c;
+      }
+      chunk.mixed = chunk.mixed || (c != chunk.cell_type);
+
+      ++chunk.num_records;
+      chunk.num_values += mint::getCellInfo(c).num_nodes;
+    }
+  }
+
+  // the first record and connectivity offset of each chunk
+  IndexType num_records = 0;
+  IndexType num_values = 0;
+  for(Chunk& chunk : chunks)
+  {
+    chunk.first_record = num_records;
+    chunk.first_value = num_values;
+    num_records += chunk.num_records;
+    num_values += chunk.num_values;
+  }
+}
+
+//------------------------------------------------------------------------------
+bool read_points(std::vector<Chunk>& chunks, int ndime, double* const* coords)
+{
+  const int nchunks = static_cast<int>(chunks.size());
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(dynamic, 1)
+#endif
+  for(int i = 0; i < nchunks; ++i)
+  {
+    Chunk& chunk = chunks[i];
+    IndexType ipoint = chunk.first_record;
+
+    const char* line = chunk.begin;
+    while(line < chunk.end && chunk.valid)
+    {
+      const char* line_end = next_line(line, chunk.end);
+      if(is_record(line, line_end))
+      {
+        const char* p = line;
+        for(int idim = 0; idim < ndime && p != nullptr; ++idim)
+        {
+          p = parse_double(p, line_end, coords[idim][ipoint]);
+        }
+
+        chunk.valid = (p != nullptr);
+        ++ipoint;
+      }
+      line = line_end;
+    }
+  }
+
+  bool valid = true;
+  for(const Chunk& chunk : chunks)
+  {
+    valid = valid && chunk.valid;
+  }
+  return valid;
+}
+
+//------------------------------------------------------------------------------
+bool read_connectivity(std::vector<Chunk>& chunks,
+                       axom::IndexType* connectivity,
+                       axom::IndexType* offsets,
+                       mint::CellType* cellTypes)
+{
+  const int nchunks = static_cast<int>(chunks.size());
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(dynamic, 1)
+#endif
+  for(int i = 0; i < nchunks; ++i)
+  {
+    Chunk& chunk = chunks[i];
+    IndexType icell = chunk.first_record;
+    IndexType offset = chunk.first_value;
+
+    const char* line = chunk.begin;
+    while(line < chunk.end && chunk.valid)
+    {
+      const char* line_end = next_line(line, chunk.end);
+      if(is_record(line, line_end))
+      {
+        IndexType ctype = -1;
+        const char* p = parse_int(line, line_end, ctype);
+        const mint::CellType c = getMintCellType(static_cast<int>(ctype));
+        const int numNodes = mint::getCellInfo(c).num_nodes;
+
+        for(int inode = 0; inode < numNodes && p != nullptr; ++inode)
+        {
+          p = parse_int(p, line_end, connectivity[offset + inode]);
+        }
+
+        if(cellTypes != nullptr)
+        {
+          cellTypes[icell] = c;
+          offsets[icell + 1] = offset + numNodes;
+        }
+
+        chunk.valid = (p != nullptr);
+        offset += numNodes;
+        ++icell;
+      }
+      line = line_end;
+    }
+  }
+
+  bool valid = true;
+  for(const Chunk& chunk : chunks)
+  {
+    valid = valid && chunk.valid;
+  }
+  return valid;
 }
 
 } /* end anonymous namespace */
@@ -232,73 +706,107 @@ int read_su2(const std::string& file, Mesh*& mesh)
   SLIC_ERROR_IF(file.length() <= 0, "No SU2 file was supplied!");
   SLIC_ERROR_IF(mesh != nullptr, "supplied mesh pointer should be a nullptr");
 
-  std::ifstream ifs(file.c_str());
-  if(!ifs.is_open())
+  MappedFile su2(file);
+  if(!su2.isValid())
   {
     SLIC_WARNING("cannot read from file [" << file << "]");
     return -1;
   }
 
-  // STEP 0: read the raw data
+  // STEP 0: locate the node and cell sections
   int ndime = -1;
-  int nelem = -1;
-  int npoin = -1;
-
-  double* points = nullptr;
-  axom::IndexType* connectivity = nullptr;
-  mint::CellType* cellTypes = nullptr;
-  bool isMixed = false;
+  Section points = {nullptr, nullptr, -1};
+  Section cells = {nullptr, nullptr, -1};
+  if(!find_sections(su2, ndime, points, cells))
+  {
+    SLIC_WARNING("truncated or malformed SU2 file [" << file << "]");
+    return -1;
+  }
 
-  read_data(ifs, ndime, nelem, npoin, isMixed, points, connectivity, cellTypes);
+  const IndexType nelem = cells.size;
+  const IndexType npoin = points.size;
   SLIC_ERROR_IF(ndime < 2 || ndime > 3, "mesh dimension must be 2 or 3!");
   SLIC_ERROR_IF(nelem <= 0, "mesh has zero cells!");
   SLIC_ERROR_IF(npoin <= 0, "mesh has zero nodes!");
 
-  SLIC_ASSERT(points != nullptr);
-  SLIC_ASSERT(connectivity != nullptr);
-  SLIC_ASSERT(cellTypes != nullptr);
-
-  ifs.close();
+  // STEP 1: count the records and cell nodes of each chunk in parallel
+  std::vector<Chunk> pointChunks = split_section(points);
+  std::vector<Chunk> cellChunks = split_section(cells);
+  count_records(pointChunks, false);
+  count_records(cellChunks, true);
 
-  // STEP 1: construct a mint mesh object
-  if(isMixed)
+  bool isMixed = false;
+  bool valid = true;
+  mint::CellType cellType = mint::UNDEFINED_CELL;
+  for(const Chunk& chunk : cellChunks)
   {
-    using MeshType = mint::UnstructuredMesh<mint::MIXED_SHAPE>;
-    MeshType* m = new MeshType(ndime, npoin, nelem);
-
-    for(int i = 0; i < npoin; ++i)
+    valid = valid && chunk.valid;
+    if(chunk.num_records > 0)
     {
-      m->appendNodes(&points[i * ndime], 1);
+      cellType =
+        (cellType == mint::UNDEFINED_CELL) ? chunk.cell_type : cellType;
+      isMixed = isMixed || chunk.mixed || (chunk.cell_type != cellType);
     }
+  }
 
-    for(int i = 0; i < nelem; ++i)
-    {
-      m->appendCell(&connectivity[i * mint::MAX_CELL_NODES], cellTypes[i]);
-    }
+  if(!valid)
+  {
+    SLIC_WARNING("invalid cell type in SU2 file [" << file << "]");
+    return -1;
+  }
+
+  // STEP 2: construct a mint mesh object and parse directly into its arrays
+  const Chunk& last = cellChunks.back();
+  const IndexType connectivitySize = last.first_value + last.num_values;
 
-    mesh = m;
+  UnstructuredMesh<MIXED_SHAPE>* mixedMesh = nullptr;
+  UnstructuredMesh<SINGLE_SHAPE>* singleMesh = nullptr;
+  if(isMixed)
+  {
+    mixedMesh =
+      new UnstructuredMesh<MIXED_SHAPE>(ndime, npoin, nelem, connectivitySize);
+    mixedMesh->resize(npoin, nelem, connectivitySize);
+    mesh = mixedMesh;
   }
   else
   {
-    using MeshType = mint::UnstructuredMesh<mint::SINGLE_SHAPE>;
-    MeshType* m = new MeshType(ndime, cellTypes[0], npoin, nelem);
-
-    for(int i = 0; i < npoin; ++i)
-    {
-      m->appendNodes(&points[i * ndime], 1);
-    }
+    singleMesh =
+      new UnstructuredMesh<SINGLE_SHAPE>(ndime, cellType, npoin, nelem);
+    singleMesh->resize(npoin, nelem);
+    mesh = singleMesh;
+  }
 
-    for(int i = 0; i < nelem; ++i)
-    {
-      m->appendCell(&connectivity[i * mint::MAX_CELL_NODES]);
-    }
+  double* coords[3] = {nullptr, nullptr, nullptr};
+  for(int idim = 0; idim < ndime; ++idim)
+  {
+    coords[idim] = mesh->getCoordinateArray(idim);
+  }
+  valid = read_points(pointChunks, ndime, coords);
 
-    mesh = m;
+  if(isMixed)
+  {
+    valid = valid &&
+      read_connectivity(cellChunks,
+                        mixedMesh->getCellNodesArray(),
+                        mixedMesh->getCellNodesOffsetsArray(),
+                        mixedMesh->getCellTypesArray());
+  }
+  else
+  {
+    valid = valid &&
+      read_connectivity(cellChunks,
+                        singleMesh->getCellNodesArray(),
+                        nullptr,
+                        nullptr);
   }
 
-  axom::deallocate(points);
-  axom::deallocate(connectivity);
-  axom::deallocate(cellTypes);
+  if(!valid)
+  {
+    SLIC_WARNING("malformed record in SU2 file [" << file << "]");
+    delete mesh;
+    mesh = nullptr;
+    return -1;
+  }
 
   SLIC_ASSERT(mesh != nullptr);
   return 0;
@@ -28,6 +28,10 @@ class Mesh;
  *
  * \note The current implementation ignores the boundary markers.
  *
+ * \note The file is memory-mapped and its points and cells are parsed in
+ *  parallel chunks when OpenMP is enabled. Coordinates are parsed to the same
+ *  values as std::strtod.
+ *
  * \note Ownership of the mesh object is passed to the caller. Consequently,
  *  the caller is responsible for properly deallocating the mesh object that
  *  the return mesh pointer points to.
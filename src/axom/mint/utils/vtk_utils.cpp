@@ -3,6 +3,7 @@
 //
 // SPDX-License-Identifier: (BSD-3-Clause)
 
+#include "axom/config.hpp"
 #include "axom/core/Macros.hpp"
 
 #include "axom/mint/utils/vtk_utils.hpp"  // file header
@@ -26,9 +27,18 @@
 
 #include "fmt/fmt.hpp"
 
+#ifdef AXOM_USE_OPENMP
+  #include <omp.h>
+#endif
+
 // C/C++ includes
-#include <fstream>  // for std::ofstream
-#include <string>   // for std::string
+#include <algorithm>  // for std::reverse, std::upper_bound
+#include <cstdint>    // for std::uint64_t
+#include <cstring>    // for std::memcpy
+#include <fstream>    // for std::ofstream
+#include <string>     // for std::string
+#include <type_traits>  // for std::is_integral
+#include <vector>     // for std::vector
 
 namespace axom
 {
@@ -39,6 +49,465 @@ namespace mint
 //------------------------------------------------------------------------------
 namespace internal
 {
+/// Number of values formatted or converted by each thread at a time
+constexpr IndexType CHUNK_SIZE = 1 << 16;
+
+/// Size of the buffer of the output file streams
+constexpr std::size_t STREAM_BUFFER_SIZE = 1 << 22;
+
+/*!
+ * \brief Returns the number of threads used to format the output.
+ */
+int get_max_threads()
+{
+#ifdef AXOM_USE_OPENMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+/*!
+ * \brief Returns true if the host stores multi-byte values in little-endian
+ *  byte order.
+ */
+bool is_little_endian()
+{
+  const std::uint16_t one = 1;
+  unsigned char first_byte;
+  std::memcpy(&first_byte, &one, 1);
+  return first_byte == 1;
+}
+
+/*!
+ * \brief Reverses the byte order of the given value.
+ */
+template <typename T>
+inline T swap_bytes(T value)
+{
+  unsigned char bytes[sizeof(T)];
+  std::memcpy(bytes, &value, sizeof(T));
+  std::reverse(bytes, bytes + sizeof(T));
+  std::memcpy(&value, bytes, sizeof(T));
+  return value;
+}
+
+/*!
+ * \brief Opens the given file for writing with a large stream buffer.
+ *
+ * \param [in] file_path the path of the file to write to.
+ * \param [in] binary true if the file is opened in binary mode.
+ * \param [in,out] buffer the storage of the stream buffer.
+ * \param [out] file the stream to open.
+ *
+ * \note The buffer must outlive the stream.
+ */
+void open_file(const std::string& file_path,
+               bool binary,
+               std::vector<char>& buffer,
+               std::ofstream& file)
+{
+  buffer.resize(STREAM_BUFFER_SIZE);
+  file.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+
+  const std::ios_base::openmode mode =
+    binary ? (std::ios::out | std::ios::binary) : std::ios::out;
+  file.open(file_path.c_str(), mode);
+}
+
+/*!
+ * \brief Formats n items in parallel chunks and writes the chunks in order.
+ *
+ * \param [in] file the stream to write to.
+ * \param [in] n the number of items to format.
+ * \param [in] format_item callable that appends the i-th item to a buffer,
+ *  with the signature void(fmt::memory_buffer&, IndexType i).
+ */
+template <typename FormatItem>
+void write_formatted(std::ofstream& file,
+                     IndexType n,
+                     const FormatItem& format_item)
+{
+  const int nthreads = get_max_threads();
+  std::vector<fmt::memory_buffer> buffers(nthreads);
+
+  for(IndexType start = 0; start < n; start += nthreads * CHUNK_SIZE)
+  {
+    const IndexType remaining = n - start;
+    const IndexType remaining_chunks =
+      (remaining + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    const int nchunks = static_cast<int>(
+      utilities::min<IndexType>(nthreads, remaining_chunks));
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static, 1)
+#endif
+    for(int chunk = 0; chunk < nchunks; ++chunk)
+    {
+      const IndexType begin = start + chunk * CHUNK_SIZE;
+      const IndexType end = utilities::min(begin + CHUNK_SIZE, n);
+
+      fmt::memory_buffer& buffer = buffers[chunk];
+      buffer.clear();
+      for(IndexType i = begin; i < end; ++i)
+      {
+        format_item(buffer, i);
+      }
+    }
+
+    for(int chunk = 0; chunk < nchunks; ++chunk)
+    {
+      file.write(buffers[chunk].data(), buffers[chunk].size());
+    }
+  }
+}
+
+/*!
+ * \brief Writes binary payloads to a stream, either as raw bytes or encoded
+ *  in base64.
+ *
+ *  Consecutive calls to write() are encoded as a single base64 stream until
+ *  finish() is called, which pads the encoded output.
+ */
+class BinaryWriter
+{
+public:
+  BinaryWriter(std::ofstream& file, bool base64)
+    : m_file(file)
+    , m_base64(base64)
+    , m_num_pending(0)
+  { }
+
+  /*!
+   * \brief Returns the number of bytes written out for a block of nbytes.
+   */
+  static std::uint64_t encodedSize(std::uint64_t nbytes, bool base64)
+  {
+    return base64 ? 4 * ((nbytes + 2) / 3) : nbytes;
+  }
+
+  /*!
+   * \brief Writes the given bytes to the stream.
+   */
+  void write(const void* data, std::size_t nbytes)
+  {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    if(!m_base64)
+    {
+      m_file.write(reinterpret_cast<const char*>(bytes), nbytes);
+      return;
+    }
+
+    // complete the bytes left over from the previous call
+    if(m_num_pending > 0)
+    {
+      while(m_num_pending < 3 && nbytes > 0)
+      {
+        m_pending[m_num_pending++] = *bytes++;
+        --nbytes;
+      }
+
+      if(m_num_pending < 3)
+      {
+        return;
+      }
+
+      encode(m_pending, 1);
+      m_num_pending = 0;
+    }
+
+    const std::size_t ntriplets = nbytes / 3;
+    encode(bytes, ntriplets);
+
+    for(std::size_t i = 3 * ntriplets; i < nbytes; ++i)
+    {
+      m_pending[m_num_pending++] = bytes[i];
+    }
+  }
+
+  /*!
+   * \brief Ends the current base64 stream, padding the left over bytes.
+   */
+  void finish()
+  {
+    if(!m_base64 || m_num_pending == 0)
+    {
+      return;
+    }
+
+    unsigned char last[3] = {0, 0, 0};
+    for(int i = 0; i < m_num_pending; ++i)
+    {
+      last[i] = m_pending[i];
+    }
+
+    char encoded[4];
+    encode_triplet(last, encoded);
+    for(int i = m_num_pending + 1; i < 4; ++i)
+    {
+      encoded[i] = '=';
+    }
+
+    m_file.write(encoded, 4);
+    m_num_pending = 0;
+  }
+
+private:
+  static void encode_triplet(const unsigned char* in, char* out)
+  {
+    static const char* ALPHABET =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    out[0] = ALPHABET[in[0] >> 2];
+    out[1] = ALPHABET[((in[0] & 0x03) << 4) | (in[1] >> 4)];
+    out[2] = ALPHABET[((in[1] & 0x0f) << 2) | (in[2] >> 6)];
+    out[3] = ALPHABET[in[2] & 0x3f];
+  }
+
+  void encode(const unsigned char* bytes, std::size_t ntriplets)
+  {
+    if(ntriplets == 0)
+    {
+      return;
+    }
+
+    m_encoded.resize(4 * ntriplets);
+    const IndexType n = static_cast<IndexType>(ntriplets);
+    char* encoded = m_encoded.data();
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static) if(n > CHUNK_SIZE)
+#endif
+    for(IndexType i = 0; i < n; ++i)
+    {
+      encode_triplet(bytes + 3 * i, encoded + 4 * i);
+    }
+
+    m_file.write(m_encoded.data(), m_encoded.size());
+  }
+
+  std::ofstream& m_file;
+  bool m_base64;
+  unsigned char m_pending[3];
+  int m_num_pending;
+  std::vector<char> m_encoded;
+};
+
+/*!
+ * \brief Converts ntuples tuples of ncomp values in parallel chunks and writes
+ *  them out as binary.
+ *
+ * \param [in] writer the binary writer.
+ * \param [in] ntuples the number of tuples.
+ * \param [in] ncomp the number of values per tuple.
+ * \param [in] swap true if the byte order of the values is reversed.
+ * \param [in] fill callable with the signature void(IndexType i, T* tuple),
+ *  which stores the ncomp values of the i-th tuple.
+ */
+template <typename T, typename FillTuple>
+void write_array(BinaryWriter& writer,
+                 IndexType ntuples,
+                 int ncomp,
+                 bool swap,
+                 const FillTuple& fill)
+{
+  const IndexType max_tuples = CHUNK_SIZE * get_max_threads();
+  std::vector<T> buffer(utilities::min(ntuples, max_tuples) * ncomp);
+
+  for(IndexType start = 0; start < ntuples; start += max_tuples)
+  {
+    const IndexType end = utilities::min(start + max_tuples, ntuples);
+    T* values = buffer.data();
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+    for(IndexType i = start; i < end; ++i)
+    {
+      T* tuple = values + (i - start) * ncomp;
+      fill(i, tuple);
+
+      if(swap)
+      {
+        for(int j = 0; j < ncomp; ++j)
+        {
+          tuple[j] = swap_bytes(tuple[j]);
+        }
+      }
+    }
+
+    writer.write(values, (end - start) * ncomp * sizeof(T));
+  }
+}
+
+/*!
+ * \brief Computes the offset of each cell in a flat connectivity array.
+ *
+ * \param [in] mesh the mesh object.
+ * \param [in] with_counts true if each cell is preceded by its node count.
+ * \param [out] offsets the ncells + 1 offsets of the cells.
+ */
+void compute_cell_offsets(const Mesh* mesh,
+                          bool with_counts,
+                          std::vector<IndexType>& offsets)
+{
+  const IndexType num_cells = mesh->getNumberOfCells();
+  offsets.resize(num_cells + 1);
+
+  offsets[0] = 0;
+  for(IndexType cellIdx = 0; cellIdx < num_cells; ++cellIdx)
+  {
+    offsets[cellIdx + 1] = offsets[cellIdx] +
+      mesh->getNumberOfCellNodes(cellIdx) + (with_counts ? 1 : 0);
+  }
+}
+
+/*!
+ * \brief Writes the flat cell connectivity array of a mesh as binary.
+ *
+ * \param [in] writer the binary writer.
+ * \param [in] mesh the mesh whose cells will be written.
+ * \param [in] offsets the cell offsets from compute_cell_offsets().
+ * \param [in] with_counts true if each cell is preceded by its node count.
+ * \param [in] swap true if the byte order of the values is reversed.
+ */
+template <typename T>
+void write_connectivity(BinaryWriter& writer,
+                        const Mesh* mesh,
+                        const std::vector<IndexType>& offsets,
+                        bool with_counts,
+                        bool swap)
+{
+  const IndexType num_cells = mesh->getNumberOfCells();
+  const IndexType max_values = CHUNK_SIZE * get_max_threads();
+  std::vector<T> buffer;
+
+  IndexType start = 0;
+  while(start < num_cells)
+  {
+    // find the range of cells that fills the buffer
+    const IndexType limit = offsets[start] + max_values;
+    IndexType end = std::upper_bound(offsets.begin() + start + 1,
+                                     offsets.end(),
+                                     limit) -
+      offsets.begin() - 1;
+    end = utilities::max(end, start + 1);
+
+    buffer.resize(offsets[end] - offsets[start]);
+    T* values = buffer.data();
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+    for(IndexType cellIdx = start; cellIdx < end; ++cellIdx)
+    {
+      IndexType cell_nodes[MAX_CELL_NODES];
+      const IndexType num_cell_nodes =
+        mesh->getCellNodeIDs(cellIdx, cell_nodes);
+
+      T* cell = values + (offsets[cellIdx] - offsets[start]);
+      if(with_counts)
+      {
+        *cell++ = static_cast<T>(num_cell_nodes);
+      }
+
+      for(IndexType i = 0; i < num_cell_nodes; ++i)
+      {
+        cell[i] = swap ? swap_bytes(static_cast<T>(cell_nodes[i]))
+                       : static_cast<T>(cell_nodes[i]);
+      }
+
+      if(with_counts && swap)
+      {
+        cell[-1] = swap_bytes(cell[-1]);
+      }
+    }
+
+    writer.write(values, buffer.size() * sizeof(T));
+    start = end;
+  }
+}
+
+/*!
+ * \brief Fills the coordinates of a node, padded to three dimensions.
+ */
+class PointFill
+{
+public:
+  explicit PointFill(const Mesh* mesh)
+    : m_mesh(mesh)
+    , m_x(nullptr)
+    , m_y(nullptr)
+    , m_z(nullptr)
+  {
+    if(mesh->hasExplicitCoordinates())
+    {
+      const int mesh_dim = mesh->getDimension();
+      m_x = mesh->getCoordinateArray(X_COORDINATE);
+      m_y = (mesh_dim > 1) ? mesh->getCoordinateArray(Y_COORDINATE) : nullptr;
+      m_z = (mesh_dim > 2) ? mesh->getCoordinateArray(Z_COORDINATE) : nullptr;
+    }
+  }
+
+  void operator()(IndexType nodeIdx, double* xyz) const
+  {
+    if(m_x != nullptr)
+    {
+      xyz[0] = m_x[nodeIdx];
+      xyz[1] = (m_y != nullptr) ? m_y[nodeIdx] : 0.0;
+      xyz[2] = (m_z != nullptr) ? m_z[nodeIdx] : 0.0;
+    }
+    else
+    {
+      xyz[0] = xyz[1] = xyz[2] = 0.0;
+      m_mesh->getNode(nodeIdx, xyz);
+    }
+  }
+
+private:
+  const Mesh* m_mesh;
+  const double* m_x;
+  const double* m_y;
+  const double* m_z;
+};
+
+/*!
+ * \brief Fills the given components of a field tuple, padding the tuple with
+ *  zeros up to a given width.
+ */
+template <typename T>
+class FieldFill
+{
+public:
+  FieldFill(const T* data, int num_components, int first, int count, int width)
+    : m_data(data)
+    , m_num_components(num_components)
+    , m_first(first)
+    , m_count(count)
+    , m_width(width)
+  { }
+
+  void operator()(IndexType i, T* tuple) const
+  {
+    const T* src = m_data + i * m_num_components + m_first;
+    for(int j = 0; j < m_count; ++j)
+    {
+      tuple[j] = src[j];
+    }
+    for(int j = m_count; j < m_width; ++j)
+    {
+      tuple[j] = static_cast<T>(0);
+    }
+  }
+
+private:
+  const T* m_data;
+  int m_num_components;
+  int m_first;
+  int m_count;
+  int m_width;
+};
+
 /*!
  * \brief Computes the maximum number of nodes of a cell on the given mesh.
  *
@@ -79,81 +548,191 @@ IndexType get_max_cell_nodes(const Mesh* mesh, IndexType& total_cell_nodes)
 }
 
 /*!
- * \brief Writes mesh node locations to a VTK file in legacy ASCII format.
+ * \brief Writes a field of type T in the legacy VTK format.
+ *
+ * \param [in] field the field to write out.
+ * \param [in] first the first component to write out.
+ * \param [in] count the number of components to write out.
+ * \param [in] width the number of values per tuple, padded with zeros.
+ * \param [in] binary true if the values are written as binary.
+ * \param [in] file the stream to write to.
+ */
+template <typename T>
+void write_legacy_values(const Field* field,
+                         int first,
+                         int count,
+                         int width,
+                         bool binary,
+                         std::ofstream& file)
+{
+  const T* data_ptr = Field::getDataPtr<T>(field);
+  SLIC_ASSERT(data_ptr != nullptr);
+
+  const FieldFill<T> fill(data_ptr,
+                          field->getNumComponents(),
+                          first,
+                          count,
+                          width);
+
+  if(binary)
+  {
+    BinaryWriter writer(file, false);
+    write_array<T>(writer,
+                   field->getNumTuples(),
+                   width,
+                   is_little_endian(),
+                   fill);
+    file << "\n";
+    return;
+  }
+
+  // 2D vectors are padded with a zero z-component, formatted per type
+  const char* pad = std::is_integral<T>::value ? "0" : "0.0";
+  write_formatted(file,
+                  field->getNumTuples(),
+                  [=](fmt::memory_buffer& buffer, IndexType i) {
+                    T tuple[3];
+                    fill(i, tuple);
+                    if(width == 1)
+                    {
+                      fmt::format_to(buffer, "{}\n", tuple[0]);
+                    }
+                    else if(count == 2)
+                    {
+                      fmt::format_to(buffer,
+                                     "{} {} {}\n",
+                                     tuple[0],
+                                     tuple[1],
+                                     pad);
+                    }
+                    else
+                    {
+                      fmt::format_to(buffer,
+                                     "{} {} {}\n",
+                                     tuple[0],
+                                     tuple[1],
+                                     tuple[2]);
+                    }
+                  });
+}
+
+/*!
+ * \brief Writes mesh node locations to a VTK file in the legacy format.
  * \param [in] mesh the mesh whose nodes will be written.
+ * \param [in] binary true if the values are written as binary.
  * \param [in] file the stream to write to.
  * \pre mesh != nullptr
  */
-void write_points(const Mesh* mesh, std::ofstream& file)
+void write_points(const Mesh* mesh, bool binary, std::ofstream& file)
 {
   SLIC_ASSERT(mesh != nullptr);
   const IndexType num_nodes = mesh->getNumberOfNodes();
-  const int mesh_dim = mesh->getDimension();
-
-  const double* x = mesh->getCoordinateArray(X_COORDINATE);
-  SLIC_ASSERT(x != nullptr);
-
-  const double* y =
-    (mesh_dim > 1) ? mesh->getCoordinateArray(Y_COORDINATE) : nullptr;
-  const double* z =
-    (mesh_dim > 2) ? mesh->getCoordinateArray(Z_COORDINATE) : nullptr;
+  const PointFill fill(mesh);
 
   fmt::print(file, "POINTS {} double\n", num_nodes);
-  for(IndexType nodeIdx = 0; nodeIdx < num_nodes; ++nodeIdx)
+  if(binary)
   {
-    double xx = x[nodeIdx];
-    double yy = (y != nullptr) ? y[nodeIdx] : 0.0;
-    double zz = (z != nullptr) ? z[nodeIdx] : 0.0;
-    fmt::print(file, "{} {} {}\n", xx, yy, zz);
+    BinaryWriter writer(file, false);
+    write_array<double>(writer, num_nodes, 3, is_little_endian(), fill);
+    file << "\n";
+    return;
   }
+
+  write_formatted(file,
+                  num_nodes,
+                  [=](fmt::memory_buffer& buffer, IndexType nodeIdx) {
+                    double xyz[3];
+                    fill(nodeIdx, xyz);
+                    fmt::format_to(buffer,
+                                   "{} {} {}\n",
+                                   xyz[0],
+                                   xyz[1],
+                                   xyz[2]);
+                  });
 }
 
 /*!
  * \brief Writes mesh cell connectivity and type to a VTK file
- *  using the legacy ASCII format.
+ *  using the legacy format.
  * \param [in] mesh the mesh whose cells will be written.
+ * \param [in] binary true if the values are written as binary.
  * \param [in] file the stream to write to.
  * \pre mesh != nullptr
  */
-void write_cells(const Mesh* mesh, std::ofstream& file)
+void write_cells(const Mesh* mesh, bool binary, std::ofstream& file)
 {
   SLIC_ASSERT(mesh != nullptr);
   const IndexType num_cells = mesh->getNumberOfCells();
 
   /* First need to get total size of the connectivity array. */
   IndexType total_size;
-  int max_cell_nodes = get_max_cell_nodes(mesh, total_size);
+  get_max_cell_nodes(mesh, total_size);
   total_size += num_cells;
 
   fmt::print(file, "CELLS {} {}\n", num_cells, total_size);
 
   /* Write out the mesh cell connectivity. */
-  IndexType* cell_nodes = new IndexType[max_cell_nodes];
-  for(IndexType cellIdx = 0; cellIdx < num_cells; ++cellIdx)
+  if(binary)
   {
-    const int num_cell_nodes = mesh->getNumberOfCellNodes(cellIdx);
-    mesh->getCellNodeIDs(cellIdx, cell_nodes);
-
-    fmt::print(file,
-               "{} {}\n",
-               num_cell_nodes,
-               fmt::join(cell_nodes, cell_nodes + num_cell_nodes, " "));
+    std::vector<IndexType> offsets;
+    compute_cell_offsets(mesh, true, offsets);
+
+    BinaryWriter writer(file, false);
+    write_connectivity<std::int32_t>(writer,
+                                     mesh,
+                                     offsets,
+                                     true,
+                                     is_little_endian());
+    file << "\n";
+  }
+  else
+  {
+    write_formatted(
+      file,
+      num_cells,
+      [=](fmt::memory_buffer& buffer, IndexType cellIdx) {
+        IndexType cell_nodes[MAX_CELL_NODES];
+        const IndexType num_cell_nodes =
+          mesh->getCellNodeIDs(cellIdx, cell_nodes);
+        fmt::format_to(buffer,
+                       "{} {}\n",
+                       num_cell_nodes,
+                       fmt::join(cell_nodes, cell_nodes + num_cell_nodes, " "));
+      });
   }
-
-  delete[] cell_nodes;
 
   /* Write out the mesh cell types. */
   fmt::print(file, "CELL_TYPES {}\n", num_cells);
-  for(IndexType cellIdx = 0; cellIdx < num_cells; ++cellIdx)
+  if(binary)
+  {
+    BinaryWriter writer(file, false);
+    write_array<std::int32_t>(writer,
+                              num_cells,
+                              1,
+                              is_little_endian(),
+                              [=](IndexType cellIdx, std::int32_t* type) {
+                                const CellType cell_type =
+                                  mesh->getCellType(cellIdx);
+                                *type = getCellInfo(cell_type).vtk_type;
+                              });
+    file << "\n";
+  }
+  else
   {
-    CellType cell_type = mesh->getCellType(cellIdx);
-    fmt::print(file, "{}\n", getCellInfo(cell_type).vtk_type);
+    write_formatted(file,
+                    num_cells,
+                    [=](fmt::memory_buffer& buffer, IndexType cellIdx) {
+                      CellType cell_type = mesh->getCellType(cellIdx);
+                      fmt::format_to(buffer,
+                                     "{}\n",
+                                     getCellInfo(cell_type).vtk_type);
+                    });
   }
 }
 
 /*!
  * \brief Writes the dimensions of a structured mesh to a VTK file using the
- *  legacy ASCII format.
+ *  legacy format.
  * \param [in] mesh the structured mesh to write out.
  * \param [in] file the stream to write to.
  * \pre mesh != nullptr
@@ -188,13 +767,15 @@ void write_dimensions(const StructuredMesh* mesh, std::ofstream& file)
 }
 
 /*!
- * \brief Writes a rectilinear mesh to a VTK file using the legacy
- *  ASCII format.
+ * \brief Writes a rectilinear mesh to a VTK file using the legacy format.
  * \param [in] mesh the rectilinear mesh to write out.
+ * \param [in] binary true if the values are written as binary.
  * \param [in] file the stream to write to.
  * \pre mesh != nullptr
  */
-void write_rectilinear_mesh(const RectilinearMesh* mesh, std::ofstream& file)
+void write_rectilinear_mesh(const RectilinearMesh* mesh,
+                            bool binary,
+                            std::ofstream& file)
 {
   SLIC_ASSERT(mesh != nullptr);
 
@@ -204,20 +785,32 @@ void write_rectilinear_mesh(const RectilinearMesh* mesh, std::ofstream& file)
                                 "Y_COORDINATES",
                                 "Z_COORDINATES"};
 
-  for(int dim = 0; dim < mesh->getDimension(); ++dim)
-  {
-    fmt::print(file,
-               "{} {} double\n",
-               coord_names[dim],
-               mesh->getNodeResolution(dim));
-    const double* coords = mesh->getCoordinateArray(dim);
-    fmt::print(file,
-               "{}\n",
-               fmt::join(coords, coords + mesh->getNodeResolution(dim), " "));
-  }
-  for(int dim = mesh->getDimension(); dim < 3; ++dim)
+  const double zero = 0.0;
+  for(int dim = 0; dim < 3; ++dim)
   {
-    fmt::print(file, "{} 1 double\n0.0\n", coord_names[dim]);
+    const bool has_dim = (dim < mesh->getDimension());
+    const IndexType n = has_dim ? mesh->getNodeResolution(dim) : 1;
+    const double* coords = has_dim ? mesh->getCoordinateArray(dim) : &zero;
+
+    fmt::print(file, "{} {} double\n", coord_names[dim], n);
+    if(binary)
+    {
+      BinaryWriter writer(file, false);
+      write_array<double>(writer,
+                          n,
+                          1,
+                          is_little_endian(),
+                          [=](IndexType i, double* x) { *x = coords[i]; });
+      file << "\n";
+    }
+    else if(has_dim)
+    {
+      fmt::print(file, "{}\n", fmt::join(coords, coords + n, " "));
+    }
+    else
+    {
+      fmt::print(file, "0.0\n");
+    }
   }
 }
 
@@ -242,126 +835,74 @@ void write_uniform_mesh(const UniformMesh* mesh, std::ofstream& file)
 }
 
 /*!
- * \brief Writes a scalar field to a VTK file using the legacy
- *  ASCII format.
+ * \brief Writes a scalar field to a VTK file using the legacy format.
  * \param [in] field the scalar field to write out.
+ * \param [in] binary true if the values are written as binary.
  * \param [in] file the stream to write to.
  * \pre field != nullptr
  * \pre field->getNumComponents() == 1
  */
-void write_scalar_data(const Field* field, std::ofstream& file)
+void write_scalar_data(const Field* field, bool binary, std::ofstream& file)
 {
   SLIC_ASSERT(field != nullptr);
   SLIC_ASSERT(field->getNumComponents() == 1);
-  const IndexType num_values = field->getNumTuples();
 
   fmt::print(file, "SCALARS {} ", field->getName());
   if(field->getType() == DOUBLE_FIELD_TYPE)
   {
     fmt::print(file, "double\n");
     fmt::print(file, "LOOKUP_TABLE default\n");
-
-    const double* data_ptr = Field::getDataPtr<double>(field);
-    SLIC_ASSERT(data_ptr != nullptr);
-
-    fmt::print(file, "{}\n", fmt::join(data_ptr, data_ptr + num_values, "\n"));
+    write_legacy_values<double>(field, 0, 1, 1, binary, file);
   }
   else if(field->getType() == INT32_FIELD_TYPE)
   {
     fmt::print(file, "int\n");
     fmt::print(file, "LOOKUP_TABLE default\n");
-
-    const int* data_ptr = Field::getDataPtr<int>(field);
-    SLIC_ASSERT(data_ptr != nullptr);
-
-    fmt::print(file, "{}\n", fmt::join(data_ptr, data_ptr + num_values, "\n"));
+    write_legacy_values<int>(field, 0, 1, 1, binary, file);
   }
 }
 
 /*!
- * \brief Writes a vector field to a VTK file using the legacy
- *  ASCII format.
+ * \brief Writes a vector field to a VTK file using the legacy format.
  * \param [in] field the vector field to write out.
+ * \param [in] binary true if the values are written as binary.
  * \param [in] file the stream to write to.
  * \pre field != nullptr
  * \pre field->getNumComponents() == 2 || field->getNumComponents() == 3
  */
-void write_vector_data(const Field* field, std::ofstream& file)
+void write_vector_data(const Field* field, bool binary, std::ofstream& file)
 {
   SLIC_ASSERT(field != nullptr);
   const int num_components = field->getNumComponents();
-  const IndexType num_values = field->getNumTuples();
   SLIC_ASSERT(num_components == 2 || num_components == 3);
 
   fmt::print(file, "VECTORS {} ", field->getName());
   if(field->getType() == DOUBLE_FIELD_TYPE)
   {
     fmt::print(file, "double\n");
-
-    const double* data_ptr = Field::getDataPtr<double>(field);
-    SLIC_ASSERT(data_ptr != nullptr);
-
-    for(IndexType i = 0; i < num_values; ++i)
-    {
-      if(num_components == 2)
-      {
-        fmt::print(file,
-                   "{} {} 0.0\n",
-                   data_ptr[num_components * i + 0],
-                   data_ptr[num_components * i + 1]);
-      }
-      else
-      {
-        fmt::print(file,
-                   "{} {} {}\n",
-                   data_ptr[num_components * i + 0],
-                   data_ptr[num_components * i + 1],
-                   data_ptr[num_components * i + 2]);
-      }
-    }
+    write_legacy_values<double>(field, 0, num_components, 3, binary, file);
   }
   else if(field->getType() == INT32_FIELD_TYPE)
   {
     fmt::print(file, "int\n");
-
-    const int* data_ptr = Field::getDataPtr<int>(field);
-    SLIC_ASSERT(data_ptr != nullptr);
-
-    for(IndexType i = 0; i < num_values; ++i)
-    {
-      if(num_components == 2)
-      {
-        fmt::print(file,
-                   "{} {} 0\n",
-                   data_ptr[num_components * i + 0],
-                   data_ptr[num_components * i + 1]);
-      }
-      else
-      {
-        fmt::print(file,
-                   "{} {} {}\n",
-                   data_ptr[num_components * i + 0],
-                   data_ptr[num_components * i + 1],
-                   data_ptr[num_components * i + 2]);
-      }
-    }
+    write_legacy_values<int>(field, 0, num_components, 3, binary, file);
   }
 }
 
 /*!
  * \brief Writes a multidimensional field to a VTK file using the legacy
- *  ASCII format.
+ *  format.
  * \param [in] field the multidimensional field to write out.
+ * \param [in] binary true if the values are written as binary.
  * \param [in] file the stream to write to.
  * \pre field != nullptr
  * \pre field->getNumComponents > 3
  */
-void write_multidim_data(const Field* field, std::ofstream& file)
+void write_multidim_data(const Field* field, bool binary, std::ofstream& file)
 {
   SLIC_ASSERT(field != nullptr);
   const int field_type = field->getType();
   const int num_components = field->getNumComponents();
-  const IndexType num_values = field->getNumTuples();
   SLIC_ASSERT(num_components > 3);
 
   if(field_type == DOUBLE_FIELD_TYPE)
@@ -370,14 +911,7 @@ void write_multidim_data(const Field* field, std::ofstream& file)
     {
       fmt::print(file, "SCALARS {}_{:0>3} double\n", field->getName(), cur_comp);
       fmt::print(file, "LOOKUP_TABLE default\n");
-
-      const double* data_ptr = Field::getDataPtr<double>(field);
-      SLIC_ASSERT(data_ptr != nullptr);
-
-      for(IndexType i = 0; i < num_values; ++i)
-      {
-        fmt::print(file, "{}\n", data_ptr[num_components * i + cur_comp]);
-      }
+      write_legacy_values<double>(field, cur_comp, 1, 1, binary, file);
     }
   }
   else if(field_type == INT32_FIELD_TYPE)
@@ -386,27 +920,22 @@ void write_multidim_data(const Field* field, std::ofstream& file)
     {
       fmt::print(file, "SCALARS {}_{:0>3} int\n", field->getName(), cur_comp);
       fmt::print(file, "LOOKUP_TABLE default\n");
-
-      const int* data_ptr = Field::getDataPtr<int>(field);
-      SLIC_ASSERT(data_ptr != nullptr);
-
-      for(IndexType i = 0; i < num_values; ++i)
-      {
-        fmt::print(file, "{}\n", data_ptr[num_components * i + cur_comp]);
-      }
+      write_legacy_values<int>(field, cur_comp, 1, 1, binary, file);
     }
   }
 }
 
 /*!
- * \brief Writes mesh FieldData to a VTK file using the legacy ASCII format.
+ * \brief Writes mesh FieldData to a VTK file using the legacy format.
  * \param [in] field_data the data to write out.
  * \param [in] num_values the number of tuples each field is expected to have.
+ * \param [in] binary true if the values are written as binary.
  * \param [in] file the stream to write to.
  * \pre field_data != nullptr
  */
 void write_data(const FieldData* field_data,
                 IndexType AXOM_DEBUG_PARAM(num_values),
+                bool binary,
                 std::ofstream& file)
 {
   const int numFields = field_data->getNumFields();
@@ -423,15 +952,15 @@ void write_data(const FieldData* field_data,
 
     if(num_components == 1)
     {
-      write_scalar_data(field, file);
+      write_scalar_data(field, binary, file);
     }
     else if(num_components == 2 || num_components == 3)
     {
-      write_vector_data(field, file);
+      write_vector_data(field, binary, file);
     }
     else if(num_components > 3)
     {
-      write_multidim_data(field, file);
+      write_multidim_data(field, binary, file);
     }
     else
     {
@@ -440,15 +969,239 @@ void write_data(const FieldData* field_data,
   }
 }
 
+/*!
+ * \brief Returns the VTK XML type name of a field, or nullptr if fields of
+ *  this type are not written out.
+ */
+const char* get_vtu_type(const Field* field)
+{
+  switch(field->getType())
+  {
+  case FLOAT_FIELD_TYPE:
+    return "Float32";
+  case DOUBLE_FIELD_TYPE:
+    return "Float64";
+  case INT32_FIELD_TYPE:
+    return "Int32";
+  case INT64_FIELD_TYPE:
+    return "Int64";
+  default:
+    return nullptr;
+  }
+}
+
+/*!
+ * \brief Returns the size in bytes of the values of a field.
+ */
+std::uint64_t get_field_bytes(const Field* field)
+{
+  const int type = field->getType();
+  const std::uint64_t value_size =
+    (type == FLOAT_FIELD_TYPE || type == INT32_FIELD_TYPE) ? 4 : 8;
+  return value_size * field->getNumTuples() * field->getNumComponents();
+}
+
+/*!
+ * \brief Writes the DataArray (or PDataArray) elements of the fields in the
+ *  given FieldData that can be written to a VTU file.
+ *
+ * \param [in] field_data the fields to describe.
+ * \param [in] tag the XML tag, i.e., "PointData" or "CellData".
+ * \param [in] base64 true if the appended data is base64 encoded.
+ * \param [in] parallel true if the elements of a .pvtu file are written.
+ * \param [in,out] offset the offset of the next appended data block.
+ * \param [in] file the stream to write to.
+ */
+void write_vtu_field_headers(const FieldData* field_data,
+                             const std::string& tag,
+                             bool base64,
+                             bool parallel,
+                             std::uint64_t& offset,
+                             std::ofstream& file)
+{
+  const char* prefix = parallel ? "P" : "";
+  const char* indent = parallel ? "    " : "      ";
+  fmt::print(file, "{}<{}{}>\n", indent, prefix, tag);
+
+  const int numFields = field_data->getNumFields();
+  for(int i = 0; i < numFields; ++i)
+  {
+    const Field* field = field_data->getField(i);
+    const char* type = get_vtu_type(field);
+    if(type == nullptr)
+    {
+      SLIC_WARNING("Field [" << field->getName() << "] has an unsupported "
+                             << "type and is not written out.");
+      continue;
+    }
+
+    fmt::print(file,
+               "{}  <{}DataArray type=\"{}\" Name=\"{}\" "
+               "NumberOfComponents=\"{}\"",
+               indent,
+               prefix,
+               type,
+               field->getName(),
+               field->getNumComponents());
+    if(parallel)
+    {
+      fmt::print(file, "/>\n");
+      continue;
+    }
+
+    fmt::print(file, " format=\"appended\" offset=\"{}\"/>\n", offset);
+    offset +=
+      BinaryWriter::encodedSize(sizeof(std::uint64_t) + get_field_bytes(field),
+                                base64);
+  }
+
+  fmt::print(file, "{}</{}{}>\n", indent, prefix, tag);
+}
+
+/*!
+ * \brief Writes an appended data block, i.e., the size of the payload
+ *  followed by the ntuples x ncomp values computed by the fill callable.
+ */
+template <typename T, typename FillTuple>
+void write_vtu_block(BinaryWriter& writer,
+                     IndexType ntuples,
+                     int ncomp,
+                     const FillTuple& fill)
+{
+  const std::uint64_t nbytes = sizeof(T) * ntuples * ncomp;
+  writer.write(&nbytes, sizeof(std::uint64_t));
+  write_array<T>(writer, ntuples, ncomp, false, fill);
+  writer.finish();
+}
+
+/*!
+ * \brief Writes the appended data blocks of a field of type T.
+ */
+template <typename T>
+void write_vtu_field_block(BinaryWriter& writer, const Field* field)
+{
+  const int num_components = field->getNumComponents();
+  const FieldFill<T> fill(Field::getDataPtr<T>(field),
+                          num_components,
+                          0,
+                          num_components,
+                          num_components);
+  write_vtu_block<T>(writer, field->getNumTuples(), num_components, fill);
+}
+
+/*!
+ * \brief Writes the appended data blocks of the fields in the given
+ *  FieldData, in the order of write_vtu_field_headers().
+ */
+void write_vtu_field_blocks(const FieldData* field_data, BinaryWriter& writer)
+{
+  const int numFields = field_data->getNumFields();
+  for(int i = 0; i < numFields; ++i)
+  {
+    const Field* field = field_data->getField(i);
+    switch(field->getType())
+    {
+    case FLOAT_FIELD_TYPE:
+      write_vtu_field_block<float>(writer, field);
+      break;
+    case DOUBLE_FIELD_TYPE:
+      write_vtu_field_block<double>(writer, field);
+      break;
+    case INT32_FIELD_TYPE:
+      write_vtu_field_block<std::int32_t>(writer, field);
+      break;
+    case INT64_FIELD_TYPE:
+      write_vtu_field_block<std::int64_t>(writer, field);
+      break;
+    default:
+      break;
+    }
+  }
+}
+
+/*!
+ * \brief Returns the byte_order attribute of the VTK XML files.
+ */
+const char* get_byte_order()
+{
+  return is_little_endian() ? "LittleEndian" : "BigEndian";
+}
+
+/*!
+ * \brief Writes the .pvtu file that indexes the pieces of a distributed mesh.
+ *
+ * \param [in] mesh the piece of the mesh, used for the field layout.
+ * \param [in] file_path the path of the .pvtu file.
+ * \param [in] piece_names the names of the piece files, relative to the
+ *  directory of the .pvtu file.
+ *
+ * \return an error code, zero signifies a successful write.
+ */
+int write_pvtu_index(const Mesh* mesh,
+                     const std::string& file_path,
+                     const std::vector<std::string>& piece_names)
+{
+  std::ofstream file(file_path.c_str());
+  if(!file.good())
+  {
+    SLIC_WARNING("Could not open file at path " << file_path);
+    return -1;
+  }
+
+  fmt::print(file, "<?xml version=\"1.0\"?>\n");
+  fmt::print(file,
+             "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\" "
+             "byte_order=\"{}\" header_type=\"UInt64\">\n",
+             get_byte_order());
+  fmt::print(file, "  <PUnstructuredGrid GhostLevel=\"0\">\n");
+
+  std::uint64_t offset = 0;
+  write_vtu_field_headers(mesh->getFieldData(NODE_CENTERED),
+                          "PointData",
+                          false,
+                          true,
+                          offset,
+                          file);
+  if(mesh->getMeshType() != PARTICLE_MESH)
+  {
+    write_vtu_field_headers(mesh->getFieldData(CELL_CENTERED),
+                            "CellData",
+                            false,
+                            true,
+                            offset,
+                            file);
+  }
+
+  fmt::print(file, "    <PPoints>\n");
+  fmt::print(file,
+             "      <PDataArray type=\"Float64\" "
+             "NumberOfComponents=\"3\"/>\n");
+  fmt::print(file, "    </PPoints>\n");
+
+  for(const std::string& piece_name : piece_names)
+  {
+    fmt::print(file, "    <Piece Source=\"{}\"/>\n", piece_name);
+  }
+
+  fmt::print(file, "  </PUnstructuredGrid>\n");
+  fmt::print(file, "</VTKFile>\n");
+
+  file.close();
+  return 0;
+}
+
 } /* namespace internal */
 
 //------------------------------------------------------------------------------
-int write_vtk(const Mesh* mesh, const std::string& file_path)
+int write_vtk(const Mesh* mesh, const std::string& file_path, VTKFormat format)
 {
   SLIC_ASSERT(mesh != nullptr);
   int mesh_type = mesh->getMeshType();
+  const bool binary = (format == VTK_BINARY);
 
-  std::ofstream file(file_path.c_str());
+  std::vector<char> buffer;
+  std::ofstream file;
+  internal::open_file(file_path, binary, buffer, file);
   if(!file.good())
   {
     SLIC_WARNING("Could not open file at path " << file_path);
@@ -458,27 +1211,27 @@ int write_vtk(const Mesh* mesh, const std::string& file_path)
   /* Write the VTK header */
   file << "# vtk DataFile Version 3.0\n";
   file << "Mesh generated by axom::mint::write_vtk\n";
-  file << "ASCII\n";
+  file << (binary ? "BINARY\n" : "ASCII\n");
 
   /* Write out the mesh node and cell coordinates. */
   if(mesh_type == mint::UNSTRUCTURED_MESH || mesh_type == mint::PARTICLE_MESH)
   {
     file << "DATASET UNSTRUCTURED_GRID\n";
-    internal::write_points(mesh, file);
-    internal::write_cells(mesh, file);
+    internal::write_points(mesh, binary, file);
+    internal::write_cells(mesh, binary, file);
   }
   else if(mesh_type == mint::STRUCTURED_CURVILINEAR_MESH)
   {
     file << "DATASET STRUCTURED_GRID\n";
     const StructuredMesh* struc_mesh = dynamic_cast<const StructuredMesh*>(mesh);
     internal::write_dimensions(struc_mesh, file);
-    internal::write_points(struc_mesh, file);
+    internal::write_points(struc_mesh, binary, file);
   }
   else if(mesh_type == mint::STRUCTURED_RECTILINEAR_MESH)
   {
     file << "DATASET RECTILINEAR_GRID\n";
     const RectilinearMesh* rect_mesh = dynamic_cast<const RectilinearMesh*>(mesh);
-    internal::write_rectilinear_mesh(rect_mesh, file);
+    internal::write_rectilinear_mesh(rect_mesh, binary, file);
   }
   else if(mesh_type == mint::STRUCTURED_UNIFORM_MESH)
   {
@@ -501,7 +1254,7 @@ int write_vtk(const Mesh* mesh, const std::string& file_path)
   if(node_data->getNumFields() > 0)
   {
     fmt::print(file, "POINT_DATA {}\n", num_nodes);
-    internal::write_data(node_data, num_nodes, file);
+    internal::write_data(node_data, num_nodes, binary, file);
   }
 
   /* Write out the cell data if any. */
@@ -512,7 +1265,7 @@ int write_vtk(const Mesh* mesh, const std::string& file_path)
     if(cell_data->getNumFields() > 0)
     {
       fmt::print(file, "CELL_DATA {}\n", num_cells);
-      internal::write_data(cell_data, num_cells, file);
+      internal::write_data(cell_data, num_cells, binary, file);
     }
   }
 
@@ -520,6 +1273,192 @@ int write_vtk(const Mesh* mesh, const std::string& file_path)
   return 0;
 }
 
+//------------------------------------------------------------------------------
+int write_vtu(const Mesh* mesh,
+              const std::string& file_path,
+              VTUEncoding encoding)
+{
+  SLIC_ASSERT(mesh != nullptr);
+  const bool base64 = (encoding == VTU_BASE64);
+
+  std::vector<char> buffer;
+  std::ofstream file;
+  internal::open_file(file_path, true, buffer, file);
+  if(!file.good())
+  {
+    SLIC_WARNING("Could not open file at path " << file_path);
+    return -1;
+  }
+
+  const IndexType num_nodes = mesh->getNumberOfNodes();
+  const IndexType num_cells = mesh->getNumberOfCells();
+  const bool has_cell_data = (mesh->getMeshType() != mint::PARTICLE_MESH);
+  const FieldData* node_data = mesh->getFieldData(mint::NODE_CENTERED);
+  const FieldData* cell_data =
+    has_cell_data ? mesh->getFieldData(mint::CELL_CENTERED) : nullptr;
+
+  std::vector<IndexType> offsets;
+  internal::compute_cell_offsets(mesh, false, offsets);
+
+  /* Write the XML header, with the offset of each appended data block */
+  fmt::print(file, "<?xml version=\"1.0\"?>\n");
+  fmt::print(file,
+             "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" "
+             "byte_order=\"{}\" header_type=\"UInt64\">\n",
+             internal::get_byte_order());
+  fmt::print(file, "  <UnstructuredGrid>\n");
+  fmt::print(file,
+             "    <Piece NumberOfPoints=\"{}\" NumberOfCells=\"{}\">\n",
+             num_nodes,
+             num_cells);
+
+  std::uint64_t offset = 0;
+  internal::write_vtu_field_headers(node_data,
+                                    "PointData",
+                                    base64,
+                                    false,
+                                    offset,
+                                    file);
+  if(has_cell_data)
+  {
+    internal::write_vtu_field_headers(cell_data,
+                                      "CellData",
+                                      base64,
+                                      false,
+                                      offset,
+                                      file);
+  }
+
+  const std::uint64_t header_size = sizeof(std::uint64_t);
+  const std::uint64_t sizes[] = {
+    3 * sizeof(double) * num_nodes,                  // points
+    sizeof(std::int64_t) * offsets[num_cells],       // connectivity
+    sizeof(std::int64_t) * num_cells,                // offsets
+    sizeof(std::uint8_t) * num_cells};               // types
+  std::uint64_t block_offsets[4];
+  for(int i = 0; i < 4; ++i)
+  {
+    block_offsets[i] = offset;
+    offset +=
+      internal::BinaryWriter::encodedSize(header_size + sizes[i], base64);
+  }
+
+  fmt::print(file, "      <Points>\n");
+  fmt::print(file,
+             "        <DataArray type=\"Float64\" NumberOfComponents=\"3\" "
+             "format=\"appended\" offset=\"{}\"/>\n",
+             block_offsets[0]);
+  fmt::print(file, "      </Points>\n");
+  fmt::print(file, "      <Cells>\n");
+  fmt::print(file,
+             "        <DataArray type=\"Int64\" Name=\"connectivity\" "
+             "format=\"appended\" offset=\"{}\"/>\n",
+             block_offsets[1]);
+  fmt::print(file,
+             "        <DataArray type=\"Int64\" Name=\"offsets\" "
+             "format=\"appended\" offset=\"{}\"/>\n",
+             block_offsets[2]);
+  fmt::print(file,
+             "        <DataArray type=\"UInt8\" Name=\"types\" "
+             "format=\"appended\" offset=\"{}\"/>\n",
+             block_offsets[3]);
+  fmt::print(file, "      </Cells>\n");
+  fmt::print(file, "    </Piece>\n");
+  fmt::print(file, "  </UnstructuredGrid>\n");
+  fmt::print(file,
+             "  <AppendedData encoding=\"{}\">\n   _",
+             base64 ? "base64" : "raw");
+
+  /* Write the appended data blocks, in the order of the header */
+  internal::BinaryWriter writer(file, base64);
+  internal::write_vtu_field_blocks(node_data, writer);
+  if(has_cell_data)
+  {
+    internal::write_vtu_field_blocks(cell_data, writer);
+  }
+
+  internal::write_vtu_block<double>(writer,
+                                    num_nodes,
+                                    3,
+                                    internal::PointFill(mesh));
+
+  writer.write(&sizes[1], header_size);
+  internal::write_connectivity<std::int64_t>(writer,
+                                             mesh,
+                                             offsets,
+                                             false,
+                                             false);
+  writer.finish();
+
+  const IndexType* cell_offsets = offsets.data();
+  internal::write_vtu_block<std::int64_t>(
+    writer,
+    num_cells,
+    1,
+    [=](IndexType cellIdx, std::int64_t* end) {
+      *end = cell_offsets[cellIdx + 1];
+    });
+
+  internal::write_vtu_block<std::uint8_t>(
+    writer,
+    num_cells,
+    1,
+    [=](IndexType cellIdx, std::uint8_t* type) {
+      *type = getCellInfo(mesh->getCellType(cellIdx)).vtk_type;
+    });
+
+  fmt::print(file, "\n  </AppendedData>\n");
+  fmt::print(file, "</VTKFile>\n");
+
+  file.close();
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+int write_pvtu(const Mesh* mesh,
+               const std::string& file_path,
+               int rank,
+               int num_ranks,
+               VTUEncoding encoding)
+{
+  SLIC_ASSERT(mesh != nullptr);
+  SLIC_ASSERT(rank >= 0 && rank < num_ranks);
+
+  const std::string extension = ".pvtu";
+  std::string base = file_path;
+  const std::size_t ext_size = extension.size();
+  if(base.size() > ext_size &&
+     base.compare(base.size() - ext_size, ext_size, extension) == 0)
+  {
+    base.erase(base.size() - ext_size);
+  }
+
+  // the pieces are referenced relative to the directory of the .pvtu file
+  const std::string::size_type slash = base.find_last_of('/');
+  const std::string dir =
+    (slash == std::string::npos) ? "" : base.substr(0, slash + 1);
+  const std::string name = base.substr(dir.size());
+
+  const std::string piece_path =
+    fmt::format("{}{}_{:0>6}.vtu", dir, name, rank);
+  int rc = write_vtu(mesh, piece_path, encoding);
+
+  if(rank == 0)
+  {
+    std::vector<std::string> piece_names(num_ranks);
+    for(int i = 0; i < num_ranks; ++i)
+    {
+      piece_names[i] = fmt::format("{}_{:0>6}.vtu", name, i);
+    }
+
+    const int index_rc =
+      internal::write_pvtu_index(mesh, base + extension, piece_names);
+    rc = (rc != 0) ? rc : index_rc;
+  }
+
+  return rc;
+}
+
 //------------------------------------------------------------------------------
 int write_vtk(mint::FiniteElement& fe, const std::string& file_path)
 {
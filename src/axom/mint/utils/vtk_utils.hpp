@@ -17,15 +17,89 @@ class Mesh;
 class FiniteElement;
 
 /*!
- * \brief Writes a mesh to a VTK file using the legacy ASCII format.
+ * \brief Enumerates the encodings of the legacy VTK file format.
+ *
+ * \see write_vtk()
+ */
+enum VTKFormat
+{
+  VTK_ASCII,  /*!< human readable ASCII file */
+  VTK_BINARY  /*!< big-endian binary payloads with an ASCII header */
+};
+
+/*!
+ * \brief Enumerates the encodings of the appended data of a VTU file.
+ *
+ * \see write_vtu()
+ */
+enum VTUEncoding
+{
+  VTU_RAW,    /*!< raw binary payloads in the native byte order */
+  VTU_BASE64  /*!< base64 encoded payloads */
+};
+
+/*!
+ * \brief Writes a mesh to a file in the legacy VTK format
  *  that can be visualized with VisIt or ParaView.
  * \param [in] mesh the mesh to write out.
  * \param [in] file_path the path of the file to write to.
+ * \param [in] format the file encoding, VTK_ASCII (default) or VTK_BINARY.
  * \return an error code, zero signifies a successful write.
  * \pre mesh != nullptr
- * \note This method is primarily intended for debugging.
+ * \note The node, cell and field data are formatted in parallel chunks when
+ *  Axom is built with OpenMP.
+ * \note The ASCII format is primarily intended for debugging.
+ */
+int write_vtk(const Mesh* mesh,
+              const std::string& file_path,
+              VTKFormat format = VTK_ASCII);
+
+/*!
+ * \brief Writes a mesh to a VTK XML unstructured grid (.vtu) file, with the
+ *  node, cell and field data in the appended section of the file.
+ *
+ * \param [in] mesh the mesh to write out.
+ * \param [in] file_path the path of the file to write to.
+ * \param [in] encoding the encoding of the appended data. Default is VTU_RAW.
+ *
+ * \return an error code, zero signifies a successful write.
+ *
+ * \note Structured meshes are written out as unstructured grids.
+ * \note Double, float, int32 and int64 fields are written out.
+ *
+ * \pre mesh != nullptr
+ */
+int write_vtu(const Mesh* mesh,
+              const std::string& file_path,
+              VTUEncoding encoding = VTU_RAW);
+
+/*!
+ * \brief Writes the piece of a distributed mesh owned by the calling rank to
+ *  a .vtu file. Rank zero also writes the .pvtu file that indexes the pieces.
+ *
+ * \param [in] mesh the piece of the mesh owned by the calling rank.
+ * \param [in] file_path the path of the .pvtu file.
+ * \param [in] rank the rank of the caller.
+ * \param [in] num_ranks the total number of ranks.
+ * \param [in] encoding the encoding of the appended data. Default is VTU_RAW.
+ *
+ * \return an error code, zero signifies a successful write.
+ *
+ * \note Each rank writes its piece independently, and the piece of rank i is
+ *  written next to the .pvtu file to "<base>_<i>.vtu", where <base> is the
+ *  file_path without the .pvtu extension and <i> is padded to six digits.
+ *
+ * \note All pieces are expected to have the same fields. The field layout in
+ *  the .pvtu file is taken from the piece of rank zero.
+ *
+ * \pre mesh != nullptr
+ * \pre 0 <= rank < num_ranks
  */
-int write_vtk(const Mesh* mesh, const std::string& file_path);
+int write_pvtu(const Mesh* mesh,
+               const std::string& file_path,
+               int rank,
+               int num_ranks,
+               VTUEncoding encoding = VTU_RAW);
 
 /*!
  * \brief Writes a FiniteElement to a VTK file in the legacy ASCII format.
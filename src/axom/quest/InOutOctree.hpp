@@ -452,6 +452,8 @@ inline std::ostream& operator<<(std::ostream& os,
 template <int DIM>
 void InOutOctree<DIM>::generateIndex()
 {
+  AXOM_PERF_MARK_FUNCTION("InOutOctree::generateIndex");
+
   using Timer = axom::utilities::Timer;
 
   // Loop through mesh vertices
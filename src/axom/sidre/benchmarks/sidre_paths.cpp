@@ -0,0 +1,127 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+#include "axom/sidre.hpp"
+#include "axom/slic.hpp"
+
+using axom::sidre::DataStore;
+using axom::sidre::Group;
+using axom::sidre::View;
+using axom::sidre::ViewHandle;
+
+//------------------------------------------------------------------------------
+namespace
+{
+const int NUM_DOMAINS = 8;
+const int NUM_FIELDS = 32;
+
+// Fixture with a mesh-like hierarchy "domain_<d>/fields/field_<f>/values"
+// and the full paths of all its Views
+class PathFixture : public ::benchmark::Fixture
+{
+public:
+  void SetUp()
+  {
+    ds = new DataStore();
+    Group* root = ds->getRoot();
+    for(int d = 0; d < NUM_DOMAINS; ++d)
+    {
+      for(int f = 0; f < NUM_FIELDS; ++f)
+      {
+        std::string path = "domain_" + std::to_string(d) + "/fields/field_" +
+          std::to_string(f) + "/values";
+        root->createViewScalar(path, d * NUM_FIELDS + f);
+        paths.push_back(path);
+      }
+    }
+  }
+
+  void TearDown()
+  {
+    delete ds;
+    ds = nullptr;
+    paths.clear();
+  }
+
+  DataStore* ds {nullptr};
+  std::vector<std::string> paths;
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// Existing path resolution, walking one path component at a time
+BENCHMARK_DEFINE_F(PathFixture, getView_walk)(benchmark::State& state)
+{
+  Group* root = ds->getRoot();
+  while(state.KeepRunning())
+  {
+    for(const auto& path : paths)
+    {
+      benchmark::DoNotOptimize(root->getView(path));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * paths.size());
+}
+BENCHMARK_REGISTER_F(PathFixture, getView_walk);
+
+//------------------------------------------------------------------------------
+// Path resolution through the DataStore's flat path index
+BENCHMARK_DEFINE_F(PathFixture, getView_pathIndex)(benchmark::State& state)
+{
+  ds->setPathIndexEnabled(true);
+  for(const auto& path : paths)
+  {
+    ds->internName(path);
+  }
+  Group* root = ds->getRoot();
+  while(state.KeepRunning())
+  {
+    for(const auto& path : paths)
+    {
+      benchmark::DoNotOptimize(root->getView(path));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * paths.size());
+}
+BENCHMARK_REGISTER_F(PathFixture, getView_pathIndex);
+
+//------------------------------------------------------------------------------
+// Access through ViewHandles resolved before the loop
+BENCHMARK_DEFINE_F(PathFixture, getView_handle)(benchmark::State& state)
+{
+  Group* root = ds->getRoot();
+  std::vector<ViewHandle> handles;
+  for(const auto& path : paths)
+  {
+    handles.push_back(root->getViewHandle(path));
+  }
+
+  while(state.KeepRunning())
+  {
+    for(auto& handle : handles)
+    {
+      benchmark::DoNotOptimize(handle.getView());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * paths.size());
+}
+BENCHMARK_REGISTER_F(PathFixture, getView_handle);
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+
+  axom::slic::SimpleLogger logger;  // create & initialize test logger,
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
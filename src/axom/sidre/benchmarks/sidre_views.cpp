@@ -0,0 +1,130 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+#include "axom/sidre.hpp"
+#include "axom/slic.hpp"
+
+using axom::sidre::DataStore;
+using axom::sidre::Group;
+using axom::sidre::INT_ID;
+using axom::sidre::View;
+
+//------------------------------------------------------------------------------
+namespace
+{
+const int VIEWS_PER_GROUP = 64;
+
+// Names are generated once so string formatting is not timed
+const std::vector<std::string>& getNames()
+{
+  static std::vector<std::string> names;
+  if(names.empty())
+  {
+    for(int i = 0; i < VIEWS_PER_GROUP; ++i)
+    {
+      names.push_back("item_" + std::to_string(i));
+    }
+  }
+  return names;
+}
+
+// Creates num_views Views in Groups of VIEWS_PER_GROUP under the root.
+// Even Views hold a scalar, odd Views own a small allocated array.
+void buildHierarchy(DataStore& ds, int num_views)
+{
+  const std::vector<std::string>& names = getNames();
+  Group* root = ds.getRoot();
+
+  for(int g = 0; g * VIEWS_PER_GROUP < num_views; ++g)
+  {
+    Group* grp = root->createGroup("group_" + std::to_string(g));
+    for(int i = 0; i < VIEWS_PER_GROUP && g * VIEWS_PER_GROUP + i < num_views;
+        ++i)
+    {
+      if(i % 2 == 0)
+      {
+        grp->createViewScalar(names[i], i);
+      }
+      else
+      {
+        grp->createViewAndAllocate(names[i], INT_ID, 8);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// Arguments are the number of Views and whether the DataStore uses an arena
+void createDestroyViews(benchmark::State& state)
+{
+  const int num_views = state.range_x();
+  const bool use_arena = state.range_y() != 0;
+
+  while(state.KeepRunning())
+  {
+    DataStore ds(use_arena);
+    buildHierarchy(ds, num_views);
+    benchmark::DoNotOptimize(ds.getRoot());
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_views);
+}
+BENCHMARK(createDestroyViews)
+  ->ArgPair(1 << 14, 0)
+  ->ArgPair(1 << 14, 1)
+  ->ArgPair(1 << 20, 0)
+  ->ArgPair(1 << 20, 1);
+
+//------------------------------------------------------------------------------
+// Traverses an existing hierarchy, reading every View
+void traverseViews(benchmark::State& state)
+{
+  const int num_views = state.range_x();
+  const bool use_arena = state.range_y() != 0;
+
+  DataStore ds(use_arena);
+  buildHierarchy(ds, num_views);
+  Group* root = ds.getRoot();
+
+  while(state.KeepRunning())
+  {
+    for(auto gidx = root->getFirstValidGroupIndex();
+        axom::sidre::indexIsValid(gidx);
+        gidx = root->getNextValidGroupIndex(gidx))
+    {
+      Group* grp = root->getGroup(gidx);
+      for(auto vidx = grp->getFirstValidViewIndex();
+          axom::sidre::indexIsValid(vidx);
+          vidx = grp->getNextValidViewIndex(vidx))
+      {
+        View* view = grp->getView(vidx);
+        benchmark::DoNotOptimize(view->getVoidPtr());
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_views);
+}
+BENCHMARK(traverseViews)
+  ->ArgPair(1 << 20, 0)
+  ->ArgPair(1 << 20, 1);
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+
+  axom::slic::SimpleLogger logger;  // create & initialize test logger,
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
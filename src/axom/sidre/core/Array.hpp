@@ -240,6 +240,8 @@ template <typename T>
 Array<T>::Array(View* view) : axom::Array<T>()
                             , m_view(view)
 {
+  this->m_has_custom_storage = true;
+
   SLIC_ERROR_IF(m_view == nullptr, "Provided View cannot be null.");
   SLIC_ERROR_IF(m_view->isEmpty(), "Provided View cannot be empty.");
 
@@ -290,6 +292,8 @@ Array<T>::Array(View* view,
   : axom::Array<T>()
   , m_view(view)
 {
+  this->m_has_custom_storage = true;
+
   SLIC_ERROR_IF(m_view == nullptr, "Provided View cannot be null.");
   SLIC_ERROR_IF(!m_view->isEmpty(), "View must be empty.");
   SLIC_ERROR_IF(num_tuples < 0,
@@ -11,9 +11,18 @@
 
 // Sidre project headers
 #include "Group.hpp"
+#include "MemoryArena.hpp"
 #include "View.hpp"
 
-#include "axom/core/Types.hpp"  // for axom types
+#include "axom/core/Types.hpp"                // for axom types
+#include "axom/core/utilities/Utilities.hpp"  // for fnv1aHash()
+
+// Conduit headers
+#include "conduit_relay.hpp"
+
+#ifdef AXOM_USE_HDF5
+  #include "conduit_relay_io_hdf5.hpp"
+#endif
 
 namespace axom
 {
@@ -32,6 +41,19 @@ int getValidAllocatorID(int allocID)
   return allocID;
 }
 
+/*!
+ * \brief Helper function. Return the ID of the allocator for host memory,
+ *  the only memory a DataStore's MemoryArena provides.
+ */
+int getHostAllocatorID()
+{
+#ifdef AXOM_USE_UMPIRE
+  return axom::getUmpireResourceAllocatorID(umpire::resource::Host);
+#else
+  return getDefaultAllocatorID();
+#endif
+}
+
 /*
  *************************************************************************
  *
@@ -51,6 +73,7 @@ Buffer* Buffer::describe(TypeID type, IndexType num_elems)
   DataType& dtype = const_cast<DataType&>(m_node.dtype());
   dtype.set(dtype.default_dtype(type));
   dtype.set_number_of_elements(num_elems);
+  markDirty();
 
   return this;
 }
@@ -82,6 +105,7 @@ Buffer* Buffer::allocate(int allocID)
   if(data != nullptr)
   {
     m_node.set_external(DataType(m_node.dtype()), data);
+    markDirty();
   }
   return this;
 }
@@ -139,13 +163,34 @@ Buffer* Buffer::reallocate(IndexType num_elems)
   DataType dtype(m_node.dtype());
   dtype.set_number_of_elements(num_elems);
   IndexType new_size = dtype.strided_bytes();
-  void* new_data_ptr =
-    axom::reallocate(static_cast<axom::uint8*>(old_data_ptr), new_size);
+  void* new_data_ptr = nullptr;
+  if(m_arena_bytes != InvalidIndex)
+  {
+    // Data held in the arena is moved to a new allocation, which
+    // allocateBytes() takes from the arena again if it is small enough.
+    const IndexType old_arena_bytes = m_arena_bytes;
+    new_data_ptr = allocateBytes(new_size, getHostAllocatorID());
+    if(new_data_ptr != nullptr)
+    {
+      copy(new_data_ptr, old_data_ptr, std::min(old_arena_bytes, new_size));
+      m_arena->deallocate(old_data_ptr, old_arena_bytes);
+    }
+    else
+    {
+      m_arena_bytes = old_arena_bytes;
+    }
+  }
+  else
+  {
+    new_data_ptr =
+      axom::reallocate(static_cast<axom::uint8*>(old_data_ptr), new_size);
+  }
 
   if(num_elems == 0 || new_data_ptr != nullptr)
   {
     m_node.reset();
     m_node.set_external(dtype, new_data_ptr);
+    markDirty();
   }
   else
   {
@@ -172,6 +217,7 @@ Buffer* Buffer::deallocate()
 
   releaseBytes(getVoidPtr());
   m_node.set_external(DataType(m_node.dtype()), nullptr);
+  markDirty();
 
   std::set<View*>::iterator vit = m_views.begin();
   for(; vit != m_views.end(); ++vit)
@@ -208,10 +254,46 @@ Buffer* Buffer::copyBytesIntoBuffer(void* src, IndexType nbytes)
   }
 
   copy(getVoidPtr(), src, nbytes);
+  markDirty();
 
   return this;
 }
 
+/*
+ *************************************************************************
+ *
+ * Compute FNV-1a checksum of Buffer data.
+ *
+ *************************************************************************
+ */
+axom::uint64 Buffer::computeChecksum() const
+{
+  if(!isAllocated())
+  {
+    return 0;
+  }
+
+  return utilities::fnv1aHash(m_node.data_ptr(), getTotalBytes());
+}
+
+/*
+ *************************************************************************
+ *
+ * Mark Buffer dirty if its checksum changed since the last call.
+ *
+ *************************************************************************
+ */
+bool Buffer::detectChanges()
+{
+  const axom::uint64 checksum = computeChecksum();
+  if(checksum != m_checksum)
+  {
+    markDirty();
+    m_checksum = checksum;
+  }
+  return isDirty();
+}
+
 /*
  *************************************************************************
  *
@@ -288,6 +370,30 @@ void Buffer::exportTo(conduit::Node& data_holder)
  */
 void Buffer::importFrom(conduit::Node& buffer_holder)
 {
+  ReferencedFiles files;
+  importFrom(buffer_holder, files);
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to import Buffer state from a conduit node, reading
+ * referenced Buffers through a cache of files.
+ *
+ *************************************************************************
+ */
+void Buffer::importFrom(conduit::Node& buffer_holder, ReferencedFiles& files)
+{
+  // An incremental checkpoint stores unchanged Buffers as a reference to
+  // the data in the checkpoint that last wrote it.
+  if(buffer_holder.has_path("reference"))
+  {
+    conduit::Node referenced_holder;
+    files.load(buffer_holder["reference"], referenced_holder);
+    importFrom(referenced_holder, files);
+    return;
+  }
+
   if(buffer_holder.has_path("schema"))
   {
     Schema schema(buffer_holder["schema"].as_string());
@@ -318,7 +424,16 @@ void Buffer::importFrom(conduit::Node& buffer_holder)
  *
  *************************************************************************
  */
-Buffer::Buffer(IndexType uid) : m_index(uid), m_views(), m_node() { }
+Buffer::Buffer(IndexType uid)
+  : m_index(uid)
+  , m_views()
+  , m_node()
+  , m_generation(1)
+  , m_clean_generation(0)
+  , m_checksum(0)
+  , m_arena(nullptr)
+  , m_arena_bytes(InvalidIndex)
+{ }
 
 /*
  *************************************************************************
@@ -331,6 +446,11 @@ Buffer::Buffer(const Buffer& source)
   : m_index(source.m_index)
   , m_views(source.m_views)
   , m_node(source.m_node)
+  , m_generation(source.m_generation)
+  , m_clean_generation(source.m_clean_generation)
+  , m_checksum(source.m_checksum)
+  , m_arena(source.m_arena)
+  , m_arena_bytes(source.m_arena_bytes)
 {
   // disallow?
 }
@@ -409,6 +529,18 @@ void Buffer::detachFromAllViews()
 void* Buffer::allocateBytes(IndexType num_bytes, int allocID)
 {
   allocID = getValidAllocatorID(allocID);
+
+  if(useArena(num_bytes, allocID))
+  {
+    void* ptr = m_arena->allocate(num_bytes);
+    if(ptr != nullptr)
+    {
+      m_arena_bytes = num_bytes;
+      return ptr;
+    }
+  }
+
+  m_arena_bytes = InvalidIndex;
   return axom::allocate<axom::int8>(num_bytes, allocID);
 }
 
@@ -421,10 +553,99 @@ void* Buffer::allocateBytes(IndexType num_bytes, int allocID)
  */
 void Buffer::releaseBytes(void* ptr)
 {
+  if(m_arena_bytes != InvalidIndex)
+  {
+    m_arena->deallocate(ptr, m_arena_bytes);
+    m_arena_bytes = InvalidIndex;
+    return;
+  }
+
   // Pointer type here should always match new call in allocateBytes.
   axom::int8* ptr_copy = static_cast<axom::int8*>(ptr);
   axom::deallocate(ptr_copy);
 }
 
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to decide if an allocation is served by the arena.
+ *
+ *************************************************************************
+ */
+bool Buffer::useArena(IndexType num_bytes, int allocID) const
+{
+  return m_arena != nullptr && MemoryArena::canAllocate(num_bytes) &&
+    allocID == getHostAllocatorID();
+}
+
+/*
+ *************************************************************************
+ *
+ * Close the files cached while loading referenced Buffers.
+ *
+ *************************************************************************
+ */
+Buffer::ReferencedFiles::~ReferencedFiles()
+{
+#ifdef AXOM_USE_HDF5
+  for(const auto& entry : m_hdf5_files)
+  {
+    conduit::relay::io::hdf5_close_file(static_cast<hid_t>(entry.second));
+  }
+#endif
+}
+
+/*
+ *************************************************************************
+ *
+ * Load the Buffer node identified by a reference, opening each file once.
+ *
+ *************************************************************************
+ */
+void Buffer::ReferencedFiles::load(conduit::Node& ref,
+                                   conduit::Node& buffer_holder)
+{
+  const std::string file_name = ref["file"].as_string();
+  const std::string path = ref["path"].as_string();
+  const std::string protocol = ref["protocol"].as_string();
+
+  if(protocol == "hdf5")
+  {
+#ifdef AXOM_USE_HDF5
+    auto it = m_hdf5_files.find(file_name);
+    if(it == m_hdf5_files.end())
+    {
+      const hid_t h5_id =
+        conduit::relay::io::hdf5_open_file_for_read(file_name);
+      SLIC_ERROR_IF(h5_id < 0,
+                    "Cannot open file '" << file_name
+                                         << "' of a referenced Buffer");
+      it = m_hdf5_files.emplace(file_name, h5_id).first;
+    }
+    conduit::relay::io::hdf5_read(static_cast<hid_t>(it->second),
+                                  path,
+                                  buffer_holder);
+#else
+    SLIC_ERROR("Referenced Buffer in file '"
+               << file_name << "' requires hdf5 support. "
+               << "Please reconfigure with hdf5.");
+#endif
+  }
+  else
+  {
+    auto it = m_files.find(file_name);
+    if(it == m_files.end())
+    {
+      it = m_files.emplace(file_name, conduit::Node()).first;
+      conduit::relay::io::load(file_name, protocol, it->second);
+    }
+
+    SLIC_ERROR_IF(!it->second.has_path(path),
+                  "Referenced Buffer '" << path << "' not found in file '"
+                                        << file_name << "'");
+    buffer_holder.set_external(it->second[path]);
+  }
+}
+
 } /* end namespace sidre */
 } /* end namespace axom */
@@ -17,7 +17,9 @@
 #define SIDRE_BUFFER_HPP_
 
 // Standard C++ headers
+#include <map>
 #include <set>
+#include <string>
 
 // Other axom headers
 #include "axom/core/memory_management.hpp"
@@ -33,6 +35,7 @@ namespace axom
 namespace sidre
 {
 class DataStore;
+class MemoryArena;
 class View;
 
 /*!
@@ -255,6 +258,63 @@ public:
    */
   void importFrom(conduit::Node& data_holder);
 
+  //@{
+  //!  @name Methods to track modification of Buffer data
+
+  /*!
+   * \brief Record that the data held by this Buffer has been modified.
+   *
+   * Sidre cannot observe writes made through the raw data pointers returned
+   * by getVoidPtr(), View::getArray(), etc. Code that modifies Buffer data
+   * that way should call this method (or View::markDirty()) so that
+   * incremental checkpoints pick up the change. Methods that modify the
+   * Buffer through its own interface (allocate, reallocate, deallocate,
+   * copyBytesIntoBuffer, etc.) call this automatically.
+   */
+  void markDirty() { ++m_generation; }
+
+  /*!
+   * \brief Return true if the Buffer has been modified since the last
+   *        call to markClean(), or if markClean() has never been called.
+   */
+  bool isDirty() const { return m_generation != m_clean_generation; }
+
+  /*!
+   * \brief Record that the current contents of the Buffer have been saved.
+   */
+  void markClean() { m_clean_generation = m_generation; }
+
+  /*!
+   * \brief Return the Buffer's modification counter.
+   *
+   * The counter is incremented each time the Buffer is marked dirty.
+   */
+  axom::uint64 getGeneration() const { return m_generation; }
+
+  /*!
+   * \brief Return a 64-bit checksum (FNV-1a) of the Buffer's data.
+   *
+   * Returns zero if the Buffer is not allocated.
+   *
+   * \note The Buffer's data must be accessible on the host.
+   */
+  axom::uint64 computeChecksum() const;
+
+  /*!
+   * \brief Compare the Buffer's data against the checksum recorded by the
+   *        previous call to this method and mark the Buffer dirty if they
+   *        differ.
+   *
+   * This allows changes made through raw data pointers to be detected
+   * without explicit calls to markDirty(), at the cost of a pass over the
+   * Buffer's data.
+   *
+   * \return true if the Buffer is dirty after the comparison.
+   */
+  bool detectChanges();
+
+  //@}
+
 private:
   DISABLE_DEFAULT_CTOR(Buffer);
   DISABLE_MOVE_AND_ASSIGNMENT(Buffer);
@@ -305,6 +365,54 @@ private:
    */
   void releaseBytes(void* ptr);
 
+  /*!
+   * \brief Private method to return true if an allocation of num_bytes
+   *        with the given allocator should be made from the owning
+   *        DataStore's MemoryArena.
+   */
+  bool useArena(IndexType num_bytes, int allocID) const;
+
+  /*!
+   * \brief Caches the files read to resolve the Buffer references written
+   *  by incremental checkpoints (see IOManager::writeIncremental()), so
+   *  that each referenced file is opened once while a checkpoint is loaded.
+   */
+  class ReferencedFiles
+  {
+  public:
+    ReferencedFiles() = default;
+
+    /*!
+     * \brief Closes the cached files.
+     */
+    ~ReferencedFiles();
+
+    /*!
+     * \brief Loads the Buffer node identified by a reference.
+     *
+     *  The reference holds the name of the file containing the Buffer's
+     *  data, the path to the Buffer node within that file and the relay
+     *  protocol used to write it.
+     */
+    void load(conduit::Node& ref, conduit::Node& buffer_holder);
+
+  private:
+    DISABLE_COPY_AND_ASSIGNMENT(ReferencedFiles);
+    DISABLE_MOVE_AND_ASSIGNMENT(ReferencedFiles);
+
+    /// Contents of the files written with protocols other than hdf5.
+    std::map<std::string, conduit::Node> m_files;
+
+    /// Ids of the open hdf5 files.
+    std::map<std::string, axom::int64> m_hdf5_files;
+  };
+
+  /*!
+   * \brief Private method to import Buffer's state from a Conduit node,
+   *  loading referenced Buffers through the given cache of files.
+   */
+  void importFrom(conduit::Node& data_holder, ReferencedFiles& files);
+
   /// Buffer's unique index within DataStore object that created it.
   IndexType m_index;
 
@@ -313,6 +421,22 @@ private:
 
   /// Conduit Node that holds Buffer data.
   Node m_node;
+
+  /// Modification counter, incremented whenever Buffer data changes.
+  axom::uint64 m_generation;
+
+  /// Value of m_generation at the last call to markClean().
+  axom::uint64 m_clean_generation;
+
+  /// Data checksum computed by the last call to detectChanges().
+  axom::uint64 m_checksum;
+
+  /// Arena of owning DataStore, or nullptr if the DataStore has none.
+  MemoryArena* m_arena;
+
+  /// Size of the arena allocation holding the Buffer's data, or
+  /// InvalidIndex if the data is not held in the arena.
+  IndexType m_arena_bytes;
 };
 
 } /* end namespace sidre */
@@ -21,9 +21,11 @@
 #include "Buffer.hpp"
 #include "Group.hpp"
 #include "Attribute.hpp"
+#include "MemoryArena.hpp"
 
 #ifdef AXOM_USE_MPI
   #include "conduit_blueprint_mpi.hpp"
+  #include "conduit_relay_mpi.hpp"
 #endif
 
 namespace axom
@@ -80,10 +82,22 @@ void DataStoreConduitInfoHandler(const std::string& message,
  *
  *************************************************************************
  */
-DataStore::DataStore()
+DataStore::DataStore() : DataStore(false) { }
+
+/*
+ *************************************************************************
+ *
+ * DataStore ctor creates optional arena and root Group.
+ *
+ *************************************************************************
+ */
+DataStore::DataStore(bool use_arena)
   : m_RootGroup(nullptr)
   , m_attribute_coll(new AttributeCollection())
   , m_need_to_finalize_slic(false)
+  , m_arena(use_arena ? new MemoryArena() : nullptr)
+  , m_use_path_index(false)
+  , m_hierarchy_generation(1)
 {
   if(!axom::slic::isInitialized())
   {
@@ -108,7 +122,7 @@ DataStore::DataStore()
   conduit::utils::set_warning_handler(DataStoreConduitWarningHandler);
   conduit::utils::set_info_handler(DataStoreConduitInfoHandler);
 
-  m_RootGroup = new Group("", this, false);
+  m_RootGroup = createObject<Group>("", this, false);
   m_RootGroup->m_parent = m_RootGroup;
 };
 
@@ -122,11 +136,14 @@ DataStore::DataStore()
 DataStore::~DataStore()
 {
   // clean up Groups and Views before we destroy Buffers
-  delete m_RootGroup;
+  destroyObject(m_RootGroup);
   destroyAllBuffers();
   destroyAllAttributes();
   delete m_attribute_coll;
 
+  // arena must outlive all objects allocated from it
+  delete m_arena;
+
   if(m_need_to_finalize_slic)
   {
     axom::slic::finalize();
@@ -205,7 +222,11 @@ Buffer* DataStore::createBuffer()
     m_free_buffer_ids.pop();
   }
 
-  Buffer* const obj = new(std::nothrow) Buffer(newIndex);
+  Buffer* const obj = createObject<Buffer>(newIndex);
+  if(obj != nullptr)
+  {
+    obj->m_arena = m_arena;
+  }
   m_data_buffers[newIndex] = obj;
 
   return obj;
@@ -244,7 +265,7 @@ void DataStore::destroyBuffer(Buffer* buff)
   {
     buff->detachFromAllViews();
     IndexType idx = buff->getIndex();
-    delete buff;
+    destroyObject(buff);
     SLIC_ASSERT(m_data_buffers[idx] != nullptr);
     m_data_buffers[idx] = nullptr;
     m_free_buffer_ids.push(idx);
@@ -309,6 +330,180 @@ IndexType DataStore::getNextValidBufferIndex(IndexType idx) const
                                                                : InvalidIndex);
 }
 
+/*
+ *************************************************************************
+ *
+ * Return id of interned name, adding it to the table if needed.
+ *
+ *************************************************************************
+ */
+IndexType DataStore::internName(const std::string& name)
+{
+  auto res = m_interned_ids.emplace(name, getNumInternedNames());
+  if(res.second)
+  {
+    m_interned_names.push_back(&res.first->first);
+  }
+  return res.first->second;
+}
+
+/*
+ *************************************************************************
+ *
+ * Return id of interned name, or InvalidIndex.
+ *
+ *************************************************************************
+ */
+IndexType DataStore::getInternedNameId(const std::string& name) const
+{
+  auto it = m_interned_ids.find(name);
+  return (it != m_interned_ids.end()) ? it->second : InvalidIndex;
+}
+
+/*
+ *************************************************************************
+ *
+ * Return interned name with given id, or InvalidName.
+ *
+ *************************************************************************
+ */
+const std::string& DataStore::getInternedName(IndexType id) const
+{
+  if(id < 0 || id >= getNumInternedNames())
+  {
+    SLIC_CHECK_MSG(id >= 0 && id < getNumInternedNames(),
+                   "DataStore has no interned name with id == " << id);
+    return InvalidName;
+  }
+  return *m_interned_names[id];
+}
+
+/*
+ *************************************************************************
+ *
+ * Enable or disable the path index.
+ *
+ *************************************************************************
+ */
+void DataStore::setPathIndexEnabled(bool enabled)
+{
+  m_use_path_index = enabled;
+  if(!enabled)
+  {
+    m_view_path_index.clear();
+    m_group_path_index.clear();
+  }
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to invalidate cached path lookups.
+ *
+ *************************************************************************
+ */
+void DataStore::hierarchyChanged()
+{
+  ++m_hierarchy_generation;
+
+  // clearing an empty table still touches all of its buckets
+  if(!m_view_path_index.empty())
+  {
+    m_view_path_index.clear();
+  }
+  if(!m_group_path_index.empty())
+  {
+    m_group_path_index.clear();
+  }
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to find View in path index.
+ *
+ *************************************************************************
+ */
+View* DataStore::getIndexedView(const Group* group, IndexType path_id) const
+{
+  auto it = m_view_path_index.find(PathKey {group, path_id});
+  return (it != m_view_path_index.end()) ? it->second : nullptr;
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to find Group in path index.
+ *
+ *************************************************************************
+ */
+Group* DataStore::getIndexedGroup(const Group* group, IndexType path_id) const
+{
+  auto it = m_group_path_index.find(PathKey {group, path_id});
+  return (it != m_group_path_index.end()) ? it->second : nullptr;
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to add View to path index.
+ *
+ *************************************************************************
+ */
+void DataStore::indexView(const Group* group, IndexType path_id, View* view)
+{
+  m_view_path_index[PathKey {group, path_id}] = view;
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to add Group to path index.
+ *
+ *************************************************************************
+ */
+void DataStore::indexGroup(const Group* group, IndexType path_id, Group* found)
+{
+  m_group_path_index[PathKey {group, path_id}] = found;
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to allocate storage for a sidre object.
+ *
+ *************************************************************************
+ */
+void* DataStore::allocateObjectBytes(std::size_t num_bytes)
+{
+  if(m_arena != nullptr &&
+     MemoryArena::canAllocate(static_cast<IndexType>(num_bytes)))
+  {
+    return m_arena->allocate(num_bytes);
+  }
+  return ::operator new(num_bytes, std::nothrow);
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to release storage of a sidre object.
+ *
+ *************************************************************************
+ */
+void DataStore::releaseObjectBytes(void* ptr, std::size_t num_bytes)
+{
+  if(m_arena != nullptr &&
+     MemoryArena::canAllocate(static_cast<IndexType>(num_bytes)))
+  {
+    m_arena->deallocate(ptr, num_bytes);
+  }
+  else
+  {
+    ::operator delete(ptr);
+  }
+}
+
 /*
  *************************************************************************
  *
@@ -627,6 +822,160 @@ bool DataStore::generateBlueprintIndex(const std::string& domain_path,
 }
 
 #ifdef AXOM_USE_MPI
+namespace
+{
+/// MPI tag for messages of the Blueprint index tree reduction.
+const int BLUEPRINT_INDEX_TAG = 4127;
+
+/*!
+ * \brief Helper function. Build the partial Blueprint index of the domains
+ *  of a mesh held on this rank.
+ *
+ * The partial index holds the union of the index entries of the domains
+ * under "index" and the parallel int64 arrays "domain_ids" and
+ * "domain_ranks". Domains without a "state/domain_id" get the id -1 and
+ * are numbered by assignFallbackDomainIds() once all ids are known.
+ */
+void buildPartialIndex(const conduit::Node& mesh_node,
+                       const std::string& mesh_name,
+                       int rank,
+                       conduit::Node& partial)
+{
+  // A mesh with coordsets is a single domain, else each child is a domain
+  std::vector<const conduit::Node*> domains;
+  if(mesh_node.has_child("coordsets"))
+  {
+    domains.push_back(&mesh_node);
+  }
+  else
+  {
+    for(conduit::index_t i = 0; i < mesh_node.number_of_children(); ++i)
+    {
+      domains.push_back(&mesh_node.child(i));
+    }
+  }
+
+  conduit::int64 num_local = static_cast<conduit::int64>(domains.size());
+  partial["domain_ids"].set(conduit::DataType::int64(num_local));
+  partial["domain_ranks"].set(conduit::DataType::int64(num_local));
+  conduit::int64* ids = partial["domain_ids"].value();
+  conduit::int64* ranks = partial["domain_ranks"].value();
+
+  for(conduit::int64 d = 0; d < num_local; ++d)
+  {
+    const conduit::Node& dom = *domains[d];
+    ids[d] = dom.has_path("state/domain_id")
+      ? dom["state/domain_id"].to_int64()
+      : -1;
+    ranks[d] = rank;
+
+    conduit::Node dom_index;
+    conduit::blueprint::mesh::generate_index(dom, mesh_name, 1, dom_index);
+    partial["index"].update(dom_index);
+  }
+}
+
+/*!
+ * \brief Helper function. Append the int64 values of src to those of dst.
+ */
+void appendInt64Array(const conduit::Node& src, conduit::Node& dst)
+{
+  conduit::int64_array src_vals = src.as_int64_array();
+  conduit::int64_array dst_vals = dst.as_int64_array();
+
+  std::vector<conduit::int64> vals(dst_vals.number_of_elements() +
+                                   src_vals.number_of_elements());
+  conduit::index_t n = 0;
+  for(conduit::index_t i = 0; i < dst_vals.number_of_elements(); ++i)
+  {
+    vals[n++] = dst_vals[i];
+  }
+  for(conduit::index_t i = 0; i < src_vals.number_of_elements(); ++i)
+  {
+    vals[n++] = src_vals[i];
+  }
+  dst.set(vals);
+}
+
+/*!
+ * \brief Helper function. Merge partial Blueprint indexes over the ranks
+ *  of comm with a binomial tree, leaving the complete result on rank 0.
+ *
+ * Each round halves the number of active ranks, so rank 0 receives
+ * log2(size) messages instead of one from every rank.
+ */
+void reducePartialIndex(conduit::Node& partial,
+                        int rank,
+                        int size,
+                        MPI_Comm comm)
+{
+  for(int step = 1; step < size; step *= 2)
+  {
+    if(rank % (2 * step) != 0)
+    {
+      conduit::relay::mpi::send_using_schema(partial,
+                                             rank - step,
+                                             BLUEPRINT_INDEX_TAG,
+                                             comm);
+      return;
+    }
+
+    if(rank + step < size)
+    {
+      conduit::Node other;
+      conduit::relay::mpi::recv_using_schema(other,
+                                             rank + step,
+                                             BLUEPRINT_INDEX_TAG,
+                                             comm);
+      if(other.has_child("index"))
+      {
+        partial["index"].update(other["index"]);
+      }
+      appendInt64Array(other["domain_ids"], partial["domain_ids"]);
+      appendInt64Array(other["domain_ranks"], partial["domain_ranks"]);
+    }
+  }
+}
+
+/*!
+ * \brief Helper function. Give each domain without an explicit id the
+ *  smallest id not used by any other domain.
+ *
+ * Domains without an id are numbered in the order of the array, which
+ * follows rank order. Duplicate explicit ids are reported.
+ */
+void assignFallbackDomainIds(conduit::int64_array& ids)
+{
+  const conduit::index_t num_domains = ids.number_of_elements();
+
+  std::vector<bool> used(num_domains, false);
+  for(conduit::index_t i = 0; i < num_domains; ++i)
+  {
+    if(ids[i] >= 0 && ids[i] < num_domains)
+    {
+      SLIC_CHECK_MSG(!used[ids[i]],
+                     "Blueprint domain id " << ids[i] << " is not unique");
+      used[ids[i]] = true;
+    }
+  }
+
+  conduit::int64 next = 0;
+  for(conduit::index_t i = 0; i < num_domains; ++i)
+  {
+    if(ids[i] == -1)
+    {
+      while(next < num_domains && used[next])
+      {
+        ++next;
+      }
+      ids[i] = next;
+      used[next] = true;
+    }
+  }
+}
+
+}  // end anonymous namespace
+
 bool DataStore::generateBlueprintIndex(MPI_Comm comm,
                                        const std::string& domain_path,
                                        const std::string& mesh_name,
@@ -662,13 +1011,49 @@ bool DataStore::generateBlueprintIndex(MPI_Comm comm,
   conduit::Node info;
   if(conduit::blueprint::mpi::verify("mesh", mesh_node, info, comm))
   {
-    conduit::Node index;
-    conduit::blueprint::mpi::mesh::generate_index(mesh_node, mesh_name, index, comm);
+    int rank = 0;
+    int size = 1;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    // Merge per-rank partial indexes up a tree rather than having
+    // rank 0 process the metadata of every domain
+    conduit::Node partial;
+    buildPartialIndex(mesh_node, mesh_name, rank, partial);
+    reducePartialIndex(partial, rank, size, comm);
 
-    Node& domain_rank_map = index["state/partition_map/datagroup"];
-    conduit::blueprint::mpi::mesh::generate_domain_to_rank_map(mesh_node,
-                                                               domain_rank_map,
-                                                               comm);
+    conduit::Node index;
+    if(rank == 0)
+    {
+      if(partial.has_child("index"))
+      {
+        index.update(partial["index"]);
+      }
+
+      conduit::int64_array ids = partial["domain_ids"].as_int64_array();
+      assignFallbackDomainIds(ids);
+      conduit::int64_array ranks = partial["domain_ranks"].as_int64_array();
+      const conduit::index_t num_domains = ids.number_of_elements();
+      index["state/number_of_domains"] = num_domains;
+
+      Node& domain_rank_map = index["state/partition_map/datagroup"];
+      domain_rank_map.set(conduit::DataType::int64(num_domains));
+      conduit::int64* domain_ranks = domain_rank_map.value();
+      for(conduit::index_t i = 0; i < num_domains; ++i)
+      {
+        domain_ranks[i] = -1;
+      }
+      for(conduit::index_t i = 0; i < num_domains; ++i)
+      {
+        SLIC_CHECK_MSG(ids[i] >= 0 && ids[i] < num_domains,
+                       "Blueprint domain id " << ids[i] << " is out of range");
+        if(ids[i] >= 0 && ids[i] < num_domains)
+        {
+          domain_ranks[ids[i]] = ranks[i];
+        }
+      }
+    }
+    conduit::relay::mpi::broadcast_using_schema(index, 0, comm);
 
     bpindex->importConduitTree(index);
 
@@ -17,8 +17,13 @@
 #define SIDRE_DATASTORE_HPP_
 
 // Standard C++ headers
-#include <vector>
+#include <functional>
+#include <new>
 #include <stack>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 // Other axom headers
 #include "axom/config.hpp"
@@ -36,6 +41,8 @@ namespace sidre
 {
 class Buffer;
 class Group;
+class MemoryArena;
+class View;
 template <typename TYPE>
 class MapCollection;
 
@@ -53,6 +60,12 @@ class MapCollection;
 class DataStore
 {
 public:
+  //
+  // Friend declaration to constrain usage via controlled access to
+  // private members.
+  //
+  friend class Group;
+
   /*!
    * \brief Default ctor initializes DataStore object and creates a root Group.
    *
@@ -61,6 +74,22 @@ public:
    */
   DataStore();
 
+  /*!
+   * \brief Ctor initializes DataStore object, optionally with a
+   *        MemoryArena, and creates a root Group.
+   *
+   * When use_arena is true, the DataStore allocates its Groups, Views,
+   * Buffers and their item collections from slab pools owned by a
+   * MemoryArena, and host Buffers whose data is no larger than
+   * MemoryArena::MAX_BYTES take their data from the arena as well. This
+   * avoids a heap allocation for each object in hierarchies with many
+   * small Views. The arena is released when the DataStore is destroyed.
+   *
+   * \note Moving Groups and Views between DataStores is an error when
+   *       either DataStore uses an arena.
+   */
+  explicit DataStore(bool use_arena);
+
   /*!
    * \brief Dtor destroys all contents of the DataStore, including data held
    *        in Buffers.
@@ -77,6 +106,84 @@ public:
    */
   const Group* getRoot() const { return m_RootGroup; };
 
+  /*!
+   * \brief Return true if the DataStore allocates from a MemoryArena.
+   */
+  bool usesArena() const { return m_arena != nullptr; }
+
+  /*!
+   * \brief Return pointer to the DataStore's MemoryArena, or nullptr if
+   *        it does not use one.
+   */
+  const MemoryArena* getMemoryArena() const { return m_arena; }
+
+  //@{
+  //!  @name Methods for interned names and fast path lookup.
+
+  /*!
+   * \brief Return the id of the given name in the DataStore's table of
+   *        interned names, adding the name if it is not already there.
+   *
+   * Ids are assigned consecutively from zero and remain valid for the
+   * lifetime of the DataStore.
+   */
+  IndexType internName(const std::string& name);
+
+  /*!
+   * \brief Return the id of the given interned name, or InvalidIndex if
+   *        the name has not been interned.
+   */
+  IndexType getInternedNameId(const std::string& name) const;
+
+  /*!
+   * \brief Return the name with the given interned id.
+   *
+   * If id is not valid, sidre::InvalidName is returned.
+   */
+  const std::string& getInternedName(IndexType id) const;
+
+  /*!
+   * \brief Return number of names in the table of interned names.
+   */
+  IndexType getNumInternedNames() const
+  {
+    return static_cast<IndexType>(m_interned_names.size());
+  }
+
+  /*!
+   * \brief Enable or disable the DataStore's path index.
+   *
+   * When enabled, Group::getView() and Group::getGroup() record the result
+   * of each successful lookup of an interned path in a flat hash table keyed
+   * on the starting Group and the path id, so later lookups of the same path
+   * skip walking the hierarchy one path component at a time. Lookups do not
+   * intern paths; only paths interned by internName() or by creating a
+   * ViewHandle are indexed. The table is cleared whenever a View or Group is
+   * attached to or detached from any Group in the DataStore.
+   *
+   * The path index is disabled by default.
+   */
+  void setPathIndexEnabled(bool enabled);
+
+  /*!
+   * \brief Return true if the DataStore's path index is enabled.
+   */
+  bool isPathIndexEnabled() const { return m_use_path_index; }
+
+  /*!
+   * \brief Return counter that is incremented whenever the Group hierarchy
+   *        of the DataStore changes.
+   *
+   * Objects that cache the result of a path lookup, such as ViewHandle,
+   * compare this against the value when they were resolved.
+   */
+  axom::uint64 getHierarchyGeneration() const
+  {
+    return m_hierarchy_generation;
+  }
+
+  //@}
+
   //@{
   //!  @name Methods to query, access, create, and destroy Buffers.
 
@@ -452,6 +559,87 @@ private:
 
   //@}
 
+  //@{
+  //!  @name Private path index methods.
+  //!        (callable only by Group methods).
+
+  /*!
+   * \brief Record that the Group hierarchy has changed, invalidating
+   *        cached path lookups.
+   */
+  void hierarchyChanged();
+
+  /*!
+   * \brief Return View found by a previous lookup of interned path from
+   *        given Group, or nullptr if there is none in the path index.
+   */
+  View* getIndexedView(const Group* group, IndexType path_id) const;
+
+  /*!
+   * \brief Return Group found by a previous lookup of interned path from
+   *        given Group, or nullptr if there is none in the path index.
+   */
+  Group* getIndexedGroup(const Group* group, IndexType path_id) const;
+
+  /*!
+   * \brief Add View found by lookup of interned path from given Group to
+   *        the path index.
+   */
+  void indexView(const Group* group, IndexType path_id, View* view);
+
+  /*!
+   * \brief Add Group found by lookup of interned path from given Group to
+   *        the path index.
+   */
+  void indexGroup(const Group* group, IndexType path_id, Group* found);
+
+  //@}
+
+  //@{
+  //!  @name Private methods to create and destroy sidre objects.
+  //!        (callable only by Group methods).
+
+  /*!
+   * \brief Allocate num_bytes bytes of object storage from the arena, if
+   *        the DataStore has one, else from the heap.
+   */
+  void* allocateObjectBytes(std::size_t num_bytes);
+
+  /*!
+   * \brief Release object storage obtained from allocateObjectBytes().
+   */
+  void releaseObjectBytes(void* ptr, std::size_t num_bytes);
+
+  /*!
+   * \brief Construct an object of type T in storage from
+   *        allocateObjectBytes(), or return nullptr on failure.
+   */
+  template <typename T, typename... Args>
+  T* createObject(Args&&... args)
+  {
+    void* bytes = allocateObjectBytes(sizeof(T));
+    return (bytes == nullptr) ? nullptr
+                              : new(bytes) T(std::forward<Args>(args)...);
+  }
+
+  /*!
+   * \brief Destroy an object made by createObject() and release its storage.
+   *
+   * T must be the type the object was created with. If obj is null, method
+   * is a no-op.
+   */
+  template <typename T>
+  void destroyObject(T* obj)
+  {
+    if(obj != nullptr)
+    {
+      obj->~T();
+      releaseObjectBytes(obj, sizeof(T));
+    }
+  }
+
+  //@}
+
   /// Root Group, created when DataStore object is created.
   Group* m_RootGroup;
 
@@ -471,6 +659,52 @@ private:
 
   /// Flag indicating whether SLIC logging environment was initialized in ctor.
   bool m_need_to_finalize_slic;
+
+  /// Arena for objects and small Buffer data, or nullptr if not used.
+  MemoryArena* m_arena;
+
+  /// Map from interned name to its id.
+  std::unordered_map<std::string, IndexType> m_interned_ids;
+
+  /// Interned names, indexed by id (point to keys of m_interned_ids).
+  std::vector<const std::string*> m_interned_names;
+
+  ///////////////////////////////////////////////////////////////////
+  //
+  /// Key of the path index: starting Group and interned path id.
+  struct PathKey
+  {
+    const Group* group;
+    IndexType path_id;
+
+    bool operator==(const PathKey& other) const
+    {
+      return group == other.group && path_id == other.path_id;
+    }
+  };
+
+  struct PathKeyHash
+  {
+    std::size_t operator()(const PathKey& key) const
+    {
+      const std::size_t h = std::hash<const void*>()(key.group);
+      return h ^ (std::hash<IndexType>()(key.path_id) + 0x9e3779b9 + (h << 6) +
+                  (h >> 2));
+    }
+  };
+  ///////////////////////////////////////////////////////////////////
+
+  /// Flag indicating whether path lookups are recorded in the path index.
+  bool m_use_path_index;
+
+  /// Counter incremented whenever the Group hierarchy changes.
+  axom::uint64 m_hierarchy_generation;
+
+  /// Path index entries for Views.
+  std::unordered_map<PathKey, View*, PathKeyHash> m_view_path_index;
+
+  /// Path index entries for Groups.
+  std::unordered_map<PathKey, Group*, PathKeyHash> m_group_path_index;
 };
 
 } /* end namespace sidre */
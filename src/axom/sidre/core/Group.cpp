@@ -107,6 +107,20 @@ bool Group::hasView(const std::string& path) const
  */
 View* Group::getView(const std::string& path)
 {
+  IndexType path_id = InvalidIndex;
+  if(m_datastore->isPathIndexEnabled())
+  {
+    // lookups do not intern, only paths that are already interned are indexed
+    path_id = m_datastore->getInternedNameId(path);
+    View* view = (path_id != InvalidIndex)
+      ? m_datastore->getIndexedView(this, path_id)
+      : nullptr;
+    if(view != nullptr)
+    {
+      return view;
+    }
+  }
+
   std::string intpath(path);
   bool create_groups_in_path = false;
   Group* group = walkPath(intpath, create_groups_in_path);
@@ -123,7 +137,12 @@ View* Group::getView(const std::string& path)
     !intpath.empty() && group->hasChildView(intpath),
     SIDRE_GROUP_LOG_PREPEND << "No View with name '" << intpath << "'");
 
-  return group->m_view_coll->getItem(intpath);
+  View* view = group->m_view_coll->getItem(intpath);
+  if(view != nullptr && path_id != InvalidIndex)
+  {
+    m_datastore->indexView(this, path_id, view);
+  }
+  return view;
 }
 
 /*
@@ -135,6 +154,12 @@ View* Group::getView(const std::string& path)
  */
 const View* Group::getView(const std::string& path) const
 {
+  if(m_datastore->isPathIndexEnabled())
+  {
+    // the path index is a cache, so updating it does not change the Group
+    return const_cast<Group*>(this)->getView(path);
+  }
+
   std::string intpath(path);
   const Group* group = walkPath(intpath);
 
@@ -218,7 +243,7 @@ View* Group::createView(const std::string& path)
     }
   }
 
-  View* view = new(std::nothrow) View(intpath);
+  View* view = getDataStore()->createObject<View>(intpath);
   if(view != nullptr)
   {
     group->attachView(view);
@@ -603,7 +628,7 @@ void Group::destroyView(const std::string& path)
     View* view = group->detachView(intpath);
     if(view != nullptr)
     {
-      delete view;
+      getDataStore()->destroyObject(view);
     }
   }
 }
@@ -620,7 +645,7 @@ void Group::destroyView(IndexType idx)
   View* view = detachView(idx);
   if(view != nullptr)
   {
-    delete view;
+    getDataStore()->destroyObject(view);
   }
 }
 
@@ -639,7 +664,7 @@ void Group::destroyViews()
     View* view = detachView(vidx);
     if(view != nullptr)
     {
-      delete view;
+      getDataStore()->destroyObject(view);
     }
 
     vidx = getNextValidViewIndex(vidx);
@@ -700,6 +725,19 @@ void Group::destroyViewsAndData()
 //
 ////////////////////////////////////////////////////////////////////////
 
+/*!
+ * \brief Helper function. Return true if Groups and Views may be moved from
+ *  one DataStore to the other.
+ *
+ *  Objects of a DataStore with a MemoryArena are allocated from its arena
+ *  and must be destroyed by that DataStore, so they cannot be moved to
+ *  another DataStore.
+ */
+static bool canMoveBetween(const DataStore* from, const DataStore* to)
+{
+  return from == to || (!from->usesArena() && !to->usesArena());
+}
+
 /*
  *************************************************************************
  *
@@ -723,6 +761,14 @@ View* Group::moveView(View* view)
     // this Group already owns the View
     return view;
   }
+  else if(!canMoveBetween(curr_group->getDataStore(), getDataStore()))
+  {
+    SLIC_ERROR(SIDRE_GROUP_LOG_PREPEND
+               << "Cannot move View '" << view->getName()
+               << "' from another DataStore when either DataStore uses "
+               << "a MemoryArena.");
+    return nullptr;
+  }
   else if(hasChildView(view->getName()))
   {
     SLIC_CHECK_MSG(!hasChildView(view->getName()),
@@ -816,6 +862,20 @@ bool Group::hasGroup(const std::string& path) const
  */
 Group* Group::getGroup(const std::string& path)
 {
+  IndexType path_id = InvalidIndex;
+  if(m_datastore->isPathIndexEnabled())
+  {
+    // lookups do not intern, only paths that are already interned are indexed
+    path_id = m_datastore->getInternedNameId(path);
+    Group* found = (path_id != InvalidIndex)
+      ? m_datastore->getIndexedGroup(this, path_id)
+      : nullptr;
+    if(found != nullptr)
+    {
+      return found;
+    }
+  }
+
   std::string intpath(path);
   bool create_groups_in_path = false;
   Group* group = walkPath(intpath, create_groups_in_path);
@@ -832,7 +892,12 @@ Group* Group::getGroup(const std::string& path)
                  SIDRE_GROUP_LOG_PREPEND
                    << "Group has no descendant Group named '" << path << "'.");
 
-  return group->m_group_coll->getItem(intpath);
+  Group* found = group->m_group_coll->getItem(intpath);
+  if(found != nullptr && path_id != InvalidIndex)
+  {
+    m_datastore->indexGroup(this, path_id, found);
+  }
+  return found;
 }
 
 /*
@@ -844,6 +909,12 @@ Group* Group::getGroup(const std::string& path)
  */
 const Group* Group::getGroup(const std::string& path) const
 {
+  if(m_datastore->isPathIndexEnabled())
+  {
+    // the path index is a cache, so updating it does not change the Group
+    return const_cast<Group*>(this)->getGroup(path);
+  }
+
   std::string intpath(path);
   const Group* group = walkPath(intpath);
 
@@ -908,8 +979,9 @@ Group* Group::createGroup(const std::string& path, bool is_list)
     return nullptr;
   }
 
+  DataStore* datastore = group->getDataStore();
   Group* new_group =
-    new(std::nothrow) Group(intpath, group->getDataStore(), is_list);
+    datastore->createObject<Group>(intpath, datastore, is_list);
   if(new_group == nullptr)
   {
     return nullptr;
@@ -931,7 +1003,8 @@ Group* Group::createUnnamedGroup(bool is_list)
   Group* new_group;
   if(m_is_list)
   {
-    new_group = new(std::nothrow) Group("", getDataStore(), is_list);
+    DataStore* datastore = getDataStore();
+    new_group = datastore->createObject<Group>("", datastore, is_list);
   }
   else
   {
@@ -967,7 +1040,7 @@ void Group::destroyGroup(const std::string& path)
     Group* targetgroup = group->detachGroup(intpath);
     if(targetgroup != nullptr)
     {
-      delete targetgroup;
+      targetgroup->getDataStore()->destroyObject(targetgroup);
     }
   }
 }
@@ -984,7 +1057,7 @@ void Group::destroyGroup(IndexType idx)
   Group* group = detachGroup(idx);
   if(group != nullptr)
   {
-    delete group;
+    group->getDataStore()->destroyObject(group);
   }
 }
 
@@ -1001,12 +1074,13 @@ void Group::destroyGroups()
   while(indexIsValid(gidx))
   {
     Group* group = this->getGroup(gidx);
-    delete group;
+    group->getDataStore()->destroyObject(group);
 
     gidx = getNextValidGroupIndex(gidx);
   }
 
   m_group_coll->removeAllItems();
+  m_datastore->hierarchyChanged();
 }
 
 /*
@@ -1035,6 +1109,15 @@ Group* Group::moveGroup(Group* group)
     return nullptr;
   }
 
+  if(!canMoveBetween(group->getDataStore(), getDataStore()))
+  {
+    SLIC_ERROR(SIDRE_GROUP_LOG_PREPEND
+               << "Cannot move Group '" << group->getName()
+               << "' from another DataStore when either DataStore uses "
+               << "a MemoryArena.");
+    return nullptr;
+  }
+
   Group* curr_group = group->getParent();
   curr_group->detachGroup(group->getName());
   attachGroup(group);
@@ -1720,13 +1803,13 @@ Group::Group(const std::string& name, DataStore* datastore, bool is_list)
 {
   if(is_list)
   {
-    m_view_coll = new ListCollection<View>();
-    m_group_coll = new ListCollection<Group>();
+    m_view_coll = m_datastore->createObject<ListCollection<View>>();
+    m_group_coll = m_datastore->createObject<ListCollection<Group>>();
   }
   else
   {
-    m_view_coll = new MapCollection<View>();
-    m_group_coll = new MapCollection<Group>();
+    m_view_coll = m_datastore->createObject<MapCollection<View>>();
+    m_group_coll = m_datastore->createObject<MapCollection<Group>>();
   }
 }
 
@@ -1741,8 +1824,21 @@ Group::~Group()
 {
   destroyViews();
   destroyGroups();
-  delete m_view_coll;
-  delete m_group_coll;
+
+  // collections were created as their concrete types in the ctor
+  if(m_is_list)
+  {
+    m_datastore->destroyObject(
+      static_cast<ListCollection<View>*>(m_view_coll));
+    m_datastore->destroyObject(
+      static_cast<ListCollection<Group>*>(m_group_coll));
+  }
+  else
+  {
+    m_datastore->destroyObject(static_cast<MapCollection<View>*>(m_view_coll));
+    m_datastore->destroyObject(
+      static_cast<MapCollection<Group>*>(m_group_coll));
+  }
 }
 
 /*
@@ -1769,6 +1865,7 @@ View* Group::attachView(View* view)
                       << "attatched to Group " << getPathName() << ".");
     view->m_owning_group = this;
     view->m_index = m_view_coll->insertItem(view, view->getName());
+    m_datastore->hierarchyChanged();
     return view;
   }
 }
@@ -1787,6 +1884,7 @@ View* Group::detachView(const std::string& name)
   {
     view->m_owning_group = nullptr;
     view->m_index = InvalidIndex;
+    m_datastore->hierarchyChanged();
   }
 
   return view;
@@ -1806,6 +1904,7 @@ View* Group::detachView(IndexType idx)
   {
     view->m_owning_group = nullptr;
     view->m_index = InvalidIndex;
+    m_datastore->hierarchyChanged();
   }
 
   return view;
@@ -1829,7 +1928,7 @@ void Group::destroyViewAndData(View* view)
     {
       getDataStore()->destroyBuffer(buffer);
     }
-    delete view;
+    getDataStore()->destroyObject(view);
   }
 }
 
@@ -1851,6 +1950,7 @@ Group* Group::attachGroup(Group* group)
   {
     group->m_parent = this;
     group->m_index = m_group_coll->insertItem(group, group->getName());
+    m_datastore->hierarchyChanged();
     return group;
   }
 }
@@ -1869,6 +1969,7 @@ Group* Group::detachGroup(const std::string& name)
   {
     group->m_parent = nullptr;
     group->m_index = InvalidIndex;
+    m_datastore->hierarchyChanged();
   }
 
   return group;
@@ -1888,6 +1989,7 @@ Group* Group::detachGroup(IndexType idx)
   {
     group->m_parent = nullptr;
     group->m_index = InvalidIndex;
+    m_datastore->hierarchyChanged();
   }
 
   return group;
@@ -2034,6 +2136,7 @@ void Group::importFrom(conduit::Node& node, bool preserve_contents)
 
   // First - Import Buffers into the DataStore.
   std::map<IndexType, IndexType> buffer_indices_map;
+  Buffer::ReferencedFiles referenced_files;
 
   if(node.has_path("buffers"))
   {
@@ -2049,7 +2152,7 @@ void Group::importFrom(conduit::Node& node, bool preserve_contents)
       buffer_indices_map[old_buffer_id] = buffer->getIndex();
 
       // populate the new Buffer's state
-      buffer->importFrom(n_buffer);
+      buffer->importFrom(n_buffer, referenced_files);
     }
   }
 
@@ -2294,6 +2397,12 @@ Group* Group::walkPath(std::string& path, bool create_groups_in_path)
 {
   Group* group_ptr = this;
 
+  // A single name needs no splitting
+  if(path.find(s_path_delimiter) == std::string::npos)
+  {
+    return group_ptr;
+  }
+
   // Split path into parts
   std::vector<std::string> path_parts =
     axom::Path(path, s_path_delimiter).parts();
@@ -2308,9 +2417,13 @@ Group* Group::walkPath(std::string& path, bool create_groups_in_path)
         iter < stop;
         ++iter)
     {
-      if(group_ptr->hasChildGroup(*iter))
+      // single lookup of the child; list Groups have no named children
+      Group* child = group_ptr->m_is_list
+        ? nullptr
+        : group_ptr->m_group_coll->getItem(*iter);
+      if(child != nullptr)
       {
-        group_ptr = group_ptr->getGroup(*iter);
+        group_ptr = child;
       }
       else if(create_groups_in_path)
       {
@@ -2333,6 +2446,24 @@ Group* Group::walkPath(std::string& path, bool create_groups_in_path)
   return group_ptr;
 }
 
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to find View with given name or path in a single walk.
+ *
+ *************************************************************************
+ */
+View* Group::findView(const std::string& path)
+{
+  std::string intpath(path);
+  bool create_groups_in_path = false;
+  Group* group = walkPath(intpath, create_groups_in_path);
+
+  return (group != nullptr && !intpath.empty())
+    ? group->m_view_coll->getItem(intpath)
+    : nullptr;
+}
+
 /*
  *************************************************************************
  *
@@ -2346,6 +2477,12 @@ const Group* Group::walkPath(std::string& path) const
 {
   const Group* group_ptr = this;
 
+  // A single name needs no splitting
+  if(path.find(s_path_delimiter) == std::string::npos)
+  {
+    return group_ptr;
+  }
+
   // Split path into parts
   std::vector<std::string> path_parts =
     axom::Path(path, s_path_delimiter).parts();
@@ -2360,9 +2497,12 @@ const Group* Group::walkPath(std::string& path) const
         iter < stop;
         ++iter)
     {
-      if(group_ptr->hasChildGroup(*iter))
+      const Group* child = group_ptr->m_is_list
+        ? nullptr
+        : group_ptr->m_group_coll->getItem(*iter);
+      if(child != nullptr)
       {
-        group_ptr = group_ptr->getGroup(*iter);
+        group_ptr = child;
       }
       else
       {
@@ -38,6 +38,7 @@
 // Sidre headers
 #include "SidreTypes.hpp"
 #include "View.hpp"
+#include "ViewHandle.hpp"
 
 // Define the default protocol for sidre I/O
 #ifdef AXOM_USE_HDF5
@@ -53,6 +54,7 @@ namespace sidre
 class Buffer;
 class Group;
 class DataStore;
+class IOManager;
 template <typename TYPE>
 class ItemCollection;
 
@@ -125,6 +127,8 @@ public:
   //
   friend class DataStore;
   friend class View;
+  friend class IOManager;
+  friend class ViewHandle;
 
   //@{
   //!  @name Basic query and accessor methods.
@@ -336,6 +340,18 @@ public:
    */
   const View* getView(IndexType idx) const;
 
+  /*!
+   * \brief Return a ViewHandle for the View with given name or path.
+   *
+   * The handle resolves the path when first used and caches the result
+   * until the DataStore's Group hierarchy changes. It is intended for code
+   * that accesses the same View repeatedly, e.g. inside a time step loop.
+   */
+  ViewHandle getViewHandle(const std::string& path)
+  {
+    return ViewHandle(this, path);
+  }
+
   //@}
 
   //@{
@@ -793,6 +809,9 @@ public:
    * If given View pointer is null or Group already has a View with
    * same name as given View, method is a no-op.
    *
+   * \note Moving a View between DataStores is an error when either
+   * DataStore uses a MemoryArena.
+   *
    * \return pointer to given argument View object or nullptr if View
    * is not moved into this Group.
    */
@@ -991,6 +1010,9 @@ public:
    * If given Group pointer is null or Group already has a child Group with
    * same name as given Group, method is a no-op.
    *
+   * \note Moving a Group between DataStores is an error when either
+   * DataStore uses a MemoryArena.
+   *
    * \return pointer to given argument Group object or nullptr if Group
    * is not moved into this Group.
    */
@@ -1566,6 +1588,14 @@ private:
    */
   const Group* walkPath(std::string& path) const;
 
+  /*!
+   * \brief Private method that returns the View with given name or path,
+   * or nullptr if there is no such View.
+   *
+   * The path is walked once and no message is logged for a missing View.
+   */
+  View* findView(const std::string& path);
+
   /*!
    * \brief Private method. If allocatorID is a valid allocator ID then return
    *  it. Otherwise return the ID of the default allocator of the owning group.
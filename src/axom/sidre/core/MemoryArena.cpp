@@ -0,0 +1,298 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+// Associated header file
+#include "MemoryArena.hpp"
+
+// Standard C++ headers
+#include <cstdlib>
+
+// Other axom headers
+#include "axom/slic/interface/slic.hpp"
+
+namespace axom
+{
+namespace sidre
+{
+constexpr std::size_t SlabPool::ALIGNMENT;
+constexpr std::size_t MemoryArena::MAX_BYTES;
+constexpr std::size_t MemoryArena::SLAB_BYTES;
+
+namespace
+{
+/// Size classes are spaced by the alignment up to this size...
+constexpr std::size_t LINEAR_CLASS_LIMIT = 512;
+
+/// ...giving this many linearly-spaced classes; the rest are powers of two.
+constexpr int NUM_LINEAR_CLASSES =
+  static_cast<int>(LINEAR_CLASS_LIMIT / SlabPool::ALIGNMENT);
+
+}  // end anonymous namespace
+
+/*
+ *************************************************************************
+ *
+ * SlabPool ctor.
+ *
+ *************************************************************************
+ */
+SlabPool::SlabPool(std::size_t block_bytes, std::size_t blocks_per_slab)
+  : m_block_bytes(0)
+  , m_blocks_per_slab(blocks_per_slab > 0 ? blocks_per_slab : 1)
+  , m_slabs()
+  , m_free_list(nullptr)
+  , m_num_in_use(0)
+{
+  // Blocks must be large enough to hold a free list node
+  std::size_t bytes = block_bytes > sizeof(FreeBlock) ? block_bytes
+                                                      : sizeof(FreeBlock);
+  m_block_bytes = ((bytes + ALIGNMENT - 1) / ALIGNMENT) * ALIGNMENT;
+}
+
+/*
+ *************************************************************************
+ *
+ * SlabPool dtor releases all slabs.
+ *
+ *************************************************************************
+ */
+SlabPool::~SlabPool()
+{
+  SLIC_WARNING_IF(m_num_in_use != 0,
+                  "SlabPool destroyed with " << m_num_in_use
+                                             << " blocks still in use.");
+
+  for(void* slab : m_slabs)
+  {
+    std::free(slab);
+  }
+}
+
+/*
+ *************************************************************************
+ *
+ * Get block from head of free list, adding a slab if needed.
+ *
+ *************************************************************************
+ */
+void* SlabPool::allocate()
+{
+  if(m_free_list == nullptr && !addSlab())
+  {
+    return nullptr;
+  }
+
+  FreeBlock* block = m_free_list;
+  m_free_list = block->next;
+  ++m_num_in_use;
+
+  return block;
+}
+
+/*
+ *************************************************************************
+ *
+ * Push block onto head of free list.
+ *
+ *************************************************************************
+ */
+void SlabPool::deallocate(void* ptr)
+{
+  if(ptr == nullptr)
+  {
+    return;
+  }
+
+  SLIC_ASSERT(m_num_in_use > 0);
+
+  FreeBlock* block = static_cast<FreeBlock*>(ptr);
+  block->next = m_free_list;
+  m_free_list = block;
+  --m_num_in_use;
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to allocate a slab and thread its blocks onto the
+ * free list.
+ *
+ *************************************************************************
+ */
+bool SlabPool::addSlab()
+{
+  // std::malloc returns memory aligned for any fundamental type,
+  // and blocks are a multiple of ALIGNMENT bytes
+  axom::uint8* slab =
+    static_cast<axom::uint8*>(std::malloc(m_block_bytes * m_blocks_per_slab));
+  if(slab == nullptr)
+  {
+    SLIC_WARNING("SlabPool failed to allocate slab of "
+                 << m_block_bytes * m_blocks_per_slab << " bytes.");
+    return false;
+  }
+  m_slabs.push_back(slab);
+
+  // Thread blocks in address order so consecutive allocations are adjacent
+  for(std::size_t i = m_blocks_per_slab; i-- > 0;)
+  {
+    FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + i * m_block_bytes);
+    block->next = m_free_list;
+    m_free_list = block;
+  }
+
+  return true;
+}
+
+/*
+ *************************************************************************
+ *
+ * MemoryArena ctor.
+ *
+ *************************************************************************
+ */
+MemoryArena::MemoryArena() : m_pools(getSizeClass(MAX_BYTES) + 1, nullptr) { }
+
+/*
+ *************************************************************************
+ *
+ * MemoryArena dtor releases all pools.
+ *
+ *************************************************************************
+ */
+MemoryArena::~MemoryArena()
+{
+  for(SlabPool* pool : m_pools)
+  {
+    delete pool;
+  }
+}
+
+/*
+ *************************************************************************
+ *
+ * Allocate from the pool for the request's size class.
+ *
+ *************************************************************************
+ */
+void* MemoryArena::allocate(std::size_t num_bytes)
+{
+  SLIC_ASSERT(num_bytes <= MAX_BYTES);
+
+  const int size_class = getSizeClass(num_bytes);
+  SlabPool*& pool = m_pools[size_class];
+  if(pool == nullptr)
+  {
+    const std::size_t class_bytes = getClassBytes(size_class);
+    pool = new SlabPool(class_bytes, SLAB_BYTES / class_bytes);
+  }
+
+  return pool->allocate();
+}
+
+/*
+ *************************************************************************
+ *
+ * Return allocation to the pool for its size class.
+ *
+ *************************************************************************
+ */
+void MemoryArena::deallocate(void* ptr, std::size_t num_bytes)
+{
+  if(ptr == nullptr)
+  {
+    return;
+  }
+
+  SlabPool* pool = m_pools[getSizeClass(num_bytes)];
+  SLIC_ASSERT(pool != nullptr);
+
+  pool->deallocate(ptr);
+}
+
+/*
+ *************************************************************************
+ *
+ * Return number of allocations held from the arena.
+ *
+ *************************************************************************
+ */
+IndexType MemoryArena::getNumAllocations() const
+{
+  IndexType num_allocs = 0;
+  for(const SlabPool* pool : m_pools)
+  {
+    if(pool != nullptr)
+    {
+      num_allocs += pool->getNumBlocksInUse();
+    }
+  }
+  return num_allocs;
+}
+
+/*
+ *************************************************************************
+ *
+ * Return bytes reserved in slabs by the arena.
+ *
+ *************************************************************************
+ */
+std::size_t MemoryArena::getNumBytesReserved() const
+{
+  std::size_t num_bytes = 0;
+  for(const SlabPool* pool : m_pools)
+  {
+    if(pool != nullptr)
+    {
+      const std::size_t slab_bytes =
+        pool->getBlockBytes() * (SLAB_BYTES / pool->getBlockBytes());
+      num_bytes += pool->getNumSlabs() * slab_bytes;
+    }
+  }
+  return num_bytes;
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to map a request size to its size class.
+ *
+ *************************************************************************
+ */
+int MemoryArena::getSizeClass(std::size_t num_bytes)
+{
+  if(num_bytes <= LINEAR_CLASS_LIMIT)
+  {
+    const std::size_t units = (num_bytes + SlabPool::ALIGNMENT - 1) /
+      SlabPool::ALIGNMENT;
+    return units > 0 ? static_cast<int>(units) - 1 : 0;
+  }
+
+  int size_class = NUM_LINEAR_CLASSES;
+  for(std::size_t bytes = 2 * LINEAR_CLASS_LIMIT; bytes < num_bytes; bytes *= 2)
+  {
+    ++size_class;
+  }
+  return size_class;
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to return block size of a size class.
+ *
+ *************************************************************************
+ */
+std::size_t MemoryArena::getClassBytes(int size_class)
+{
+  if(size_class < NUM_LINEAR_CLASSES)
+  {
+    return (size_class + 1) * SlabPool::ALIGNMENT;
+  }
+  return (2 * LINEAR_CLASS_LIMIT) << (size_class - NUM_LINEAR_CLASSES);
+}
+
+} /* end namespace sidre */
+} /* end namespace axom */
@@ -0,0 +1,213 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ ******************************************************************************
+ *
+ * \file MemoryArena.hpp
+ *
+ * \brief   Header file containing definition of SlabPool and MemoryArena
+ *          classes.
+ *
+ *          A MemoryArena can optionally be owned by a DataStore (see
+ *          DataStore::DataStore(bool)). When present, the DataStore uses it
+ *          to allocate its metadata objects (Views, Groups, Buffers and
+ *          their item collections) and the data of small host Buffers,
+ *          instead of making a separate heap allocation for each.
+ *
+ ******************************************************************************
+ */
+
+#ifndef SIDRE_MEMORYARENA_HPP_
+#define SIDRE_MEMORYARENA_HPP_
+
+// Standard C++ headers
+#include <cstddef>
+#include <vector>
+
+// Other axom headers
+#include "axom/core/Macros.hpp"
+#include "axom/core/Types.hpp"
+
+// Sidre project headers
+#include "SidreTypes.hpp"
+
+namespace axom
+{
+namespace sidre
+{
+/*!
+ * \class SlabPool
+ *
+ * \brief SlabPool hands out fixed-size blocks of memory carved from
+ *        large slabs.
+ *
+ * Freed blocks are kept on an intrusive free list and reused by later
+ * allocations. Slabs are only returned to the system when the SlabPool is
+ * destroyed.
+ */
+class SlabPool
+{
+public:
+  /*!
+   * \brief Constructor.
+   *
+   * \param block_bytes     size in bytes of each block; rounded up to a
+   *                        multiple of SlabPool::ALIGNMENT
+   * \param blocks_per_slab number of blocks in each slab
+   */
+  SlabPool(std::size_t block_bytes, std::size_t blocks_per_slab);
+
+  /*!
+   * \brief Destructor releases all slabs.
+   */
+  ~SlabPool();
+
+  /*!
+   * \brief Return pointer to an unused block, or nullptr if a new slab
+   *        could not be allocated.
+   */
+  void* allocate();
+
+  /*!
+   * \brief Return a block obtained from allocate() to the pool.
+   *
+   * If ptr is null, method is a no-op.
+   */
+  void deallocate(void* ptr);
+
+  /*!
+   * \brief Return size in bytes of the blocks in this pool.
+   */
+  std::size_t getBlockBytes() const { return m_block_bytes; }
+
+  /*!
+   * \brief Return number of blocks currently handed out by the pool.
+   */
+  IndexType getNumBlocksInUse() const { return m_num_in_use; }
+
+  /*!
+   * \brief Return number of slabs allocated by the pool.
+   */
+  IndexType getNumSlabs() const
+  {
+    return static_cast<IndexType>(m_slabs.size());
+  }
+
+  /// Alignment (in bytes) of every block returned by allocate().
+  static constexpr std::size_t ALIGNMENT = 16;
+
+private:
+  DISABLE_DEFAULT_CTOR(SlabPool);
+  DISABLE_COPY_AND_ASSIGNMENT(SlabPool);
+  DISABLE_MOVE_AND_ASSIGNMENT(SlabPool);
+
+  /// Node of the intrusive list threaded through free blocks.
+  struct FreeBlock
+  {
+    FreeBlock* next;
+  };
+
+  /*!
+   * \brief Private method to allocate a new slab and put its blocks on the
+   *        free list. Returns false if the allocation failed.
+   */
+  bool addSlab();
+
+  std::size_t m_block_bytes;
+  std::size_t m_blocks_per_slab;
+  std::vector<void*> m_slabs;
+  FreeBlock* m_free_list;
+  IndexType m_num_in_use;
+};
+
+/*!
+ * \class MemoryArena
+ *
+ * \brief MemoryArena is a size-class allocator for small host allocations.
+ *
+ * Requests are rounded up to one of a fixed set of size classes, each
+ * served by its own SlabPool. Classes are spaced SlabPool::ALIGNMENT bytes
+ * apart up to 512 bytes, then by powers of two up to MAX_BYTES. Requests
+ * larger than MAX_BYTES must be made elsewhere (see canAllocate()).
+ *
+ * Since the block size is not stored with the block, deallocate() must be
+ * passed the same size that was given to allocate().
+ *
+ * A MemoryArena is not thread-safe.
+ */
+class MemoryArena
+{
+public:
+  /// Largest allocation (in bytes) served by the arena.
+  static constexpr std::size_t MAX_BYTES = 4096;
+
+  /// Approximate size (in bytes) of each slab of memory.
+  static constexpr std::size_t SLAB_BYTES = 64 * 1024;
+
+  MemoryArena();
+
+  ~MemoryArena();
+
+  /*!
+   * \brief Return true if an allocation of num_bytes can be served
+   *        by the arena.
+   */
+  static bool canAllocate(IndexType num_bytes)
+  {
+    return num_bytes >= 0 && static_cast<std::size_t>(num_bytes) <= MAX_BYTES;
+  }
+
+  /*!
+   * \brief Allocate num_bytes bytes from the arena.
+   *
+   * A zero byte request returns a valid, unique pointer.
+   *
+   * \pre canAllocate(num_bytes)
+   *
+   * \return pointer to the allocation, or nullptr on failure.
+   */
+  void* allocate(std::size_t num_bytes);
+
+  /*!
+   * \brief Return memory obtained from allocate(num_bytes) to the arena.
+   *
+   * If ptr is null, method is a no-op.
+   */
+  void deallocate(void* ptr, std::size_t num_bytes);
+
+  /*!
+   * \brief Return number of allocations currently held from the arena.
+   */
+  IndexType getNumAllocations() const;
+
+  /*!
+   * \brief Return total bytes of slab memory reserved by the arena.
+   */
+  std::size_t getNumBytesReserved() const;
+
+private:
+  DISABLE_COPY_AND_ASSIGNMENT(MemoryArena);
+  DISABLE_MOVE_AND_ASSIGNMENT(MemoryArena);
+
+  /*!
+   * \brief Private method to return the index of the size class for a
+   *        request of num_bytes bytes.
+   */
+  static int getSizeClass(std::size_t num_bytes);
+
+  /*!
+   * \brief Private method to return the block size of a size class.
+   */
+  static std::size_t getClassBytes(int size_class);
+
+  /// One pool per size class, created on first use.
+  std::vector<SlabPool*> m_pools;
+};
+
+} /* end namespace sidre */
+} /* end namespace axom */
+
+#endif /* SIDRE_MEMORYARENA_HPP_ */
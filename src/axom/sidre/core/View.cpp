@@ -581,10 +581,39 @@ View* View::updateFrom(const View* other)
   src += other->getOffset() * other->getBytesPerElement();
 
   copy(dst, src, getTotalBytes());
+  markDirty();
 
   return this;
 }
 
+/*
+ *************************************************************************
+ *
+ * Mark data in View's Buffer as modified.
+ *
+ *************************************************************************
+ */
+View* View::markDirty()
+{
+  if(hasBuffer())
+  {
+    m_data_buffer->markDirty();
+  }
+  return this;
+}
+
+/*
+ *************************************************************************
+ *
+ * Return true if data in View's Buffer was modified since last saved.
+ *
+ *************************************************************************
+ */
+bool View::isDirty() const
+{
+  return hasBuffer() ? m_data_buffer->isDirty() : true;
+}
+
 /*
  *************************************************************************
  *
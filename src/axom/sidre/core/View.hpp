@@ -19,9 +19,11 @@
 // Standard C++ headers
 #include <string>
 #include <set>
+#include <type_traits>
 
 // Other axom headers
 #include "axom/config.hpp"
+#include "axom/core/ArrayView.hpp"
 #include "axom/core/memory_management.hpp"
 #include "axom/core/Macros.hpp"
 #include "axom/core/Types.hpp"
@@ -93,6 +95,7 @@ public:
   // Friend declaration to constrain usage via controlled access to
   // private members.
   //
+  friend class DataStore;
   friend class Group;
   friend class Buffer;
 
@@ -748,6 +751,28 @@ public:
  */
   View* updateFrom(const View* other);
 
+  /*!
+   * \brief Record that the data in this View has been modified.
+   *
+   * If the View is attached to a Buffer, the Buffer is marked dirty so its
+   * data will be written by the next incremental checkpoint.  Other Views
+   * (external, scalar, string) are always written in full, so this is a
+   * no-op for them.
+   *
+   * \sa Buffer::markDirty()
+   *
+   * \return pointer to this View object.
+   */
+  View* markDirty();
+
+  /*!
+   * \brief Return true if the data in this View has been modified since its
+   *        Buffer was last marked clean.
+   *
+   * Views that are not attached to a Buffer always return true.
+   */
+  bool isDirty() const;
+
   //@{
   //! @name Methods to retrieve data in a view.
 
@@ -770,6 +795,62 @@ public:
     return getData();
   }
 
+  /*!
+   * \brief Returns a strided ArrayView of the view's array data, which
+   *  accounts for the offset, stride and shape of the view.
+   *
+   *  For example, the ArrayView of a view of every other value of a buffer
+   *  of integers can be used in a kernel as follows:
+   *
+   *      auto a = view->getArrayView< int >();
+   *      axom::for_all< ExecSpace >( a.size(), AXOM_LAMBDA( IndexType i )
+   *      { a[ i ] = 0; } );
+   *
+   * \tparam T the type of the data, possibly const.
+   * \tparam DIM the number of dimensions of the view.
+   *
+   * \pre The type of the view corresponds to T.
+   * \pre getNumDimensions() == DIM
+   *
+   * \note The ArrayView is invalidated when the view is reallocated or
+   *  described again.
+   */
+  template <typename T, int DIM = 1>
+  axom::ArrayView<T, DIM, axom::layout::Strided> getArrayView()
+  {
+    using U = typename std::remove_const<T>::type;
+    SLIC_ERROR_IF(getTypeID() != detail::SidreTT<U>::id,
+                  SIDRE_VIEW_LOG_PREPEND
+                    << "View type (" << getTypeID()
+                    << ") differs from the ArrayView type ("
+                    << detail::SidreTT<U>::id << ").");
+    SLIC_ERROR_IF(getNumDimensions() != DIM,
+                  SIDRE_VIEW_LOG_PREPEND
+                    << "View has " << getNumDimensions() << " dimensions, "
+                    << "but the ArrayView has " << DIM << ".");
+
+    // the stride of the view applies to its flattened, row-major values
+    IndexType view_shape[DIM];
+    getShape(DIM, view_shape);
+
+    axom::StackArray<axom::IndexType, DIM> shape;
+    axom::StackArray<axom::IndexType, DIM> strides;
+    for(int d = DIM - 1; d >= 0; --d)
+    {
+      shape[d] = static_cast<axom::IndexType>(view_shape[d]);
+      strides[d] = (d == DIM - 1) ? static_cast<axom::IndexType>(getStride())
+                                  : strides[d + 1] * shape[d + 1];
+    }
+
+    T* data = static_cast<T*>(getVoidPtr());
+    if(data != nullptr)
+    {
+      data += getOffset();
+    }
+
+    return axom::ArrayView<T, DIM, axom::layout::Strided>(data, shape, strides);
+  }
+
   /*!
    * \brief Returns a pointer to the string contained in the view.
    *
@@ -0,0 +1,68 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+// Associated header file
+#include "ViewHandle.hpp"
+
+// Sidre project headers
+#include "Group.hpp"
+#include "View.hpp"
+
+namespace axom
+{
+namespace sidre
+{
+/*
+ *************************************************************************
+ *
+ * Ctor interns path in Group's DataStore.
+ *
+ *************************************************************************
+ */
+ViewHandle::ViewHandle(Group* group, const std::string& path)
+  : m_group(group)
+  , m_datastore(nullptr)
+  , m_path_id(InvalidIndex)
+  , m_view(nullptr)
+  , m_generation(0)
+{
+  SLIC_CHECK_MSG(group != nullptr, "Cannot create ViewHandle for null Group");
+
+  if(group != nullptr)
+  {
+    m_datastore = group->getDataStore();
+    m_path_id = m_datastore->internName(path);
+  }
+}
+
+/*
+ *************************************************************************
+ *
+ * Return handle's path.
+ *
+ *************************************************************************
+ */
+const std::string& ViewHandle::getPath() const
+{
+  return (m_datastore != nullptr) ? m_datastore->getInternedName(m_path_id)
+                                  : InvalidName;
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to resolve handle's path.
+ *
+ *************************************************************************
+ */
+void ViewHandle::resolve()
+{
+  const std::string& path = m_datastore->getInternedName(m_path_id);
+  m_view = m_group->findView(path);
+  m_generation = m_datastore->getHierarchyGeneration();
+}
+
+} /* end namespace sidre */
+} /* end namespace axom */
@@ -0,0 +1,127 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ ******************************************************************************
+ *
+ * \file ViewHandle.hpp
+ *
+ * \brief   Header file containing definition of ViewHandle class.
+ *
+ ******************************************************************************
+ */
+
+#ifndef SIDRE_VIEWHANDLE_HPP_
+#define SIDRE_VIEWHANDLE_HPP_
+
+// Standard C++ headers
+#include <string>
+
+// Other axom headers
+#include "axom/core/Types.hpp"
+
+// Sidre project headers
+#include "DataStore.hpp"
+#include "SidreTypes.hpp"
+
+namespace axom
+{
+namespace sidre
+{
+class Group;
+class View;
+
+/*!
+ * \class ViewHandle
+ *
+ * \brief ViewHandle refers to a View by its path relative to a Group and
+ *        caches the result of resolving the path.
+ *
+ * The path is resolved on first use and again only after the DataStore's
+ * Group hierarchy changes (see DataStore::getHierarchyGeneration()), so
+ * repeated access through a handle costs one integer comparison instead of
+ * a path walk. If no View exists at the path, getView() returns nullptr;
+ * the handle will find a View created at the path later.
+ *
+ * The path is stored as an id in the DataStore's table of interned names,
+ * so handles are cheap to copy. A ViewHandle must not be used after the
+ * Group it was created from is destroyed.
+ *
+ * Example:
+ *
+ *      sidre::ViewHandle density = grp->getViewHandle("fields/density");
+ *      for(...)
+ *      {
+ *        double* data = density.getView()->getData();
+ *        ...
+ *      }
+ */
+class ViewHandle
+{
+public:
+  /*!
+   * \brief Default ctor creates a handle that refers to no View.
+   */
+  ViewHandle()
+    : m_group(nullptr)
+    , m_datastore(nullptr)
+    , m_path_id(InvalidIndex)
+    , m_view(nullptr)
+    , m_generation(0)
+  { }
+
+  /*!
+   * \brief Create a handle to the View at given path relative to group.
+   */
+  ViewHandle(Group* group, const std::string& path);
+
+  /*!
+   * \brief Return pointer to the View the handle refers to, or nullptr
+   *        if there is no View at the handle's path.
+   */
+  View* getView()
+  {
+    if(m_datastore != nullptr &&
+       m_generation != m_datastore->getHierarchyGeneration())
+    {
+      resolve();
+    }
+    return m_view;
+  }
+
+  /*!
+   * \brief Return true if a View exists at the handle's path.
+   */
+  bool isValid() { return getView() != nullptr; }
+
+  /*!
+   * \brief Return the Group the handle's path is relative to.
+   */
+  Group* getGroup() const { return m_group; }
+
+  /*!
+   * \brief Return the handle's path, or sidre::InvalidName if the handle
+   *        was default constructed.
+   */
+  const std::string& getPath() const;
+
+private:
+  /*!
+   * \brief Private method to look up the View at the handle's path and
+   *        record the hierarchy generation it was found in.
+   */
+  void resolve();
+
+  Group* m_group;
+  DataStore* m_datastore;
+  IndexType m_path_id;
+  View* m_view;
+  axom::uint64 m_generation;
+};
+
+} /* end namespace sidre */
+} /* end namespace axom */
+
+#endif /* SIDRE_VIEWHANDLE_HPP_ */
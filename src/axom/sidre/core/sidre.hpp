@@ -23,7 +23,9 @@
 #include "Group.hpp"
 #include "DataStore.hpp"
 #include "View.hpp"
+#include "ViewHandle.hpp"
 #include "Iterator.hpp"
+#include "MemoryArena.hpp"
 #include "SidreTypes.hpp"
 #include "Array.hpp"
 #ifdef AXOM_USE_MPI
@@ -0,0 +1,221 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+// Associated header file
+#include "FileDrainer.hpp"
+
+// Standard C++ headers
+#include <cstdio>
+
+// Other axom headers
+#include "axom/core/utilities/FileUtilities.hpp"
+#include "axom/slic/interface/slic.hpp"
+
+namespace axom
+{
+namespace sidre
+{
+constexpr std::size_t FileDrainer::DEFAULT_BLOCK_BYTES;
+
+/*
+ *************************************************************************
+ *
+ * FileDrainer ctor.
+ *
+ *************************************************************************
+ */
+FileDrainer::FileDrainer(std::size_t block_bytes)
+  : m_block_bytes(block_bytes > 0 ? block_bytes : DEFAULT_BLOCK_BYTES)
+  , m_num_pending(0)
+  , m_stop(false)
+{ }
+
+/*
+ *************************************************************************
+ *
+ * FileDrainer dtor finishes queued moves and joins the drain thread.
+ *
+ *************************************************************************
+ */
+FileDrainer::~FileDrainer()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_work_cv.notify_one();
+
+  if(m_thread.joinable())
+  {
+    m_thread.join();
+  }
+}
+
+/*
+ *************************************************************************
+ *
+ * Queue a file move, starting the drain thread if needed.
+ *
+ *************************************************************************
+ */
+void FileDrainer::enqueue(const std::string& src_path,
+                          const std::string& dst_path)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.emplace_back(src_path, dst_path);
+    ++m_num_pending;
+  }
+
+  if(!m_thread.joinable())
+  {
+    m_thread = std::thread(&FileDrainer::drain, this);
+  }
+  m_work_cv.notify_one();
+}
+
+/*
+ *************************************************************************
+ *
+ * Wait for all queued moves to finish.
+ *
+ *************************************************************************
+ */
+bool FileDrainer::wait()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_done_cv.wait(lock, [this] { return m_num_pending == 0; });
+
+  // Report failures here, since slic is not used from the drain thread
+  for(const std::string& path : m_failed_paths)
+  {
+    SLIC_WARNING("FileDrainer failed to move staged file " << path);
+  }
+
+  const bool success = m_failed_paths.empty();
+  m_failed_paths.clear();
+  return success;
+}
+
+/*
+ *************************************************************************
+ *
+ * Return number of moves queued or in progress.
+ *
+ *************************************************************************
+ */
+int FileDrainer::getNumPending()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_num_pending;
+}
+
+/*
+ *************************************************************************
+ *
+ * Copy a file in large blocks to a temporary name, rename it into place
+ * and remove the source.
+ *
+ *************************************************************************
+ */
+bool FileDrainer::moveFile(const std::string& src_path,
+                           const std::string& dst_path,
+                           std::size_t block_bytes)
+{
+  std::string dir_name;
+  utilities::filesystem::getDirName(dir_name, dst_path);
+  if(!dir_name.empty())
+  {
+    utilities::filesystem::makeDirsForPath(dir_name);
+  }
+
+  std::FILE* src = std::fopen(src_path.c_str(), "rb");
+  if(src == nullptr)
+  {
+    return false;
+  }
+
+  const std::string tmp_path = dst_path + ".drain";
+  std::FILE* dst = std::fopen(tmp_path.c_str(), "wb");
+  if(dst == nullptr)
+  {
+    std::fclose(src);
+    return false;
+  }
+
+  // Blocks are already large, so bypass stdio's own buffering
+  std::setvbuf(src, nullptr, _IONBF, 0);
+  std::setvbuf(dst, nullptr, _IONBF, 0);
+
+  std::vector<char> block(block_bytes);
+  bool success = true;
+  while(success)
+  {
+    const std::size_t num_read = std::fread(block.data(), 1, block_bytes, src);
+    if(num_read > 0 &&
+       std::fwrite(block.data(), 1, num_read, dst) != num_read)
+    {
+      success = false;
+    }
+    if(num_read < block_bytes)
+    {
+      success = success && !std::ferror(src);
+      break;
+    }
+  }
+
+  std::fclose(src);
+  success = (std::fclose(dst) == 0) && success;
+
+  if(success && std::rename(tmp_path.c_str(), dst_path.c_str()) == 0)
+  {
+    std::remove(src_path.c_str());
+    return true;
+  }
+
+  std::remove(tmp_path.c_str());
+  return false;
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method run by the drain thread.
+ *
+ *************************************************************************
+ */
+void FileDrainer::drain()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while(true)
+  {
+    m_work_cv.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+    if(m_queue.empty())
+    {
+      // Only reached when stopping with nothing left to move
+      return;
+    }
+
+    std::pair<std::string, std::string> item = std::move(m_queue.front());
+    m_queue.pop_front();
+
+    lock.unlock();
+    const bool success = moveFile(item.first, item.second, m_block_bytes);
+    lock.lock();
+
+    if(!success)
+    {
+      m_failed_paths.push_back(item.first);
+    }
+    --m_num_pending;
+    if(m_num_pending == 0)
+    {
+      m_done_cv.notify_all();
+    }
+  }
+}
+
+} /* end namespace sidre */
+} /* end namespace axom */
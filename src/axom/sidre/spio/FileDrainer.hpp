@@ -0,0 +1,131 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ ******************************************************************************
+ *
+ * \file FileDrainer.hpp
+ *
+ * \brief   Header file containing definition of FileDrainer class.
+ *
+ ******************************************************************************
+ */
+
+#ifndef SIDRE_FILEDRAINER_HPP_
+#define SIDRE_FILEDRAINER_HPP_
+
+// Standard C++ headers
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Other axom headers
+#include "axom/core/Macros.hpp"
+
+namespace axom
+{
+namespace sidre
+{
+/*!
+ * \class FileDrainer
+ *
+ * \brief FileDrainer moves files from a staging location to their final
+ * location on a background thread.
+ *
+ * IOManager uses a FileDrainer on one rank per node to drain checkpoint
+ * files written to fast node-local storage (see
+ * IOManager::setStagingDirectory()) to the parallel file system while the
+ * application continues.
+ *
+ * Each file is copied with large sequential reads and writes to a
+ * temporary file next to its destination, which is then renamed, so a
+ * partially copied file is never visible at the destination path.  The
+ * staged file is removed after a successful copy.
+ *
+ * The thread is started on the first call to enqueue().  Methods may be
+ * called from a single thread other than the drain thread.
+ */
+class FileDrainer
+{
+public:
+  /// Default size in bytes of each read and write during a copy.
+  static constexpr std::size_t DEFAULT_BLOCK_BYTES = 8 * 1024 * 1024;
+
+  /*!
+   * \brief Constructor
+   *
+   * \param block_bytes  size in bytes of each read and write
+   */
+  explicit FileDrainer(std::size_t block_bytes = DEFAULT_BLOCK_BYTES);
+
+  /*!
+   * \brief Destructor finishes all queued moves and stops the thread.
+   */
+  ~FileDrainer();
+
+  /*!
+   * \brief Queue the file at src_path to be moved to dst_path.
+   *
+   * Directories in dst_path are created as needed.
+   */
+  void enqueue(const std::string& src_path, const std::string& dst_path);
+
+  /*!
+   * \brief Block until every queued move has finished.
+   *
+   * A warning is logged for each move that failed.
+   *
+   * \return false if any move since the previous call to wait() failed.
+   */
+  bool wait();
+
+  /*!
+   * \brief Return number of moves queued or in progress.
+   */
+  int getNumPending();
+
+  /*!
+   * \brief Move the file at src_path to dst_path on the calling thread.
+   *
+   * Errors are not logged, so this may be called from any thread.
+   *
+   * \return true if the file was copied and the source removed.
+   */
+  static bool moveFile(const std::string& src_path,
+                       const std::string& dst_path,
+                       std::size_t block_bytes = DEFAULT_BLOCK_BYTES);
+
+private:
+  DISABLE_COPY_AND_ASSIGNMENT(FileDrainer);
+  DISABLE_MOVE_AND_ASSIGNMENT(FileDrainer);
+
+  /*!
+   * \brief Body of the drain thread.
+   */
+  void drain();
+
+  std::size_t m_block_bytes;
+
+  std::thread m_thread;
+  std::mutex m_mutex;
+  std::condition_variable m_work_cv;
+  std::condition_variable m_done_cv;
+
+  // State below is guarded by m_mutex
+  std::deque<std::pair<std::string, std::string>> m_queue;
+  int m_num_pending;
+  std::vector<std::string> m_failed_paths;
+  bool m_stop;
+};
+
+} /* end namespace sidre */
+} /* end namespace axom */
+
+#endif /* SIDRE_FILEDRAINER_HPP_ */
@@ -6,15 +6,21 @@
 // Associated header file
 #include "IOManager.hpp"
 
+// Standard C++ headers
+#include <limits>
+
 // Other axom headers
 #include "axom/core/Macros.hpp"
+#include "axom/core/utilities/AnnotationMacros.hpp"
 #include "axom/core/utilities/FileUtilities.hpp"
+#include "axom/core/utilities/Utilities.hpp"
 
 // SiDRe project headers
 #include "axom/sidre/core/Buffer.hpp"
 #include "axom/sidre/core/Group.hpp"
 #include "axom/sidre/core/DataStore.hpp"
 #include "axom/sidre/core/SidreTypes.hpp"
+#include "axom/sidre/spio/FileDrainer.hpp"
 #include "fmt/fmt.hpp"
 
 // Conduit headers
@@ -61,6 +67,92 @@ std::string broadcastString(const std::string& str, MPI_Comm comm, int rank)
   return res;
 }
 
+/*!
+ *  Utility function to gather a string from every rank to rank 0.  The
+ *  returned vector is only filled on rank 0.
+ */
+std::vector<std::string> gatherStrings(const std::string& str,
+                                       MPI_Comm comm,
+                                       int rank)
+{
+  int num_ranks = 0;
+  MPI_Comm_size(comm, &num_ranks);
+
+  int size = static_cast<int>(str.size());
+  std::vector<int> sizes(rank == 0 ? num_ranks : 0);
+  MPI_Gather(&size, 1, MPI_INT, sizes.data(), 1, MPI_INT, 0, comm);
+
+  std::vector<int> offsets(sizes.size(), 0);
+  int total = 0;
+  for(std::size_t i = 0; i < sizes.size(); ++i)
+  {
+    offsets[i] = total;
+    total += sizes[i];
+  }
+
+  std::vector<char> buf(total);
+  MPI_Gatherv(str.data(),
+              size,
+              MPI_CHAR,
+              buf.data(),
+              sizes.data(),
+              offsets.data(),
+              MPI_CHAR,
+              0,
+              comm);
+
+  std::vector<std::string> res;
+  for(std::size_t i = 0; i < sizes.size(); ++i)
+  {
+    res.emplace_back(buf.data() + offsets[i], sizes[i]);
+  }
+  return res;
+}
+
+/*!
+ *  Utility function to return the first domain of a Blueprint mesh, or
+ *  nullptr if it has none.  A mesh with coordsets is a single domain,
+ *  otherwise each child is a domain.
+ */
+const conduit::Node* getFirstDomain(const conduit::Node& mesh)
+{
+  if(mesh.has_child("coordsets"))
+  {
+    return &mesh;
+  }
+  return (mesh.number_of_children() > 0) ? &mesh.child(0) : nullptr;
+}
+
+/*!
+ *  Utility function to hash the parts of a Blueprint mesh that determine
+ *  its index: the schema of the mesh (names, types and sizes, but not
+ *  values) and the ids of its domains.
+ */
+axom::uint64 hashMeshStructure(const conduit::Node& mesh,
+                               const std::string& salt)
+{
+  axom::uint64 hash = axom::utilities::fnv1aHash(nullptr, 0);
+  auto hashString = [&hash](const std::string& str) {
+    hash = axom::utilities::fnv1aHash(str.data(), str.size(), hash);
+  };
+
+  hashString(salt);
+  hashString(mesh.schema().to_json());
+
+  const bool single = mesh.has_child("coordsets");
+  const conduit::index_t num_domains = single ? 1 : mesh.number_of_children();
+  for(conduit::index_t d = 0; d < num_domains; ++d)
+  {
+    const conduit::Node& dom = single ? mesh : mesh.child(d);
+    if(dom.has_path("state/domain_id"))
+    {
+      hashString(std::to_string(dom["state/domain_id"].to_int64()));
+    }
+  }
+
+  return hash;
+}
+
 }  // end anonymous namespace
 
 namespace axom
@@ -80,6 +172,13 @@ IOManager::IOManager(MPI_Comm comm, bool use_scr)
   , m_baton(nullptr)
   , m_mpi_comm(comm)
   , m_use_scr(use_scr)
+  , m_node_comm(MPI_COMM_NULL)
+  , m_drainer(nullptr)
+  , m_drain_pending(false)
+  , m_use_checksums(false)
+  , m_cache_bp_index(true)
+  , m_bp_index_cached(false)
+  , m_bp_index_signature(0)
 {
   MPI_Comm_size(comm, &m_comm_size);
   MPI_Comm_rank(comm, &m_my_rank);
@@ -103,6 +202,16 @@ IOManager::IOManager(MPI_Comm comm, bool use_scr)
  */
 IOManager::~IOManager()
 {
+  if(m_drain_pending)
+  {
+    waitForDrain();
+  }
+  delete m_drainer;
+  if(m_node_comm != MPI_COMM_NULL)
+  {
+    MPI_Comm_free(&m_node_comm);
+  }
+
   if(m_baton)
   {
     delete m_baton;
@@ -156,6 +265,67 @@ void IOManager::write(sidre::Group* datagroup,
                       const std::string& protocol,
                       const std::string& tree_pattern)
 {
+  writeGroup(datagroup, num_files, file_string, protocol, tree_pattern, false);
+}
+
+/*
+ *************************************************************************
+ *
+ * Write to file, storing only Buffers changed since the last call.
+ *
+ *************************************************************************
+ */
+void IOManager::writeIncremental(sidre::Group* datagroup,
+                                 int num_files,
+                                 const std::string& file_string,
+                                 const std::string& protocol,
+                                 const std::string& tree_pattern)
+{
+  const bool is_sidre_protocol = protocol == "sidre_hdf5" ||
+    protocol == "sidre_conduit_json" || protocol == "sidre_json";
+
+  SLIC_WARNING_IF(!is_sidre_protocol,
+                  "IOManager::writeIncremental() -- '"
+                    << protocol << "' protocol does not support incremental "
+                    << "checkpoints. Writing all data.");
+  SLIC_ERROR_IF(m_use_scr,
+                "IOManager::writeIncremental() is not supported with SCR");
+
+  writeGroup(datagroup,
+             num_files,
+             file_string,
+             protocol,
+             tree_pattern,
+             is_sidre_protocol);
+}
+
+/*
+ *************************************************************************
+ *
+ * Forget previous incremental checkpoint.
+ *
+ *************************************************************************
+ */
+void IOManager::resetIncremental() { m_prev_buffers.clear(); }
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to write group to files, optionally incrementally.
+ *
+ *************************************************************************
+ */
+void IOManager::writeGroup(sidre::Group* datagroup,
+                           int num_files,
+                           const std::string& file_string,
+                           const std::string& protocol,
+                           const std::string& tree_pattern,
+                           bool incremental)
+{
+  AXOM_PERF_MARK_FUNCTION("IOManager::write");
+
+  waitForDrain();
+
   if(m_baton)
   {
     if(m_baton->getNumFiles() != num_files)
@@ -172,6 +342,8 @@ void IOManager::write(sidre::Group* datagroup,
 
   SLIC_ERROR_IF(m_use_scr && num_files != m_comm_size,
                 "SCR requires a file per process");
+  SLIC_ERROR_IF(!m_staging_dir.empty() && num_files != m_comm_size,
+                "Staging output files requires a file per process");
 
   std::string root_string = file_string;
   createRootFile(root_string, num_files, protocol, tree_pattern);
@@ -190,6 +362,14 @@ void IOManager::write(sidre::Group* datagroup,
 
     hdf5_name = getSCRPath(hdf5_name);
 
+    // When staging, the file is written locally and drained to hdf5_name
+    std::string out_name = hdf5_name;
+    if(!m_staging_dir.empty())
+    {
+      out_name = getStagedPath(hdf5_name);
+      m_staged_files.emplace_back(out_name, hdf5_name);
+    }
+
     hid_t h5_file_id, h5_group_id;
     if(m_baton->isFirstInGroup())
     {
@@ -197,17 +377,17 @@ void IOManager::write(sidre::Group* datagroup,
       if(!m_use_scr)
       {
         std::string dir_name;
-        utilities::filesystem::getDirName(dir_name, hdf5_name);
+        utilities::filesystem::getDirName(dir_name, out_name);
         if(!dir_name.empty())
         {
           utilities::filesystem::makeDirsForPath(dir_name);
         }
       }
-      h5_file_id = conduit::relay::io::hdf5_create_file(hdf5_name);
+      h5_file_id = conduit::relay::io::hdf5_create_file(out_name);
     }
     else
     {
-      h5_file_id = conduit::relay::io::hdf5_open_file_for_read_write(hdf5_name);
+      h5_file_id = conduit::relay::io::hdf5_open_file_for_read_write(out_name);
     }
     SLIC_ASSERT(h5_file_id >= 0);
 
@@ -223,7 +403,16 @@ void IOManager::write(sidre::Group* datagroup,
                             H5P_DEFAULT);
     SLIC_ASSERT(h5_group_id >= 0);
 
-    datagroup->save(h5_group_id);
+    if(incremental)
+    {
+      conduit::Node n;
+      exportIncremental(datagroup, hdf5_name, group_name, "hdf5", n);
+      conduit::relay::io::hdf5_write(n, h5_group_id);
+    }
+    else
+    {
+      datagroup->save(h5_group_id);
+    }
     herr_t status;
     AXOM_UNUSED_VAR(status);
 
@@ -244,13 +433,136 @@ void IOManager::write(sidre::Group* datagroup,
     std::string file_name = fmt::sprintf("%s_%07d", file_string, set_id);
 
     std::string obase = file_name + "." + protocol;
-    datagroup->save(obase, protocol);
+
+    // When staging, the file is written locally and drained to obase
+    std::string out_name = obase;
+    if(!m_staging_dir.empty())
+    {
+      out_name = getStagedPath(obase);
+      m_staged_files.emplace_back(out_name, obase);
+
+      std::string dir_name;
+      utilities::filesystem::getDirName(dir_name, out_name);
+      if(!dir_name.empty())
+      {
+        utilities::filesystem::makeDirsForPath(dir_name);
+      }
+    }
+
+    if(incremental)
+    {
+      std::string relay_protocol = correspondingRelayProtocol(protocol);
+      conduit::Node n;
+      exportIncremental(datagroup, obase, "", relay_protocol, n);
+      conduit::relay::io::save(n, out_name, relay_protocol);
+    }
+    else
+    {
+      datagroup->save(out_name, protocol);
+    }
   }
   (void)m_baton->pass();
 
+  if(incremental)
+  {
+    finishIncremental(datagroup);
+  }
+
+  if(!m_staging_dir.empty())
+  {
+    startDrain();
+  }
+
   MPI_Barrier(m_mpi_comm);
 }
 
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to export group, referencing unchanged Buffers.
+ *
+ *************************************************************************
+ */
+void IOManager::exportIncremental(sidre::Group* group,
+                                  const std::string& file_name,
+                                  const std::string& path_in_file,
+                                  const std::string& relay_protocol,
+                                  conduit::Node& n)
+{
+  DataStore* ds = group->getDataStore();
+
+  group->exportTo(n["sidre"], nullptr);
+  if(relay_protocol != "hdf5")
+  {
+    ds->saveAttributeLayout(n["sidre/attribute"]);
+  }
+  group->createExternalLayout(n["sidre/external"]);
+  n["sidre_group_name"] = group->getName();
+
+  const std::string prefix = path_in_file.empty() ? "" : path_in_file + "/";
+
+  m_curr_buffers.clear();
+
+  if(!n.has_path("sidre/buffers"))
+  {
+    return;
+  }
+
+  conduit::NodeIterator buffs_itr = n["sidre/buffers"].children();
+  while(buffs_itr.has_next())
+  {
+    conduit::Node& n_buffer = buffs_itr.next();
+    IndexType buffer_id = n_buffer["id"].to_int64();
+    Buffer* buffer = ds->getBuffer(buffer_id);
+
+    if(m_use_checksums)
+    {
+      buffer->detectChanges();
+    }
+
+    BufferLocation& location = m_curr_buffers[buffer_id];
+
+    const auto prev = m_prev_buffers.find(buffer_id);
+    if(prev != m_prev_buffers.end() && !buffer->isDirty() &&
+       n_buffer.has_child("data"))
+    {
+      // Data is unchanged; point to the checkpoint that last wrote it
+      n_buffer.remove("data");
+      location = prev->second;
+
+      conduit::Node& ref = n_buffer["reference"];
+      ref["file"] = location.file;
+      ref["path"] = location.path;
+      ref["protocol"] = location.protocol;
+    }
+    else
+    {
+      location.file = file_name;
+      location.path = prefix + "sidre/buffers/" + buffs_itr.name();
+      location.protocol = relay_protocol;
+    }
+  }
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to complete an incremental checkpoint.
+ *
+ *************************************************************************
+ */
+void IOManager::finishIncremental(sidre::Group* group)
+{
+  DataStore* ds = group->getDataStore();
+  for(const auto& entry : m_curr_buffers)
+  {
+    ds->getBuffer(entry.first)->markClean();
+  }
+
+  m_prev_buffers.swap(m_curr_buffers);
+  m_curr_buffers.clear();
+}
+
 /*
  *************************************************************************
  *
@@ -263,6 +575,7 @@ void IOManager::read(sidre::Group* datagroup,
                      const std::string& protocol,
                      bool preserve_contents)
 {
+  waitForDrain();
   MPI_Barrier(m_mpi_comm);
 
   if(protocol == "sidre_hdf5")
@@ -313,6 +626,7 @@ void IOManager::read(sidre::Group* datagroup,
                      const std::string& root_file,
                      bool preserve_contents)
 {
+  waitForDrain();
   MPI_Barrier(m_mpi_comm);
   std::string protocol = getProtocol(root_file);
   read(datagroup, root_file, protocol, preserve_contents);
@@ -350,9 +664,167 @@ std::string IOManager::getSCRPath(const std::string& path)
 #endif
 }
 
+/*
+ *************************************************************************
+ *
+ * Set node-local directory for staging output files.
+ *
+ *************************************************************************
+ */
+void IOManager::setStagingDirectory(const std::string& local_dir)
+{
+  waitForDrain();
+
+  SLIC_ERROR_IF(m_use_scr && !local_dir.empty(),
+                "IOManager cannot stage output files when using SCR");
+
+  m_staging_dir = local_dir;
+
+  if(!m_staging_dir.empty() && m_node_comm == MPI_COMM_NULL)
+  {
+    // The lowest rank on each node drains the files of the whole node
+    MPI_Comm_split_type(m_mpi_comm,
+                        MPI_COMM_TYPE_SHARED,
+                        m_my_rank,
+                        MPI_INFO_NULL,
+                        &m_node_comm);
+
+    int node_rank = 0;
+    MPI_Comm_rank(m_node_comm, &node_rank);
+    if(node_rank == 0)
+    {
+      m_drainer = new FileDrainer();
+    }
+  }
+}
+
+/*
+ *************************************************************************
+ *
+ * Wait for staged files to drain, then move the root file.
+ *
+ *************************************************************************
+ */
+bool IOManager::waitForDrain()
+{
+  if(!m_drain_pending)
+  {
+    return true;
+  }
+
+  int failed = 0;
+  if(m_drainer != nullptr && !m_drainer->wait())
+  {
+    failed = 1;
+  }
+  MPI_Allreduce(MPI_IN_PLACE, &failed, 1, MPI_INT, MPI_MAX, m_mpi_comm);
+
+  // All data files are at their final paths, so the root file may follow
+  if(m_my_rank == 0 && !m_staged_root.empty())
+  {
+    if(failed)
+    {
+      SLIC_WARNING("IOManager -- not all staged files were drained. Root file '"
+                   << m_final_root << "' was left at '" << m_staged_root
+                   << "'.");
+    }
+    else if(!FileDrainer::moveFile(m_staged_root, m_final_root))
+    {
+      SLIC_WARNING("IOManager -- failed to move staged root file '"
+                   << m_staged_root << "' to '" << m_final_root << "'.");
+      failed = 1;
+    }
+  }
+  MPI_Bcast(&failed, 1, MPI_INT, 0, m_mpi_comm);
+
+  m_staged_root.clear();
+  m_final_root.clear();
+  m_drain_pending = false;
+
+  return failed == 0;
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to get path of a file in the staging directory.
+ *
+ *************************************************************************
+ */
+std::string IOManager::getStagedPath(const std::string& path) const
+{
+  const std::string::size_type start = path.find_first_not_of('/');
+  const std::string rel_path =
+    (start == std::string::npos) ? std::string() : path.substr(start);
+
+  return utilities::filesystem::joinPath(m_staging_dir, rel_path);
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to get current location of a root file.
+ *
+ *************************************************************************
+ */
+std::string IOManager::getRootFilePath(const std::string& root_name)
+{
+  if(!m_staged_root.empty() && root_name == m_final_root)
+  {
+    return m_staged_root;
+  }
+  return getSCRPath(root_name);
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to queue this write's staged files on the node's
+ * drain thread.
+ *
+ *************************************************************************
+ */
+void IOManager::startDrain()
+{
+  // Pack (staged, final) path pairs as newline-terminated strings
+  std::string files;
+  for(const auto& file : m_staged_files)
+  {
+    files += file.first + '\n' + file.second + '\n';
+  }
+  m_staged_files.clear();
+
+  int node_rank = 0;
+  MPI_Comm_rank(m_node_comm, &node_rank);
+  std::vector<std::string> node_files =
+    gatherStrings(files, m_node_comm, node_rank);
+
+  if(m_drainer != nullptr)
+  {
+    for(const std::string& rank_files : node_files)
+    {
+      std::string::size_type pos = 0;
+      while(pos < rank_files.size())
+      {
+        const std::string::size_type src_end = rank_files.find('\n', pos);
+        const std::string::size_type dst_end =
+          rank_files.find('\n', src_end + 1);
+        m_drainer->enqueue(rank_files.substr(pos, src_end - pos),
+                           rank_files.substr(src_end + 1,
+                                             dst_end - src_end - 1));
+        pos = dst_end + 1;
+      }
+    }
+  }
+
+  m_drain_pending = true;
+}
+
 void IOManager::loadExternalData(sidre::Group* datagroup,
                                  const std::string& root_file)
 {
+  waitForDrain();
+
   int num_files = getNumFilesFromRoot(root_file);
   int num_groups = getNumGroupsFromRoot(root_file);
   SLIC_ASSERT(num_files > 0);
@@ -521,6 +993,20 @@ void IOManager::createRootFile(const std::string& file_base,
 
     root_file_name = getSCRPath(root_file_name);
 
+    if(!m_staging_dir.empty())
+    {
+      m_final_root = root_file_name;
+      m_staged_root = getStagedPath(root_file_name);
+      root_file_name = m_staged_root;
+
+      std::string dir_name;
+      utilities::filesystem::getDirName(dir_name, root_file_name);
+      if(!dir_name.empty())
+      {
+        utilities::filesystem::makeDirsForPath(dir_name);
+      }
+    }
+
     conduit::relay::io::save(n, root_file_name, relay_protocol);
   }
 }
@@ -538,7 +1024,7 @@ std::string IOManager::getProtocol(const std::string& root_orig)
 
   if(m_my_rank == 0)
   {
-    std::string root_name = getSCRPath(root_orig);
+    std::string root_name = getRootFilePath(root_orig);
 
     std::string extension;
     std::string base;
@@ -624,7 +1110,7 @@ std::string IOManager::getFilePatternFromRoot(const std::string& root_name,
   std::string file_pattern;
   if(m_my_rank == 0)
   {
-    std::string root_path = getSCRPath(root_name);
+    std::string root_path = getRootFilePath(root_name);
 
     conduit::Node n;
     std::string relay_protocol = correspondingRelayProtocol(protocol);
@@ -651,7 +1137,7 @@ std::string IOManager::getHDF5FilePattern(const std::string& root_name)
   std::string file_pattern;
   if(m_my_rank == 0)
   {
-    std::string root_path = getSCRPath(root_name);
+    std::string root_path = getRootFilePath(root_name);
 
     conduit::Node n;
     conduit::relay::io::load(root_path + ":file_pattern", "hdf5", n);
@@ -848,7 +1334,7 @@ int IOManager::getNumFilesFromRoot(const std::string& root_file)
   int read_num_files = 0;
   if(m_my_rank == 0)
   {
-    std::string root_path = getSCRPath(root_file);
+    std::string root_path = getRootFilePath(root_file);
 
     conduit::Node n;
     conduit::relay::io::load(root_path + ":number_of_files", "hdf5", n);
@@ -874,7 +1360,7 @@ int IOManager::getNumGroupsFromRoot(const std::string& root_file)
   int read_num_trees = 0;
   if(m_my_rank == 0)
   {
-    std::string root_path = getSCRPath(root_file);
+    std::string root_path = getRootFilePath(root_file);
 
     conduit::Node n;
     conduit::relay::io::load(root_path + ":number_of_trees", "hdf5", n);
@@ -904,7 +1390,7 @@ void IOManager::writeGroupToRootFile(sidre::Group* group,
                                      const std::string& file_name)
 {
 #ifdef AXOM_USE_HDF5
-  std::string tmp_name = getSCRPath(file_name);
+  std::string tmp_name = getRootFilePath(file_name);
 
   hid_t root_file_id =
     conduit::relay::io::hdf5_open_file_for_read_write(tmp_name);
@@ -958,7 +1444,7 @@ void IOManager::writeGroupToRootFileAtPath(sidre::Group* group,
                                            const std::string& group_path)
 {
 #ifdef AXOM_USE_HDF5
-  std::string tmp_name = getSCRPath(file_name);
+  std::string tmp_name = getRootFilePath(file_name);
 
   hid_t root_file_id =
     conduit::relay::io::hdf5_open_file_for_read_write(tmp_name);
@@ -1017,7 +1503,7 @@ void IOManager::writeViewToRootFileAtPath(sidre::View* view,
                                           const std::string& group_path)
 {
 #ifdef AXOM_USE_HDF5
-  std::string tmp_name = getSCRPath(file_name);
+  std::string tmp_name = getRootFilePath(file_name);
 
   hid_t root_file_id =
     conduit::relay::io::hdf5_open_file_for_read_write(tmp_name);
@@ -1058,7 +1544,7 @@ void IOManager::writeBlueprintIndexToRootFile(DataStore* datastore,
                                               const std::string& mesh_path)
 {
 #ifdef AXOM_USE_HDF5
-  std::string tmp_name = getSCRPath(file_name);
+  std::string tmp_name = getRootFilePath(file_name);
 
   hid_t root_file_id =
     conduit::relay::io::hdf5_open_file_for_read_write(tmp_name);
@@ -1107,10 +1593,8 @@ void IOManager::writeBlueprintIndexToRootFile(DataStore* datastore,
 
   if(multi_domain)
   {
-    success = datastore->generateBlueprintIndex(MPI_COMM_WORLD,
-                                                domain_path,
-                                                mesh_path,
-                                                bp_index);
+    success =
+      generateBlueprintIndex(datastore, domain_path, mesh_path, bp_index);
   }
   else
   {
@@ -1199,5 +1683,95 @@ void IOManager::writeBlueprintIndexToRootFile(DataStore* datastore,
 #endif /* AXOM_USE_HDF5 */
 }
 
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to generate or restore cached Blueprint index.
+ *
+ *************************************************************************
+ */
+bool IOManager::generateBlueprintIndex(DataStore* datastore,
+                                       const std::string& domain_path,
+                                       const std::string& mesh_path,
+                                       const std::string& bp_index)
+{
+  Group* root = datastore->getRoot();
+  Group* domain = nullptr;
+  if(domain_path == "/")
+  {
+    domain = root;
+  }
+  else if(root->hasGroup(domain_path))
+  {
+    domain = root->getGroup(domain_path);
+  }
+
+  conduit::Node mesh_node;
+  if(domain)
+  {
+    domain->createNativeLayout(mesh_node);
+  }
+
+  const std::string salt = domain_path + ":" + mesh_path + ":" + bp_index;
+  const axom::uint64 signature = hashMeshStructure(mesh_node, salt);
+
+  int changed = (!m_cache_bp_index || !m_bp_index_cached ||
+                 signature != m_bp_index_signature)
+    ? 1
+    : 0;
+  MPI_Allreduce(MPI_IN_PLACE, &changed, 1, MPI_INT, MPI_MAX, m_mpi_comm);
+
+  if(changed)
+  {
+    m_bp_index_cached = false;
+    bool success = datastore->generateBlueprintIndex(m_mpi_comm,
+                                                     domain_path,
+                                                     mesh_path,
+                                                     bp_index);
+    if(success && m_cache_bp_index)
+    {
+      conduit::Node layout;
+      root->getGroup(bp_index)->createNativeLayout(layout);
+      m_bp_index_cache.reset();
+      m_bp_index_cache.set(layout);
+      m_bp_index_signature = signature;
+      m_bp_index_cached = true;
+    }
+    return success;
+  }
+
+  // Structure is unchanged, so only the cycle and time of the index differ
+  Group* index_group = root->hasGroup(bp_index) ? root->getGroup(bp_index)
+                                                : root->createGroup(bp_index);
+  index_group->importConduitTree(m_bp_index_cache);
+
+  double state[2] = {std::numeric_limits<double>::lowest(),
+                     std::numeric_limits<double>::lowest()};
+  const conduit::Node* first = getFirstDomain(mesh_node);
+  if(first != nullptr && first->has_path("state/cycle"))
+  {
+    state[0] = (*first)["state/cycle"].to_float64();
+  }
+  if(first != nullptr && first->has_path("state/time"))
+  {
+    state[1] = (*first)["state/time"].to_float64();
+  }
+  MPI_Allreduce(MPI_IN_PLACE, state, 2, MPI_DOUBLE, MPI_MAX, m_mpi_comm);
+
+  if(index_group->hasView("state/cycle") &&
+     state[0] > std::numeric_limits<double>::lowest())
+  {
+    index_group->getView("state/cycle")
+      ->setScalar(static_cast<conduit::int64>(state[0]));
+  }
+  if(index_group->hasView("state/time") &&
+     state[1] > std::numeric_limits<double>::lowest())
+  {
+    index_group->getView("state/time")->setScalar(state[1]);
+  }
+
+  return true;
+}
+
 } /* end namespace sidre */
 } /* end namespace axom */
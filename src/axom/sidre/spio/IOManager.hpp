@@ -16,6 +16,12 @@
 #ifndef SIDRE_IOMANAGER_HPP_
 #define SIDRE_IOMANAGER_HPP_
 
+// Standard C++ headers
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
 // Other axom headers
 #include "axom/config.hpp"
 #include "axom/core/Macros.hpp"
@@ -31,6 +37,8 @@ namespace axom
 {
 namespace sidre
 {
+class FileDrainer;
+
 /*!
  * \class IOManager
  *
@@ -56,6 +64,9 @@ public:
 
   /*!
    * \brief Destructor
+   *
+   * If a staged write is still draining, this completes it with
+   * waitForDrain(), making the destructor an MPI collective call.
    */
   ~IOManager();
 
@@ -95,6 +106,122 @@ public:
              const std::string& protocol,
              const std::string& tree_pattern = "datagroup");
 
+  /*!
+   * \brief write a Group to output files as an incremental checkpoint
+   *
+   * Behaves like write(), except that Buffers that have not been modified
+   * since the previous call to writeIncremental() on this IOManager are not
+   * written again.  Instead, the output holds a reference to the location
+   * of the Buffer's data in the files of the checkpoint that last wrote it.
+   * read() follows these references, so restarting from the last
+   * checkpoint in a chain reassembles the full state.  All files in the
+   * chain must remain available at their original paths.
+   *
+   * A Buffer is considered modified if it is dirty (see Buffer::isDirty()).
+   * Buffer methods that change data mark the Buffer dirty automatically;
+   * code that writes through raw data pointers must call
+   * View::markDirty() or Buffer::markDirty(), or enable checksum-based
+   * change detection with setIncrementalChecksums().
+   *
+   * The first call, and the first call after resetIncremental(), writes
+   * all Buffers.
+   *
+   * This is an MPI collective call.
+   *
+   * valid protocols:
+   *
+   *    sidre_hdf5
+   *    sidre_conduit_json
+   *    sidre_json
+   *
+   * Other protocols do not store Buffers separately and are written in
+   * full, as with write().
+   *
+   * \param group         Group to write to output
+   * \param num_files     number of output data files
+   * \param file_string   base name for output files
+   * \param protocol      identifies I/O protocol
+   * \param tree_pattern  Optional tree pattern string placed in root file,
+   *                      to set search path for data in the output files
+   */
+  void writeIncremental(sidre::Group* group,
+                        int num_files,
+                        const std::string& file_string,
+                        const std::string& protocol,
+                        const std::string& tree_pattern = "datagroup");
+
+  /*!
+   * \brief Start a new chain of incremental checkpoints
+   *
+   * The next call to writeIncremental() will write all Buffers.
+   */
+  void resetIncremental();
+
+  /*!
+   * \brief Use data checksums to detect modified Buffers
+   *
+   * When enabled, writeIncremental() compares a checksum of each Buffer's
+   * data against the checksum computed at the previous checkpoint (see
+   * Buffer::detectChanges()), so that changes made through raw pointers are
+   * found without explicit calls to markDirty().  This costs a pass over
+   * every Buffer's data at each checkpoint.  Disabled by default.
+   */
+  void setIncrementalChecksums(bool use_checksums)
+  {
+    m_use_checksums = use_checksums;
+  }
+
+  /*!
+   * \brief Stage output files in a node-local directory
+   *
+   * When a staging directory is set, write() and writeIncremental() write
+   * each rank's files below local_dir (for example "/dev/shm/ckpt" or a
+   * node-local NVMe mount) instead of at their final paths, and return
+   * as soon as the local writes are done.  One rank on each node then
+   * moves the node's files to their final paths on a background thread.
+   * The final path of a file is appended to local_dir to get its staged
+   * path.
+   *
+   * The root file is staged on rank 0 and is only moved to its final path
+   * after every rank's files have been drained, so a root file at the
+   * final path always refers to complete data.  Until then, root file
+   * methods such as writeGroupToRootFile() called on rank 0 with the
+   * final root file name update the staged root file.
+   *
+   * Staging requires a file per process and cannot be combined with SCR.
+   * An empty local_dir disables staging.
+   *
+   * This is an MPI collective call.  Any pending drain is completed first.
+   *
+   * \param local_dir  directory on node-local storage
+   */
+  void setStagingDirectory(const std::string& local_dir);
+
+  /*!
+   * \brief Return the staging directory, or an empty string if staging is
+   * disabled.
+   */
+  const std::string& getStagingDirectory() const { return m_staging_dir; }
+
+  /*!
+   * \brief Block until the files of the last staged write have been moved
+   * to their final paths, then move the root file.
+   *
+   * This is called by write(), writeIncremental() and read() before they
+   * begin, and by the destructor.  It is a no-op when no drain is pending.
+   *
+   * This is an MPI collective call.
+   *
+   * \return true if every file was moved successfully.
+   */
+  bool waitForDrain();
+
+  /*!
+   * \brief Return true if a staged write has not yet been completed with
+   * waitForDrain().
+   */
+  bool hasPendingDrain() const { return m_drain_pending; }
+
   /*!
    * \brief write additional group to existing root file
    *
@@ -209,8 +336,15 @@ public:
    * domain_path.  For the mesh_path argument, we choose only the path that
    * exists in the file:  "domain/blueprint_mesh".
    *
-   * This is not an MPI collective call.  One rank writes a blueprint index
-   * to one root file.
+   * For a multi-domain mesh this is an MPI collective call.  The index is
+   * merged over the ranks with a tree reduction and rank 0 writes it to the
+   * root file.
+   *
+   * The generated index is cached by the IOManager.  When the structure of
+   * the mesh (its hierarchy, types and sizes, and its domain ids) is
+   * unchanged on every rank since the previous call, the cached index is
+   * reused with only its cycle and time updated.  See
+   * setBlueprintIndexCaching().
    *
    * \param datastore     DataStore containing Groups that hold domains
    *                      that adhere to the Blueprint format
@@ -225,6 +359,22 @@ public:
                                      const std::string& file_name,
                                      const std::string& mesh_path);
 
+  /*!
+   * \brief Enable or disable reuse of the Blueprint index generated by
+   * writeBlueprintIndexToRootFile() across checkpoints.
+   *
+   * Disabling caching also discards the cached index.  Enabled by default.
+   */
+  void setBlueprintIndexCaching(bool use_cache)
+  {
+    m_cache_bp_index = use_cache;
+    if(!use_cache)
+    {
+      m_bp_index_cached = false;
+      m_bp_index_cache.reset();
+    }
+  }
+
   /*!
    * \brief read from input file
    *
@@ -286,6 +436,53 @@ public:
 private:
   DISABLE_COPY_AND_ASSIGNMENT(IOManager);
 
+  /*!
+   * \brief The file, path within the file and relay protocol of the
+   * checkpoint that holds a Buffer's data.
+   */
+  struct BufferLocation
+  {
+    std::string file;
+    std::string path;
+    std::string protocol;
+  };
+
+  /*!
+   * \brief Shared implementation of write() and writeIncremental()
+   */
+  void writeGroup(sidre::Group* group,
+                  int num_files,
+                  const std::string& file_string,
+                  const std::string& protocol,
+                  const std::string& tree_pattern,
+                  bool incremental);
+
+  /*!
+   * \brief Fill a Conduit node with the sidre layout of a group for an
+   * incremental checkpoint.
+   *
+   * Buffers that are unchanged since the previous incremental checkpoint
+   * are replaced by references to the checkpoint that last wrote their
+   * data, so that a reference never points to another reference.
+   *
+   * \param group          Group being written
+   * \param file_name      name of the file the node will be written to
+   * \param path_in_file   path to the node within that file
+   * \param relay_protocol conduit relay protocol used to write the file
+   * \param n              node to fill
+   */
+  void exportIncremental(sidre::Group* group,
+                         const std::string& file_name,
+                         const std::string& path_in_file,
+                         const std::string& relay_protocol,
+                         conduit::Node& n);
+
+  /*!
+   * \brief Mark the Buffers written by exportIncremental() as clean and
+   * record the location of their data for the next checkpoint.
+   */
+  void finishIncremental(sidre::Group* group);
+
   void createRootFile(const std::string& file_base,
                       int num_files,
                       const std::string& protocol,
@@ -332,6 +529,17 @@ private:
    */
   void getRankToFileMap(View* rank_to_file_map, int num_files);
 
+  /*!
+   * \brief Generate the Blueprint index of a multi-domain mesh, or restore
+   * the cached index if the mesh structure is unchanged on all ranks.
+   *
+   * This is an MPI collective call.
+   */
+  bool generateBlueprintIndex(DataStore* datastore,
+                              const std::string& domain_path,
+                              const std::string& mesh_path,
+                              const std::string& bp_index);
+
   /*!
    * \brief If needed, get a file path created by SCR.
    *
@@ -351,6 +559,28 @@ private:
    */
   std::string getSCRPath(const std::string& path);
 
+  /*!
+   * \brief Return the path below the staging directory at which the file
+   * with final path \a path is staged.
+   */
+  std::string getStagedPath(const std::string& path) const;
+
+  /*!
+   * \brief Return the path at which a root file is currently stored.
+   *
+   * This is the staged root file while its drain is pending, otherwise the
+   * result of getSCRPath().
+   */
+  std::string getRootFilePath(const std::string& root_name);
+
+  /*!
+   * \brief Hand the files staged by this rank in the current write to the
+   * drain thread on this rank's node.
+   *
+   * This is an MPI collective call.
+   */
+  void startDrain();
+
   int m_comm_size;  // num procs in the MPI communicator
   int m_my_rank;    // rank of this proc
 
@@ -359,6 +589,28 @@ private:
   MPI_Comm m_mpi_comm;
 
   bool m_use_scr;
+
+  // Node-local staging of output files
+  std::string m_staging_dir;
+  MPI_Comm m_node_comm;
+  FileDrainer* m_drainer;
+  bool m_drain_pending;
+  std::vector<std::pair<std::string, std::string>> m_staged_files;
+  std::string m_staged_root;
+  std::string m_final_root;
+
+  // Location of the data of each Buffer written by this rank's incremental
+  // checkpoints: the Buffers of the previous checkpoint and of the one
+  // being written
+  bool m_use_checksums;
+  std::map<IndexType, BufferLocation> m_prev_buffers;
+  std::map<IndexType, BufferLocation> m_curr_buffers;
+
+  // Blueprint index cached by writeBlueprintIndexToRootFile()
+  bool m_cache_bp_index;
+  bool m_bp_index_cached;
+  axom::uint64 m_bp_index_signature;
+  conduit::Node m_bp_index_cache;
 };
 
 } /* end namespace sidre */
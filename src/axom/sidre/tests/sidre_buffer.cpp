@@ -356,6 +356,68 @@ TEST(sidre_buffer, destroy_all_buffers)
   delete ds;
 }
 
+//------------------------------------------------------------------------------
+TEST(sidre_buffer, dirty_tracking)
+{
+  DataStore* ds = new DataStore();
+
+  // New Buffers are dirty until marked clean
+  Buffer* dbuff = ds->createBuffer(INT_ID, 10)->allocate();
+  EXPECT_TRUE(dbuff->isDirty());
+
+  dbuff->markClean();
+  EXPECT_FALSE(dbuff->isDirty());
+
+  // Modifying the Buffer through its interface marks it dirty
+  int vals[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  axom::uint64 gen = dbuff->getGeneration();
+  dbuff->copyBytesIntoBuffer(vals, sizeof(vals));
+  EXPECT_TRUE(dbuff->isDirty());
+  EXPECT_GT(dbuff->getGeneration(), gen);
+
+  dbuff->markClean();
+  dbuff->reallocate(20);
+  EXPECT_TRUE(dbuff->isDirty());
+
+  // Writes through a View's data pointer must be marked explicitly
+  View* view = ds->getRoot()->createView("v", INT_ID, 20, dbuff);
+  dbuff->markClean();
+  int* data = view->getData();
+  data[0] = 42;
+  EXPECT_FALSE(view->isDirty());
+  view->markDirty();
+  EXPECT_TRUE(view->isDirty());
+  EXPECT_TRUE(dbuff->isDirty());
+
+  delete ds;
+}
+
+//------------------------------------------------------------------------------
+TEST(sidre_buffer, detect_changes)
+{
+  DataStore* ds = new DataStore();
+
+  Buffer* dbuff = ds->createBuffer(INT_ID, 10)->allocate();
+  int* data = dbuff->getData();
+  for(int i = 0; i < 10; ++i)
+  {
+    data[i] = i;
+  }
+
+  EXPECT_TRUE(dbuff->detectChanges());
+  dbuff->markClean();
+
+  // Unchanged data is not reported as dirty
+  EXPECT_FALSE(dbuff->detectChanges());
+  EXPECT_EQ(dbuff->computeChecksum(), dbuff->computeChecksum());
+
+  // Changes through raw pointers are found by the checksum
+  data[5] = -5;
+  EXPECT_TRUE(dbuff->detectChanges());
+
+  delete ds;
+}
+
 #ifdef AXOM_USE_UMPIRE
 
 class UmpireTest : public ::testing::TestWithParam<int>
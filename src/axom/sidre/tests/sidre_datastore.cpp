@@ -39,3 +39,127 @@ TEST(sidre_datastore, destroy_buffer)
 
   delete ds;
 }
+
+//------------------------------------------------------------------------------
+
+TEST(sidre_datastore, memory_arena)
+{
+  using axom::sidre::Group;
+  using axom::sidre::INT_ID;
+  using axom::sidre::MemoryArena;
+  using axom::sidre::View;
+
+  DataStore plain;
+  EXPECT_FALSE(plain.usesArena());
+  EXPECT_TRUE(plain.getMemoryArena() == nullptr);
+
+  DataStore ds(true);
+  EXPECT_TRUE(ds.usesArena());
+  const MemoryArena* arena = ds.getMemoryArena();
+  ASSERT_TRUE(arena != nullptr);
+
+  // root Group and its two item collections
+  const IndexType num_root_allocs = arena->getNumAllocations();
+  EXPECT_EQ(num_root_allocs, 3);
+
+  Group* root = ds.getRoot();
+  Group* grp = root->createGroup("grp");
+  View* scalar = grp->createViewScalar("scalar", 42);
+  View* small = grp->createViewAndAllocate("small", INT_ID, 10);
+  const IndexType num_big = MemoryArena::MAX_BYTES / sizeof(int) + 1;
+  View* big = grp->createViewAndAllocate("big", INT_ID, num_big);
+
+  // Group + 2 collections, 3 Views, 2 Buffers and the small Buffer's data
+  EXPECT_EQ(arena->getNumAllocations(), num_root_allocs + 9);
+  EXPECT_EQ(scalar->getData<int>(), 42);
+
+  int* small_data = small->getData();
+  int* big_data = big->getData();
+  for(int i = 0; i < 10; ++i)
+  {
+    small_data[i] = i;
+  }
+  big_data[num_big - 1] = 7;
+
+  // growing moves data out of the arena and keeps its values
+  small->reallocate(num_big);
+  EXPECT_EQ(arena->getNumAllocations(), num_root_allocs + 8);
+  small_data = small->getData();
+  for(int i = 0; i < 10; ++i)
+  {
+    EXPECT_EQ(small_data[i], i);
+  }
+
+  // a new small View takes its View, Buffer and data from the arena
+  View* tiny = grp->createViewAndAllocate("tiny", INT_ID, 4);
+  EXPECT_EQ(arena->getNumAllocations(), num_root_allocs + 11);
+
+  // deallocating a View's data returns it to the arena
+  tiny->deallocate();
+  EXPECT_EQ(arena->getNumAllocations(), num_root_allocs + 10);
+  EXPECT_EQ(big->getData<int*>()[num_big - 1], 7);
+
+  // destroying everything returns all blocks to the arena
+  grp->destroyViewsAndData();
+  root->destroyGroup("grp");
+  EXPECT_EQ(arena->getNumAllocations(), num_root_allocs);
+
+  // freed blocks are reused rather than reserving more memory
+  const std::size_t reserved = arena->getNumBytesReserved();
+  root->createGroup("again")->createViewAndAllocate("small", INT_ID, 10);
+  EXPECT_EQ(arena->getNumBytesReserved(), reserved);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(sidre_datastore, intern_names)
+{
+  DataStore ds;
+  EXPECT_EQ(ds.getNumInternedNames(), 0);
+  EXPECT_EQ(ds.getInternedNameId("a/b"), axom::sidre::InvalidIndex);
+
+  IndexType id_ab = ds.internName("a/b");
+  IndexType id_c = ds.internName("c");
+  EXPECT_EQ(id_ab, 0);
+  EXPECT_EQ(id_c, 1);
+  EXPECT_EQ(ds.internName("a/b"), id_ab);
+  EXPECT_EQ(ds.getInternedNameId("c"), id_c);
+  EXPECT_EQ(ds.getNumInternedNames(), 2);
+
+  EXPECT_EQ(ds.getInternedName(id_ab), "a/b");
+  EXPECT_EQ(ds.getInternedName(id_c), "c");
+
+  // names stay valid as the table grows
+  const std::string& name_ab = ds.getInternedName(id_ab);
+  for(int i = 0; i < 1000; ++i)
+  {
+    ds.internName("name_" + std::to_string(i));
+  }
+  EXPECT_EQ(name_ab, "a/b");
+
+  // check error condition
+  EXPECT_EQ(ds.getInternedName(5000), axom::sidre::InvalidName);
+}
+
+//------------------------------------------------------------------------------
+
+TEST(sidre_datastore_DeathTest, memory_arena_move_between_datastores)
+{
+  using axom::sidre::Group;
+  using axom::sidre::View;
+
+  const char IGNORE_OUTPUT[] = ".*";
+
+  DataStore plain;
+  DataStore ds(true);
+  View* view = ds.getRoot()->createViewScalar("scalar", 1);
+  Group* group = ds.getRoot()->createGroup("grp");
+
+  // objects of an arena must be destroyed by the DataStore that owns it
+  EXPECT_DEATH_IF_SUPPORTED(plain.getRoot()->moveView(view), IGNORE_OUTPUT);
+  EXPECT_DEATH_IF_SUPPORTED(plain.getRoot()->moveGroup(group), IGNORE_OUTPUT);
+
+  // moves within the DataStore are allowed
+  EXPECT_EQ(group->moveView(view), view);
+  EXPECT_EQ(ds.getRoot()->getView("grp/scalar"), view);
+}
@@ -375,6 +375,103 @@ TEST(sidre_group, view_with_path)
   delete ds;
 }
 
+//------------------------------------------------------------------------------
+// getView(), getGroup() with the DataStore path index enabled
+//------------------------------------------------------------------------------
+TEST(sidre_group, path_index)
+{
+  DataStore* ds = new DataStore();
+  EXPECT_FALSE(ds->isPathIndexEnabled());
+  ds->setPathIndexEnabled(true);
+  EXPECT_TRUE(ds->isPathIndexEnabled());
+
+  Group* root = ds->getRoot();
+  Group* groupB = root->createGroup("groupA/groupB");
+  View* viewA = groupB->createView("viewA");
+
+  // lookups do not intern paths
+  EXPECT_EQ(root->getView("groupA/groupB/viewA"), viewA);
+  EXPECT_EQ(ds->getInternedNameId("groupA/groupB/viewA"), InvalidIndex);
+  EXPECT_EQ(ds->getNumInternedNames(), 0);
+
+  ds->internName("groupA/groupB/viewA");
+  ds->internName("groupA/groupB");
+
+  // repeated lookups, including through const Groups, find the same items
+  for(int i = 0; i < 2; ++i)
+  {
+    EXPECT_EQ(root->getView("groupA/groupB/viewA"), viewA);
+    EXPECT_EQ(root->getGroup("groupA/groupB"), groupB);
+    const Group* croot = root;
+    EXPECT_EQ(croot->getView("groupA/groupB/viewA"), viewA);
+  }
+  EXPECT_EQ(ds->getNumInternedNames(), 2);
+
+  // changes to the hierarchy are seen by later lookups
+  groupB->destroyView("viewA");
+  EXPECT_EQ(root->getView("groupA/groupB/viewA"), static_cast<void*>(nullptr));
+  View* viewA2 = groupB->createView("viewA");
+  EXPECT_EQ(root->getView("groupA/groupB/viewA"), viewA2);
+
+  // a recreated Group may reuse the memory of the destroyed one
+  root->destroyGroup("groupA");
+  EXPECT_EQ(root->getGroup("groupA/groupB"), static_cast<void*>(nullptr));
+  root->createGroup("groupA");
+  EXPECT_EQ(root->getView("groupA/groupB/viewA"), static_cast<void*>(nullptr));
+
+  delete ds;
+}
+
+//------------------------------------------------------------------------------
+// ViewHandle resolves a path once and follows hierarchy changes
+//------------------------------------------------------------------------------
+TEST(sidre_group, view_handle)
+{
+  DataStore* ds = new DataStore();
+  Group* root = ds->getRoot();
+  Group* fields = root->createGroup("fields");
+
+  axom::sidre::ViewHandle empty;
+  EXPECT_EQ(empty.getView(), static_cast<void*>(nullptr));
+  EXPECT_EQ(empty.getPath(), axom::sidre::InvalidName);
+
+  // handle to a View that does not exist yet
+  axom::sidre::ViewHandle handle = root->getViewHandle("fields/density");
+  EXPECT_EQ(handle.getGroup(), root);
+  EXPECT_EQ(handle.getPath(), "fields/density");
+  EXPECT_FALSE(handle.isValid());
+
+  View* density = fields->createViewScalar("density", 1.5);
+  EXPECT_TRUE(handle.isValid());
+  EXPECT_EQ(handle.getView(), density);
+
+  // copies share the interned path
+  axom::sidre::ViewHandle copy = handle;
+  EXPECT_EQ(copy.getView(), density);
+  EXPECT_EQ(ds->getInternedNameId("fields/density"),
+            ds->getInternedNameId(copy.getPath()));
+
+  // handle follows a View moved away from and back to its path
+  Group* other = root->createGroup("other");
+  other->moveView(density);
+  EXPECT_FALSE(handle.isValid());
+  fields->moveView(density);
+  EXPECT_EQ(handle.getView(), density);
+
+  // and sees a replacement View
+  fields->destroyView("density");
+  View* density2 = fields->createViewScalar("density", 2.5);
+  EXPECT_EQ(handle.getView(), density2);
+  EXPECT_EQ(handle.getView()->getData<double>(), 2.5);
+
+  // handle to a path through a Group that does not exist
+  axom::sidre::ViewHandle missing = root->getViewHandle("none/density");
+  EXPECT_EQ(missing.getView(), static_cast<void*>(nullptr));
+  EXPECT_FALSE(root->hasGroup("none"));
+
+  delete ds;
+}
+
 //------------------------------------------------------------------------------
 // Verify getViewName(), getViewIndex()
 //------------------------------------------------------------------------------
@@ -1012,6 +1012,52 @@ TEST(sidre_view, int_array_strided_views)
 
 //------------------------------------------------------------------------------
 
+TEST(sidre_view, int_array_strided_array_views)
+{
+  const IndexType num_elts = 12;
+
+  DataStore* ds = new DataStore();
+  Group* root = ds->getRoot();
+  Buffer* dbuff = ds->createBuffer(INT_ID, num_elts)->allocate();
+
+  int* data_ptr = dbuff->getData();
+  for(int i = 0; i < num_elts; i++)
+  {
+    data_ptr[i] = i;
+  }
+
+  // (num_elems, offset [in # elems], stride [in # elems])
+  View* dv_o = root->createView("odd", dbuff)->apply(INT_ID, 6, 1, 2);
+
+  axom::ArrayView<int, 1, axom::layout::Strided> odd =
+    dv_o->getArrayView<int>();
+  EXPECT_EQ(odd.size(), 6);
+  EXPECT_EQ(odd.stride(0), 2);
+  for(int i = 0; i < 6; i++)
+  {
+    EXPECT_EQ(odd[i], 2 * i + 1);
+  }
+
+  // a 2D view of the whole buffer, as 4 triples
+  IndexType shape[2] = {4, 3};
+  View* dv_t = root->createView("triples", dbuff)->apply(INT_ID, 2, shape);
+
+  auto triples = dv_t->getArrayView<const int, 2>();
+  EXPECT_EQ(triples.shape(0), 4);
+  EXPECT_EQ(triples.shape(1), 3);
+  for(int i = 0; i < 4; i++)
+  {
+    for(int j = 0; j < 3; j++)
+    {
+      EXPECT_EQ(triples(i, j), 3 * i + j);
+    }
+  }
+
+  delete ds;
+}
+
+//------------------------------------------------------------------------------
+
 TEST(sidre_view, int_array_depth_view)
 {
   DataStore* ds = new DataStore();
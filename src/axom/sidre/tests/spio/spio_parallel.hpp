@@ -36,6 +36,10 @@
 #include "mpi.h"
 // _parallel_io_headers_end
 
+#include "axom/core/utilities/FileUtilities.hpp"
+
+#include <cstdio>  // for std::rename
+
 using axom::sidre::DataStore;
 using axom::sidre::DataType;
 using axom::sidre::Group;
@@ -283,6 +287,162 @@ TEST(spio_parallel, write_read_write)
   writer_b.write(ds_r.getRoot(), num_files, filename, PROTOCOL);
 }
 
+//------------------------------------------------------------------------------
+TEST(spio_parallel, incremental_writeread)
+{
+  int my_rank, num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  const int num_files = numOutputFiles(num_ranks);
+  const int NUM_VALS = 10;
+
+  DataStore* ds = new DataStore();
+  Group* root = ds->getRoot();
+
+  // "topology" never changes; "field" is updated between checkpoints
+  View* topo_view =
+    root->createViewAndAllocate("topology", DataType::c_int(NUM_VALS));
+  View* field_view =
+    root->createViewAndAllocate("field", DataType::c_double(NUM_VALS));
+
+  int* topo = topo_view->getData();
+  double* field = field_view->getData();
+  for(int i = 0; i < NUM_VALS; ++i)
+  {
+    topo[i] = 100 * my_rank + i;
+    field[i] = 0.;
+  }
+
+  IOManager writer(MPI_COMM_WORLD);
+
+  const int NUM_CYCLES = 3;
+  std::string last_root;
+  for(int cycle = 0; cycle < NUM_CYCLES; ++cycle)
+  {
+    for(int i = 0; i < NUM_VALS; ++i)
+    {
+      field[i] = cycle + 0.5 * i;
+    }
+    field_view->markDirty();
+
+    // each checkpoint is written to its own directory
+    const std::string dir_name =
+      fmt::sprintf("out_spio_incremental_%02d", cycle);
+    if(my_rank == 0)
+    {
+      axom::utilities::filesystem::makeDirsForPath(dir_name);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    std::string file_name = dir_name + "/checkpoint";
+    writer.writeIncremental(root, num_files, file_name, PROTOCOL);
+    last_root = file_name + ROOT_EXT;
+  }
+
+  // "topology" references the first checkpoint directly, so the last
+  // checkpoint does not depend on the middle one
+  MPI_Barrier(MPI_COMM_WORLD);
+  if(my_rank == 0)
+  {
+    EXPECT_EQ(0,
+              std::rename("out_spio_incremental_01",
+                          "out_spio_incremental_01_moved"));
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  // Restart from the last checkpoint in the chain
+  DataStore* ds2 = new DataStore();
+  IOManager reader(MPI_COMM_WORLD);
+  reader.read(ds2->getRoot(), last_root);
+
+  EXPECT_TRUE(ds2->getRoot()->isEquivalentTo(root));
+
+  int* topo2 = ds2->getRoot()->getView("topology")->getData();
+  double* field2 = ds2->getRoot()->getView("field")->getData();
+  for(int i = 0; i < NUM_VALS; ++i)
+  {
+    EXPECT_EQ(topo[i], topo2[i]);
+    EXPECT_DOUBLE_EQ(field[i], field2[i]);
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  if(my_rank == 0)
+  {
+    std::rename("out_spio_incremental_01_moved", "out_spio_incremental_01");
+  }
+
+  delete ds2;
+  delete ds;
+}
+
+//------------------------------------------------------------------------------
+TEST(spio_parallel, staged_writeread)
+{
+  int my_rank, num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  const int NUM_VALS = 1000;
+
+  DataStore* ds = new DataStore();
+  Group* root = ds->getRoot();
+
+  View* field_view =
+    root->createViewAndAllocate("field", DataType::c_double(NUM_VALS));
+  double* field = field_view->getData();
+  root->createViewScalar<int>("rank", my_rank);
+
+  // A local directory stands in for node-local storage
+  IOManager writer(MPI_COMM_WORLD);
+  writer.setStagingDirectory("out_spio_staging");
+  EXPECT_EQ(writer.getStagingDirectory(), "out_spio_staging");
+
+  const int NUM_CYCLES = 2;
+  std::string root_name;
+  for(int cycle = 0; cycle < NUM_CYCLES; ++cycle)
+  {
+    for(int i = 0; i < NUM_VALS; ++i)
+    {
+      field[i] = 1000. * cycle + 10. * my_rank + i;
+    }
+
+    std::string file_name = fmt::sprintf("out_spio_staged_%02d", cycle);
+    root_name = file_name + ROOT_EXT;
+    writer.write(root, num_ranks, file_name, PROTOCOL);
+    EXPECT_TRUE(writer.hasPendingDrain());
+
+    // The root file only appears once every rank's files are drained
+    if(my_rank == 0)
+    {
+      EXPECT_FALSE(axom::utilities::filesystem::pathExists(root_name));
+    }
+
+    EXPECT_TRUE(writer.waitForDrain());
+    EXPECT_FALSE(writer.hasPendingDrain());
+    EXPECT_TRUE(axom::utilities::filesystem::pathExists(root_name));
+  }
+
+  // Leave the last checkpoint draining; read() completes it
+  writer.write(root, num_ranks, "out_spio_staged_last", PROTOCOL);
+
+  DataStore* ds2 = new DataStore();
+  writer.read(ds2->getRoot(), "out_spio_staged_last" + ROOT_EXT);
+  EXPECT_FALSE(writer.hasPendingDrain());
+
+  EXPECT_TRUE(ds2->getRoot()->isEquivalentTo(root));
+  EXPECT_EQ(static_cast<int>(ds2->getRoot()->getView("rank")->getData()),
+            my_rank);
+  double* field2 = ds2->getRoot()->getView("field")->getData();
+  for(int i = 0; i < NUM_VALS; ++i)
+  {
+    EXPECT_DOUBLE_EQ(field[i], field2[i]);
+  }
+
+  delete ds2;
+  delete ds;
+}
+
 //------------------------------------------------------------------------------
 TEST(spio_parallel, external_writeread)
 {
@@ -1030,3 +1190,112 @@ TEST(spio_parallel, sidre_simple_blueprint_example)
 
 #endif
 }
+
+TEST(spio_parallel, blueprint_index_reduce_and_cache)
+{
+  int my_rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  int num_ranks;
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+#ifdef AXOM_USE_HDF5
+  // one small uniform domain per rank
+  axom::sidre::Node n_mesh;
+  conduit::blueprint::mesh::examples::basic("uniform", 3, 3, 1, n_mesh);
+  n_mesh["coordsets/coords/origin/x"] = my_rank * 20.0;
+  n_mesh["state/cycle"] = 1;
+  n_mesh["state/time"] = 0.5;
+
+  DataStore ds;
+  Group* root = ds.getRoot();
+  root->createGroup("mesh")->importConduitTree(n_mesh);
+
+  axom::sidre::IOManager writer(MPI_COMM_WORLD);
+  const std::string index_path = "blueprint_index/mesh";
+
+  // first checkpoint generates the index with a tree reduction
+  writer.write(root, num_ranks, "out_spio_bp_cache_0", "sidre_hdf5");
+  MPI_Barrier(MPI_COMM_WORLD);
+  writer.writeBlueprintIndexToRootFile(&ds,
+                                       "mesh",
+                                       "out_spio_bp_cache_0.root",
+                                       "mesh");
+
+  Group* state = root->getGroup(index_path + "/state");
+  ASSERT_TRUE(state != nullptr);
+  EXPECT_EQ(static_cast<int>(state->getView("number_of_domains")->getData()),
+            num_ranks);
+  View* domain_rank = state->getView("partition_map/datagroup");
+  EXPECT_EQ(domain_rank->getNumElements(), num_ranks);
+  axom::int64* domain_rank_ptr = domain_rank->getData();
+  for(int i = 0; i < num_ranks; ++i)
+  {
+    EXPECT_EQ(domain_rank_ptr[i], i);
+  }
+
+  // second checkpoint with the same structure reuses the index but picks
+  // up the new cycle
+  root->getView("mesh/state/cycle")->setScalar(2);
+  writer.write(root, num_ranks, "out_spio_bp_cache_1", "sidre_hdf5");
+  MPI_Barrier(MPI_COMM_WORLD);
+  writer.writeBlueprintIndexToRootFile(&ds,
+                                       "mesh",
+                                       "out_spio_bp_cache_1.root",
+                                       "mesh");
+
+  state = root->getGroup(index_path + "/state");
+  EXPECT_EQ(static_cast<int>(state->getView("cycle")->getData()), 2);
+  EXPECT_EQ(static_cast<int>(state->getView("number_of_domains")->getData()),
+            num_ranks);
+  EXPECT_FALSE(root->hasGroup(index_path + "/fields/rank"));
+
+  // a new field changes the structure, so the index is regenerated
+  Group* field = root->createGroup("mesh/fields/rank");
+  field->createViewString("association", "element");
+  field->createViewString("topology", "mesh");
+  field->createViewAndAllocate("values", axom::sidre::INT64_ID, 4);
+  writer.write(root, num_ranks, "out_spio_bp_cache_2", "sidre_hdf5");
+  MPI_Barrier(MPI_COMM_WORLD);
+  writer.writeBlueprintIndexToRootFile(&ds,
+                                       "mesh",
+                                       "out_spio_bp_cache_2.root",
+                                       "mesh");
+
+  EXPECT_TRUE(root->hasGroup(index_path + "/fields/rank"));
+#endif
+}
+
+TEST(spio_parallel, blueprint_index_mixed_domain_ids)
+{
+  int my_rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  int num_ranks;
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  // one domain per rank, where only rank 0 gives its domain an id
+  axom::sidre::Node n_mesh;
+  conduit::blueprint::mesh::examples::basic("uniform", 3, 3, 1, n_mesh);
+  n_mesh["coordsets/coords/origin/x"] = my_rank * 20.0;
+  if(my_rank == 0)
+  {
+    n_mesh["state/domain_id"] = num_ranks - 1;
+  }
+
+  DataStore ds;
+  Group* root = ds.getRoot();
+  root->createGroup("mesh")->importConduitTree(n_mesh);
+
+  EXPECT_TRUE(
+    ds.generateBlueprintIndex(MPI_COMM_WORLD, "mesh", "mesh", "index"));
+
+  // the other domains take the remaining ids in rank order
+  View* domain_rank = root->getView("index/state/partition_map/datagroup");
+  ASSERT_TRUE(domain_rank != nullptr);
+  EXPECT_EQ(domain_rank->getNumElements(), num_ranks);
+  axom::int64* domain_rank_ptr = domain_rank->getData();
+  for(int i = 0; i < num_ranks - 1; ++i)
+  {
+    EXPECT_EQ(domain_rank_ptr[i], i + 1);
+  }
+  EXPECT_EQ(domain_rank_ptr[num_ranks - 1], 0);
+}
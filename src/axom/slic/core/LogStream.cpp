@@ -11,38 +11,109 @@
 #include "axom/slic/core/LogStream.hpp"
 
 // C/C++ includes
+#include <algorithm>
+#include <cstring>
 #include <ctime>
-#include <sstream>
+#include <utility>
 
 namespace axom
 {
 namespace slic
 {
+namespace
+{
+/*!
+ * \brief Appends the decimal digits of the given integer to the string.
+ */
+void appendInteger(std::string& str, int value)
+{
+  char digits[16];
+  int ndigits = 0;
+
+  unsigned int magnitude = (value < 0) ? 0u - static_cast<unsigned int>(value)
+                                       : static_cast<unsigned int>(value);
+  do
+  {
+    digits[ndigits++] = static_cast<char>('0' + magnitude % 10);
+    magnitude /= 10;
+  } while(magnitude != 0);
+
+  if(value < 0)
+  {
+    str += '-';
+  }
+  while(ndigits > 0)
+  {
+    str += digits[--ndigits];
+  }
+}
+
+}  // end anonymous namespace
+
 //------------------------------------------------------------------------------
 LogStream::LogStream()
-  : m_formatString("*****\n[<LEVEL>]\n\n <MESSAGE> \n\n <FILE>\n<LINE>\n****\n")
-{ }
+{
+  this->setFormatString(
+    "*****\n[<LEVEL>]\n\n <MESSAGE> \n\n <FILE>\n<LINE>\n****\n");
+}
 
 //------------------------------------------------------------------------------
 LogStream::~LogStream() { }
 
 //------------------------------------------------------------------------------
-void LogStream::replaceKey(std::string& msg,
-                           const std::string& key,
-                           const std::string& value,
-                           std::size_t pos)
+void LogStream::setFormatString(const std::string& format)
 {
-  if(pos == std::string::npos)
+  struct Keyword
+  {
+    const char* key;
+    FormatSegment::Field field;
+  };
+
+  static const Keyword keywords[] = {{"<LEVEL>", FormatSegment::Level},
+                                     {"<MESSAGE>", FormatSegment::Message},
+                                     {"<TAG>", FormatSegment::Tag},
+                                     {"<FILE>", FormatSegment::File},
+                                     {"<RANK>", FormatSegment::Rank},
+                                     {"<LINE>", FormatSegment::Line},
+                                     {"<TIMESTAMP>", FormatSegment::TimeStamp}};
+  const int nkeywords = sizeof(keywords) / sizeof(Keyword);
+
+  // find the first occurrence of each keyword
+  std::vector<std::pair<std::size_t, int>> fields;
+  for(int k = 0; k < nkeywords; ++k)
   {
-    pos = msg.find(key);
+    const std::size_t pos = format.find(keywords[k].key);
+    if(pos != std::string::npos)
+    {
+      fields.push_back(std::make_pair(pos, k));
+    }
   }
+  std::sort(fields.begin(), fields.end());
 
-  if(pos != std::string::npos)
+  m_formatString = format;
+  m_formatSegments.clear();
+
+  std::size_t literalStart = 0;
+  for(const std::pair<std::size_t, int>& field : fields)
   {
-    msg = msg.substr(0, pos) + value +
-      msg.substr(pos + key.length(), msg.length() - 1);
+    const std::size_t pos = field.first;
+    const Keyword& keyword = keywords[field.second];
+
+    if(pos > literalStart)
+    {
+      m_formatSegments.push_back(
+        {FormatSegment::Literal,
+         format.substr(literalStart, pos - literalStart)});
+    }
+    m_formatSegments.push_back({keyword.field, std::string()});
+    literalStart = pos + std::strlen(keyword.key);
+  }
 
-  }  // END if
+  if(literalStart < format.size())
+  {
+    m_formatSegments.push_back(
+      {FormatSegment::Literal, format.substr(literalStart)});
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -72,33 +143,56 @@ std::string LogStream::getFormatedMessage(const std::string& msgLevel,
                                           const std::string& fileName,
                                           int line)
 {
-  std::string msg = m_formatString;
-
-  this->replaceKey(msg, "<LEVEL>", msgLevel);
-  this->replaceKey(msg, "<MESSAGE>", message);
-  this->replaceKey(msg, "<TAG>", tagName);
-  this->replaceKey(msg, "<FILE>", fileName);
-  this->replaceKey(msg, "<RANK>", rank);
-
-  if(line != MSG_IGNORE_LINE)
-  {
-    std::ostringstream oss;
-    oss << line;
+  return this->formatMessage(msgLevel, message, tagName, rank, fileName, line);
+}
 
-    this->replaceKey(msg, "<LINE>", oss.str());
-  }
-  else
-  {
-    this->replaceKey(msg, "<LINE>", "");
-  }
+//------------------------------------------------------------------------------
+const std::string& LogStream::formatMessage(const std::string& msgLevel,
+                                            const std::string& message,
+                                            const std::string& tagName,
+                                            const std::string& rank,
+                                            const std::string& fileName,
+                                            int line)
+{
+  // the buffer keeps its capacity across messages
+  static thread_local std::string buffer;
+  buffer.clear();
 
-  std::size_t pos = msg.find("<TIMESTAMP>");
-  if(pos != std::string::npos)
+  for(const FormatSegment& segment : m_formatSegments)
   {
-    this->replaceKey(msg, "<TIMESTAMP>", this->getTimeStamp(), pos);
+    switch(segment.field)
+    {
+    case FormatSegment::Literal:
+      buffer += segment.text;
+      break;
+    case FormatSegment::Level:
+      buffer += msgLevel;
+      break;
+    case FormatSegment::Message:
+      buffer += message;
+      break;
+    case FormatSegment::Tag:
+      buffer += tagName;
+      break;
+    case FormatSegment::File:
+      buffer += fileName;
+      break;
+    case FormatSegment::Line:
+      if(line != MSG_IGNORE_LINE)
+      {
+        appendInteger(buffer, line);
+      }
+      break;
+    case FormatSegment::Rank:
+      buffer += rank;
+      break;
+    case FormatSegment::TimeStamp:
+      buffer += this->getTimeStamp();
+      break;
+    }
   }
 
-  return (msg);
+  return buffer;
 }
 
 } /* namespace slic */
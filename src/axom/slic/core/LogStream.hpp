@@ -25,6 +25,7 @@
 
 // C/C++ includes
 #include <string>  // For STL string
+#include <vector>  // For STL vector
 
 namespace axom
 {
@@ -56,9 +57,12 @@ public:
    *    <li> <TAG> user-supplied tag </li>
    *    <li> <FILE> with the filename </li>
    *    <li> <LINE> with the line number </li>
-   *    <li> <LINE> with the MPI rank </li>
+   *    <li> <RANK> with the MPI rank </li>
    *    <li> <TIMESTAMP> date/time the message is logged </li>
    *  </ul>
+   *  Only the first occurrence of each keyword is replaced. The format
+   *  string is compiled here into a sequence of literal text and fields, so
+   *  that messages are formatted in a single pass.
    *
    *  An example illustrating how an application can setup the format string
    *  is shown below:
@@ -74,7 +78,7 @@ public:
    *         std::string( "***********************************\n" );
    * \endcode
    */
-  void setFormatString(const std::string& format) { m_formatString = format; }
+  void setFormatString(const std::string& format);
 
   /*!
    * \brief Appends the given message to the stream.
@@ -140,6 +144,30 @@ protected:
                                  const std::string& fileName,
                                  int line);
 
+  /*!
+   * \brief Formats the message into a buffer that is reused by the calling
+   *  thread, which avoids allocating a new string for each message.
+   *
+   * \param [in] msgLevel the level of the given message.
+   * \param [in] message the user-supplied message.
+   * \param [in] tagName user-supplied tag, may be MSG_IGNORE_TAG
+   * \param [in] rank the MPI rank(s) of the message.
+   * \param [in] fileName filename where this message is logged, may be
+   *  MSG_IGNORE_FILE to ignore this field.
+   * \param [in] line the line number within the file where the message is
+   *  logged, may be MSG_IGNORE_LINE to ignore this field.
+   * \return a reference to the formatted message, which is valid until the
+   *  next call to formatMessage() or getFormatedMessage() on the same thread.
+   *
+   * \see getFormatedMessage
+   */
+  const std::string& formatMessage(const std::string& msgLevel,
+                                   const std::string& message,
+                                   const std::string& tagName,
+                                   const std::string& rank,
+                                   const std::string& fileName,
+                                   int line);
+
   /*!
    * \brief Returns a time-stamp.
    * \return str a textual representation of the current time.
@@ -147,18 +175,30 @@ protected:
   std::string getTimeStamp();
 
 private:
-  std::string m_formatString;
-
   /*!
-   * \brief Replaces the given key in the message string with the given value.
-   * \param [in,out] msg the message string that will be modified.
-   * \param [in] key the key in the message that will be replace.
-   * \param [in] value the value to replace it with.
+   * \brief A piece of the compiled format string, which is either literal
+   *  text or a field that is replaced by a part of the message.
    */
-  void replaceKey(std::string& msg,
-                  const std::string& key,
-                  const std::string& value,
-                  std::size_t pos = std::string::npos);
+  struct FormatSegment
+  {
+    enum Field
+    {
+      Literal,
+      Level,
+      Message,
+      Tag,
+      File,
+      Line,
+      Rank,
+      TimeStamp
+    };
+
+    Field field;
+    std::string text;
+  };
+
+  std::string m_formatString;
+  std::vector<FormatSegment> m_formatSegments;
 
   DISABLE_COPY_AND_ASSIGNMENT(LogStream);
   DISABLE_MOVE_AND_ASSIGNMENT(LogStream);
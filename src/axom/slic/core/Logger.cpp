@@ -6,6 +6,7 @@
 #include "axom/slic/core/Logger.hpp"
 
 #include "axom/slic/core/LogStream.hpp"
+#include "axom/slic/internal/AsyncLogWriter.hpp"
 
 #include "axom/core/utilities/Utilities.hpp"  // for utilities::processAbort()
 
@@ -18,6 +19,8 @@ namespace slic
 {
 Logger* Logger::s_Logger = nullptr;
 std::map<std::string, Logger*> Logger::s_loggers;
+std::mutex Logger::s_streamMutex;
+constexpr std::size_t Logger::DEFAULT_ASYNC_CAPACITY;
 
 //------------------------------------------------------------------------------
 Logger::Logger()
@@ -49,6 +52,9 @@ Logger::Logger(const std::string& name)
 //------------------------------------------------------------------------------
 Logger::~Logger()
 {
+  // append the queued messages before the streams are deleted
+  m_asyncWriter.reset();
+
   std::map<LogStream*, LogStream*>::iterator it = m_streamObjectsManager.begin();
   for(; it != m_streamObjectsManager.end(); ++it)
   {
@@ -102,6 +108,30 @@ void Logger::setLoggingMsgLevel(message::Level level)
   }
 }
 
+//------------------------------------------------------------------------------
+void Logger::enableAsync(std::size_t capacity)
+{
+  if(m_asyncWriter != nullptr)
+  {
+    return;
+  }
+
+  m_asyncWriter.reset(new internal::AsyncLogWriter(
+    capacity,
+    [this](internal::LogRecord& record) {
+      std::lock_guard<std::mutex> lock(s_streamMutex);
+      this->appendToStreams(record.level,
+                            record.message,
+                            record.tagName,
+                            record.fileName,
+                            record.line,
+                            record.filter_duplicates);
+    }));
+}
+
+//------------------------------------------------------------------------------
+void Logger::disableAsync() { m_asyncWriter.reset(); }
+
 //------------------------------------------------------------------------------
 void Logger::addStreamToMsgLevel(LogStream* ls,
                                  message::Level level,
@@ -207,13 +237,25 @@ void Logger::logMessage(message::Level level,
 
   }  // END if
 
-  unsigned nstreams = static_cast<unsigned>(m_logStreams[level].size());
-  for(unsigned istream = 0; istream < nstreams; ++istream)
+  if(m_asyncWriter != nullptr)
   {
-    m_logStreams[level][istream]
-      ->append(level, message, tagName, fileName, line, filter_duplicates);
-
-  }  // END for all streams
+    m_asyncWriter->push(internal::LogRecord {level,
+                                             message,
+                                             tagName,
+                                             fileName,
+                                             line,
+                                             filter_duplicates});
+  }
+  else
+  {
+    std::lock_guard<std::mutex> lock(s_streamMutex);
+    this->appendToStreams(level,
+                          message,
+                          tagName,
+                          fileName,
+                          line,
+                          filter_duplicates);
+  }
 
   if((m_abortOnError && (level == message::Error)) ||
      (m_abortOnWarning && (level == message::Warning)))
@@ -224,9 +266,32 @@ void Logger::logMessage(message::Level level,
   }  // END if
 }
 
+//------------------------------------------------------------------------------
+void Logger::appendToStreams(message::Level level,
+                             const std::string& message,
+                             const std::string& tagName,
+                             const std::string& fileName,
+                             int line,
+                             bool filter_duplicates)
+{
+  unsigned nstreams = static_cast<unsigned>(m_logStreams[level].size());
+  for(unsigned istream = 0; istream < nstreams; ++istream)
+  {
+    m_logStreams[level][istream]
+      ->append(level, message, tagName, fileName, line, filter_duplicates);
+
+  }  // END for all streams
+}
+
 //------------------------------------------------------------------------------
 void Logger::flushStreams()
 {
+  if(m_asyncWriter != nullptr)
+  {
+    m_asyncWriter->drain();
+  }
+
+  std::lock_guard<std::mutex> lock(s_streamMutex);
   for(int level = message::Error; level < message::Num_Levels; ++level)
   {
     unsigned nstreams = static_cast<unsigned>(m_logStreams[level].size());
@@ -242,6 +307,12 @@ void Logger::flushStreams()
 //------------------------------------------------------------------------------
 void Logger::pushStreams()
 {
+  if(m_asyncWriter != nullptr)
+  {
+    m_asyncWriter->drain();
+  }
+
+  std::lock_guard<std::mutex> lock(s_streamMutex);
   for(int level = message::Error; level < message::Num_Levels; ++level)
   {
     unsigned nstreams = static_cast<unsigned>(m_logStreams[level].size());
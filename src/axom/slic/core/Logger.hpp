@@ -13,9 +13,12 @@
 #include "axom/slic/core/MessageLevel.hpp"
 
 // C/C++ includes
-#include <string>  // for STL string
-#include <vector>  // for STL vector
-#include <map>     // for STL map
+#include <cstddef>  // for std::size_t
+#include <memory>   // for std::unique_ptr
+#include <mutex>    // for std::mutex
+#include <string>   // for STL string
+#include <vector>   // for STL vector
+#include <map>      // for STL map
 
 #include "axom/core/Macros.hpp"
 
@@ -26,6 +29,11 @@ namespace slic
 // Forward declarations
 class LogStream;
 
+namespace internal
+{
+class AsyncLogWriter;
+}
+
 // Type alias for readability
 using AbortFunctionPtr = void (*)();
 
@@ -45,6 +53,14 @@ using AbortFunctionPtr = void (*)();
  *  application to use some of the predefined LogStream mechanisms or implement
  *  a custom one by implementing a derivative of the LogStream class.
  *
+ *  Messages may be logged from several threads, e.g., in OpenMP regions. The
+ *  streams are appended to by one thread at a time. In asynchronous mode,
+ *  see enableAsync(), logging threads only queue the messages, which a
+ *  background thread formats and appends to the streams.
+ *
+ * \note The configuration methods, e.g., setLoggingMsgLevel() and
+ *  addStreamToMsgLevel(), must not be called while other threads log.
+ *
  * \see LogStream MessageType
  */
 class Logger
@@ -65,6 +81,16 @@ public:
    */
   void setLoggingMsgLevel(message::Level level);
 
+  /*!
+   * \brief Checks whether messages of the given level are logged.
+   * \param [in] level the level in query.
+   * \return status true if messages of the given level are logged.
+   */
+  bool isLevelEnabled(message::Level level) const
+  {
+    return m_isEnabled[level];
+  }
+
   /*!
    * \brief Toggles the abort behavior for error messages. Default is false.
    * \param [in] status user-supplied flag.
@@ -126,6 +152,31 @@ public:
    */
   std::string getName() const { return this->m_name; };
 
+  /*!
+   * \brief Enables asynchronous logging.
+   *
+   *  Logged messages are queued, without taking a lock, and a background
+   *  thread appends them to the streams. A logging thread only waits when the
+   *  queue is full. Errors and warnings that abort, flushStreams() and
+   *  pushStreams() first wait for the queued messages to be appended.
+   *
+   * \param [in] capacity the number of messages the queue holds (optional).
+   * \note Has no effect if asynchronous logging is already enabled.
+   * \post this->isAsyncEnabled() == true
+   */
+  void enableAsync(std::size_t capacity = DEFAULT_ASYNC_CAPACITY);
+
+  /*!
+   * \brief Appends the queued messages and disables asynchronous logging.
+   * \post this->isAsyncEnabled() == false
+   */
+  void disableAsync();
+
+  /*!
+   * \brief Checks whether asynchronous logging is enabled.
+   */
+  bool isAsyncEnabled() const { return m_asyncWriter != nullptr; }
+
   /*!
    * \brief Binds the given stream to the given level for this Logger instance.
    * \param [in] ls pointer to the user-supplied LogStream object.
@@ -245,6 +296,11 @@ public:
   /// \name Static Methods
   ///@{
 
+  /*!
+   * \brief The default capacity of the message queue of asynchronous loggers.
+   */
+  static constexpr std::size_t DEFAULT_ASYNC_CAPACITY = 4096;
+
   /*!
    * \brief Initializes the logging environment, with the root logger.
    * \post Logger::getActiveLogger() != NULL.
@@ -318,6 +374,17 @@ private:
    */
   ~Logger();
 
+  /*!
+   * \brief Appends the given message to the streams of its level.
+   * \note Must be called with s_streamMutex locked.
+   */
+  void appendToStreams(message::Level level,
+                       const std::string& message,
+                       const std::string& tagName,
+                       const std::string& fileName,
+                       int line,
+                       bool filter_duplicates);
+
   /// \name Private class members
   ///@{
 
@@ -330,6 +397,8 @@ private:
   std::map<LogStream*, LogStream*> m_streamObjectsManager;
   std::vector<LogStream*> m_logStreams[message::Num_Levels];
 
+  std::unique_ptr<internal::AsyncLogWriter> m_asyncWriter;
+
   ///@}
 
   /// \name Static Members
@@ -338,6 +407,9 @@ private:
   static Logger* s_Logger;
   static std::map<std::string, Logger*> s_loggers;
 
+  // serializes the appends to the streams, which may be shared by loggers
+  static std::mutex s_streamMutex;
+
   ///@}
 
   DISABLE_COPY_AND_ASSIGNMENT(Logger);
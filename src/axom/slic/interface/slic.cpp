@@ -83,6 +83,52 @@ void setLoggingMsgLevel(message::Level level)
   Logger::getActiveLogger()->setLoggingMsgLevel(level);
 }
 
+//------------------------------------------------------------------------------
+bool isLevelEnabled(message::Level level)
+{
+  Logger* logger = Logger::getActiveLogger();
+  return (logger != nullptr) && logger->isLevelEnabled(level);
+}
+
+//------------------------------------------------------------------------------
+void enableAsyncLogging(std::size_t capacity)
+{
+  if(!isInitialized())
+  {
+    std::cerr << "[ERROR]: slic::initialize() must be called "
+              << "before making any other calls to SLIC.";
+    return;
+  }
+
+  Logger::getActiveLogger()->enableAsync(capacity);
+}
+
+//------------------------------------------------------------------------------
+void disableAsyncLogging()
+{
+  if(!isInitialized())
+  {
+    std::cerr << "[ERROR]: slic::initialize() must be called "
+              << "before making any other calls to SLIC.";
+    return;
+  }
+
+  Logger::getActiveLogger()->disableAsync();
+}
+
+//------------------------------------------------------------------------------
+bool isAsyncLoggingEnabled()
+{
+  if(!isInitialized())
+  {
+    std::cerr << "[ERROR]: slic::initialize() must be called "
+              << "before making any other calls to SLIC.";
+    return false;
+  }
+
+  return Logger::getActiveLogger()->isAsyncEnabled();
+}
+
 //------------------------------------------------------------------------------
 void setAbortOnError(bool status)
 {
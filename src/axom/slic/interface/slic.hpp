@@ -72,6 +72,38 @@ void setLoggingMsgLevel(message::Level level);
  */
 message::Level getLoggingMsgLevel();
 
+/*!
+ * \brief Checks whether the active logger logs messages of the given level.
+ * \param [in] level the level in query.
+ * \return status true if slic is initialized and the level is logged.
+ * \note The slic macros call this before formatting their message, so that
+ *  messages of disabled levels cost only this call.
+ */
+bool isLevelEnabled(message::Level level);
+
+/*!
+ * \brief Enables asynchronous logging on the current active logger.
+ * \param [in] capacity the number of messages the queue holds (optional).
+ * \see Logger::enableAsync
+ * \pre slic::isInitialized() == true.
+ */
+void enableAsyncLogging(std::size_t capacity = Logger::DEFAULT_ASYNC_CAPACITY);
+
+/*!
+ * \brief Appends the queued messages of the current active logger and
+ *  disables its asynchronous logging.
+ * \pre slic::isInitialized() == true.
+ */
+void disableAsyncLogging();
+
+/*!
+ * \brief Checks whether asynchronous logging is enabled for the current
+ *  active logger.
+ * \return status true if asynchronous logging is enabled, otherwise, false.
+ * \pre slic::isInitialized() == true.
+ */
+bool isAsyncLoggingEnabled();
+
 /*!
  * \brief Toggles the abort behavior for errors on the current active logger.
  * \param [in] status user-supplied flag.
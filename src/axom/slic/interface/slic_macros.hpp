@@ -79,12 +79,15 @@
  * \endcode
  *
  */
-#define SLIC_WARNING(msg)                                           \
-  do                                                                \
-  {                                                                 \
-    std::ostringstream __oss;                                       \
-    __oss << msg;                                                   \
-    axom::slic::logWarningMessage(__oss.str(), __FILE__, __LINE__); \
+#define SLIC_WARNING(msg)                                             \
+  do                                                                  \
+  {                                                                   \
+    if(axom::slic::isLevelEnabled(axom::slic::message::Warning))      \
+    {                                                                 \
+      std::ostringstream __oss;                                       \
+      __oss << msg;                                                   \
+      axom::slic::logWarningMessage(__oss.str(), __FILE__, __LINE__); \
+    }                                                                 \
   } while(axom::slic::detail::false_value)
 
 /*!
@@ -100,15 +103,15 @@
  * \endcode
  *
  */
-#define SLIC_WARNING_IF(EXP, msg)                                     \
-  do                                                                  \
-  {                                                                   \
-    if(EXP)                                                           \
-    {                                                                 \
-      std::ostringstream __oss;                                       \
-      __oss << msg;                                                   \
-      axom::slic::logWarningMessage(__oss.str(), __FILE__, __LINE__); \
-    }                                                                 \
+#define SLIC_WARNING_IF(EXP, msg)                                         \
+  do                                                                      \
+  {                                                                       \
+    if((EXP) && axom::slic::isLevelEnabled(axom::slic::message::Warning)) \
+    {                                                                     \
+      std::ostringstream __oss;                                           \
+      __oss << msg;                                                       \
+      axom::slic::logWarningMessage(__oss.str(), __FILE__, __LINE__);     \
+    }                                                                     \
   } while(axom::slic::detail::false_value)
 
 /// @}
@@ -272,15 +275,18 @@
  * \endcode
  *
  */
-#define SLIC_INFO(msg)                                \
-  do                                                  \
-  {                                                   \
-    std::ostringstream __oss;                         \
-    __oss << msg;                                     \
-    axom::slic::logMessage(axom::slic::message::Info, \
-                           __oss.str(),               \
-                           __FILE__,                  \
-                           __LINE__);                 \
+#define SLIC_INFO(msg)                                        \
+  do                                                          \
+  {                                                           \
+    if(axom::slic::isLevelEnabled(axom::slic::message::Info)) \
+    {                                                         \
+      std::ostringstream __oss;                               \
+      __oss << msg;                                           \
+      axom::slic::logMessage(axom::slic::message::Info,       \
+                             __oss.str(),                     \
+                             __FILE__,                        \
+                             __LINE__);                       \
+    }                                                         \
   } while(axom::slic::detail::false_value)
 
 /*!
@@ -296,18 +302,18 @@
  * \endcode
  *
  */
-#define SLIC_INFO_IF(EXP, msg)                          \
-  do                                                    \
-  {                                                     \
-    if(EXP)                                             \
-    {                                                   \
-      std::ostringstream __oss;                         \
-      __oss << msg;                                     \
-      axom::slic::logMessage(axom::slic::message::Info, \
-                             __oss.str(),               \
-                             __FILE__,                  \
-                             __LINE__);                 \
-    }                                                   \
+#define SLIC_INFO_IF(EXP, msg)                                         \
+  do                                                                   \
+  {                                                                    \
+    if((EXP) && axom::slic::isLevelEnabled(axom::slic::message::Info)) \
+    {                                                                  \
+      std::ostringstream __oss;                                        \
+      __oss << msg;                                                    \
+      axom::slic::logMessage(axom::slic::message::Info,                \
+                             __oss.str(),                              \
+                             __FILE__,                                 \
+                             __LINE__);                                \
+    }                                                                  \
   } while(axom::slic::detail::false_value)
 
 #ifdef AXOM_DEBUG
@@ -324,15 +330,18 @@
  * \endcode
  *
  */
-  #define SLIC_DEBUG(msg)                                \
-    do                                                   \
-    {                                                    \
-      std::ostringstream __oss;                          \
-      __oss << msg;                                      \
-      axom::slic::logMessage(axom::slic::message::Debug, \
-                             __oss.str(),                \
-                             __FILE__,                   \
-                             __LINE__);                  \
+  #define SLIC_DEBUG(msg)                                        \
+    do                                                           \
+    {                                                            \
+      if(axom::slic::isLevelEnabled(axom::slic::message::Debug)) \
+      {                                                          \
+        std::ostringstream __oss;                                \
+        __oss << msg;                                            \
+        axom::slic::logMessage(axom::slic::message::Debug,       \
+                               __oss.str(),                      \
+                               __FILE__,                         \
+                               __LINE__);                        \
+      }                                                          \
     } while(axom::slic::detail::false_value)
 
   /*!
@@ -348,18 +357,18 @@
  * \endcode
  *
  */
-  #define SLIC_DEBUG_IF(EXP, msg)                          \
-    do                                                     \
-    {                                                      \
-      if(EXP)                                              \
-      {                                                    \
-        std::ostringstream __oss;                          \
-        __oss << msg;                                      \
-        axom::slic::logMessage(axom::slic::message::Debug, \
-                               __oss.str(),                \
-                               __FILE__,                   \
-                               __LINE__);                  \
-      }                                                    \
+  #define SLIC_DEBUG_IF(EXP, msg)                                         \
+    do                                                                    \
+    {                                                                     \
+      if((EXP) && axom::slic::isLevelEnabled(axom::slic::message::Debug)) \
+      {                                                                   \
+        std::ostringstream __oss;                                         \
+        __oss << msg;                                                     \
+        axom::slic::logMessage(axom::slic::message::Debug,                \
+                               __oss.str(),                               \
+                               __FILE__,                                  \
+                               __LINE__);                                 \
+      }                                                                   \
     } while(axom::slic::detail::false_value)
 
 #else  // turn off debug macros
@@ -0,0 +1,174 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/slic/internal/AsyncLogWriter.hpp"
+
+// C/C++ includes
+#include <chrono>   // for std::chrono::milliseconds
+#include <cstdint>  // for std::intptr_t
+#include <utility>  // for std::move
+
+namespace axom
+{
+namespace slic
+{
+namespace internal
+{
+//------------------------------------------------------------------------------
+LogRecordQueue::LogRecordQueue(std::size_t capacity)
+  : m_enqueuePos(0)
+  , m_dequeuePos(0)
+{
+  std::size_t size = 2;
+  while(size < capacity)
+  {
+    size *= 2;
+  }
+
+  m_cells.reset(new Cell[size]);
+  m_mask = size - 1;
+  for(std::size_t i = 0; i < size; ++i)
+  {
+    m_cells[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+//------------------------------------------------------------------------------
+LogRecordQueue::~LogRecordQueue() { }
+
+//------------------------------------------------------------------------------
+bool LogRecordQueue::tryPush(LogRecord& record)
+{
+  std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+  Cell* cell = nullptr;
+
+  while(true)
+  {
+    cell = &m_cells[pos & m_mask];
+    const std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+    const std::intptr_t diff =
+      static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+
+    if(diff == 0)
+    {
+      // the cell is free, try to claim it
+      if(m_enqueuePos.compare_exchange_weak(pos,
+                                            pos + 1,
+                                            std::memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if(diff < 0)
+    {
+      // the cell still holds the record of the previous lap
+      return false;
+    }
+    else
+    {
+      pos = m_enqueuePos.load(std::memory_order_relaxed);
+    }
+  }
+
+  cell->record = std::move(record);
+  cell->sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool LogRecordQueue::tryPop(LogRecord& record)
+{
+  Cell& cell = m_cells[m_dequeuePos & m_mask];
+  if(cell.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1)
+  {
+    return false;
+  }
+
+  record = std::move(cell.record);
+  cell.sequence.store(m_dequeuePos + m_mask + 1, std::memory_order_release);
+  ++m_dequeuePos;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+AsyncLogWriter::AsyncLogWriter(std::size_t capacity, WriteFunction write)
+  : m_queue(capacity)
+  , m_write(std::move(write))
+  , m_writeCount(0)
+  , m_stop(false)
+  , m_idle(false)
+{
+  m_thread = std::thread(&AsyncLogWriter::run, this);
+}
+
+//------------------------------------------------------------------------------
+AsyncLogWriter::~AsyncLogWriter()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop.store(true);
+  }
+  m_wakeup.notify_one();
+  m_thread.join();
+}
+
+//------------------------------------------------------------------------------
+void AsyncLogWriter::push(LogRecord&& record)
+{
+  while(!m_queue.tryPush(record))
+  {
+    m_wakeup.notify_one();
+    std::this_thread::yield();
+  }
+
+  if(m_idle.load())
+  {
+    m_wakeup.notify_one();
+  }
+}
+
+//------------------------------------------------------------------------------
+void AsyncLogWriter::drain()
+{
+  const std::size_t target = m_queue.getPushCount();
+  while(m_writeCount.load(std::memory_order_acquire) < target)
+  {
+    m_wakeup.notify_one();
+    std::this_thread::yield();
+  }
+}
+
+//------------------------------------------------------------------------------
+void AsyncLogWriter::run()
+{
+  LogRecord record;
+  std::size_t count = 0;
+
+  while(true)
+  {
+    while(m_queue.tryPop(record))
+    {
+      m_write(record);
+      m_writeCount.store(++count, std::memory_order_release);
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if(m_stop.load() && count == m_queue.getPushCount())
+    {
+      break;
+    }
+
+    // The timeout bounds the delay of a record whose push missed the wakeup
+    m_idle.store(true);
+    m_wakeup.wait_for(lock, std::chrono::milliseconds(10));
+    m_idle.store(false);
+  }
+}
+
+} /* namespace internal */
+
+} /* namespace slic */
+
+} /* namespace axom */
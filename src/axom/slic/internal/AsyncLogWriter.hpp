@@ -0,0 +1,176 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ * \file AsyncLogWriter.hpp
+ */
+
+#ifndef AXOM_SLIC_ASYNCLOGWRITER_HPP_
+#define AXOM_SLIC_ASYNCLOGWRITER_HPP_
+
+#include "axom/slic/core/MessageLevel.hpp"
+#include "axom/core/Macros.hpp"
+
+// C/C++ includes
+#include <atomic>              // for std::atomic
+#include <condition_variable>  // for std::condition_variable
+#include <cstddef>             // for std::size_t
+#include <functional>          // for std::function
+#include <memory>              // for std::unique_ptr
+#include <mutex>               // for std::mutex
+#include <string>              // for std::string
+#include <thread>              // for std::thread
+
+namespace axom
+{
+namespace slic
+{
+namespace internal
+{
+/*!
+ * \brief A message that is queued for an asynchronous Logger.
+ */
+struct LogRecord
+{
+  message::Level level;
+  std::string message;
+  std::string tagName;
+  std::string fileName;
+  int line;
+  bool filter_duplicates;
+};
+
+/*!
+ * \class LogRecordQueue
+ *
+ * \brief A bounded, lock-free queue of LogRecords with multiple producers and
+ *  a single consumer.
+ *
+ *  The queue is a ring buffer of cells that carry a sequence number. A
+ *  producer claims a position with a compare-and-swap on the enqueue
+ *  position, moves its record into the cell and publishes it by advancing
+ *  the sequence number of the cell, which the consumer waits for.
+ */
+class LogRecordQueue
+{
+public:
+  /*!
+   * \brief Constructor.
+   * \param [in] capacity the number of records the queue holds, which is
+   *  rounded up to a power of two.
+   */
+  explicit LogRecordQueue(std::size_t capacity);
+
+  ~LogRecordQueue();
+
+  /*!
+   * \brief Moves the given record to the back of the queue.
+   * \return true if the record was queued, false if the queue is full.
+   * \note Thread-safe.
+   */
+  bool tryPush(LogRecord& record);
+
+  /*!
+   * \brief Moves the record at the front of the queue into the given record.
+   * \return true if a record was dequeued, false if the queue is empty.
+   * \note Must only be called from one thread at a time.
+   */
+  bool tryPop(LogRecord& record);
+
+  /*!
+   * \brief Returns the number of records pushed into the queue so far,
+   *  including records whose push is in progress.
+   */
+  std::size_t getPushCount() const
+  {
+    return m_enqueuePos.load(std::memory_order_acquire);
+  }
+
+private:
+  struct Cell
+  {
+    std::atomic<std::size_t> sequence;
+    LogRecord record;
+  };
+
+  std::unique_ptr<Cell[]> m_cells;
+  std::size_t m_mask;
+
+  // the padding keeps the producer and consumer positions on different
+  // cache lines
+  char m_pad0[64];
+  std::atomic<std::size_t> m_enqueuePos;
+  char m_pad1[64];
+  std::size_t m_dequeuePos;
+
+  DISABLE_COPY_AND_ASSIGNMENT(LogRecordQueue);
+  DISABLE_MOVE_AND_ASSIGNMENT(LogRecordQueue);
+};
+
+/*!
+ * \class AsyncLogWriter
+ *
+ * \brief Writes the records pushed from any thread on a background thread.
+ *
+ *  Pushing a record takes no lock, unless the queue is full, in which case
+ *  the pushing thread yields until the writer thread makes room. The writer
+ *  thread sleeps while the queue is empty.
+ */
+class AsyncLogWriter
+{
+public:
+  using WriteFunction = std::function<void(LogRecord&)>;
+
+  /*!
+   * \brief Constructor. Starts the writer thread.
+   * \param [in] capacity the capacity of the queue of records.
+   * \param [in] write the function that writes a record, which is called on
+   *  the writer thread.
+   */
+  AsyncLogWriter(std::size_t capacity, WriteFunction write);
+
+  /*!
+   * \brief Destructor. Writes the queued records and stops the writer thread.
+   * \pre No thread pushes records during or after the destruction.
+   */
+  ~AsyncLogWriter();
+
+  /*!
+   * \brief Queues the given record for writing.
+   * \note Thread-safe.
+   */
+  void push(LogRecord&& record);
+
+  /*!
+   * \brief Waits until the records that were pushed before the call are
+   *  written.
+   */
+  void drain();
+
+private:
+  void run();
+
+  LogRecordQueue m_queue;
+  WriteFunction m_write;
+
+  std::atomic<std::size_t> m_writeCount;
+  std::atomic<bool> m_stop;
+  std::atomic<bool> m_idle;
+
+  std::mutex m_mutex;
+  std::condition_variable m_wakeup;
+  std::thread m_thread;
+
+  DISABLE_COPY_AND_ASSIGNMENT(AsyncLogWriter);
+  DISABLE_MOVE_AND_ASSIGNMENT(AsyncLogWriter);
+};
+
+} /* namespace internal */
+
+} /* namespace slic */
+
+} /* namespace axom */
+
+#endif /* AXOM_SLIC_ASYNCLOGWRITER_HPP_ */
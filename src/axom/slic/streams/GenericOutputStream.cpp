@@ -38,12 +38,12 @@ void GenericOutputStream::append(message::Level msgLevel,
     return;
   }
 
-  (*m_stream) << this->getFormatedMessage(message::getLevelAsString(msgLevel),
-                                          message,
-                                          tagName,
-                                          "",
-                                          fileName,
-                                          line);
+  (*m_stream) << this->formatMessage(message::getLevelAsString(msgLevel),
+                                     message,
+                                     tagName,
+                                     "",
+                                     fileName,
+                                     line);
 }
 
 } /* namespace slic */
@@ -130,7 +130,7 @@ void LumberjackStream::write()
     {
       rankString = std::to_string(messages[i]->count()) + ": " +
         messages[i]->stringOfRanks();
-      (*m_stream) << this->getFormatedMessage(
+      (*m_stream) << this->formatMessage(
         message::getLevelAsString(
           static_cast<message::Level>(messages[i]->level())),
         messages[i]->text(),
@@ -0,0 +1,256 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+// slic includes
+#include "axom/slic/interface/slic.hpp"
+#include "axom/slic/internal/AsyncLogWriter.hpp"
+#include "axom/slic/streams/GenericOutputStream.hpp"
+
+// gtest includes
+#include "gtest/gtest.h"  // for gtest macros
+
+// C/C++ includes
+#include <sstream>  // for std::ostringstream, std::istringstream
+#include <string>   // for std::string
+#include <thread>   // for std::thread
+#include <vector>   // for std::vector
+
+// namespace alias
+namespace slic = axom::slic;
+
+//------------------------------------------------------------------------------
+// HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+/*!
+ * \brief Initializes slic with a stream that writes one line per message.
+ */
+void initialize(std::ostringstream& oss)
+{
+  slic::initialize();
+  slic::setLoggingMsgLevel(slic::message::Info);
+  slic::addStreamToAllMsgLevels(
+    new slic::GenericOutputStream(&oss, "<LEVEL>:<MESSAGE>\n"));
+}
+
+//------------------------------------------------------------------------------
+std::vector<std::string> get_lines(const std::ostringstream& oss)
+{
+  std::vector<std::string> lines;
+  std::istringstream iss(oss.str());
+  std::string line;
+  while(std::getline(iss, line))
+  {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+//------------------------------------------------------------------------------
+void log_from_threads(int nthreads, int nmessages)
+{
+  std::vector<std::thread> threads;
+  for(int t = 0; t < nthreads; ++t)
+  {
+    threads.emplace_back([=]() {
+      for(int i = 0; i < nmessages; ++i)
+      {
+        SLIC_INFO(t << " " << i);
+      }
+    });
+  }
+  for(std::thread& thread : threads)
+  {
+    thread.join();
+  }
+}
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Checks that each thread's messages were all written, in order.
+ */
+void check_thread_messages(const std::ostringstream& oss,
+                           int nthreads,
+                           int nmessages)
+{
+  const std::vector<std::string> lines = get_lines(oss);
+  EXPECT_EQ(static_cast<std::size_t>(nthreads * nmessages), lines.size());
+
+  std::vector<int> next(nthreads, 0);
+  for(const std::string& line : lines)
+  {
+    std::istringstream iss(line.substr(line.find(':') + 1));
+    int t = -1;
+    int i = -1;
+    iss >> t >> i;
+    ASSERT_TRUE(t >= 0 && t < nthreads);
+    EXPECT_EQ(next[t], i);
+    next[t] = i + 1;
+  }
+}
+
+}  // end anonymous namespace
+
+//------------------------------------------------------------------------------
+// UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(slic_async, record_queue)
+{
+  slic::internal::LogRecordQueue queue(3);
+
+  // the capacity is rounded up to 4
+  for(int i = 0; i < 4; ++i)
+  {
+    slic::internal::LogRecord record {slic::message::Info,
+                                      std::to_string(i),
+                                      "",
+                                      "",
+                                      i,
+                                      false};
+    EXPECT_TRUE(queue.tryPush(record));
+  }
+
+  slic::internal::LogRecord extra {slic::message::Info, "4", "", "", 4, false};
+  EXPECT_FALSE(queue.tryPush(extra));
+  EXPECT_EQ(4u, queue.getPushCount());
+
+  slic::internal::LogRecord record;
+  for(int i = 0; i < 4; ++i)
+  {
+    ASSERT_TRUE(queue.tryPop(record));
+    EXPECT_EQ(std::to_string(i), record.message);
+    EXPECT_EQ(i, record.line);
+  }
+  EXPECT_FALSE(queue.tryPop(record));
+
+  // popped cells are reused
+  EXPECT_TRUE(queue.tryPush(extra));
+  ASSERT_TRUE(queue.tryPop(record));
+  EXPECT_EQ("4", record.message);
+}
+
+//------------------------------------------------------------------------------
+TEST(slic_async, level_enabled)
+{
+  EXPECT_FALSE(slic::isLevelEnabled(slic::message::Error));
+
+  std::ostringstream oss;
+  initialize(oss);
+
+  EXPECT_TRUE(slic::isLevelEnabled(slic::message::Error));
+  EXPECT_TRUE(slic::isLevelEnabled(slic::message::Info));
+  EXPECT_FALSE(slic::isLevelEnabled(slic::message::Debug));
+
+  // the message of a disabled level is not evaluated
+  int evaluated = 0;
+  slic::setLoggingMsgLevel(slic::message::Warning);
+  SLIC_INFO("not logged " << ++evaluated);
+  EXPECT_EQ(0, evaluated);
+  EXPECT_TRUE(oss.str().empty());
+
+  slic::setLoggingMsgLevel(slic::message::Info);
+  SLIC_INFO("logged " << ++evaluated);
+  EXPECT_EQ(1, evaluated);
+  EXPECT_EQ("INFO:logged 1\n", oss.str());
+
+  slic::finalize();
+}
+
+//------------------------------------------------------------------------------
+TEST(slic_async, sync_threads)
+{
+  // synchronous logging appends to the streams one thread at a time
+  std::ostringstream oss;
+  initialize(oss);
+  EXPECT_FALSE(slic::isAsyncLoggingEnabled());
+
+  log_from_threads(4, 500);
+  check_thread_messages(oss, 4, 500);
+
+  slic::finalize();
+}
+
+//------------------------------------------------------------------------------
+TEST(slic_async, async_flush)
+{
+  std::ostringstream oss;
+  initialize(oss);
+
+  slic::enableAsyncLogging();
+  EXPECT_TRUE(slic::isAsyncLoggingEnabled());
+
+  for(int i = 0; i < 100; ++i)
+  {
+    SLIC_INFO(0 << " " << i);
+  }
+  slic::flushStreams();
+  check_thread_messages(oss, 1, 100);
+
+  slic::disableAsyncLogging();
+  EXPECT_FALSE(slic::isAsyncLoggingEnabled());
+
+  slic::finalize();
+}
+
+//------------------------------------------------------------------------------
+TEST(slic_async, async_threads)
+{
+  std::ostringstream oss;
+  initialize(oss);
+
+  // a small queue makes the logging threads wait for the writer
+  slic::enableAsyncLogging(16);
+  log_from_threads(4, 500);
+  slic::flushStreams();
+  check_thread_messages(oss, 4, 500);
+
+  // the queued messages are written when asynchronous logging is disabled
+  log_from_threads(2, 100);
+  slic::disableAsyncLogging();
+  EXPECT_EQ(4u * 500 + 2 * 100, get_lines(oss).size());
+
+  slic::finalize();
+}
+
+//------------------------------------------------------------------------------
+TEST(slic_async, async_finalize)
+{
+  // the queued messages are written when slic is finalized
+  std::ostringstream oss;
+  initialize(oss);
+  slic::enableAsyncLogging();
+
+  log_from_threads(2, 100);
+  slic::finalize();
+
+  check_thread_messages(oss, 2, 100);
+}
+
+//------------------------------------------------------------------------------
+TEST(slic_async, async_abort)
+{
+  // messages that abort are written before the abort function is called
+  static std::ostringstream oss;
+  static std::string logged_at_abort;
+
+  initialize(oss);
+  slic::enableAsyncLogging();
+  slic::enableAbortOnWarning();
+  slic::setAbortFunction([]() { logged_at_abort = oss.str(); });
+
+  SLIC_INFO("info");
+  SLIC_WARNING("warning");
+  EXPECT_EQ("INFO:info\nWARNING:warning\n", logged_at_abort);
+
+  slic::finalize();
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,97 @@
+// Copyright (c) 2017-2021, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "benchmark/benchmark_api.h"
+#include "axom/slic/interface/slic.hpp"
+#include "axom/slic/streams/GenericOutputStream.hpp"
+
+// C/C++ includes
+#include <ostream>  // for std::ostream
+
+/*!
+ * \file
+ *
+ * Benchmarks of the cost of the SLIC logging macros on the calling thread,
+ * for a disabled message level and for synchronous and asynchronous logging
+ * to a stream that discards its output.
+ */
+
+namespace slic = axom::slic;
+
+namespace
+{
+// a stream without a buffer discards its output
+std::ostream nullStream(nullptr);
+
+/*!
+ * \brief Initializes slic with a stream that discards all messages.
+ */
+void initialize()
+{
+  slic::initialize();
+  slic::setLoggingMsgLevel(slic::message::Info);
+  slic::addStreamToAllMsgLevels(new slic::GenericOutputStream(
+    &nullStream,
+    "[<LEVEL>] <MESSAGE> (<FILE>:<LINE>)\n"));
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+static void BM_LogDisabledLevel(benchmark::State& state)
+{
+  initialize();
+
+  int i = 0;
+  while(state.KeepRunning())
+  {
+    SLIC_DEBUG("message " << ++i);
+  }
+  benchmark::DoNotOptimize(i);
+
+  slic::finalize();
+}
+BENCHMARK(BM_LogDisabledLevel);
+
+//------------------------------------------------------------------------------
+static void BM_LogSync(benchmark::State& state)
+{
+  initialize();
+
+  int i = 0;
+  while(state.KeepRunning())
+  {
+    SLIC_INFO("message " << ++i);
+  }
+
+  slic::finalize();
+}
+BENCHMARK(BM_LogSync);
+
+//------------------------------------------------------------------------------
+static void BM_LogAsync(benchmark::State& state)
+{
+  initialize();
+  slic::enableAsyncLogging(state.range_x());
+
+  int i = 0;
+  while(state.KeepRunning())
+  {
+    SLIC_INFO("message " << ++i);
+  }
+  slic::flushStreams();
+
+  slic::finalize();
+}
+BENCHMARK(BM_LogAsync)->Arg(1 << 8)->Arg(1 << 12)->Arg(1 << 16);
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
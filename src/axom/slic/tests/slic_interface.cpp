@@ -6,6 +6,9 @@
 #include "gtest/gtest.h"
 
 #include "axom/slic/interface/slic.hpp"
+#include "axom/slic/streams/GenericOutputStream.hpp"
+
+#include <sstream>
 
 TEST(slic_interface, initialize_finalize)
 {
@@ -41,3 +44,54 @@ TEST(slic_interface, logging_level)
 
   axom::slic::finalize();
 }
+
+TEST(slic_interface, format_string)
+{
+  namespace slic = axom::slic;
+
+  slic::initialize();
+  slic::setLoggingMsgLevel(slic::message::Debug);
+
+  std::ostringstream oss;
+  slic::GenericOutputStream* stream = new slic::GenericOutputStream(&oss);
+  slic::addStreamToAllMsgLevels(stream);
+
+  // all keywords, in any order and next to each other
+  stream->setFormatString("<FILE>:<LINE>[<TAG>]<LEVEL>: <MESSAGE>!<RANK>\n");
+  slic::logMessage(slic::message::Info, "msg", "tag", "file.cpp", 42);
+  slic::logMessage(slic::message::Warning, "msg", "tag", "file.cpp", -7);
+  slic::logMessage(slic::message::Debug,
+                   "msg",
+                   MSG_IGNORE_TAG,
+                   MSG_IGNORE_FILE,
+                   MSG_IGNORE_LINE,
+                   false);
+  EXPECT_EQ(
+    "file.cpp:42[tag]INFO: msg!\n"
+    "file.cpp:-7[tag]WARNING: msg!\n"
+    ":[]DEBUG: msg!\n",
+    oss.str());
+
+  // only the first occurrence of a keyword is replaced and keywords in the
+  // message are not replaced
+  oss.str("");
+  stream->setFormatString("<MESSAGE> <LEVEL> <LEVEL>");
+  slic::logMessage(slic::message::Info, "<TAG> <LINE>", "tag", "file.cpp", 1);
+  EXPECT_EQ("<TAG> <LINE> INFO <LEVEL>", oss.str());
+
+  // a format string without keywords
+  oss.str("");
+  stream->setFormatString("constant\n");
+  slic::logMessage(slic::message::Info, "msg");
+  EXPECT_EQ("constant\n", oss.str());
+
+  // the time stamp is the only part of the message that varies
+  oss.str("");
+  stream->setFormatString("[<TIMESTAMP>]");
+  slic::logMessage(slic::message::Info, "msg");
+  EXPECT_EQ('[', oss.str().front());
+  EXPECT_EQ(']', oss.str().back());
+  EXPECT_GT(oss.str().size(), 2u);
+
+  slic::finalize();
+}
@@ -8,6 +8,7 @@
 
 #include "axom/core/Types.hpp"              // fixed bitwidth types
 #include "axom/core/execution/for_all.hpp"  // for generic for_all()
+#include "axom/core/execution/scan.hpp"     // for exclusive_scan()
 #include "axom/core/memory_management.hpp"  // for memory functions
 #include "axom/core/numerics/floating_point_limits.hpp"  // floating_point_limits
 #include "axom/core/utilities/AnnotationMacros.hpp"      // for annotations
@@ -473,13 +474,9 @@ void BVH<NDIMS, ExecSpace, FloatType>::findPoints(IndexType* offsets,
                                                    y,
                                                    z););
 
-  using exec_policy = typename axom::execution_space<ExecSpace>::loop_policy;
   AXOM_PERF_MARK_SECTION(
     "exclusive_scan",
-    RAJA::exclusive_scan<exec_policy>(counts,
-                                      counts + numPts,
-                                      offsets,
-                                      RAJA::operators::plus<IndexType> {}););
+    axom::exclusive_scan<ExecSpace>(counts, offsets, numPts););
 
   AXOM_PERF_MARK_SECTION(
     "allocate_candidates",
@@ -573,13 +570,9 @@ void BVH<NDIMS, ExecSpace, FloatType>::findRays(IndexType* offsets,
                                                       z0,
                                                       nz););
 
-  using exec_policy = typename axom::execution_space<ExecSpace>::loop_policy;
   AXOM_PERF_MARK_SECTION(
     "exclusive_scan",
-    RAJA::exclusive_scan<exec_policy>(counts,
-                                      counts + numRays,
-                                      offsets,
-                                      RAJA::operators::plus<IndexType> {}););
+    axom::exclusive_scan<ExecSpace>(counts, offsets, numRays););
 
   AXOM_PERF_MARK_SECTION(
     "allocate_candidates",
@@ -672,13 +665,9 @@ void BVH<NDIMS, ExecSpace, FloatType>::findBoundingBoxes(IndexType* offsets,
                                                       zmin,
                                                       zmax););
 
-  using exec_policy = typename axom::execution_space<ExecSpace>::loop_policy;
   AXOM_PERF_MARK_SECTION(
     "exclusive_scan",
-    RAJA::exclusive_scan<exec_policy>(counts,
-                                      counts + numBoxes,
-                                      offsets,
-                                      RAJA::operators::plus<IndexType> {}););
+    axom::exclusive_scan<ExecSpace>(counts, offsets, numBoxes););
 
   AXOM_PERF_MARK_SECTION(
     "allocate_candidates",
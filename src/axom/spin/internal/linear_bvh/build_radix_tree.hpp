@@ -10,6 +10,7 @@
 
 #include "axom/core/execution/execution_space.hpp"
 #include "axom/core/execution/for_all.hpp"
+#include "axom/core/execution/sort.hpp"
 
 #include "axom/core/utilities/AnnotationMacros.hpp"  // for annotations
 
@@ -231,10 +232,8 @@ void sort_mcodes(uint32*& mcodes, int32 size, int32* iter)
 
   array_counting<ExecSpace>(iter, size, 0, 1);
 
-  AXOM_PERF_MARK_SECTION(
-    "raja_stable_sort",
-    using EXEC_POL = typename axom::execution_space<ExecSpace>::loop_policy;
-    RAJA::stable_sort_pairs<EXEC_POL>(mcodes, mcodes + size, iter););
+  AXOM_PERF_MARK_SECTION("sort_pairs",
+                         axom::sort_pairs<ExecSpace>(mcodes, iter, size););
 }
 
 #else